@@ -0,0 +1,158 @@
+"""
+模拟器输出对比工具
+
+对比两次模拟器运行的输出目录 (基准 和 当前):
+    1. 同名 PNG 截图逐像素比较，列出不同的像素数
+    2. frames.csv 按场景汇总每帧的平均总线字节数、写入像素数和主机绘制耗时，列出变化
+有截图不同，或某场景每帧字节数增加超过 --bytes-tolerance 时返回 1，可用于提交前检查。
+主机绘制耗时受机器负载影响，只显示不参与判定。
+
+只依赖 Python 标准库 (PNG 用 zlib 解码)。
+用法:
+    python compare_frames.py golden/ sim_out/
+    python compare_frames.py golden/ sim_out/ --bytes-tolerance 5
+"""
+import argparse
+import collections
+import csv
+import os
+import struct
+import sys
+import zlib
+
+
+def read_png(path):
+    """解码 8 位 RGB/RGBA 的非隔行 PNG，返回 (宽, 高, 每像素字节数, 像素字节)"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError("不是PNG文件: " + path)
+    pos = 8
+    idat = b''
+    width = height = bpp = 0
+    while pos < len(data):
+        length, ctype = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if ctype == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', body)
+            if depth != 8 or color not in (2, 6) or interlace:
+                raise ValueError("只支持8位RGB/RGBA非隔行PNG: " + path)
+            bpp = 3 if color == 2 else 4
+        elif ctype == b'IDAT':
+            idat += body
+        pos += 12 + length
+
+    raw = zlib.decompress(idat)
+    stride = width * bpp
+    out = bytearray(stride * height)
+    prev = bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        out[y * stride:(y + 1) * stride] = line
+        prev = line
+    return width, height, bpp, bytes(out)
+
+
+def diff_pixels(path_a, path_b):
+    """返回两张截图中不同的像素数，尺寸不同时返回 None"""
+    wa, ha, ba, pa = read_png(path_a)
+    wb, hb, bb, pb = read_png(path_b)
+    if (wa, ha, ba) != (wb, hb, bb):
+        return None
+    if pa == pb:
+        return 0
+    return sum(1 for i in range(0, len(pa), ba) if pa[i:i + ba] != pb[i:i + ba])
+
+
+def load_frames(path):
+    """按场景汇总 frames.csv: {场景: {帧数, 平均字节, 平均像素, 平均耗时}}"""
+    sums = collections.OrderedDict()
+    if not os.path.exists(path):
+        return sums
+    with open(path, newline='') as f:
+        for row in csv.DictReader(f):
+            s = sums.setdefault(row['scenario'], collections.Counter())
+            s['frames'] += 1
+            for key in ('bytes', 'pixels', 'windows', 'host_us'):
+                s[key] += int(row[key])
+    result = collections.OrderedDict()
+    for name, s in sums.items():
+        n = s['frames']
+        result[name] = {'frames': n, 'bytes': s['bytes'] / n, 'pixels': s['pixels'] / n,
+                        'windows': s['windows'] / n, 'host_us': s['host_us'] / n}
+    return result
+
+
+def percent(old, new):
+    return (new - old) * 100.0 / old if old else (0.0 if new == old else float('inf'))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="对比两次模拟器运行的截图和每帧开销")
+    parser.add_argument('baseline', help="基准输出目录")
+    parser.add_argument('current', help="当前输出目录")
+    parser.add_argument('--bytes-tolerance', type=float, default=2.0,
+                        help="每帧平均字节数允许增加的百分比 (默认 2)")
+    args = parser.parse_args()
+
+    failed = False
+
+    print("== 截图")
+    base_png = {n for n in os.listdir(args.baseline) if n.endswith('.png')}
+    cur_png = {n for n in os.listdir(args.current) if n.endswith('.png')}
+    for name in sorted(base_png | cur_png):
+        if name not in cur_png:
+            print("  缺少   %s" % name)
+            failed = True
+            continue
+        if name not in base_png:
+            print("  新增   %s" % name)
+            continue
+        diff = diff_pixels(os.path.join(args.baseline, name), os.path.join(args.current, name))
+        if diff is None:
+            print("  尺寸不同 %s" % name)
+            failed = True
+        elif diff:
+            print("  不同   %s: %d 像素" % (name, diff))
+            failed = True
+    print("  共 %d 张" % len(base_png | cur_png))
+
+    print("== 每帧开销 (平均)")
+    print("  %-28s %7s %10s %10s %8s %9s" % ("场景", "帧数", "字节", "像素", "窗口", "主机us"))
+    base = load_frames(os.path.join(args.baseline, 'frames.csv'))
+    cur = load_frames(os.path.join(args.current, 'frames.csv'))
+    for name in list(base) + [n for n in cur if n not in base]:
+        if name not in cur or name not in base:
+            print("  %-28s 仅在%s中" % (name, "基准" if name in base else "当前"))
+            continue
+        b, c = base[name], cur[name]
+        change = percent(b['bytes'], c['bytes'])
+        mark = ''
+        if change > args.bytes_tolerance:
+            mark = '  <-- 字节数增加'
+            failed = True
+        print("  %-28s %7d %10.0f %10.0f %8.1f %9.0f  字节%+.1f%% 耗时%+.1f%%%s" % (
+            name, c['frames'], c['bytes'], c['pixels'], c['windows'], c['host_us'],
+            change, percent(b['host_us'], c['host_us']), mark))
+
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == '__main__':
+    main()
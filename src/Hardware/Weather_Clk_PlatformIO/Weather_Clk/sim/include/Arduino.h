@@ -0,0 +1,138 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// 主机模拟器使用的 Arduino-ESP32 核心替身。
+// 时间来自虚拟时钟 (只在 delay/vTaskDelay 时推进)，引脚和外设操作只记录不执行，
+// 使界面代码在 Linux 上得到可重复的结果。
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <cmath>
+
+#include "pgmspace.h"
+#include "WString.h"
+#include "Print.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+
+using std::max;
+using std::min;
+using std::abs;
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define INPUT_PULLDOWN 0x09
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define radians(deg) ((deg) * DEG_TO_RAD)
+#define degrees(rad) ((rad) * RAD_TO_DEG)
+#define sq(x) ((x) * (x))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bit(b) (1UL << (b))
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define digitalPinToInterrupt(p) (p)
+#define digitalPinToBitMask(p) (1UL << ((p) & 31))
+#define IRAM_ATTR
+#define ARDUINO_ISR_ATTR
+
+#define log_e(...) ((void)0)
+#define log_w(...) ((void)0)
+#define log_i(...) ((void)0)
+#define log_d(...) ((void)0)
+
+// --- 时间 (虚拟时钟) ---
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+bool getLocalTime(struct tm *info, uint32_t ms = 5000);
+void configTime(long gmtOffsetSec, int daylightOffsetSec, const char *server1, const char *server2 = NULL, const char *server3 = NULL);
+
+// --- 引脚 ---
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t pin);
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration = 0);
+void noTone(uint8_t pin);
+
+// --- 数字转字符串 (avr-libc 扩展) ---
+char *ltoa(long value, char *buf, int base);
+char *ultoa(unsigned long value, char *buf, int base);
+char *itoa(int value, char *buf, int base);
+char *utoa(unsigned value, char *buf, int base);
+char *dtostrf(double value, signed char width, unsigned char prec, char *buf);
+
+// --- 随机数 ---
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+// --- 芯片 ---
+uint32_t getCpuFrequencyMhz();
+bool setCpuFrequencyMhz(uint32_t mhz);
+float temperatureRead();
+
+class EspClass
+{
+public:
+    uint32_t getCycleCount();
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getHeapSize();
+    uint32_t getCpuFreqMHz() { return getCpuFrequencyMhz(); }
+    void restart();
+};
+extern EspClass ESP;
+
+/**
+ * @brief 串口：输出写到主机的标准输出，输入始终为空。
+ */
+class HardwareSerial : public Stream
+{
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    void end() {}
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    size_t write(const uint8_t *buf, size_t size) override { return fwrite(buf, 1, size, stdout); }
+    using Print::write;
+    void setRxBufferSize(size_t) {}
+    operator bool() const { return true; }
+};
+extern HardwareSerial Serial;
+
+#endif // SIM_ARDUINO_H
@@ -0,0 +1,24 @@
+#ifndef SIM_EEPROM_H
+#define SIM_EEPROM_H
+
+// EEPROM 替身：内存中的 512 字节，每个场景开始时为全 0xFF (擦除状态)。
+
+#include <Arduino.h>
+
+class EEPROMClass
+{
+public:
+    bool begin(size_t size) { (void)size; return true; }
+    uint8_t read(int address) { return data[address]; }
+    void write(int address, uint8_t value) { data[address] = value; }
+    bool commit() { return true; }
+    void erase() { memset(data, 0xFF, sizeof(data)); }
+    template <typename T> T &get(int address, T &t) { memcpy(&t, data + address, sizeof(T)); return t; }
+    template <typename T> const T &put(int address, const T &t) { memcpy(data + address, &t, sizeof(T)); return t; }
+
+private:
+    uint8_t data[512];
+};
+extern EEPROMClass EEPROM;
+
+#endif // SIM_EEPROM_H
@@ -0,0 +1,32 @@
+#ifndef SIM_HTTP_CLIENT_H
+#define SIM_HTTP_CLIENT_H
+
+// HTTPClient 替身：GET 返回 Sim_SetFixtureDir 目录中与 URL 匹配的文件，没有匹配时返回 404。
+
+#include <Arduino.h>
+#include "WiFi.h"
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_NOT_FOUND 404
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+
+class HTTPClient
+{
+public:
+    bool begin(WiFiClient &client, const String &url) { (void)client; this->url = url; return true; }
+    bool begin(const String &url) { this->url = url; return true; }
+    void end() {}
+    void setTimeout(uint16_t) {}
+    void setConnectTimeout(int32_t) {}
+    void addHeader(const String &, const String &) {}
+    int GET();
+    String getString() { return body; }
+    int getSize() { return body.length(); }
+    static String errorToString(int code) { return String("error ") + code; }
+
+private:
+    String url;
+    String body;
+};
+
+#endif // SIM_HTTP_CLIENT_H
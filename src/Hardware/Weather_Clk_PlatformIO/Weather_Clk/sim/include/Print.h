@@ -0,0 +1,88 @@
+#ifndef SIM_PRINT_H
+#define SIM_PRINT_H
+
+#include <stdarg.h>
+#include <stdio.h>
+#include "WString.h"
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print;
+
+/**
+ * @brief Arduino Printable：可以把自身输出到 Print 的对象。
+ */
+class Printable
+{
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print &p) const = 0;
+};
+
+/**
+ * @brief Arduino Print 的模拟实现，所有输出最终落到 write(uint8_t)。
+ */
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buf, size_t size)
+    {
+        size_t n = 0;
+        while (size--) n += write(*buf++);
+        return n;
+    }
+    size_t write(const char *s) { return s ? write((const uint8_t *)s, strlen(s)) : 0; }
+    virtual void flush() {}
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char buf[512];
+        va_list args;
+        va_start(args, format);
+        int len = vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        if (len < 0) return 0;
+        return write((const uint8_t *)buf, len < (int)sizeof(buf) ? len : sizeof(buf) - 1);
+    }
+
+    size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v, int base = DEC) { return print(String(v, base)); }
+    size_t print(unsigned int v, int base = DEC) { return print(String(v, base)); }
+    size_t print(long v, int base = DEC) { return print(String(v, base)); }
+    size_t print(unsigned long v, int base = DEC) { return print(String(v, base)); }
+    size_t print(double v, int digits = 2) { return print(String(v, digits)); }
+    size_t print(const Printable &p) { return p.printTo(*this); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T> size_t println(const T &v) { return print(v) + println(); }
+    template <typename T> size_t println(const T &v, int f) { return print(v, f) + println(); }
+};
+
+/**
+ * @brief Arduino Stream 的模拟实现。
+ */
+class Stream : public Print
+{
+public:
+    virtual int available() { return 0; }
+    virtual int read() { return -1; }
+    virtual int peek() { return -1; }
+    size_t readBytes(char *buf, size_t length)
+    {
+        size_t n = 0;
+        int c;
+        while (n < length && (c = read()) >= 0) buf[n++] = (char)c;
+        return n;
+    }
+    size_t readBytes(uint8_t *buf, size_t length) { return readBytes((char *)buf, length); }
+    void setTimeout(unsigned long) {}
+};
+
+#endif // SIM_PRINT_H
@@ -0,0 +1,49 @@
+#ifndef SIM_SPI_H
+#define SIM_SPI_H
+
+// SPI 总线替身：发出的每个字节交给 SimPanel，由它按 ST7789 命令集解码到帧存储器。
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+#define MSBFIRST 1
+#define LSBFIRST 0
+
+class SPISettings
+{
+public:
+    SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0)
+    {
+        (void)clock; (void)bitOrder; (void)dataMode;
+    }
+};
+
+class SPIClass
+{
+public:
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) { (void)sck; (void)miso; (void)mosi; (void)ss; }
+    void end() {}
+    void beginTransaction(SPISettings) {}
+    void endTransaction() {}
+    void setFrequency(uint32_t) {}
+    void setDataMode(uint8_t) {}
+    void setBitOrder(uint8_t) {}
+    void setHwCs(bool) {}
+
+    uint8_t transfer(uint8_t data);
+    uint16_t transfer16(uint16_t data);
+    uint32_t transfer32(uint32_t data);
+    void transfer(void *data, uint32_t size);
+    void write(uint8_t data) { transfer(data); }
+    void write16(uint16_t data) { transfer16(data); }
+    void write32(uint32_t data) { transfer32(data); }
+    void writeBytes(const uint8_t *data, uint32_t size);
+    void writePixels(const void *data, uint32_t size);
+};
+
+extern SPIClass SPI;
+
+#endif // SIM_SPI_H
@@ -0,0 +1,152 @@
+#ifndef SIM_WSTRING_H
+#define SIM_WSTRING_H
+
+// Arduino String 的模拟实现，基于 std::string，只提供工程中用到的接口。
+
+#include <string>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+class __FlashStringHelper;
+#define F(s) (s)
+
+class String
+{
+public:
+    String(const char *s = "") : str(s ? s : "") {}
+    String(const char *s, size_t len) : str(s, len) {}
+    String(const std::string &s) : str(s) {}
+    String(char c) : str(1, c) {}
+    String(unsigned char v, unsigned char base = 10) { fromUnsigned(v, base); }
+    String(int v, unsigned char base = 10) { fromSigned(v, base); }
+    String(unsigned int v, unsigned char base = 10) { fromUnsigned(v, base); }
+    String(long v, unsigned char base = 10) { fromSigned(v, base); }
+    String(unsigned long v, unsigned char base = 10) { fromUnsigned(v, base); }
+    String(long long v, unsigned char base = 10) { fromSigned(v, base); }
+    String(unsigned long long v, unsigned char base = 10) { fromUnsigned(v, base); }
+    String(float v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+    String(double v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+
+    const char *c_str() const { return str.c_str(); }
+    unsigned int length() const { return str.length(); }
+    bool isEmpty() const { return str.empty(); }
+    bool reserve(unsigned int size) { str.reserve(size); return true; }
+    char charAt(unsigned int i) const { return i < str.length() ? str[i] : 0; }
+    void setCharAt(unsigned int i, char c) { if (i < str.length()) str[i] = c; }
+    char operator[](unsigned int i) const { return charAt(i); }
+    char &operator[](unsigned int i) { return str[i]; }
+    explicit operator bool() const { return true; }
+
+    bool concat(const String &s) { str += s.str; return true; }
+    bool concat(const char *s) { if (s) str += s; return s != NULL; }
+    bool concat(char c) { str += c; return true; }
+    bool concat(int v) { return concat(String(v)); }
+    bool concat(unsigned int v) { return concat(String(v)); }
+    bool concat(long v) { return concat(String(v)); }
+    bool concat(unsigned long v) { return concat(String(v)); }
+    bool concat(float v) { return concat(String(v)); }
+    bool concat(double v) { return concat(String(v)); }
+    bool concat(const char *s, unsigned int len) { str.append(s, len); return true; }
+    template <typename T> String &operator+=(const T &v) { concat(v); return *this; }
+
+    bool equals(const String &s) const { return str == s.str; }
+    bool equalsIgnoreCase(const String &s) const { return strcasecmp(c_str(), s.c_str()) == 0; }
+    bool operator==(const String &s) const { return str == s.str; }
+    bool operator==(const char *s) const { return str == (s ? s : ""); }
+    bool operator!=(const String &s) const { return str != s.str; }
+    bool operator!=(const char *s) const { return !(*this == s); }
+    bool operator<(const String &s) const { return str < s.str; }
+    int compareTo(const String &s) const { return str.compare(s.str); }
+    bool startsWith(const String &s) const { return str.compare(0, s.str.length(), s.str) == 0; }
+    bool endsWith(const String &s) const
+    {
+        return s.str.length() <= str.length() && str.compare(str.length() - s.str.length(), s.str.length(), s.str) == 0;
+    }
+
+    int indexOf(char c, unsigned int from = 0) const { return find(str.find(c, from)); }
+    int indexOf(const String &s, unsigned int from = 0) const { return find(str.find(s.str, from)); }
+    int lastIndexOf(char c) const { return find(str.rfind(c)); }
+    int lastIndexOf(const String &s) const { return find(str.rfind(s.str)); }
+    String substring(unsigned int from) const { return from < str.length() ? String(str.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const
+    {
+        if (from > to) { unsigned int t = from; from = to; to = t; }
+        if (from >= str.length()) return String();
+        return String(str.substr(from, to - from));
+    }
+
+    void replace(const String &from, const String &to)
+    {
+        if (from.str.empty()) return;
+        for (size_t pos = 0; (pos = str.find(from.str, pos)) != std::string::npos; pos += to.str.length())
+        {
+            str.replace(pos, from.str.length(), to.str);
+        }
+    }
+    void replace(char from, char to) { for (auto &c : str) if (c == from) c = to; }
+    void remove(unsigned int index) { if (index < str.length()) str.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < str.length()) str.erase(index, count); }
+    void toUpperCase() { for (auto &c : str) c = toupper((unsigned char)c); }
+    void toLowerCase() { for (auto &c : str) c = tolower((unsigned char)c); }
+    void trim()
+    {
+        size_t b = str.find_first_not_of(" \t\r\n");
+        size_t e = str.find_last_not_of(" \t\r\n");
+        str = b == std::string::npos ? std::string() : str.substr(b, e - b + 1);
+    }
+
+    long toInt() const { return atol(c_str()); }
+    float toFloat() const { return atof(c_str()); }
+    double toDouble() const { return atof(c_str()); }
+    void toCharArray(char *buf, unsigned int size, unsigned int index = 0) const { getBytes((unsigned char *)buf, size, index); }
+    void getBytes(unsigned char *buf, unsigned int size, unsigned int index = 0) const
+    {
+        if (size == 0) return;
+        unsigned int n = index < str.length() ? str.length() - index : 0;
+        if (n > size - 1) n = size - 1;
+        memcpy(buf, str.data() + index, n);
+        buf[n] = 0;
+    }
+
+    // ArduinoJson 写入 String 时使用
+    size_t write(uint8_t c) { str += (char)c; return 1; }
+
+private:
+    std::string str;
+
+    static int find(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+    void fromSigned(long long v, unsigned char base)
+    {
+        if (v < 0 && base == 10) { fromUnsigned(-(unsigned long long)v, base); str.insert(str.begin(), '-'); }
+        else fromUnsigned((unsigned long long)v, base);
+    }
+    void fromUnsigned(unsigned long long v, unsigned char base)
+    {
+        char buf[66];
+        int i = sizeof(buf) - 1;
+        buf[i] = 0;
+        do { int d = v % base; buf[--i] = d < 10 ? '0' + d : 'a' + d - 10; v /= base; } while (v);
+        str = buf + i;
+    }
+    void fromDouble(double v, unsigned int decimals)
+    {
+        char buf[48];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+        str = buf;
+    }
+};
+
+inline String operator+(const String &a, const String &b) { String s(a); s.concat(b); return s; }
+inline String operator+(const String &a, const char *b) { String s(a); s.concat(b); return s; }
+inline String operator+(const char *a, const String &b) { String s(a); s.concat(b); return s; }
+inline String operator+(const String &a, char b) { String s(a); s.concat(b); return s; }
+inline String operator+(const String &a, int b) { String s(a); s.concat(b); return s; }
+inline String operator+(const String &a, unsigned int b) { String s(a); s.concat(b); return s; }
+inline String operator+(const String &a, long b) { String s(a); s.concat(b); return s; }
+inline String operator+(const String &a, unsigned long b) { String s(a); s.concat(b); return s; }
+inline String operator+(const String &a, float b) { String s(a); s.concat(b); return s; }
+inline String operator+(const String &a, double b) { String s(a); s.concat(b); return s; }
+
+#endif // SIM_WSTRING_H
@@ -0,0 +1,40 @@
+#ifndef SIM_WIFI_H
+#define SIM_WIFI_H
+
+// WiFi 替身：始终处于已连接状态，网络请求由 HTTPClient 替身从固定响应文件返回。
+
+#include <Arduino.h>
+
+typedef enum
+{
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+class WiFiClient
+{
+public:
+    virtual ~WiFiClient() {}
+    void stop() {}
+    bool connected() { return false; }
+};
+
+class WiFiClass
+{
+public:
+    wl_status_t status() { return WL_CONNECTED; }
+    bool isConnected() { return true; }
+    int32_t RSSI() { return -55; }
+    String SSID() { return "SimNet"; }
+    String localIP() { return "192.168.1.100"; }
+    void begin(const char *, const char *) {}
+    void disconnect(bool = false) {}
+    void mode(int) {}
+    void setSleep(bool) {}
+};
+extern WiFiClass WiFi;
+
+#endif // SIM_WIFI_H
@@ -0,0 +1,13 @@
+#ifndef SIM_WIFI_CLIENT_SECURE_H
+#define SIM_WIFI_CLIENT_SECURE_H
+
+#include "WiFi.h"
+
+class WiFiClientSecure : public WiFiClient
+{
+public:
+    void setInsecure() {}
+    void setCACert(const char *) {}
+};
+
+#endif // SIM_WIFI_CLIENT_SECURE_H
@@ -0,0 +1,16 @@
+#ifndef SIM_ESP_HEAP_CAPS_H
+#define SIM_ESP_HEAP_CAPS_H
+
+// 堆统计替身：返回固定值，使依赖堆统计的显示在每次运行中保持一致。
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+size_t heap_caps_get_minimum_free_size(uint32_t caps);
+
+#endif // SIM_ESP_HEAP_CAPS_H
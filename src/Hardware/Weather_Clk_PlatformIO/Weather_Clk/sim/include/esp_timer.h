@@ -0,0 +1,10 @@
+#ifndef SIM_ESP_TIMER_H
+#define SIM_ESP_TIMER_H
+
+// 高精度计时替身：返回主机时间，帧耗时统计反映的是主机上的真实绘制耗时，不受虚拟时钟影响。
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time();
+
+#endif // SIM_ESP_TIMER_H
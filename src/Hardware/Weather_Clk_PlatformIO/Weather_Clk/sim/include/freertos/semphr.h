@@ -0,0 +1,6 @@
+#ifndef SIM_FREERTOS_SEMPHR_H
+#define SIM_FREERTOS_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+#endif // SIM_FREERTOS_SEMPHR_H
@@ -0,0 +1,6 @@
+#ifndef SIM_FREERTOS_TASK_H
+#define SIM_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+#endif // SIM_FREERTOS_TASK_H
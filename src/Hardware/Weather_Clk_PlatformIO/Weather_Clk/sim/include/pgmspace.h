@@ -0,0 +1,24 @@
+#ifndef SIM_PGMSPACE_H
+#define SIM_PGMSPACE_H
+
+// 主机上常量数据就在普通内存中，PROGMEM 访问即普通读取。
+// TFT_eSPI 用 pgm_read_dword 和 uint32_t 保存字体表中的指针，模拟器需以 -no-pie 链接，
+// 使常量数据位于 4GB 以下，32 位读出的地址仍然有效。
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_float(addr) (*(const float *)(addr))
+#define pgm_read_ptr(addr) (*(void *const *)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strcmp_P strcmp
+
+#endif // SIM_PGMSPACE_H
@@ -0,0 +1,119 @@
+// 最小的 PNG 编码器：IDAT 中使用不压缩的 deflate 块，截图文件较大但格式简单、结果稳定
+#include "PngWriter.h"
+#include <stdio.h>
+#include <vector>
+
+static uint32_t crcTable[256];
+
+static void initCrcTable()
+{
+  for (uint32_t n = 0; n < 256; n++)
+  {
+    uint32_t c = n;
+    for (int k = 0; k < 8; k++)
+    {
+      c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+    }
+    crcTable[n] = c;
+  }
+}
+
+static uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc = 0xFFFFFFFFu)
+{
+  for (size_t i = 0; i < len; i++)
+  {
+    crc = crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return crc;
+}
+
+static void putBe32(std::vector<uint8_t> &out, uint32_t v)
+{
+  out.push_back(v >> 24);
+  out.push_back(v >> 16);
+  out.push_back(v >> 8);
+  out.push_back(v);
+}
+
+/**
+ * @brief 追加一个 PNG 数据块：长度、类型、内容和 CRC
+ */
+static void putChunk(std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data)
+{
+  putBe32(out, data.size());
+  size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data.begin(), data.end());
+  putBe32(out, crc32(&out[start], out.size() - start) ^ 0xFFFFFFFFu);
+}
+
+bool Png_WriteRgb565(const char *path, const uint16_t *pixels, int width, int height)
+{
+  if (crcTable[1] == 0)
+  {
+    initCrcTable();
+  }
+
+  // 每行前加一个过滤类型字节 (0 = 不过滤)，RGB565 展开为 8 位 RGB
+  std::vector<uint8_t> raw;
+  raw.reserve((size_t)(width * 3 + 1) * height);
+  for (int y = 0; y < height; y++)
+  {
+    raw.push_back(0);
+    for (int x = 0; x < width; x++)
+    {
+      uint16_t c = pixels[y * width + x];
+      uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+      raw.push_back((r << 3) | (r >> 2));
+      raw.push_back((g << 2) | (g >> 4));
+      raw.push_back((b << 3) | (b >> 2));
+    }
+  }
+
+  // zlib 流：头部、若干个最大 65535 字节的存储块、Adler-32
+  std::vector<uint8_t> z = {0x78, 0x01};
+  uint32_t a = 1, b = 0;
+  for (size_t pos = 0; pos < raw.size() || pos == 0;)
+  {
+    size_t len = raw.size() - pos > 0xFFFF ? 0xFFFF : raw.size() - pos;
+    bool last = pos + len == raw.size();
+    z.push_back(last ? 1 : 0);
+    z.push_back(len & 0xFF);
+    z.push_back(len >> 8);
+    z.push_back(~len & 0xFF);
+    z.push_back((~len >> 8) & 0xFF);
+    for (size_t i = 0; i < len; i++)
+    {
+      uint8_t v = raw[pos + i];
+      z.push_back(v);
+      a = (a + v) % 65521;
+      b = (b + a) % 65521;
+    }
+    pos += len;
+    if (last) break;
+  }
+  putBe32(z, (b << 16) | a);
+
+  std::vector<uint8_t> ihdr;
+  putBe32(ihdr, width);
+  putBe32(ihdr, height);
+  ihdr.push_back(8); // 位深
+  ihdr.push_back(2); // 颜色类型: RGB
+  ihdr.push_back(0); // 压缩方法
+  ihdr.push_back(0); // 过滤方法
+  ihdr.push_back(0); // 不隔行
+
+  std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  putChunk(png, "IHDR", ihdr);
+  putChunk(png, "IDAT", z);
+  putChunk(png, "IEND", std::vector<uint8_t>());
+
+  FILE *f = fopen(path, "wb");
+  if (!f)
+  {
+    return false;
+  }
+  bool ok = fwrite(png.data(), 1, png.size(), f) == png.size();
+  fclose(f);
+  return ok;
+}
@@ -0,0 +1,14 @@
+#ifndef PNG_WRITER_H
+#define PNG_WRITER_H
+
+#include <stdint.h>
+
+/**
+ * @brief 把 RGB565 画面保存为 PNG (8位RGB，不压缩的 deflate 块，不依赖 zlib)。
+ * @param path 输出文件路径。
+ * @param pixels width * height 个 RGB565 像素，按行存放。
+ * @return 写入成功返回 true。
+ */
+bool Png_WriteRgb565(const char *path, const uint16_t *pixels, int width, int height);
+
+#endif // PNG_WRITER_H
@@ -0,0 +1,75 @@
+#ifndef SIM_H
+#define SIM_H
+
+#include <Arduino.h>
+
+#define SIM_EPOCH_START 1750000000 // 虚拟时钟零点对应的 UTC 时间 (2025-06-15 15:06:40)
+
+/**
+ * @brief 脚本化的输入事件类型。
+ */
+enum SimInputType
+{
+    SIM_INPUT_ENCODER,   ///< 编码器旋转，value 为步数 (正为顺时针)。
+    SIM_INPUT_CLICK,     ///< 按钮单击。
+    SIM_INPUT_LONG_PRESS ///< 按钮长按。
+};
+
+/**
+ * @brief 场景运行超过时限时从 Sim_Sleep 抛出，结束卡住的界面循环。
+ */
+struct SimTimeout
+{
+};
+
+/**
+ * @brief 每次界面让出CPU (delay/vTaskDelay) 时调用的回调，在虚拟时钟推进之前执行。
+ */
+typedef void (*SimSleepHook)(uint32_t nowMs);
+
+// --- 虚拟时钟 ---
+
+/**
+ * @brief 虚拟时钟当前的毫秒数。
+ */
+uint32_t Sim_Now();
+
+/**
+ * @brief 让出CPU：先调用睡眠回调，再把虚拟时钟推进 ms 毫秒。
+ * @details 所有 delay、vTaskDelay 最终都落到这里。超过 Sim_SetDeadline 设定的时刻时抛出 SimTimeout。
+ */
+void Sim_Sleep(uint32_t ms);
+
+/**
+ * @brief 复位虚拟时钟、随机数和输入队列，开始一个新场景。
+ */
+void Sim_Reset();
+
+void Sim_SetSleepHook(SimSleepHook hook);
+void Sim_SetDeadline(uint32_t ms);
+
+/**
+ * @brief 主机上的单调时钟 (纳秒)，用于测量绘制代码的真实耗时。
+ */
+uint64_t Sim_HostNanos();
+
+// --- 输入 ---
+
+/**
+ * @brief 在虚拟时刻 atMs 加入一个输入事件，事件按加入顺序依次被读取。
+ */
+void Sim_QueueInput(uint32_t atMs, SimInputType type, int value = 0);
+
+/**
+ * @brief 输入队列是否已读空。
+ */
+bool Sim_InputDone();
+
+// --- 网络 ---
+
+/**
+ * @brief 设置 HTTP 固定响应所在的目录，URL 中包含某个文件名 (去掉 .json) 时返回该文件的内容。
+ */
+void Sim_SetFixtureDir(const char *dir);
+
+#endif // SIM_H
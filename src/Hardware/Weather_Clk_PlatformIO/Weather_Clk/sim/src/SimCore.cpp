@@ -0,0 +1,261 @@
+// Arduino-ESP32 核心、FreeRTOS 和 SPI 的模拟实现
+#include "Sim.h"
+#include "SimPanel.h"
+#include "RotaryEncoder.h"
+#include <SPI.h>
+#include <esp_timer.h>
+#include <time.h>
+#include <chrono>
+
+// --- 全局变量 ---
+HardwareSerial Serial;
+EspClass ESP;
+SPIClass SPI;
+
+static uint32_t nowMs = 0;
+static uint32_t deadlineMs = UINT32_MAX;
+static SimSleepHook sleepHook = NULL;
+static uint32_t randomState = 1;
+static int dummyHandle; // 所有任务、队列、信号量句柄都指向它
+
+// =================================================================================================
+// 虚拟时钟
+// =================================================================================================
+
+uint32_t Sim_Now()
+{
+  return nowMs;
+}
+
+void Sim_Sleep(uint32_t ms)
+{
+  if (sleepHook) sleepHook(nowMs);
+  if (nowMs >= deadlineMs)
+  {
+    throw SimTimeout();
+  }
+  nowMs += ms ? ms : 1; // 0 毫秒的让出也推进时钟，避免轮询循环原地打转
+}
+
+void Sim_Reset()
+{
+  nowMs = 0;
+  deadlineMs = UINT32_MAX;
+  randomState = 1;
+  initRotaryEncoder(); // 清空输入队列
+}
+
+void Sim_SetSleepHook(SimSleepHook hook)
+{
+  sleepHook = hook;
+}
+
+void Sim_SetDeadline(uint32_t ms)
+{
+  deadlineMs = ms;
+}
+
+uint64_t Sim_HostNanos()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+unsigned long millis() { return nowMs; }
+unsigned long micros() { return nowMs * 1000UL; }
+void delay(uint32_t ms) { Sim_Sleep(ms); }
+void delayMicroseconds(uint32_t us) { (void)us; }
+void yield() {}
+
+/**
+ * @brief 主机 libc 的 time() 换成虚拟时钟，界面中用到的日期计算与 getLocalTime 一致
+ */
+extern "C" time_t time(time_t *t)
+{
+  time_t now = SIM_EPOCH_START + nowMs / 1000;
+  if (t) *t = now;
+  return now;
+}
+
+bool getLocalTime(struct tm *info, uint32_t ms)
+{
+  (void)ms;
+  time_t now = time(NULL);
+  localtime_r(&now, info);
+  return true;
+}
+
+void configTime(long, int, const char *, const char *, const char *) {}
+
+// =================================================================================================
+// 引脚、随机数和芯片
+// =================================================================================================
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t pin, uint8_t val) { SimPanel_PinWrite(pin, val); }
+int digitalRead(uint8_t) { return HIGH; } // 按钮等上拉输入保持未按下
+uint16_t analogRead(uint8_t) { return 2048; }
+void analogWrite(uint8_t, int) {}
+void attachInterrupt(uint8_t, void (*)(void), int) {}
+void detachInterrupt(uint8_t) {}
+void tone(uint8_t, unsigned int, unsigned long) {}
+void noTone(uint8_t) {}
+
+long random(long max)
+{
+  if (max <= 0) return 0;
+  randomState = randomState * 1103515245 + 12345;
+  return (randomState >> 1) % max;
+}
+
+long random(long min, long max)
+{
+  return max > min ? min + random(max - min) : min;
+}
+
+void randomSeed(unsigned long seed) { randomState = seed ? seed : 1; }
+
+long map(long x, long inMin, long inMax, long outMin, long outMax)
+{
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+uint32_t getCpuFrequencyMhz() { return 160; }
+bool setCpuFrequencyMhz(uint32_t) { return true; }
+float temperatureRead() { return 42.0f; }
+
+// 周期计数器按 160MHz 换算主机时间，帧耗时统计反映的是主机上的真实绘制耗时
+uint32_t EspClass::getCycleCount() { return (uint32_t)(Sim_HostNanos() * 160 / 1000); }
+int64_t esp_timer_get_time() { return (int64_t)(Sim_HostNanos() / 1000); }
+uint32_t EspClass::getFreeHeap() { return 200 * 1024; }
+uint32_t EspClass::getMinFreeHeap() { return 180 * 1024; }
+uint32_t EspClass::getMaxAllocHeap() { return 100 * 1024; }
+uint32_t EspClass::getHeapSize() { return 320 * 1024; }
+void EspClass::restart() { exit(0); }
+
+char *ultoa(unsigned long value, char *buf, int base)
+{
+  char tmp[66];
+  int i = 0;
+  do { int d = value % base; tmp[i++] = d < 10 ? '0' + d : 'a' + d - 10; value /= base; } while (value);
+  for (int j = 0; j < i; j++) buf[j] = tmp[i - 1 - j];
+  buf[i] = 0;
+  return buf;
+}
+
+char *ltoa(long value, char *buf, int base)
+{
+  if (value < 0 && base == 10)
+  {
+    buf[0] = '-';
+    ultoa(-(unsigned long)value, buf + 1, base);
+    return buf;
+  }
+  return ultoa((unsigned long)value, buf, base);
+}
+
+char *itoa(int value, char *buf, int base) { return ltoa(value, buf, base); }
+char *utoa(unsigned value, char *buf, int base) { return ultoa(value, buf, base); }
+
+char *dtostrf(double value, signed char width, unsigned char prec, char *buf)
+{
+  sprintf(buf, "%*.*f", width, prec, value);
+  return buf;
+}
+
+// =================================================================================================
+// SPI：字节送入面板模型
+// =================================================================================================
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+  SimPanel_Write(data);
+  return 0;
+}
+
+uint16_t SPIClass::transfer16(uint16_t data)
+{
+  SimPanel_Write(data >> 8);
+  SimPanel_Write(data & 0xFF);
+  return 0;
+}
+
+uint32_t SPIClass::transfer32(uint32_t data)
+{
+  transfer16(data >> 16);
+  transfer16(data & 0xFFFF);
+  return 0;
+}
+
+void SPIClass::transfer(void *data, uint32_t size)
+{
+  writeBytes((const uint8_t *)data, size);
+}
+
+void SPIClass::writeBytes(const uint8_t *data, uint32_t size)
+{
+  while (size--) SimPanel_Write(*data++);
+}
+
+void SPIClass::writePixels(const void *data, uint32_t size)
+{
+  writeBytes((const uint8_t *)data, size);
+}
+
+// =================================================================================================
+// FreeRTOS：单任务，延时推进虚拟时钟，其他任务不运行
+// =================================================================================================
+
+TickType_t xTaskGetTickCount() { return nowMs; }
+void vTaskDelay(TickType_t ticks) { Sim_Sleep(ticks); }
+
+void vTaskDelayUntil(TickType_t *previousWake, TickType_t increment)
+{
+  TickType_t wake = *previousWake + increment;
+  Sim_Sleep(wake > nowMs ? wake - nowMs : 0);
+  *previousWake = wake;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return &dummyHandle; }
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t, const char *, uint32_t, void *, UBaseType_t, TaskHandle_t *handle, BaseType_t)
+{
+  if (handle) *handle = NULL; // 后台任务不运行，调用者看到的是尚未创建的句柄
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t priority, TaskHandle_t *handle)
+{
+  return xTaskCreatePinnedToCore(fn, name, stack, arg, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t) {}
+eTaskState eTaskGetState(TaskHandle_t task) { return task ? eRunning : eDeleted; }
+void vTaskSuspend(TaskHandle_t) {}
+void vTaskResume(TaskHandle_t) {}
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 1024; }
+uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 1; }
+BaseType_t xTaskNotifyGive(TaskHandle_t) { return pdPASS; }
+
+QueueHandle_t xQueueCreate(UBaseType_t, UBaseType_t) { return &dummyHandle; }
+BaseType_t xQueueSend(QueueHandle_t, const void *, TickType_t) { return pdTRUE; }
+BaseType_t xQueueSendToBack(QueueHandle_t, const void *, TickType_t) { return pdTRUE; }
+// 其他任务不运行，队列永远是空的：限时等待等同于睡眠到超时
+BaseType_t xQueueReceive(QueueHandle_t, void *, TickType_t wait)
+{
+  if (wait != 0 && wait != portMAX_DELAY) Sim_Sleep(wait);
+  return pdFALSE;
+}
+BaseType_t xQueuePeek(QueueHandle_t, void *, TickType_t) { return pdFALSE; }
+BaseType_t xQueueReset(QueueHandle_t) { return pdPASS; }
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t) { return 0; }
+void vQueueDelete(QueueHandle_t) {}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return &dummyHandle; }
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return &dummyHandle; }
+SemaphoreHandle_t xSemaphoreCreateBinary() { return &dummyHandle; }
+BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+BaseType_t xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t) { return pdTRUE; }
+TaskHandle_t xSemaphoreGetMutexHolder(SemaphoreHandle_t) { return xTaskGetCurrentTaskHandle(); }
+void vSemaphoreDelete(SemaphoreHandle_t) {}
@@ -0,0 +1,53 @@
+// 设置分区的模拟实现：32KB 内存闪存，每次运行从全空白开始
+#include <esp_partition.h>
+#include <string.h>
+
+#define SIM_FLASH_SECTOR 4096
+
+// --- 全局变量 ---
+static const esp_partition_t settingsPartition = {ESP_PARTITION_TYPE_DATA, 0x40, 0x3E2000, 0x8000, "settings", false};
+static uint8_t flash[0x8000];
+static bool flashReady = false;
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label)
+{
+  if (type != settingsPartition.type || subtype != settingsPartition.subtype ||
+      (label && strcmp(label, settingsPartition.label) != 0))
+  {
+    return NULL;
+  }
+  if (!flashReady)
+  {
+    memset(flash, 0xFF, sizeof(flash));
+    flashReady = true;
+  }
+  return &settingsPartition;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t offset, void *dst, size_t size)
+{
+  if (partition != &settingsPartition || offset + size > sizeof(flash)) return ESP_ERR_INVALID_SIZE;
+  memcpy(dst, flash + offset, size);
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t offset, const void *src, size_t size)
+{
+  if (partition != &settingsPartition || offset + size > sizeof(flash)) return ESP_ERR_INVALID_SIZE;
+  const uint8_t *p = (const uint8_t *)src;
+  for (size_t i = 0; i < size; i++)
+  {
+    flash[offset + i] &= p[i]; // 编程只能清除位
+  }
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size)
+{
+  if (partition != &settingsPartition || offset % SIM_FLASH_SECTOR || size % SIM_FLASH_SECTOR || offset + size > sizeof(flash))
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  memset(flash + offset, 0xFF, size);
+  return ESP_OK;
+}
@@ -0,0 +1,67 @@
+// 旋转编码器的模拟实现：按脚本在虚拟时刻依次给出旋转、单击和长按
+#include "Sim.h"
+#include "RotaryEncoder.h"
+#include <deque>
+
+/**
+ * @brief 一个待读取的输入事件
+ */
+struct SimInputEvent
+{
+  uint32_t atMs;
+  SimInputType type;
+  int value;
+};
+
+// --- 全局变量 ---
+static std::deque<SimInputEvent> inputQueue;
+
+/**
+ * @brief 队首事件已到时刻且类型匹配时取出它
+ */
+static bool takeEvent(SimInputType type, int *value)
+{
+  if (inputQueue.empty())
+  {
+    return false;
+  }
+  const SimInputEvent &e = inputQueue.front();
+  if (e.type != type || e.atMs > Sim_Now())
+  {
+    return false;
+  }
+  if (value) *value = e.value;
+  inputQueue.pop_front();
+  return true;
+}
+
+void Sim_QueueInput(uint32_t atMs, SimInputType type, int value)
+{
+  inputQueue.push_back({atMs, type, value});
+}
+
+bool Sim_InputDone()
+{
+  return inputQueue.empty();
+}
+
+void initRotaryEncoder()
+{
+  inputQueue.clear();
+}
+
+int readEncoder()
+{
+  int steps = 0;
+  return takeEvent(SIM_INPUT_ENCODER, &steps) ? steps : 0;
+}
+
+int readButton()
+{
+  return takeEvent(SIM_INPUT_CLICK, NULL) ? 1 : 0;
+}
+
+bool readButtonLongPress()
+{
+  return takeEvent(SIM_INPUT_LONG_PRESS, NULL);
+}
@@ -0,0 +1,196 @@
+// ST7789 面板模型：把 SPI 字节流按命令集解码到 240x320 的帧存储器
+#include "SimPanel.h"
+#include <string.h>
+
+#define CMD_CASET    0x2A
+#define CMD_RASET    0x2B
+#define CMD_RAMWR    0x2C
+#define CMD_VSCRDEF  0x33
+#define CMD_MADCTL   0x36
+#define CMD_VSCRSADD 0x37
+#define CMD_RAMWRC   0x3C
+
+#define MAD_MY 0x80
+#define MAD_MX 0x40
+#define MAD_MV 0x20
+
+// --- 全局变量 ---
+static uint16_t gram[SIM_PANEL_ROWS][SIM_PANEL_COLS];
+static uint8_t dcPin = 0xFF;
+static bool dataMode = false;      // DC 高电平：后续字节是数据
+static uint8_t command = 0;        // 当前命令
+static uint8_t params[8];          // 当前命令已收到的参数
+static uint32_t paramCount = 0;
+static uint8_t madctl = 0;
+static uint8_t viewMadctl = 0;
+static uint16_t xs = 0, xe = SIM_PANEL_COLS - 1, ys = 0, ye = SIM_PANEL_ROWS - 1; // 地址窗口 (逻辑坐标)
+static uint16_t cx = 0, cy = 0;    // 写像素的当前位置
+static bool pixelHigh = false;     // 已收到像素的高字节
+static uint8_t pixelMsb = 0;
+static uint16_t tfa = 0, vsa = SIM_PANEL_ROWS, bfa = 0, ssa = 0; // 垂直滚动定义和起始地址
+static SimPanelCounters counters;
+
+/**
+ * @brief 逻辑地址 (列, 行) 在给定 MADCTL 下对应的帧存储器位置
+ * @details MV 先交换行列，MX/MY 再分别镜像物理列 (0~239) 和物理行 (0~319)
+ * @return 超出帧存储器时返回false
+ */
+static bool mapAddress(uint8_t mad, uint16_t c, uint16_t r, uint16_t *col, uint16_t *row)
+{
+  uint16_t a = (mad & MAD_MV) ? r : c;
+  uint16_t b = (mad & MAD_MV) ? c : r;
+  if (a >= SIM_PANEL_COLS || b >= SIM_PANEL_ROWS)
+  {
+    return false;
+  }
+  *col = (mad & MAD_MX) ? SIM_PANEL_COLS - 1 - a : a;
+  *row = (mad & MAD_MY) ? SIM_PANEL_ROWS - 1 - b : b;
+  return true;
+}
+
+/**
+ * @brief 显示行 line 实际显示的帧存储器行 (垂直滚动)
+ */
+static uint16_t scrolledRow(uint16_t line)
+{
+  if (line < tfa || line >= tfa + vsa)
+  {
+    return line;
+  }
+  uint32_t row = ssa + (line - tfa);
+  if (row >= (uint32_t)(tfa + vsa)) row -= vsa;
+  return row;
+}
+
+static void writePixel(uint16_t color)
+{
+  uint16_t col, row;
+  if (mapAddress(madctl, cx, cy, &col, &row))
+  {
+    gram[row][col] = color;
+  }
+  counters.pixels++;
+
+  if (++cx > xe)
+  {
+    cx = xs;
+    if (++cy > ye) cy = ys;
+  }
+}
+
+static void beginCommand(uint8_t cmd)
+{
+  command = cmd;
+  paramCount = 0;
+  pixelHigh = false;
+  counters.commands++;
+  if (cmd == CMD_RAMWR)
+  {
+    cx = xs;
+    cy = ys;
+    counters.windows++;
+  }
+  else if (cmd == CMD_RAMWRC)
+  {
+    counters.windows++;
+  }
+}
+
+static void commandData(uint8_t data)
+{
+  if (command == CMD_RAMWR || command == CMD_RAMWRC)
+  {
+    if (!pixelHigh)
+    {
+      pixelMsb = data;
+      pixelHigh = true;
+    }
+    else
+    {
+      writePixel((pixelMsb << 8) | data);
+      pixelHigh = false;
+    }
+    return;
+  }
+
+  if (paramCount < sizeof(params)) params[paramCount] = data;
+  paramCount++;
+  switch (command)
+  {
+  case CMD_CASET:
+    if (paramCount == 4) { xs = (params[0] << 8) | params[1]; xe = (params[2] << 8) | params[3]; }
+    break;
+  case CMD_RASET:
+    if (paramCount == 4) { ys = (params[0] << 8) | params[1]; ye = (params[2] << 8) | params[3]; }
+    break;
+  case CMD_MADCTL:
+    if (paramCount == 1) madctl = params[0];
+    break;
+  case CMD_VSCRDEF:
+    if (paramCount == 6)
+    {
+      tfa = (params[0] << 8) | params[1];
+      vsa = (params[2] << 8) | params[3];
+      bfa = (params[4] << 8) | params[5];
+      if (tfa + vsa + bfa != SIM_PANEL_ROWS || vsa == 0) { tfa = 0; vsa = SIM_PANEL_ROWS; bfa = 0; } // 无效定义被面板忽略
+    }
+    break;
+  case CMD_VSCRSADD:
+    if (paramCount == 2) ssa = (params[0] << 8) | params[1];
+    break;
+  }
+}
+
+void SimPanel_Init(uint8_t pin)
+{
+  memset(gram, 0, sizeof(gram));
+  memset(&counters, 0, sizeof(counters));
+  dcPin = pin;
+  dataMode = false;
+  command = 0;
+  madctl = viewMadctl = 0;
+  xs = 0; xe = SIM_PANEL_COLS - 1; ys = 0; ye = SIM_PANEL_ROWS - 1;
+  tfa = 0; vsa = SIM_PANEL_ROWS; bfa = 0; ssa = 0;
+}
+
+void SimPanel_PinWrite(uint8_t pin, uint8_t level)
+{
+  if (pin == dcPin)
+  {
+    dataMode = level != 0;
+  }
+}
+
+void SimPanel_Write(uint8_t byte)
+{
+  counters.bytes++;
+  if (dataMode) commandData(byte);
+  else beginCommand(byte);
+}
+
+void SimPanel_SetViewFromCurrent()
+{
+  viewMadctl = madctl;
+}
+
+void SimPanel_Snapshot(uint16_t *out)
+{
+  for (uint16_t y = 0; y < SIM_VIEW_HEIGHT; y++)
+  {
+    for (uint16_t x = 0; x < SIM_VIEW_WIDTH; x++)
+    {
+      uint16_t col, line;
+      uint16_t color = 0;
+      if (mapAddress(viewMadctl, x, y, &col, &line))
+      {
+        color = gram[scrolledRow(line)][col];
+      }
+      *out++ = color;
+    }
+  }
+}
+
+SimPanelCounters SimPanel_GetCounters()
+{
+  return counters;
+}
@@ -0,0 +1,54 @@
+#ifndef SIM_PANEL_H
+#define SIM_PANEL_H
+
+#include <stdint.h>
+
+#define SIM_PANEL_COLS 240 // ST7789 帧存储器列数
+#define SIM_PANEL_ROWS 320 // ST7789 帧存储器行数，面板显示其中的 SIM_VIEW_HEIGHT 行
+#define SIM_VIEW_WIDTH  240
+#define SIM_VIEW_HEIGHT 240
+
+/**
+ * @brief 面板总线计数，由 SimPanel_GetCounters 返回，可相减得到一帧的增量。
+ */
+struct SimPanelCounters
+{
+    uint32_t bytes;    ///< SPI 上发送的总字节数 (命令 + 参数 + 像素)。
+    uint32_t commands; ///< 命令数。
+    uint32_t windows;  ///< RAMWR 次数，即设置地址窗口后开始写像素的次数。
+    uint32_t pixels;   ///< 写入帧存储器的像素数。
+};
+
+/**
+ * @brief 复位面板模型：帧存储器清零，滚动和 MADCTL 恢复默认。
+ * @param dcPin 数据/命令选择引脚，digitalWrite 到该引脚的电平决定后续字节是命令还是数据。
+ */
+void SimPanel_Init(uint8_t dcPin);
+
+/**
+ * @brief digitalWrite 的落点，跟踪 DC 引脚电平。
+ */
+void SimPanel_PinWrite(uint8_t pin, uint8_t level);
+
+/**
+ * @brief SPI 发出的一个字节。
+ */
+void SimPanel_Write(uint8_t byte);
+
+/**
+ * @brief 以当前的 MADCTL 作为截图方向 (在 tft.setRotation 之后调用)，截图与该旋转下的屏幕坐标一致。
+ */
+void SimPanel_SetViewFromCurrent();
+
+/**
+ * @brief 读取当前面板上显示的画面 (已计入硬件滚动)。
+ * @param out SIM_VIEW_WIDTH * SIM_VIEW_HEIGHT 个 RGB565 像素，按行存放。
+ */
+void SimPanel_Snapshot(uint16_t *out);
+
+/**
+ * @brief 获取累计的总线计数。
+ */
+SimPanelCounters SimPanel_GetCounters();
+
+#endif // SIM_PANEL_H
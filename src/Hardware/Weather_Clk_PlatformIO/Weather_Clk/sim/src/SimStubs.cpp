@@ -0,0 +1,129 @@
+// 模拟器中不参与链接的模块的替身：外设、天气、闹钟、音乐和不做截图的子菜单
+#include "Sim.h"
+#include <TFT_eSPI.h>
+#include <HTTPClient.h>
+#include <EEPROM.h>
+#include <esp_heap_caps.h>
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#include "System.h"
+#include "weather.h"
+#include "Alarm.h"
+#include "Buzzer.h"
+#include "MQTT.h"
+#include "DS18B20.h"
+#include "Power.h"
+
+// --- 全局变量 ---
+TFT_eSPI tft;
+TFT_eSprite menuSprite(&tft);
+WiFiClass WiFi;
+EEPROMClass EEPROM;
+
+struct tm timeinfo;
+char temperature[10] = "26";
+char humidity[10] = "58";
+char reporttime[25] = "2025-06-15 23:00";
+char lastSyncTimeStr[45] = "Synced 23:05";
+char lastWeatherSyncStr[45] = "Weather 23:00";
+char wifiStatusStr[30] = "WiFi: Connected";
+bool wifi_connected = true;
+bool synced = true;
+
+volatile bool g_alarm_is_ringing = false;
+volatile bool exitSubMenu = false;
+const int numSongs = 0;
+float g_currentTemperature = 25.5f;
+
+static std::string fixtureDir;
+
+// =================================================================================================
+// 系统日志：输出到标准输出，不画到屏幕上
+// =================================================================================================
+
+void tftLog(String text, uint16_t color)
+{
+  (void)color;
+  Serial.println(text);
+}
+
+void tftLogInfo(const String &text) { Serial.println("[INFO] " + text); }
+void tftLogWarning(const String &text) { Serial.println("[WARN] " + text); }
+void tftLogError(const String &text) { Serial.println("[ERROR] " + text); }
+void tftLogSuccess(const String &text) { Serial.println("[OK] " + text); }
+void tftLogDebug(const String &text) { Serial.println("[DEBUG] " + text); }
+void tftClearLog() {}
+
+// =================================================================================================
+// 外设与网络
+// =================================================================================================
+
+bool ensureWiFiConnected() { return true; }
+void silentSyncTime() {}
+void silentFetchWeather() {}
+float getDS18B20Temp() { return g_currentTemperature; }
+void Alarm_ShowRingingScreen() {}
+uint32_t Buzzer_Play(int, PlayMode, BuzzerVoice, uint32_t) { return 0; }
+void Buzzer_Tone(uint16_t, uint16_t, BuzzerVoice) {}
+void Buzzer_Stop(uint32_t) {}
+void Power_LockAcquire(PowerLock) {}
+void Power_LockRelease(PowerLock) {}
+
+size_t heap_caps_get_free_size(uint32_t) { return 200 * 1024; }
+size_t heap_caps_get_largest_free_block(uint32_t) { return 100 * 1024; }
+size_t heap_caps_get_minimum_free_size(uint32_t) { return 180 * 1024; }
+
+void Sim_SetFixtureDir(const char *dir)
+{
+  fixtureDir = dir ? dir : "";
+}
+
+/**
+ * @brief 在固定响应目录中找文件名 (去掉 .json) 出现在 URL 中的文件，返回其内容
+ */
+int HTTPClient::GET()
+{
+  body = "";
+  DIR *dir = fixtureDir.empty() ? NULL : opendir(fixtureDir.c_str());
+  if (!dir)
+  {
+    return HTTP_CODE_NOT_FOUND;
+  }
+  int code = HTTP_CODE_NOT_FOUND;
+  while (struct dirent *entry = readdir(dir))
+  {
+    std::string name = entry->d_name;
+    size_t dot = name.rfind(".json");
+    if (dot == std::string::npos || dot == 0 || url.indexOf(name.substr(0, dot).c_str()) < 0)
+    {
+      continue;
+    }
+    std::ifstream file(fixtureDir + "/" + name);
+    std::stringstream text;
+    text << file.rdbuf();
+    body = text.str().c_str();
+    code = HTTP_CODE_OK;
+    break;
+  }
+  closedir(dir);
+  return code;
+}
+
+// =================================================================================================
+// 不做截图的子菜单：进入后立即返回主菜单
+// =================================================================================================
+
+void weatherMenu() {}
+void BuzzerMenu() {}
+void SpaceMenuScreen() {}
+void AlarmMenu() {}
+void MusicMenuLite() {}
+void performanceMenu() {}
+void SecondScreenMenu() {}
+void DS18B20Menu() {}
+void AnimationMenu() {}
+void GamesMenu() {}
+void ADCMenu() {}
+void LEDMenu() {}
+void SystemMonitorMenu() {}
@@ -0,0 +1,268 @@
+/**
+ * @file main.cpp
+ * @brief 主机上的界面模拟器
+ * @details 把主菜单、每个表盘和互联网信息页面在虚拟时钟下运行一遍，按脚本注入编码器输入，
+ *          把 ST7789 面板模型上的画面在固定时刻保存为 PNG，并把每一帧的总线开销写入 frames.csv。
+ *          两次运行的输出目录可以用 sim/compare_frames.py 对比，检查画面和每帧开销的变化。
+ *
+ * 用法: sim [输出目录] [固定响应目录]   (默认 sim_out 和 sim/fixtures)
+ */
+#include "Sim.h"
+#include "SimPanel.h"
+#include "PngWriter.h"
+#include <TFT_eSPI.h>
+#include <EEPROM.h>
+#include <sys/stat.h>
+#include <vector>
+#include "Menu.h"
+#include "Watchface.h"
+#include "Internet.h"
+#include "Display.h"
+#include "HwScroll.h"
+#include "Memory.h"
+#include "Profiler.h"
+#include "FontCache.h"
+#include "DigitAtlas.h"
+#include "TargetSettings.h"
+#include "Settings.h"
+
+#define SIM_SCENARIO_MAX_MS 5000 // 单个场景的最长虚拟运行时间
+
+// 与 Watchface.cpp 中 watchfaceItems 的顺序一致 (第0项 Target Settings 不是表盘，不截图)
+static const char *const watchfaceNames[] = {
+    "scan", "scan_seg", "scroll", "scroll_seg", "progress_bar", "sim_clock",
+    "galaxy", "terminal_sim", "simple_clock", "code_rain", "snow", "waves",
+    "neno", "bouncing_balls", "sand_box", "cube3d"};
+static const int WATCHFACE_NAME_COUNT = sizeof(watchfaceNames) / sizeof(watchfaceNames[0]);
+
+/**
+ * @brief 一次截图：在虚拟时刻 atMs 之后的第一次让出CPU时保存画面
+ */
+struct SimCapture
+{
+  uint32_t atMs;
+  String name;
+  bool done;
+};
+
+// --- 全局变量 ---
+static String outDir;
+static String scenarioName;
+static FILE *framesCsv = NULL;
+static std::vector<SimCapture> captures;
+static uint16_t prevFrame[SIM_VIEW_WIDTH * SIM_VIEW_HEIGHT];
+static uint16_t curFrame[SIM_VIEW_WIDTH * SIM_VIEW_HEIGHT];
+static SimPanelCounters lastCounters;
+static uint64_t lastHostNs;
+static uint32_t frameIndex;
+
+/**
+ * @brief 睡眠回调：面板有新的写入时记一帧，到时刻的截图写成 PNG
+ */
+static void onSleep(uint32_t nowMs)
+{
+  uint64_t hostNs = Sim_HostNanos();
+  SimPanelCounters c = SimPanel_GetCounters();
+  bool changed = c.commands != lastCounters.commands || c.bytes != lastCounters.bytes;
+  bool snapped = false;
+
+  if (changed)
+  {
+    SimPanel_Snapshot(curFrame);
+    snapped = true;
+    uint32_t diff = 0;
+    for (int i = 0; i < SIM_VIEW_WIDTH * SIM_VIEW_HEIGHT; i++)
+    {
+      diff += curFrame[i] != prevFrame[i];
+    }
+    fprintf(framesCsv, "%s,%u,%u,%u,%u,%u,%u,%u,%u\n", scenarioName.c_str(), frameIndex++, nowMs,
+            c.windows - lastCounters.windows, c.pixels - lastCounters.pixels,
+            c.bytes - lastCounters.bytes, c.commands - lastCounters.commands, diff,
+            (uint32_t)((hostNs - lastHostNs) / 1000));
+    memcpy(prevFrame, curFrame, sizeof(curFrame));
+    lastCounters = c;
+  }
+
+  for (SimCapture &cap : captures)
+  {
+    if (cap.done || nowMs < cap.atMs) continue;
+    if (!snapped)
+    {
+      SimPanel_Snapshot(curFrame);
+      snapped = true;
+    }
+    String path = outDir + "/" + scenarioName + "_" + cap.name + ".png";
+    if (!Png_WriteRgb565(path.c_str(), curFrame, SIM_VIEW_WIDTH, SIM_VIEW_HEIGHT))
+    {
+      fprintf(stderr, "写入 %s 失败\n", path.c_str());
+    }
+    cap.done = true;
+  }
+
+  // 帧耗时只计界面代码本身，不含本回调的截图和写文件
+  lastHostNs = Sim_HostNanos();
+}
+
+static void capture(uint32_t atMs, const char *name)
+{
+  captures.push_back({atMs, name, false});
+}
+
+/**
+ * @brief 开始一个场景：面板和屏幕重新初始化，虚拟时钟归零
+ */
+static void beginScenario(const String &name)
+{
+  Sim_SetSleepHook(NULL);
+  if (HwScroll_IsActive())
+  {
+    HwScroll_End();
+  }
+  SimPanel_Init(TFT_DC);
+  tft.init();
+  tft.setRotation(1);
+  SimPanel_SetViewFromCurrent();
+  tft.fillScreen(TFT_BLACK);
+  Display_Invalidate();
+  Arena_Reset();
+  Profiler_Reset();
+
+  Sim_Reset();
+  scenarioName = name;
+  captures.clear();
+  frameIndex = 0;
+  lastCounters = SimPanel_GetCounters();
+  SimPanel_Snapshot(prevFrame);
+  lastHostNs = Sim_HostNanos();
+}
+
+/**
+ * @brief 运行场景直到虚拟时钟超过 durationMs，卡住的界面循环由 SimTimeout 结束
+ */
+static void runScenario(void (*body)(), uint32_t durationMs)
+{
+  Sim_SetDeadline(durationMs < SIM_SCENARIO_MAX_MS ? durationMs : SIM_SCENARIO_MAX_MS);
+  Sim_SetSleepHook(onSleep);
+  try
+  {
+    body();
+  }
+  catch (const SimTimeout &)
+  {
+  }
+  Sim_SetSleepHook(NULL);
+  Sim_SetDeadline(UINT32_MAX); // 场景之间的重新初始化也会调用 delay
+
+  for (const SimCapture &cap : captures)
+  {
+    if (!cap.done)
+    {
+      fprintf(stderr, "%s: 截图 %s 未完成 (界面在 %ums 前已退出)\n", scenarioName.c_str(), cap.name.c_str(), cap.atMs);
+    }
+  }
+  Serial.printf("== %s: %u 帧\n", scenarioName.c_str(), frameIndex);
+  Profiler_Dump();
+}
+
+// =================================================================================================
+// 场景
+// =================================================================================================
+
+static void mainMenuBody()
+{
+  showMenuConfig();
+  while (true)
+  {
+    showMenu();
+    vTaskDelay(pdMS_TO_TICKS(15));
+  }
+}
+
+/**
+ * @brief 主菜单：初始画面，然后向右滚动几项再向左滚动一项
+ */
+static void runMainMenu()
+{
+  beginScenario("menu");
+  capture(0, "home");
+  for (int i = 0; i < 3; i++)
+  {
+    Sim_QueueInput(300 + i * 500, SIM_INPUT_ENCODER, 1);
+  }
+  Sim_QueueInput(1800, SIM_INPUT_ENCODER, -1);
+  capture(250, "scroll_start");
+  capture(1700, "item3");
+  capture(2300, "item2");
+  runScenario(mainMenuBody, 2500);
+}
+
+/**
+ * @brief 表盘：在表盘列表中转到第 index 项并单击进入，运行一段时间后截两张图
+ */
+static void runWatchface(int index)
+{
+  beginScenario(String("watchface_") + watchfaceNames[index - 1]);
+  Sim_QueueInput(50, SIM_INPUT_ENCODER, index);
+  Sim_QueueInput(400, SIM_INPUT_CLICK); // 列表把开机后 300ms 内的单击当作双击
+  capture(1500, "a");
+  capture(3000, "b");
+  runScenario(WatchfaceMenu, 3200);
+}
+
+/**
+ * @brief 互联网信息页面：单击获取当前页数据 (来自固定响应文件)，翻到下一页再获取一次
+ */
+static void runInternet()
+{
+  beginScenario("internet");
+  Sim_QueueInput(1000, SIM_INPUT_CLICK);
+  Sim_QueueInput(2000, SIM_INPUT_ENCODER, 1);
+  Sim_QueueInput(2200, SIM_INPUT_CLICK);
+  capture(1900, "page0");
+  capture(3000, "page1");
+  runScenario(InternetMenuScreen, 3200);
+}
+
+int main(int argc, char **argv)
+{
+  setenv("TZ", "CST-8", 1); // 与固件 configTime 的东八区一致，截图不随主机时区变化
+  tzset();
+  outDir = argc > 1 ? argv[1] : "sim_out";
+  Sim_SetFixtureDir(argc > 2 ? argv[2] : "sim/fixtures");
+  mkdir(outDir.c_str(), 0755);
+
+  String csvPath = outDir + "/frames.csv";
+  framesCsv = fopen(csvPath.c_str(), "w");
+  if (!framesCsv)
+  {
+    fprintf(stderr, "无法创建 %s\n", csvPath.c_str());
+    return 1;
+  }
+  fprintf(framesCsv, "scenario,frame,t_ms,windows,pixels,bytes,commands,changed_px,host_us\n");
+
+  // 与 bootSystem 中的界面部分相同，跳过外设、网络和开机动画
+  EEPROM.begin(512);
+  EEPROM.erase();
+  Arena_Init();
+  initRotaryEncoder();
+  SimPanel_Init(TFT_DC);
+  tft.init();
+  tft.setRotation(1);
+  SimPanel_SetViewFromCurrent();
+  menuSprite.createSprite(240, 240);
+  Display_Init();
+  FontCache_Init();
+  DigitAtlas_Init();
+  Settings_Init();
+  TargetSettings_Init();
+
+  runMainMenu();
+  for (int i = 1; i <= WATCHFACE_NAME_COUNT; i++)
+  {
+    runWatchface(i);
+  }
+  runInternet();
+
+  fclose(framesCsv);
+  return 0;
+}
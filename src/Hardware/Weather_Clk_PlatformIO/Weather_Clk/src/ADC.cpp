@@ -9,6 +9,10 @@
 #include "RotaryEncoder.h"
 #include <math.h>
 #include "driver/adc.h"
+#include "Display.h"
+#include "SysMon.h"
+#include "Worker.h"
+#include "EventBus.h"
 
 // 创建一个仪表盘控件对象，用于显示电压
 MeterWidget volts = MeterWidget(&tft);
@@ -23,8 +27,6 @@ MeterWidget volts = MeterWidget(&tft);
 static esp_adc_cal_characteristics_t adc1_chars;
 // 标志位，表示ADC校准是否成功启用
 bool cali_enable = false;
-// 标志位，用于通知ADC显示任务停止运行
-bool stopADCDisplayTask = false;
 // 全局光照强度变量
 float g_lux = 0.0f;
 
@@ -86,7 +88,11 @@ void ADC_Task(void *pvParameters)
     const float R10 = 8000.0f;
     const float GAMMA = 0.6f;
 
+    int32_t lastLux = -1; // 上次发布的光照 (lux)
+
+    SysMon_Watch(10000);
     for (;;) {
+        SysMon_Heartbeat();
         uint32_t sum = 0;
         const int samples = 50;
         for (int i = 0; i < samples; i++)
@@ -109,6 +115,11 @@ void ADC_Task(void *pvParameters)
 
         float r_photo = (voltage_v * R_FIXED) / (3.3f - voltage_v);
         g_lux = pow((r_photo / R10), (1.0f / -GAMMA)) * 10.0f;
+        if ((int32_t)g_lux != lastLux)
+        {
+            lastLux = (int32_t)g_lux;
+            EventBus_Publish(EVENT_SENSOR, SENSOR_LIGHT, lastLux);
+        }
 
         vTaskDelay(pdMS_TO_TICKS(500)); // 每500ms更新一次
     }
@@ -124,95 +135,95 @@ void startADC()
 
 
 /**
- * @brief [FreeRTOS Task] ADC数据显示任务
- * @param pvParameters 任务创建时传入的参数（未使用）
- * @details 这是一个在ADC菜单激活时运行的周期性任务，负责在屏幕上显示当前的ADC和光照强度信息。
+ * @brief [绘制作业] 画出电压表盘
  */
-void ADC_Display_Task(void *pvParameters)
+static void adcScreenStart(int arg)
 {
     volts.analogMeter(0, 0, 3.3f, "V", "0", "0.8", "1.6", "2.4", "3.3");
+}
 
-    while (!stopADCDisplayTask)
-    {
-        // 直接使用全局变量 g_lux，由后台任务更新
-        float current_lux = g_lux;
-
-        // --- ADC原始值和电压的计算（为了显示，这里需要重新计算） ---
-        uint32_t sum = 0;
-        const int samples = 10; // 显示任务可以减少采样次数
-        for (int i = 0; i < samples; i++)
-        {
-            sum += adc1_get_raw(ADC_CHANNEL);
-            delay(1);
-        }
-        sum /= samples;
+/**
+ * @brief [绘制作业] 在屏幕上显示当前的ADC和光照强度信息
+ * @return 每100ms更新一次
+ */
+static uint32_t adcScreenStep()
+{
+    // 直接使用全局变量 g_lux，由后台任务更新
+    float current_lux = g_lux;
 
-        float voltage_v = 0;
-        if (cali_enable)
-        {
-            uint32_t voltage_mv = esp_adc_cal_raw_to_voltage(sum, &adc1_chars);
-            voltage_v = voltage_mv / 1000.0f;
-        }
-        else
-        {
-            voltage_v = (sum * 3.3) / 4095.0;
-        }
+    // --- ADC原始值和电压的计算（为了显示，这里需要重新计算） ---
+    uint32_t sum = 0;
+    const int samples = 10; // 显示任务可以减少采样次数
+    for (int i = 0; i < samples; i++)
+    {
+        sum += adc1_get_raw(ADC_CHANNEL);
+        delay(1);
+    }
+    sum /= samples;
 
-        // --- 使用Sprite进行无闪烁更新 ---
-        menuSprite.fillSprite(TFT_BLACK);
-        menuSprite.setTextSize(2);
-        menuSprite.setTextFont(1);
-        menuSprite.setTextColor(TFT_WHITE, TFT_BLACK);
-
-        // 显示光照强度
-        char luxStr[10];
-        dtostrf(current_lux, 4, 1, luxStr);
-        menuSprite.setCursor(20, 10);
-        menuSprite.print("LUX: "); menuSprite.print(luxStr);
-
-        // 显示电压和ADC原始值
-        char voltStr[10];
-        dtostrf(voltage_v, 4, 2, voltStr);
-        menuSprite.setCursor(20, 35);
-        menuSprite.print("VOL: "); menuSprite.print(voltStr);
-
-        menuSprite.setCursor(20, 60);
-        menuSprite.print("ADC: "); menuSprite.print(sum);
-
-        // 绘制光照强度进度条
-        float constrainedLux = constrain(current_lux, 0.0f, 1000.0f);
-        int barWidth = map((long) constrainedLux, 0L, 1000L, 0L, 200L); // 映射范围调整为0-1000
-        menuSprite.drawRect(20, 85, 202, 22, TFT_WHITE);
-        menuSprite.fillRect(21, 86, 200, 20, TFT_BLACK);
-        menuSprite.fillRect(21, 86, barWidth, 20, TFT_GREEN);
-
-        menuSprite.pushSprite(0, 130);
-
-        vTaskDelay(pdMS_TO_TICKS(100));
+    float voltage_v = 0;
+    if (cali_enable)
+    {
+        uint32_t voltage_mv = esp_adc_cal_raw_to_voltage(sum, &adc1_chars);
+        voltage_v = voltage_mv / 1000.0f;
     }
-    vTaskDelete(NULL);
+    else
+    {
+        voltage_v = (sum * 3.3) / 4095.0;
+    }
+
+    // --- 使用Sprite进行无闪烁更新 ---
+    menuSprite.fillSprite(TFT_BLACK);
+    menuSprite.setTextSize(2);
+    menuSprite.setTextFont(1);
+    menuSprite.setTextColor(TFT_WHITE, TFT_BLACK);
+
+    // 显示光照强度
+    char luxStr[10];
+    dtostrf(current_lux, 4, 1, luxStr);
+    menuSprite.setCursor(20, 10);
+    menuSprite.print("LUX: "); menuSprite.print(luxStr);
+
+    // 显示电压和ADC原始值
+    char voltStr[10];
+    dtostrf(voltage_v, 4, 2, voltStr);
+    menuSprite.setCursor(20, 35);
+    menuSprite.print("VOL: "); menuSprite.print(voltStr);
+
+    menuSprite.setCursor(20, 60);
+    menuSprite.print("ADC: "); menuSprite.print(sum);
+
+    // 绘制光照强度进度条
+    float constrainedLux = constrain(current_lux, 0.0f, 1000.0f);
+    int barWidth = map((long) constrainedLux, 0L, 1000L, 0L, 200L); // 映射范围调整为0-1000
+    menuSprite.drawRect(20, 85, 202, 22, TFT_WHITE);
+    menuSprite.fillRect(21, 86, 200, 20, TFT_BLACK);
+    menuSprite.fillRect(21, 86, barWidth, 20, TFT_GREEN);
+
+    Display_Present(0, 130);
+    return 100;
 }
 
+static const WorkerJob adcScreenJob = {"adc", adcScreenStart, adcScreenStep, NULL, NULL};
+
 
 /**
  * @brief ADC菜单的入口函数
- * @details 此函数负责启动ADC数据显示任务，并处理用户的退出操作。
+ * @details 此函数在绘制工作任务上启动ADC数据显示作业，并处理用户的退出操作。
  */
 void ADCMenu()
 {
-    stopADCDisplayTask = false;
     tft.fillScreen(TFT_BLACK);
+    Display_Invalidate(); // 屏幕已被直接清空，下一帧整屏推送
 
-    // 创建并启动ADC显示任务
-    xTaskCreatePinnedToCore(ADC_Display_Task, "ADC_Display", 4096, NULL, 1, NULL, 0);
+    Worker_Start(WORKER_RENDER, &adcScreenJob, 0);
 
     while (1)
     {
         if (exitSubMenu || g_alarm_is_ringing || readButton())
         {
             exitSubMenu = false;
-            stopADCDisplayTask = true;
-            vTaskDelay(pdMS_TO_TICKS(200)); // 等待任务结束
+            Worker_Stop(WORKER_RENDER); // 返回时作业已停止
             break;
         }
         vTaskDelay(pdMS_TO_TICKS(10));
@@ -7,12 +7,20 @@
 #include <EEPROM.h>         
 #include <freertos/task.h>  
 #include <pgmspace.h>       
+#include <esp_sntp.h>
+#include "Display.h"
+#include "Settings.h"
+#include "Power.h"
+#include "EventBus.h"
 
 // --- 宏定义 ---
 #define MAX_ALARMS 10           // 支持的最大闹钟数量
-#define EEPROM_START_ADDR 0     // EEPROM中存储闹钟数据的起始地址
-#define EEPROM_MAGIC_KEY 0xAD   // 用于验证EEPROM数据有效性的“魔术数字”
+#define EEPROM_START_ADDR 0     // 旧版固件在EEPROM中存储闹钟数据的起始地址 (仅用于导入)
+#define EEPROM_MAGIC_KEY 0xAD   // 旧版EEPROM数据有效性的“魔术数字”
+#define ALARMS_SCHEMA_VERSION 1 // 设置存储中闹钟记录的格式版本，AlarmSetting 布局改变时递增
 #define ALARMS_PER_PAGE 5       // 闹钟列表每页显示的数量
+#define ALARM_MAX_SLEEP_S 3600  // 调度任务单次最长等待(秒)，兜底未通知的时钟调整
+#define ALARM_SONG_GAP_MS 500   // 响铃时每首歌之间的间隔
 
 // --- 全局状态变量 ---
 // 闹钟是否正在响铃的全局标志，volatile确保在中断或多任务环境下被正确访问
@@ -25,11 +33,12 @@ enum EditMode { EDIT_HOUR, EDIT_MINUTE, EDIT_DAYS, EDIT_SAVE, EDIT_DELETE };
 // --- 模块内部静态变量 ---
 static AlarmSetting alarms[MAX_ALARMS]; // 存储所有闹钟设置的数组
 static int alarm_count = 0;             // 当前已设置的闹钟数量
-static int last_checked_day = -1;       // 上次检查闹钟触发是星期几，用于每日重置状态
+static time_t lastFireTime = 0;         // 上一次响铃的时刻，同一时刻不会重复响铃
+static volatile time_t nextFireTime = 0; // 调度任务算出的下一个响铃时刻，0 表示没有
 
 // --- FreeRTOS任务句柄 ---
-static TaskHandle_t alarmMusicTaskHandle = NULL; // 闹钟音乐播放任务的句柄
-static volatile bool stopAlarmMusic = false;     // 用于从外部停止音乐播放任务的标志
+static TaskHandle_t alarmTaskHandle = NULL;      // 闹钟调度任务的句柄
+static uint32_t alarmPlayback = 0;               // 响铃音乐在音频工作任务中的播放编号
 
 // --- UI状态变量 ---
 static int list_selected_index = 0;     // 在闹钟列表中当前选中的项
@@ -42,7 +51,6 @@ static void saveAlarms();
 static void Alarm_Delete(int index);
 static void editAlarm(int index);
 static void drawAlarmList();
-void Alarm_Loop_Check();
 
 
 // =====================================================================================
@@ -139,7 +147,7 @@ static void drawAlarmList()
             menuSprite.drawString("+ Add New Alarm", 15, y_pos);
         }
     }
-    menuSprite.pushSprite(0, 0); // 将绘制好的sprite内容推送到屏幕
+    Display_Present(); // 将绘制好的sprite内容推送到屏幕
 }
 
 /**
@@ -196,43 +204,45 @@ static void drawEditScreen(const AlarmSetting &alarm, EditMode mode, int day_cur
     menuSprite.drawRoundRect(125, save_box_y, 75, 30, 5, TFT_WHITE);
     menuSprite.drawString("DELETE", 163, save_box_y + 15);
 
-    menuSprite.pushSprite(0, 0); // 推送到屏幕
+    Display_Present(); // 推送到屏幕
 }
 
 // =====================================================================================
-//                                 后台逻辑 (EEPROM, 任务)
+//                                 后台逻辑 (设置存储, 任务)
 // =====================================================================================
 
 /**
- * @brief 将所有闹钟设置保存到EEPROM
+ * @brief 将所有闹钟设置保存到设置存储
  */
 static void saveAlarms()
 {
-    EEPROM.write(EEPROM_START_ADDR, EEPROM_MAGIC_KEY); // 写入魔术数字，表示数据有效
-    EEPROM.put(EEPROM_START_ADDR + 1, alarms);         // 写入整个闹钟数组
-    EEPROM.commit();                                   // 提交更改
+    Settings_Write(SETTINGS_KEY_ALARMS, ALARMS_SCHEMA_VERSION, alarms, sizeof(alarms));
+    Alarm_Reschedule(); // 所有编辑都经过这里，闹钟变了就重新计算响铃时刻
 }
 
 /**
- * @brief 从EEPROM加载闹钟设置
+ * @brief 从设置存储加载闹钟设置
+ * @details 设置存储中没有记录时，尝试导入旧版固件保存在EEPROM中的闹钟。
  */
 static void loadAlarms()
 {
-    // 检查魔术数字是否匹配
-    if (EEPROM.read(EEPROM_START_ADDR) == EEPROM_MAGIC_KEY)
+    uint8_t version = 0;
+    bool loaded = Settings_Read(SETTINGS_KEY_ALARMS, alarms, sizeof(alarms), &version) == sizeof(alarms) &&
+                  version == ALARMS_SCHEMA_VERSION;
+    if (!loaded && EEPROM.read(EEPROM_START_ADDR) == EEPROM_MAGIC_KEY)
     {
-        EEPROM.get(EEPROM_START_ADDR + 1, alarms); // 读取闹钟数组
-        // 重新计算有效的闹钟数量
-        alarm_count = 0;
-        for (int i = 0; i < MAX_ALARMS; ++i) if (alarms[i].hour != 255) alarm_count++;
+        EEPROM.get(EEPROM_START_ADDR + 1, alarms); // 导入旧版EEPROM中的闹钟数组
+        saveAlarms();
+        loaded = true;
     }
-    else
-    { // 如果魔术数字不匹配，说明是首次运行或数据损坏
+    if (!loaded)
+    { // 首次运行，或记录的格式无法识别
         memset(alarms, 0xFF, sizeof(alarms)); // 用无效值(255)填充数组
         for (int i = 0; i < MAX_ALARMS; ++i) alarms[i].enabled = false;
-        alarm_count = 0;
-        saveAlarms(); // 保存这个初始化的空状态
     }
+    // 重新计算有效的闹钟数量
+    alarm_count = 0;
+    for (int i = 0; i < MAX_ALARMS; ++i) if (alarms[i].hour != 255) alarm_count++;
 }
 
 /**
@@ -254,67 +264,21 @@ static void Alarm_Delete(int index)
     saveAlarms(); // 保存更改
 }
 
-/**
- * @brief [FreeRTOS Task] 闹钟响铃时循环播放音乐的任务
- * @param pvParameters 未使用
- */
-void Alarm_MusicLoop_Task(void *pvParameters)
-{
-    while (true)
-    {
-        // 循环播放音乐库中的所有歌曲
-        for (int i = 0; i < numSongs; i++)
-        {
-            if (stopAlarmMusic)
-            { // 检查停止标志
-                vTaskDelete(NULL); // 如果置位，则删除任务
-            }
-
-            Song currentSong;
-            memcpy_P(&currentSong, &songs[i], sizeof(Song)); // 从PROGMEM中复制歌曲数据
-
-            // 播放当前歌曲的每个音符
-            for (int j = 0; j < currentSong.length; j++)
-            {
-                if (stopAlarmMusic)
-                {
-                    noTone(BUZZER_PIN); // 立即停止声音
-                    vTaskDelete(NULL);
-                }
-                int note = pgm_read_word(&currentSong.melody[j]); // 读取音符频率
-                int duration = pgm_read_word(&currentSong.durations[j]); // 读取音符时长
-
-                tone(BUZZER_PIN, note, duration * 0.9); // 播放音符，留出10%的间隔
-                vTaskDelay(pdMS_TO_TICKS(duration)); // 等待音符时长
-            }
-            vTaskDelay(pdMS_TO_TICKS(500)); // 每首歌之间暂停500ms
-        }
-    }
-}
-
 /**
  * @brief 触发指定索引的闹钟
  * @param index 要触发的闹钟的索引
  */
 static void triggerAlarm(int index)
 {
-    alarms[index].triggered_today = true; // 标记为今天已触发
-    saveAlarms();
     Serial.printf("ALARM %d TRIGGERED! PLAYING MUSIC...\n", index);
+    Power_NoteActivity(POWER_WAKE_ALARM); // 熄屏时点亮屏幕
 
-    // 如果已有音乐任务在运行，先删除它
-    if (alarmMusicTaskHandle != NULL)
-    {
-        vTaskDelete(alarmMusicTaskHandle);
-        alarmMusicTaskHandle = NULL;
-    }
-
+    g_alarm_is_ringing = true; // 设置全局响铃标志 (先于退出标志，音乐播放界面据此就地显示响铃界面而不是退出)
     exitSubMenu = true;       // 设置全局退出子菜单标志，让当前活动的功能退出
-    g_alarm_is_ringing = true; // 设置全局响铃标志
-    stopAlarmMusic = false;   // 重置音乐停止标志
 
-    // 创建新的音乐播放任务
-    xTaskCreatePinnedToCore(Alarm_MusicLoop_Task, "AlarmMusicLoopTask", 8192, NULL, 1, &alarmMusicTaskHandle, 0);
+    // 从第一首开始依次循环播放音乐库，在闹钟声部上抢占其他声音，停止后被抢占的音乐从原处继续
+    alarmPlayback = Buzzer_Play(0, LIST_LOOP, VOICE_ALARM, ALARM_SONG_GAP_MS);
+    EventBus_Publish(EVENT_ALARM_RING, index); // 界面循环立即醒来显示响铃画面
 }
 
 /**
@@ -323,14 +287,10 @@ static void triggerAlarm(int index)
  */
 void Alarm_StopMusic()
 {
-    if (alarmMusicTaskHandle != NULL)
-    {
-        stopAlarmMusic = true; // 设置停止标志
-        vTaskDelay(pdMS_TO_TICKS(50)); // 等待任务自行删除
-        alarmMusicTaskHandle = NULL;
-    }
-    noTone(BUZZER_PIN); // 确保声音立即停止
+    Buzzer_Stop(alarmPlayback); // 返回时已静音
+    alarmPlayback = 0;
     g_alarm_is_ringing = false; // 重置全局响铃标志
+    EventBus_Publish(EVENT_ALARM_STOP);
     Serial.println("Alarm music stopped by user.");
     // 恢复菜单的默认字体，避免UI混乱
     menuSprite.setTextFont(1);
@@ -338,69 +298,140 @@ void Alarm_StopMusic()
 }
 
 /**
- * @brief 初始化闹钟系统。
- * @details 此函数从EEPROM中加载之前保存的闹钟设置。
- *          同时，它会创建一个后台FreeRTOS任务，用于周期性地检查是否有闹钟需要触发。
+ * @brief 计算一个闹钟在 after 之后的下一次响铃时刻
+ * @details 逐日构造当天的本地时间 hour:minute 交给 mktime 换算，tm_isdst 设为 -1
+ *          让C库自己判断当天是否夏令时，跨越夏令时切换的日子也落在正确的墙上时间。
+ * @param alarm 闹钟设置。
+ * @param after 只返回严格晚于此时刻的响铃时间。
+ * @return 响铃时刻；闹钟未启用或没有选择任何星期时返回 0。
  */
-void Alarm_Init()
+static time_t nextFireOf(const AlarmSetting &alarm, time_t after)
 {
-    loadAlarms(); // 从EEPROM加载闹钟
-    last_checked_day = -1; // 重置上次检查日期
+    if (!alarm.enabled || alarm.hour > 23 || alarm.minute > 59 || (alarm.days_of_week & 0x7F) == 0) return 0;
 
-    void Alarm_Check_Task(void *pvParameters); // 前向声明检查任务
-    // 创建一个后台任务，用于周期性检查闹钟
-    xTaskCreate(Alarm_Check_Task, "Alarm Check Task", 2048, NULL, 5, NULL);
+    struct tm base;
+    localtime_r(&after, &base);
+    // 最多看8天：今天的时刻已过且只选了今天的星期时，下一次在7天后
+    for (int day = 0; day <= 7; day++)
+    {
+        struct tm t = base;
+        t.tm_mday += day;
+        t.tm_hour = alarm.hour;
+        t.tm_min = alarm.minute;
+        t.tm_sec = 0;
+        t.tm_isdst = -1;
+        time_t fire = mktime(&t); // 同时规范化日期，tm_wday 变为那一天的星期
+        if (fire > after && (alarm.days_of_week & (1 << t.tm_wday))) return fire;
+    }
+    return 0;
 }
 
 /**
- * @brief [FreeRTOS Task] 周期性检查闹钟的任务
- * @param pvParameters 未使用
+ * @brief 在所有闹钟中找出最早的响铃时刻
+ * @param after 只考虑严格晚于此时刻的响铃。
+ * @param[out] index 最早响铃的闹钟索引。
+ * @return 最早的响铃时刻，没有可响的闹钟时返回 0。
  */
-void Alarm_Check_Task(void *pvParameters)
+static time_t findNextFire(time_t after, int *index)
 {
-    for (;;)
+    time_t best = 0;
+    for (int i = 0; i < alarm_count; ++i)
     {
-        Alarm_Loop_Check(); // 调用核心检查逻辑
-        vTaskDelay(pdMS_TO_TICKS(1000)); // 每秒检查一次
+        time_t fire = nextFireOf(alarms[i], after);
+        if (fire && (best == 0 || fire < best))
+        {
+            best = fire;
+            *index = i;
+        }
     }
+    return best;
 }
 
 /**
- * @brief 周期性检查闹钟触发。
- * @details 此函数应被一个定时任务反复调用。它会检查当前时间是否与任何已启用的
- *          闹钟匹配。如果匹配，并且当天尚未触发过，它将调用 `triggerAlarm` 函数。
+ * @brief SNTP 校时回调，系统时间被调整后重新计算响铃时刻
  */
-void Alarm_Loop_Check()
+static void onTimeSynced(struct timeval *tv)
 {
-    extern struct tm timeinfo;
-    if (timeinfo.tm_year < 100) return; // 如果时间未同步，则不检查
+    Alarm_Reschedule();
+}
 
-    int current_day = timeinfo.tm_wday;
-    // 如果日期变化，重置所有闹钟的“今日已触发”标志
-    if (last_checked_day != current_day)
+/**
+ * @brief [FreeRTOS Task] 闹钟调度任务
+ * @details 算出最早的响铃时刻后阻塞在任务通知上直到那一刻，中途只有编辑闹钟或
+ *          校时会唤醒它重新计算。醒来后按当前时间判断是否到点，没到就继续等剩下的时间。
+ *          每次最多等 ALARM_MAX_SLEEP_S，防止未经通知的时钟调整让闹钟错过太久。
+ * @param pvParameters 未使用
+ */
+static void Alarm_Check_Task(void *pvParameters)
+{
+    for (;;)
     {
-        for (int i = 0; i < alarm_count; ++i) { alarms[i].triggered_today = false; }
-        last_checked_day = current_day;
-        saveAlarms();
-    }
+        time_t now = time(NULL);
+        struct tm local;
+        localtime_r(&now, &local);
+        if (local.tm_year < 100)
+        { // 时间未同步，等校时回调通知
+            nextFireTime = 0;
+            ulTaskNotifyTake(pdTRUE, (TickType_t)ALARM_MAX_SLEEP_S * configTICK_RATE_HZ);
+            continue;
+        }
 
-    // 遍历所有闹钟
-    for (int i = 0; i < alarm_count; ++i)
-    {
-        if (g_alarm_is_ringing) break; // 如果已有闹钟在响，则不触发新的
-        // 检查闹钟是否启用、今天尚未触发
-        if (alarms[i].enabled && !alarms[i].triggered_today)
+        // 时钟被向后拨了很多时，上次响铃时刻已经没有意义
+        if (lastFireTime > now + 60) lastFireTime = 0;
+        // 从当前这一分钟开始找，刚设好的本分钟闹钟也会响，已经响过的不会重复
+        time_t after = now - local.tm_sec - 1;
+        if (lastFireTime > after) after = lastFireTime;
+
+        int index = -1;
+        time_t fire = findNextFire(after, &index);
+        nextFireTime = fire;
+        if (fire == 0)
+        { // 没有启用的闹钟，等到有编辑为止
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        if (fire > now)
         {
-            bool day_match = alarms[i].days_of_week & (1 << current_day); // 检查星期是否匹配
-            // 检查时和分是否匹配
-            if (day_match && alarms[i].hour == timeinfo.tm_hour && alarms[i].minute == timeinfo.tm_min)
-            {
-                triggerAlarm(i); // 触发闹钟
-            }
+            time_t wait = fire - now;
+            if (wait > ALARM_MAX_SLEEP_S) wait = ALARM_MAX_SLEEP_S;
+            ulTaskNotifyTake(pdTRUE, (TickType_t)wait * configTICK_RATE_HZ);
+            continue; // 不论超时还是被通知，都按新的当前时间重新判断
         }
+
+        lastFireTime = fire;
+        if (!g_alarm_is_ringing) triggerAlarm(index); // 已有闹钟在响时不打断它
     }
 }
 
+/**
+ * @brief 初始化闹钟系统。
+ * @details 此函数从设置存储中加载之前保存的闹钟设置，注册校时回调，
+ *          并创建在下一个响铃时刻醒来的调度任务。
+ */
+void Alarm_Init()
+{
+    loadAlarms(); // 从设置存储加载闹钟
+    sntp_set_time_sync_notification_cb(onTimeSynced);
+    xTaskCreate(Alarm_Check_Task, "Alarm Check Task", 2048, NULL, 5, &alarmTaskHandle);
+}
+
+/**
+ * @brief 让调度任务重新计算下一个响铃时刻。
+ */
+void Alarm_Reschedule()
+{
+    if (alarmTaskHandle != NULL) xTaskNotifyGive(alarmTaskHandle);
+}
+
+/**
+ * @brief 获取下一个响铃时刻。
+ */
+time_t Alarm_GetNextFireTime()
+{
+    return nextFireTime;
+}
+
 // =====================================================================================
 //                                     UI交互逻辑
 // =====================================================================================
@@ -431,7 +462,7 @@ void Alarm_ShowRingingScreen()
     {
         if (readButton())
         { // 检测按钮点击
-            tone(BUZZER_PIN, 1500, 100); // 提示音
+            Buzzer_Tone(1500, 100); // 提示音
             Alarm_StopMusic(); // 停止闹钟
         }
 
@@ -453,7 +484,7 @@ void Alarm_ShowRingingScreen()
                 strftime(time_buf, sizeof(time_buf), "%H:%M:%S", &timeinfo);
                 menuSprite.drawString(time_buf, 120, 90);
             }
-            menuSprite.pushSprite(0, 0);
+            Display_Present();
         }
 
         vTaskDelay(pdMS_TO_TICKS(50));
@@ -492,7 +523,7 @@ static void editAlarm(int index)
         int encoder_value = readEncoder(); // 读取编码器旋转
         if (encoder_value != 0)
         {
-            tone(BUZZER_PIN, 1000, 20); // 旋转提示音
+            Buzzer_Tone(1000, 20); // 旋转提示音
             switch (edit_mode)
             {
             case EDIT_HOUR: temp_alarm.hour = (temp_alarm.hour + encoder_value + 24) % 24; break;
@@ -510,7 +541,7 @@ static void editAlarm(int index)
 
         if (readButton())
         { // 读取按钮短按
-            tone(BUZZER_PIN, 2000, 50);
+            Buzzer_Tone(2000, 50);
             if (edit_mode == EDIT_DAYS)
             { // 在星期编辑模式下，单击是选中/取消选中
                 temp_alarm.days_of_week ^= (1 << day_cursor);
@@ -595,7 +626,7 @@ void AlarmMenu()
             }
 
             drawAlarmList();
-            tone(BUZZER_PIN, 1000 + 50 * list_selected_index, 20);
+            Buzzer_Tone(1000 + 50 * list_selected_index, 20);
         }
 
         if (readButton()) { click_count++; last_click_time = millis(); }
@@ -605,7 +636,7 @@ void AlarmMenu()
         {
             if (click_count == 1)
             { // 单击
-                tone(BUZZER_PIN, 2000, 50);
+                Buzzer_Tone(2000, 50);
                 if (list_selected_index < alarm_count)
                 { // 对已存在的闹钟，单击是启用/禁用
                     alarms[list_selected_index].enabled = !alarms[list_selected_index].enabled;
@@ -622,7 +653,7 @@ void AlarmMenu()
 
         if (click_count >= 2)
         { // 双击
-            tone(BUZZER_PIN, 2500, 50);
+            Buzzer_Tone(2500, 50);
             if (list_selected_index < alarm_count)
             { // 对已存在的闹钟，双击是进入编辑界面
                 editAlarm(list_selected_index);
@@ -694,9 +725,8 @@ bool Alarm_Update(int index, uint8_t hour, uint8_t minute, uint8_t days_of_week,
     alarms[index].minute = minute;
     alarms[index].days_of_week = days_of_week;
     alarms[index].enabled = enabled;
-    alarms[index].triggered_today = false; // 重置触发状态
 
-    // 保存到EEPROM
+    // 保存到设置存储
     saveAlarms();
 
     return true;
@@ -2,6 +2,7 @@
 #define ALARM_H
 
 #include <stdint.h>
+#include <time.h>
 
 extern volatile bool g_alarm_is_ringing;
 
@@ -11,13 +12,13 @@ struct AlarmSetting
   uint8_t minute;
   uint8_t days_of_week;
   bool enabled;
-  bool triggered_today;
+  bool triggered_today; // 已不再使用，保留以兼容已保存的记录布局
 };
 
 /**
  * @brief 初始化闹钟系统。
- * @details 此函数从EEPROM中加载之前保存的闹钟设置。
- *          同时，它会创建一个后台FreeRTOS任务，用于周期性地检查是否有闹钟需要触发。
+ * @details 此函数从设置存储中加载之前保存的闹钟设置，并创建调度任务。
+ *          调度任务只在下一个响铃时刻、闹钟被编辑或 SNTP 校时后醒来。
  */
 void Alarm_Init();
 
@@ -29,11 +30,16 @@ void Alarm_Init();
 void AlarmMenu();
 
 /**
- * @brief 周期性检查闹钟触发。
- * @details 此函数应被一个定时任务反复调用。它会检查当前时间是否与任何已启用的
- *          闹钟匹配。如果匹配，并且当天尚未触发过，它将调用 `triggerAlarm` 函数。
+ * @brief 通知调度任务重新计算下一个响铃时刻。
+ * @details 保存闹钟时会自动调用；其他代码手动修改系统时间后也应调用。
  */
-void Alarm_Loop_Check();
+void Alarm_Reschedule();
+
+/**
+ * @brief 获取下一个响铃时刻。
+ * @return 下一个响铃的 time_t，时间未同步或没有启用的闹钟时返回 0。
+ */
+time_t Alarm_GetNextFireTime();
 
 /**
  * @brief 显示闹钟响铃界面。
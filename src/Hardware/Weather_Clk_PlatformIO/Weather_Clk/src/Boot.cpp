@@ -0,0 +1,183 @@
+// 包含所有必需的头文件
+#include "Boot.h"
+#include "Memory.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/event_groups.h>
+
+static const char *const statusNames[] = {"pending", "running", "ok", "failed", "skipped"};
+
+// --- 全局变量 ---
+static const BootStageDef *stageDefs = NULL;
+static int stageCount = 0;
+static BootStageInfo stageInfo[BOOT_MAX_STAGES];
+static EventGroupHandle_t doneEvents = NULL; // 每个阶段完成 (不论结果) 时置位
+static uint32_t allMask = 0;
+static uint32_t runMs = 0;        // Boot_Run 被调用的时刻
+static uint32_t readyMs = 0;      // 主菜单首次显示的时刻
+static uint32_t finishedMs = 0;   // 最后一个阶段完成的时刻
+static int remaining = 0;
+static portMUX_TYPE bootMux = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief 等待依赖完成后执行第 i 个阶段，记录结果并通知依赖它的阶段
+ */
+static void runStage(int i)
+{
+  const BootStageDef &def = stageDefs[i];
+
+  if (def.deps)
+  {
+    xEventGroupWaitBits(doneEvents, def.deps, pdFALSE, pdTRUE, portMAX_DELAY);
+  }
+  bool depsOk = true;
+  for (int d = 0; d < stageCount; d++)
+  {
+    if ((def.deps & BOOT_BIT(d)) && stageInfo[d].status != BOOT_OK) depsOk = false;
+  }
+
+  stageInfo[i].startMs = millis();
+  BootStatus result = BOOT_SKIPPED;
+  if (depsOk)
+  {
+    stageInfo[i].status = BOOT_RUNNING;
+    result = def.run() ? BOOT_OK : BOOT_FAILED;
+  }
+  stageInfo[i].durationMs = millis() - stageInfo[i].startMs;
+  stageInfo[i].status = result;
+  Serial.printf("[Boot] %-8s %-7s %lu ms\n", def.name, statusNames[result], (unsigned long)stageInfo[i].durationMs);
+
+  portENTER_CRITICAL(&bootMux);
+  bool last = --remaining == 0;
+  portEXIT_CRITICAL(&bootMux);
+  if (last)
+  {
+    finishedMs = millis();
+  }
+  xEventGroupSetBits(doneEvents, BOOT_BIT(i)); // 置位后依赖它的阶段开始执行
+  if (last)
+  {
+    Boot_Dump();
+  }
+}
+
+/**
+ * @brief [FreeRTOS Task] 执行一个启动阶段
+ * @param arg 阶段序号
+ */
+static void stageTask(void *arg)
+{
+  runStage((int)(intptr_t)arg);
+  vTaskDelete(NULL);
+}
+
+void Boot_Run(const BootStageDef *stages, int count)
+{
+  if (count > BOOT_MAX_STAGES)
+  {
+    count = BOOT_MAX_STAGES;
+  }
+  stageDefs = stages;
+  stageCount = count;
+  remaining = count;
+  allMask = BOOT_BIT(count) - 1;
+  runMs = millis();
+  doneEvents = xEventGroupCreate();
+  for (int i = 0; i < count; i++)
+  {
+    stageInfo[i] = {BOOT_PENDING, 0, 0};
+  }
+
+  for (int i = 0; i < count; i++)
+  {
+    if (xTaskCreate(stageTask, stages[i].name, stages[i].stack, (void *)(intptr_t)i, BOOT_STAGE_PRIO, NULL) != pdPASS)
+    {
+      // 建不了任务时在当前任务中执行，阶段表按依赖排序，前面的阶段已经在运行
+      Serial.printf("[Boot] %s: no memory for task, running inline\n", stages[i].name);
+      runStage(i);
+    }
+  }
+}
+
+uint32_t Boot_Wait(uint32_t mask, uint32_t timeoutMs)
+{
+  if (doneEvents == NULL)
+  {
+    return 0;
+  }
+  uint32_t done = xEventGroupGetBits(doneEvents) & allMask;
+  uint32_t pending = mask & allMask & ~done;
+  if (pending == 0)
+  {
+    return done;
+  }
+  return xEventGroupWaitBits(doneEvents, pending, pdFALSE, pdFALSE, pdMS_TO_TICKS(timeoutMs)) & allMask;
+}
+
+uint32_t Boot_GetDone()
+{
+  return doneEvents ? xEventGroupGetBits(doneEvents) & allMask : 0;
+}
+
+BootStageInfo Boot_GetStage(int index)
+{
+  BootStageInfo info = stageInfo[index];
+  if (info.status == BOOT_RUNNING)
+  {
+    info.durationMs = millis() - info.startMs;
+  }
+  return info;
+}
+
+const char *Boot_StatusName(BootStatus status)
+{
+  return statusNames[status];
+}
+
+void Boot_MarkReady()
+{
+  readyMs = millis();
+}
+
+void Boot_Dump()
+{
+  Serial.printf("[Boot] %d stages started at %lu ms\n", stageCount, (unsigned long)runMs);
+  Serial.println("[Boot] stage    status   start(ms)  time(ms)  deps");
+  for (int i = 0; i < stageCount; i++)
+  {
+    BootStageInfo s = Boot_GetStage(i);
+    Serial.printf("[Boot] %-8s %-7s %9lu %9lu  ", stageDefs[i].name, statusNames[s.status],
+                  (unsigned long)s.startMs, (unsigned long)s.durationMs);
+    bool first = true;
+    for (int d = 0; d < stageCount; d++)
+    {
+      if (!(stageDefs[i].deps & BOOT_BIT(d))) continue;
+      Serial.printf("%s%s", first ? "" : ",", stageDefs[d].name);
+      first = false;
+    }
+    Serial.println(first ? "-" : "");
+  }
+  if (readyMs)
+  {
+    Serial.printf("[Boot] menu ready at %lu ms\n", (unsigned long)readyMs);
+  }
+  if (finishedMs)
+  {
+    Serial.printf("[Boot] all stages done at %lu ms\n", (unsigned long)finishedMs);
+  }
+  else
+  {
+    Serial.printf("[Boot] %d stages still running\n", remaining);
+  }
+  Heap_Log("boot");
+}
+
+bool Boot_HandleCommand(const char *line)
+{
+  if (strncmp(line, "boot", 4) != 0)
+  {
+    return false;
+  }
+  Boot_Dump();
+  return true;
+}
@@ -0,0 +1,91 @@
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <Arduino.h>
+
+#define BOOT_MAX_STAGES   24 // FreeRTOS 事件组可用的位数，每个阶段占一位
+#define BOOT_STAGE_PRIO   1  // 阶段任务的优先级，与 setup()/loop() 所在的任务相同，计算量大的阶段与启动画面轮流执行
+
+#define BOOT_BIT(i) (1UL << (i)) // 阶段序号对应的依赖位
+
+/**
+ * @brief 启动阶段的状态。
+ */
+enum BootStatus
+{
+    BOOT_PENDING, ///< 等待依赖完成。
+    BOOT_RUNNING, ///< 正在执行。
+    BOOT_OK,      ///< 执行成功。
+    BOOT_FAILED,  ///< 执行失败，依赖它的阶段会被跳过。
+    BOOT_SKIPPED  ///< 有依赖失败或被跳过，没有执行。
+};
+
+/**
+ * @brief 一个启动阶段。
+ */
+struct BootStageDef
+{
+    const char *name;   ///< 阶段名，用于启动画面和报告。
+    bool (*run)();      ///< 初始化函数，返回是否成功。在独立的任务中运行，不能访问屏幕。
+    uint32_t deps;      ///< 依赖的阶段 (BOOT_BIT 的组合)，全部完成后才开始。
+    uint32_t stack;     ///< 阶段任务的栈大小 (字节)。
+};
+
+/**
+ * @brief 一个启动阶段的执行记录。
+ */
+struct BootStageInfo
+{
+    BootStatus status;   ///< 当前状态。
+    uint32_t startMs;    ///< 开始执行的时刻 (开机以来的毫秒数)。
+    uint32_t durationMs; ///< 执行耗时，执行中时为已用时间。
+};
+
+/**
+ * @brief 按依赖关系并行执行启动阶段。
+ * @details 每个阶段一个任务，等到依赖全部完成后执行，完成后任务自行删除。
+ *          没有依赖关系的阶段同时进行：等待外设或网络的阶段阻塞时，其他阶段继续执行。
+ *          所有阶段完成后在串口输出启动报告。
+ * @param stages 阶段表，须在整个启动过程中有效 (通常是静态数组)。
+ * @param count 阶段数，不超过 BOOT_MAX_STAGES。
+ */
+void Boot_Run(const BootStageDef *stages, int count);
+
+/**
+ * @brief 等待 mask 中尚未完成的任一阶段完成，或超时。
+ * @return 已完成 (成功、失败或跳过) 的阶段集合。
+ */
+uint32_t Boot_Wait(uint32_t mask, uint32_t timeoutMs);
+
+/**
+ * @brief 已完成的阶段集合。
+ */
+uint32_t Boot_GetDone();
+
+/**
+ * @brief 获取一个阶段的执行记录。
+ */
+BootStageInfo Boot_GetStage(int index);
+
+/**
+ * @brief 状态的显示名。
+ */
+const char *Boot_StatusName(BootStatus status);
+
+/**
+ * @brief 记录界面可用 (主菜单首次显示) 的时刻，写入启动报告。
+ */
+void Boot_MarkReady();
+
+/**
+ * @brief 在串口输出启动报告：每个阶段的开始时刻、耗时、结果和依赖，以及界面可用和全部完成的时刻。
+ */
+void Boot_Dump();
+
+/**
+ * @brief 处理串口命令 "boot"，输出启动报告。
+ * @return 是启动命令时返回 true。
+ */
+bool Boot_HandleCommand(const char *line);
+
+#endif // BOOT_H
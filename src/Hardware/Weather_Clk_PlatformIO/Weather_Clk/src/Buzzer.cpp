@@ -5,29 +5,101 @@
 #include <TFT_eSPI.h>
 #include <time.h>
 #include "LED.h"
+#include "NoteEvents.h"
 #include <math.h>
 #include "Menu.h"
 #include "MQTT.h"
 #include "weather.h"
 #include "Alarm.h"
 #include <freertos/task.h>
-
-// --- 任务句柄 ---
-TaskHandle_t buzzerTaskHandle = NULL; // FreeRTOS中用于控制蜂鸣器播放任务的句柄
-TaskHandle_t ledTaskHandle = NULL;    // FreeRTOS中用于控制LED动画任务的句柄
-static TaskHandle_t backgroundMusicTaskHandle = NULL; // 用于后台播放的独立任务句柄
+#include "Display.h"
+#include "Power.h"
+#include "Worker.h"
+#include "EventBus.h"
+#include <freertos/semphr.h>
+#include <esp_timer.h>
 
 // --- 播放状态 ---
-PlayMode currentPlayMode = LIST_LOOP; // 当前播放模式，默认为列表循环
-volatile bool stopBuzzerTask = false; // 停止蜂鸣器任务的标志，volatile确保多任务环境下的可见性
-volatile bool isPaused = false;       // 暂停状态的标志
-volatile bool stopLedTask = false;    // 停止LED任务的标志
-extern volatile bool g_force_exit_ui; // 引用在main.cpp中定义的全局UI退出标志
+PlayMode currentPlayMode = LIST_LOOP; // 播放界面选择的播放模式，默认为列表循环
+static uint32_t playerPlayback = 0;   // 播放界面启动的播放编号
+volatile bool isPaused = false;       // 播放界面的暂停状态
+
+// --- 混音器状态 ---
+// 每个声部一份播放状态，只由音频工作任务写入，其他任务通过 Buzzer_GetPosition 读取
+struct Voice
+{
+  uint32_t id;             // 正在播放的编号，0 表示空闲
+  bool isTone;             // 单音 (Buzzer_Tone)，不是歌曲
+  Song song;               // 当前歌曲 (从PROGMEM复制)
+  int songIndex;
+  int noteIndex;
+  PlayMode mode;
+  uint32_t gapMs;          // 两首歌之间的间隔
+  uint16_t frequency;      // 当前音符频率
+  uint16_t durationMs;     // 当前音符时长
+  TickType_t noteTick;     // 当前音符开始的时刻
+  TickType_t segmentEnd;   // 当前音符或两首歌间隔结束的时刻
+  bool inSegment;          // 正在发声，或处于两首歌之间的间隔
+  bool noteOn;             // 当前音符尚未结束
+  bool songEnded;          // 当前歌曲已播完
+  bool paused;
+};
+static Voice voices[VOICE_COUNT];
+static int soundingVoice = -1; // 占用蜂鸣器的声部，-1 表示静音
+
+// 发给混音作业的命令
+enum BuzzerCmdType
+{
+  BUZZER_CMD_PLAY,
+  BUZZER_CMD_TONE,
+  BUZZER_CMD_STOP,
+  BUZZER_CMD_PAUSE,
+  BUZZER_CMD_RESUME,
+  BUZZER_CMD_MODE
+};
+
+struct BuzzerCmd
+{
+  BuzzerCmdType type;
+  uint8_t voice;
+  uint32_t id;
+  int32_t arg;             // PLAY: 歌曲索引；TONE: 频率；STOP: 停止命令序号
+  uint32_t ms;             // PLAY: 两首歌的间隔；TONE: 时长
+  PlayMode mode;           // PLAY、MODE
+};
+static QueueHandle_t cmdQueue = NULL;
+static SemaphoreHandle_t stopDone = NULL;   // 每处理完一条停止命令给出一次
+static SemaphoreHandle_t stopLock = NULL;   // 同一时间只有一个调用者等待 stopDone
+static int32_t stopSeq = 0;                 // 最近发出的停止命令序号，在 stopLock 内递增
+static volatile int32_t stopDoneSeq = 0;    // 最近处理完的停止命令序号
+static uint32_t latestId[VOICE_COUNT];      // 各声部最近一次播放的编号，播完后清零
+static uint32_t nextId = 0;
+static portMUX_TYPE playbackMux = portMUX_INITIALIZER_UNLOCKED;
+
+// --- 混音器统计 ---
+static uint32_t mixerCommands = 0;   // 处理的命令数
+static uint32_t mixerDropped = 0;    // 被丢弃的单音 (有更高优先级的声音，或队列已满)
+static uint32_t mixerPreempts = 0;   // 发声的声部被更高优先级声部打断的次数
+static uint32_t mixerStepMaxUs = 0;  // 混音作业一步的最长耗时
+
+static const char *const voiceNames[VOICE_COUNT] = {"click", "music", "notify", "alarm"};
 
-// --- 用于UI更新的共享状态 ---
-static volatile int shared_song_index = 0;           // 当前播放歌曲在列表中的索引
-static volatile int shared_note_index = 0;           // 当前歌曲中正在播放的音符索引
-static volatile TickType_t current_note_start_tick = 0; // 当前音符开始播放的系统时间点（tick）
+// --- 播放界面状态 ---
+// 由播放界面根据收到的音符事件维护，播放任务不再写共享的volatile变量
+struct PlaybackView
+{
+  int songIndex;          // 当前播放歌曲在列表中的索引
+  int noteIndex;          // 当前歌曲中正在播放的音符索引
+  TickType_t noteTick;    // 当前音符开始播放的系统时间点（tick）
+  uint16_t frequency;     // 当前音符频率
+  uint16_t durationMs;    // 当前音符时长
+  bool noteOn;            // 当前是否有音符在发声
+};
+static PlaybackView playbackView = {0, 0, 0, 0, 0, false};
+static QueueHandle_t noteEventQueue = NULL; // 播放界面订阅音符事件的队列
+static QueueHandle_t songRequestQueue = NULL; // 播放界面订阅远程点歌的队列，收到即退出
+#define NOTE_EVENT_QUEUE_LEN 16
+#define BEAT_FLASH_MS        80 // 节拍闪光持续时间
 
 // --- 歌曲数据 ---
 // PROGMEM关键字将大型数据结构（如歌曲）存储在闪存中，以节省宝贵的RAM
@@ -156,18 +228,25 @@ static uint32_t calculateSongDuration_ms(int songIndex)
  */
 static uint32_t calculateElapsedTime_ms()
 {
-  if (shared_song_index < 0 || shared_song_index >= numSongs) return 0; // 边界检查
+  if (playbackView.songIndex < 0 || playbackView.songIndex >= numSongs) return 0; // 边界检查
   Song song;
-  memcpy_P(&song, &songs[shared_song_index], sizeof(Song));
+  memcpy_P(&song, &songs[playbackView.songIndex], sizeof(Song));
   uint32_t elapsed_ms = 0;
   // 累加已播放音符的总时长
-  for (int i = 0; i < shared_note_index; i++)
+  for (int i = 0; i < playbackView.noteIndex && i < song.length; i++)
   {
     elapsed_ms += pgm_read_word(song.durations + i);
   }
-  // 加上当前正在播放的音符所经过的时间
-  TickType_t current_note_elapsed_ticks = xTaskGetTickCount() - current_note_start_tick;
-  elapsed_ms += (current_note_elapsed_ticks * 1000) / configTICK_RATE_HZ; // 将ticks转换为毫秒
+  // 加上当前正在播放的音符所经过的时间（不超过该音符时长，暂停时进度条停住）
+  if (playbackView.noteOn)
+  {
+    uint32_t note_elapsed = pdTICKS_TO_MS(xTaskGetTickCount() - playbackView.noteTick);
+    elapsed_ms += min(note_elapsed, (uint32_t) playbackView.durationMs);
+  }
+  else
+  {
+    elapsed_ms += playbackView.durationMs;
+  }
   return elapsed_ms;
 }
 
@@ -215,7 +294,7 @@ void displaySongList(int selectedIndex)
     }
   }
   menuSprite.setTextDatum(TL_DATUM); // 恢复左上角对齐
-  menuSprite.pushSprite(0, 0); // 将sprite内容推送到屏幕
+  Display_Present(); // 将sprite内容推送到屏幕
 }
 
 /**
@@ -224,7 +303,9 @@ void displaySongList(int selectedIndex)
 void displayPlayingSong()
 {
   uint32_t elapsed_ms = calculateElapsedTime_ms(); // 获取已播放时间
-  uint32_t total_ms = calculateSongDuration_ms(shared_song_index); // 获取总时间
+  uint32_t total_ms = calculateSongDuration_ms(playbackView.songIndex); // 获取总时间
+  const int song_index = playbackView.songIndex;
+  const int note_index = playbackView.noteIndex;
 
   menuSprite.fillScreen(TFT_BLACK);
   menuSprite.setTextDatum(MC_DATUM);
@@ -232,7 +313,7 @@ void displayPlayingSong()
 
   // 显示歌曲名称
   menuSprite.setTextSize(2);
-  menuSprite.drawString(songs[shared_song_index].name, 120, 20);
+  menuSprite.drawString(songs[song_index].name, 120, 20);
 
   // 显示当前时间
   extern struct tm timeinfo;
@@ -255,6 +336,7 @@ void displayPlayingSong()
   case SINGLE_LOOP: mode_text = "Single Loop"; break;
   case LIST_LOOP:   mode_text = "List Loop"; break;
   case RANDOM_PLAY: mode_text = "Random"; break;
+  case PLAY_ONCE:   mode_text = "Play Once"; break;
   }
   menuSprite.setTextSize(1);
   menuSprite.drawString(mode_text, 120, 100);
@@ -262,7 +344,7 @@ void displayPlayingSong()
 
   // --- 时域歌曲可视化 ---
   Song current_song;
-  memcpy_P(&current_song, &songs[shared_song_index], sizeof(Song));
+  memcpy_P(&current_song, &songs[song_index], sizeof(Song));
 
   if (current_song.length > 0)
   {
@@ -296,7 +378,13 @@ void displayPlayingSong()
 
       if (bar_height > 0)
       {
-        uint16_t color = (i <= shared_note_index) ? TFT_CYAN : TFT_DARKGREY; // 已播放的为青色，未播放的为灰色
+        uint16_t color = (i <= note_index) ? TFT_CYAN : TFT_DARKGREY; // 已播放的为青色，未播放的为灰色
+        if (i == note_index && playbackView.noteOn) // 正在发声的音符按音高着色
+        {
+          uint8_t r, g, b;
+          LedEngine_HueToRGB(NoteEvents_PitchToHue(freq), &r, &g, &b);
+          color = tft.color565(r, g, b);
+        }
         int x_pos = graph_x + floor(i * step);
         menuSprite.fillRect(x_pos, graph_y_bottom - bar_height, bar_width, bar_height, color);
       }
@@ -316,149 +404,520 @@ void displayPlayingSong()
 
   // 显示当前音符信息
   int current_freq = 0, current_dur = 0;
-  if (!isPaused && shared_note_index < current_song.length)
+  if (!isPaused && playbackView.noteOn)
   {
-    current_freq = pgm_read_word(current_song.melody + shared_note_index);
-    current_dur = pgm_read_word(current_song.durations + shared_note_index);
+    current_freq = playbackView.frequency;
+    current_dur = playbackView.durationMs;
   }
   char note_info[30];
   snprintf(note_info, sizeof(note_info), "Note: %d Hz, %d ms", current_freq, current_dur);
   menuSprite.setTextSize(1);
   menuSprite.drawString(note_info, 120, 228);
 
-  menuSprite.pushSprite(0, 0);
+  // 节拍闪光：音符刚开始时按音高色相给屏幕描边
+  uint32_t since_note = pdTICKS_TO_MS(xTaskGetTickCount() - playbackView.noteTick);
+  if (playbackView.noteOn && playbackView.frequency > 0 && since_note < BEAT_FLASH_MS)
+  {
+    uint8_t r, g, b;
+    LedEngine_HueToRGB(NoteEvents_PitchToHue(playbackView.frequency), &r, &g, &b);
+    uint16_t flash_color = tft.color565(r, g, b);
+    menuSprite.drawRect(0, 0, 240, 240, flash_color);
+    menuSprite.drawRect(1, 1, 238, 238, flash_color);
+    menuSprite.drawRect(2, 2, 236, 236, flash_color);
+  }
+
+  Display_Present();
+}
+
+/**
+ * @brief 载入第 songIndex 首歌，第一个音符发声时再通知订阅者
+ */
+static void loadSong(Voice &voice, int songIndex)
+{
+  voice.songIndex = songIndex;
+  memcpy_P(&voice.song, &songs[songIndex], sizeof(Song));
+  voice.noteIndex = 0;
+  voice.songEnded = false;
+}
+
+/**
+ * @brief 根据播放模式选出下一首歌
+ */
+static int nextSongIndex(const Voice &voice, int songIdx)
+{
+  if (voice.mode == LIST_LOOP) return (songIdx + 1) % numSongs; // 列表循环
+  if (voice.mode == RANDOM_PLAY && numSongs > 1) // 随机播放，确保下一首和当前不同
+  {
+    int currentSong = songIdx;
+    do { songIdx = random(numSongs); } while (songIdx == currentSong);
+  }
+  return songIdx; // 单曲循环
+}
+
+/**
+ * @brief 发布音符事件。只有音乐声部驱动播放界面和灯效，闹钟、报时和提示音不发布
+ */
+static void publishNote(int v, NoteEventType type, int noteIndex, int frequency, int durationMs)
+{
+  if (v != VOICE_MUSIC)
+  {
+    return;
+  }
+  NoteEvents_Publish(type, voices[v].id, voices[v].songIndex, noteIndex, frequency, durationMs);
+}
+
+/**
+ * @brief 打断声部当前的音符或间隔，音符序号不变，再次轮到它时从这个音符重新开始
+ */
+static void cutVoice(int v)
+{
+  Voice &voice = voices[v];
+  if (v == soundingVoice)
+  {
+    noTone(BUZZER_PIN);
+  }
+  if (voice.noteOn && !voice.isTone)
+  {
+    publishNote(v, NOTE_EVENT_NOTE_OFF, voice.noteIndex, voice.frequency, voice.durationMs);
+  }
+  voice.noteOn = false;
+  voice.inSegment = false;
+}
+
+/**
+ * @brief 声部播放结束，释放它的编号
+ */
+static void endVoice(int v)
+{
+  Voice &voice = voices[v];
+  cutVoice(v);
+  portENTER_CRITICAL(&playbackMux);
+  if (latestId[v] == voice.id) latestId[v] = 0;
+  portEXIT_CRITICAL(&playbackMux);
+  voice.id = 0;
+  voice.paused = false;
+  voice.frequency = 0;
+  voice.durationMs = 0;
+}
+
+/**
+ * @brief 编号为 id 的播放所在的声部，已结束或已被替换时返回 -1
+ */
+static int findVoice(uint32_t id)
+{
+  for (int v = 0; v < VOICE_COUNT; v++)
+  {
+    if (id != 0 && voices[v].id == id) return v;
+  }
+  return -1;
 }
 
 /**
- * @brief NeoPixel LED彩虹效果的辅助函数
- * @param WheelPos 色轮上的位置 (0-255)
- * @return 返回计算出的32位颜色值
+ * @brief 优先级最高的、未暂停的声部
  */
-uint32_t Wheel(byte WheelPos)
+static int topVoice()
 {
-  WheelPos = 255 - WheelPos;
-  if (WheelPos < 85) return strip.Color(255 - WheelPos * 3, 0, WheelPos * 3);
-  if (WheelPos < 170) { WheelPos -= 85; return strip.Color(0, WheelPos * 3, 255 - WheelPos * 3); }
-  WheelPos -= 170;
-  return strip.Color(WheelPos * 3, 255 - WheelPos * 3, 0);
+  for (int v = VOICE_COUNT - 1; v >= 0; v--)
+  {
+    if (voices[v].id != 0 && !voices[v].paused) return v;
+  }
+  return -1;
 }
 
 /**
- * @brief [FreeRTOS Task] LED彩虹灯效任务
- * @param pvParameters 未使用
+ * @brief [音频作业] 执行一条命令
  */
-void Led_Rainbow_Task(void *pvParameters)
+static void handleCmd(const BuzzerCmd &cmd)
 {
-  for (uint16_t j = 0; ; j++)
+  switch (cmd.type)
+  {
+  case BUZZER_CMD_TONE:
+    if (topVoice() > cmd.voice)
+    { // 更高优先级的声音正在播放，单音不排队
+      mixerDropped++;
+      break;
+    }
+    // 单音被接受时才记为声部最近的播放，被丢弃的单音不影响同一声部上歌曲的编号
+    portENTER_CRITICAL(&playbackMux);
+    latestId[cmd.voice] = cmd.id;
+    portEXIT_CRITICAL(&playbackMux);
+    // fall through
+  case BUZZER_CMD_PLAY:
   {
-    if (stopLedTask) // 检查停止标志
+    Voice &voice = voices[cmd.voice];
+    if (voice.id != 0)
     {
-      strip.clear(); // 清除灯带
-      strip.show();
-      vTaskDelete(NULL); // 删除任务
+      cutVoice(cmd.voice); // 替换同一声部上的播放
     }
-    for (uint16_t i = 0; i < strip.numPixels(); i++)
+    voice.id = cmd.id;
+    voice.isTone = cmd.type == BUZZER_CMD_TONE;
+    voice.mode = cmd.mode;
+    voice.paused = false;
+    if (voice.isTone)
     {
-      strip.setPixelColor(i, Wheel(((i * 256 / strip.numPixels()) + j) & 255));
+      voice.songIndex = -1;
+      voice.song.length = 1;
+      voice.noteIndex = 0;
+      voice.songEnded = false;
+      voice.frequency = cmd.arg;
+      voice.durationMs = cmd.ms;
     }
-    strip.show();
-    vTaskDelay(pdMS_TO_TICKS(20)); // 任务延时，控制动画速度
+    else
+    {
+      voice.gapMs = cmd.ms;
+      loadSong(voice, cmd.arg);
+    }
+    break;
+  }
+  case BUZZER_CMD_STOP:
+  {
+    int v = findVoice(cmd.id);
+    if (v >= 0) endVoice(v);
+    stopDoneSeq = cmd.arg;
+    xSemaphoreGive(stopDone);
+    break;
+  }
+  case BUZZER_CMD_PAUSE:
+  case BUZZER_CMD_RESUME:
+  {
+    int v = findVoice(cmd.id);
+    if (v < 0) break;
+    if (cmd.type == BUZZER_CMD_PAUSE && !voices[v].paused)
+    {
+      cutVoice(v); // 暂停时立即静音，继续时从被打断的音符开始
+    }
+    voices[v].paused = cmd.type == BUZZER_CMD_PAUSE;
+    break;
+  }
+  case BUZZER_CMD_MODE:
+  {
+    int v = findVoice(cmd.id);
+    if (v >= 0) voices[v].mode = cmd.mode;
+    break;
+  }
   }
 }
 
 /**
- * @brief [FreeRTOS Task] 蜂鸣器音乐播放任务
- * @param pvParameters 指向要播放的歌曲索引的指针
+ * @brief [音频作业] 推进发声的声部：当前音符未结束时只返回剩余时间，否则开始下一个音符
+ * @return 到下一步的毫秒数，0 表示这个声部已播完，需要重新选择声部
  */
-void Buzzer_Task(void *pvParameters)
+static uint32_t advanceVoice(int v)
 {
-  int songIdx = *(int *) pvParameters;
-  for (;;) // 无限循环以支持不同的播放模式
-  {
-    shared_song_index = songIdx; // 更新全局共享的歌曲索引
-    Song song;
-    memcpy_P(&song, &songs[songIdx], sizeof(Song));
+  Voice &voice = voices[v];
+  TickType_t now = xTaskGetTickCount();
+  TickType_t start = now;
 
-    // 遍历并播放当前歌曲的每个音符
-    for (int i = 0; i < song.length; i++)
+  if (voice.inSegment)
+  {
+    int32_t left = (int32_t)(voice.segmentEnd - now);
+    if (left > 0)
     {
-      shared_note_index = i;
-      current_note_start_tick = xTaskGetTickCount();
-
-      if (stopBuzzerTask) { noTone(BUZZER_PIN); vTaskDelete(NULL); } // 检查停止标志
+      return pdTICKS_TO_MS(left); // 被命令唤醒，当前音符还没结束
+    }
+    // 接着上一段的结束时刻开始，每一步的延迟不会累积成节奏漂移
+    start = voice.segmentEnd;
+    voice.inSegment = false;
+    if (voice.noteOn)
+    {
+      if (!voice.isTone)
+      {
+        publishNote(v, NOTE_EVENT_NOTE_OFF, voice.noteIndex, voice.frequency, voice.durationMs);
+      }
+      voice.noteOn = false;
+      voice.noteIndex++;
+    }
+  }
 
-      while (isPaused) // 如果暂停，则在此循环等待
+  if (voice.noteIndex >= voice.song.length)
+  {
+    if (voice.isTone)
+    {
+      endVoice(v);
+      return 0;
+    }
+    if (!voice.songEnded)
+    {
+      voice.songEnded = true;
+      voice.frequency = 0;
+      voice.durationMs = 0;
+      publishNote(v, NOTE_EVENT_SONG_END, voice.song.length, 0, 0);
+      if (voice.mode == PLAY_ONCE)
       {
-        noTone(BUZZER_PIN);
-        current_note_start_tick = xTaskGetTickCount(); // 重置音符开始时间，避免进度条跳跃
-        vTaskDelay(pdMS_TO_TICKS(50));
+        endVoice(v);
+        return 0;
       }
+      voice.segmentEnd = start + pdMS_TO_TICKS(voice.gapMs);
+      voice.inSegment = true;
+      return voice.gapMs > 0 ? voice.gapMs : 1;
+    }
+    loadSong(voice, nextSongIndex(voice, voice.songIndex));
+  }
 
-      int note = pgm_read_word(song.melody + i);
-      int duration = pgm_read_word(song.durations + i);
-      if (note > 0) tone(BUZZER_PIN, note, duration); // 播放音符
-      vTaskDelay(pdMS_TO_TICKS(duration)); // 等待音符时长
+  int note = voice.frequency;
+  int duration = voice.durationMs;
+  if (!voice.isTone)
+  {
+    if (voice.noteIndex == 0)
+    {
+      publishNote(v, NOTE_EVENT_SONG_START, 0, 0, 0);
     }
+    note = pgm_read_word(voice.song.melody + voice.noteIndex);
+    duration = pgm_read_word(voice.song.durations + voice.noteIndex);
+  }
+  if ((int32_t)(now - start) > (int32_t)pdMS_TO_TICKS(duration))
+  {
+    start = now; // 落后超过一个音符 (如刚从抢占中恢复)，不补跑
+  }
+  voice.frequency = note;
+  voice.durationMs = duration;
+  voice.noteTick = start;
+  voice.segmentEnd = start + pdMS_TO_TICKS(duration);
+  voice.inSegment = true;
+  voice.noteOn = true;
+  if (!voice.isTone)
+  {
+    publishNote(v, NOTE_EVENT_NOTE_ON, voice.noteIndex, note, duration); // 与发声同一时刻通知灯效和界面
+  }
+  if (note > 0)
+  {
+    Power_LockFor(POWER_LOCK_AUDIO, duration + POWER_AUDIO_HOLD_MS); // 播放期间 APB 不降频
+    tone(BUZZER_PIN, note, duration); // 播放音符
+  }
+  int32_t left = (int32_t)(voice.segmentEnd - now);
+  return left > 0 ? pdTICKS_TO_MS(left) : 1;
+}
+
+/**
+ * @brief [音频作业] 开始时所有声部空闲
+ */
+static void mixerStart(int arg)
+{
+  memset(voices, 0, sizeof(voices));
+  soundingVoice = -1;
+}
 
-    vTaskDelay(pdMS_TO_TICKS(2000)); // 歌曲结束后暂停2秒
+/**
+ * @brief [音频作业] 执行队列中的命令，再让优先级最高的声部发声
+ * @return 到当前音符结束的时间；所有声部空闲时返回 WORKER_IDLE，等下一条命令
+ */
+static uint32_t mixerStep()
+{
+  int64_t startUs = esp_timer_get_time();
+
+  BuzzerCmd cmd;
+  while (xQueueReceive(cmdQueue, &cmd, 0) == pdTRUE)
+  {
+    handleCmd(cmd);
+    mixerCommands++;
+  }
 
-    // 根据播放模式决定下一首歌曲
-    if (currentPlayMode == SINGLE_LOOP) {} // 单曲循环，不做任何事
-    else if (currentPlayMode == LIST_LOOP) songIdx = (songIdx + 1) % numSongs; // 列表循环
-    else if (currentPlayMode == RANDOM_PLAY) // 随机播放
+  uint32_t wait = WORKER_IDLE;
+  // 一个声部播完后立即轮到下一个声部，重选次数不超过声部数
+  for (int i = 0; i <= VOICE_COUNT; i++)
+  {
+    int top = topVoice();
+    if (top != soundingVoice)
     {
-      if (numSongs > 1)
-      {
-        int currentSong = songIdx;
-        do { songIdx = random(numSongs); } while (songIdx == currentSong); // 确保下一首和当前不同
+      if (soundingVoice >= 0 && voices[soundingVoice].id != 0 && !voices[soundingVoice].paused)
+      { // 被更高优先级的声部抢占：乐曲停在当前音符，单音直接丢弃
+        mixerPreempts++;
+        if (voices[soundingVoice].isTone) endVoice(soundingVoice);
+        else cutVoice(soundingVoice);
       }
+      soundingVoice = top;
+    }
+    if (top < 0)
+    {
+      wait = WORKER_IDLE;
+      break;
     }
+    wait = advanceVoice(top);
+    if (wait != 0) break;
   }
+
+  uint32_t us = (uint32_t)(esp_timer_get_time() - startUs);
+  if (us > mixerStepMaxUs) mixerStepMaxUs = us;
+  return wait;
 }
 
 /**
- * @brief [FreeRTOS Task] 用于播放背景音乐（如开机音乐、提示音）的简化任务
- * @param pvParameters 指向要播放的歌曲索引的指针
+ * @brief [音频作业] 被替换时静音 (混音作业常驻，正常不会发生)
  */
-void Buzzer_PlayMusic_Task(void *pvParameters)
+static void mixerStop()
 {
-  int songIndex = *(int *) pvParameters;
-  Song song;
-  memcpy_P(&song, &songs[songIndex], sizeof(Song));
+  noTone(BUZZER_PIN);
+  soundingVoice = -1;
+}
 
-  for (int i = 0; i < song.length; i++)
+static const WorkerJob mixerJob = {"mixer", mixerStart, mixerStep, NULL, mixerStop};
+
+/**
+ * @brief 分配一个播放编号
+ * @param record 是否立即记为声部最近一次的播放 (歌曲)；单音等混音作业接受后再记
+ */
+static uint32_t newPlayback(BuzzerVoice voice, bool record)
+{
+  portENTER_CRITICAL(&playbackMux);
+  uint32_t id = ++nextId;
+  if (id == 0) id = ++nextId;
+  if (record) latestId[voice] = id;
+  portEXIT_CRITICAL(&playbackMux);
+  return id;
+}
+
+/**
+ * @brief 把命令交给混音作业
+ * @param wait 队列已满时最长等待的tick数
+ */
+static bool sendCmd(const BuzzerCmd &cmd, TickType_t wait)
+{
+  if (xQueueSend(cmdQueue, &cmd, wait) != pdTRUE)
+  {
+    return false;
+  }
+  Worker_Wake(WORKER_AUDIO);
+  return true;
+}
+
+uint32_t Buzzer_Play(int songIndex, PlayMode mode, BuzzerVoice voice, uint32_t gapMs)
+{
+  if (songIndex < 0 || songIndex >= numSongs || cmdQueue == NULL) return 0;
+  uint32_t id = newPlayback(voice, true);
+  BuzzerCmd cmd = {BUZZER_CMD_PLAY, (uint8_t)voice, id, songIndex, gapMs, mode};
+  sendCmd(cmd, portMAX_DELAY);
+  return id;
+}
+
+void Buzzer_Tone(uint16_t frequency, uint16_t durationMs, BuzzerVoice voice)
+{
+  if (cmdQueue == NULL) return;
+  BuzzerCmd cmd = {BUZZER_CMD_TONE, (uint8_t)voice, newPlayback(voice, false), frequency, durationMs, PLAY_ONCE};
+  if (!sendCmd(cmd, 0))
+  {
+    mixerDropped++;
+  }
+}
+
+void Buzzer_Stop(uint32_t id)
+{
+  if (!Buzzer_IsPlaying(id)) return;
+  xSemaphoreTake(stopLock, portMAX_DELAY);
+  BuzzerCmd cmd = {BUZZER_CMD_STOP, 0, id, ++stopSeq, 0, PLAY_ONCE};
+  sendCmd(cmd, portMAX_DELAY);
+  // 之前超时的停止命令完成时也会给出信号，按序号丢弃，直到本条命令处理完
+  TickType_t start = xTaskGetTickCount();
+  TickType_t timeout = pdMS_TO_TICKS(WORKER_STOP_TIMEOUT_MS);
+  bool done = false;
+  for (;;)
+  {
+    TickType_t elapsed = xTaskGetTickCount() - start;
+    if (elapsed >= timeout || xSemaphoreTake(stopDone, timeout - elapsed) != pdTRUE)
+    {
+      break;
+    }
+    if (stopDoneSeq == cmd.arg)
+    {
+      done = true;
+      break;
+    }
+  }
+  xSemaphoreGive(stopLock);
+  if (!done)
   {
-    if (stopBuzzerTask) { noTone(BUZZER_PIN); vTaskDelete(NULL); return; }
+    Serial.println("[Audio] stop timed out");
+  }
+}
+
+void Buzzer_Pause(uint32_t id, bool paused)
+{
+  if (!Buzzer_IsPlaying(id)) return;
+  BuzzerCmd cmd = {paused ? BUZZER_CMD_PAUSE : BUZZER_CMD_RESUME, 0, id, 0, 0, PLAY_ONCE};
+  sendCmd(cmd, portMAX_DELAY);
+}
+
+void Buzzer_SetMode(uint32_t id, PlayMode mode)
+{
+  if (!Buzzer_IsPlaying(id)) return;
+  BuzzerCmd cmd = {BUZZER_CMD_MODE, 0, id, 0, 0, mode};
+  sendCmd(cmd, portMAX_DELAY);
+}
 
-    int note = pgm_read_word(song.melody + i);
-    int duration = pgm_read_word(song.durations + i);
-    if (note > 0) tone(BUZZER_PIN, note, duration);
-    vTaskDelay(pdMS_TO_TICKS(duration));
+bool Buzzer_IsPlaying(uint32_t id)
+{
+  bool playing = false;
+  portENTER_CRITICAL(&playbackMux);
+  for (int v = 0; v < VOICE_COUNT; v++)
+  {
+    if (id != 0 && latestId[v] == id) playing = true;
   }
-  vTaskDelete(NULL); // 播放完毕后自删除
+  portEXIT_CRITICAL(&playbackMux);
+  return playing;
+}
+
+BuzzerPosition Buzzer_GetPosition()
+{
+  const Voice &music = voices[VOICE_MUSIC];
+  BuzzerPosition pos;
+  pos.playing = music.id != 0;
+  pos.paused = music.paused;
+  pos.preempted = pos.playing && !music.paused && soundingVoice != VOICE_MUSIC;
+  pos.songIndex = music.songIndex;
+  pos.noteIndex = music.noteIndex;
+  pos.totalNotes = music.song.length;
+  bool sounding = music.noteOn && soundingVoice == VOICE_MUSIC; // 暂停或被抢占时进度停在当前音符开头
+  pos.frequency = sounding ? music.frequency : 0;
+  pos.durationMs = sounding ? music.durationMs : 0;
+  pos.noteTick = music.noteTick;
+  return pos;
 }
 
 /**
- * @brief 初始化蜂鸣器引脚
+ * @brief 初始化蜂鸣器引脚，启动混音作业
  */
-void Buzzer_Init() { pinMode(BUZZER_PIN, OUTPUT); }
+void Buzzer_Init()
+{
+  pinMode(BUZZER_PIN, OUTPUT);
+  if (cmdQueue == NULL)
+  {
+    cmdQueue = xQueueCreate(BUZZER_CMD_QUEUE_LEN, sizeof(BuzzerCmd));
+    stopDone = xSemaphoreCreateCounting(BUZZER_CMD_QUEUE_LEN, 0);
+    stopLock = xSemaphoreCreateMutex();
+  }
+  Worker_Start(WORKER_AUDIO, &mixerJob, 0);
+}
+
+bool Buzzer_HandleCommand(const char *line)
+{
+  if (strncmp(line, "audio", 5) != 0)
+  {
+    return false;
+  }
+  Serial.println("[Audio] voice   id        song  note   state");
+  for (int v = VOICE_COUNT - 1; v >= 0; v--)
+  {
+    const Voice &voice = voices[v];
+    const char *state = voice.id == 0 ? "idle" : voice.paused ? "paused" : v == soundingVoice ? "playing" : "preempted";
+    Serial.printf("[Audio] %-7s %-9lu %5d %5d   %s\n", voiceNames[v], (unsigned long)voice.id, voice.songIndex,
+                  voice.noteIndex, state);
+  }
+  Serial.printf("[Audio] commands %lu, dropped tones %lu, preempts %lu, step max %lu us\n",
+                (unsigned long)mixerCommands, (unsigned long)mixerDropped, (unsigned long)mixerPreempts,
+                (unsigned long)mixerStepMaxUs);
+  return true;
+}
 
 /**
  * @brief 停止所有与音乐播放相关的任务和硬件
  */
 static void stop_buzzer_playback()
 {
-  // 删除任务
-  if (buzzerTaskHandle != NULL) { vTaskDelete(buzzerTaskHandle); buzzerTaskHandle = NULL; }
-  if (ledTaskHandle != NULL) { vTaskDelete(ledTaskHandle); ledTaskHandle = NULL; }
-  // 停止硬件
-  noTone(BUZZER_PIN);
-  strip.clear();
-  strip.show();
+  Buzzer_Stop(playerPlayback); // 返回时音频工作任务已经静音
+  led_off();
+  if (noteEventQueue != NULL) NoteEvents_UnsubscribeQueue(noteEventQueue);
+  if (songRequestQueue != NULL) EventBus_UnsubscribeQueue(songRequestQueue);
   // 重置状态标志
   isPaused = false;
-  stopBuzzerTask = false;
-  stopLedTask = false;
 }
 
 /**
@@ -487,12 +946,12 @@ void BuzzerMenu()
         if (selectedSongIndex < displayOffset) displayOffset = selectedSongIndex;
         else if (selectedSongIndex >= displayOffset + visibleSongs) displayOffset = selectedSongIndex - visibleSongs + 1;
         displaySongList(selectedSongIndex);
-        tone(BUZZER_PIN, 1000, 50); // 提示音
+        Buzzer_Tone(1000, 50); // 提示音
       }
 
       if (readButton()) // 短按按钮
       {
-        tone(BUZZER_PIN, 1500, 50);
+        Buzzer_Tone(1500, 50);
         play_song_full_ui(selectedSongIndex); // 调用新的播放函数
         inListMenu = false; // 退出列表，进入播放界面
       }
@@ -507,19 +966,7 @@ void BuzzerMenu()
 
 void play_song_background(int songIndex)
 {
-  static int currentSongIndex = -1; // 使用静态变量来存储歌曲索引
-  if (songIndex < 0 || songIndex >= numSongs) return;
-
-  // 如果有后台音乐正在播放，先停止它
-  if (backgroundMusicTaskHandle != NULL)
-  {
-    vTaskDelete(backgroundMusicTaskHandle);
-    backgroundMusicTaskHandle = NULL;
-  }
-
-  currentSongIndex = songIndex;
-  // 创建一个新的后台播放任务
-  xTaskCreate(Buzzer_PlayMusic_Task, "BackgroundMusic", 4096, &currentSongIndex, 1, &backgroundMusicTaskHandle);
+  Buzzer_Play(songIndex, PLAY_ONCE); // 替换正在播放的音乐
 }
 
 void play_song_full_ui(int songIndex)
@@ -527,32 +974,49 @@ void play_song_full_ui(int songIndex)
   if (songIndex < 0 || songIndex >= numSongs) return;
 
   // --- 进入播放界面 ---
-  stopBuzzerTask = false;
-  stopLedTask = false;
   isPaused = false;
   currentPlayMode = LIST_LOOP; // 默认播放模式
 
-  // 创建播放和灯效任务
-  if (buzzerTaskHandle == NULL)
+  // 订阅音符事件，界面由实际发声的音符驱动
+  if (noteEventQueue == NULL)
   {
-    xTaskCreatePinnedToCore(Buzzer_Task, "Buzzer_Task", 4096, &songIndex, 2, &buzzerTaskHandle, 0);
+    noteEventQueue = xQueueCreate(NOTE_EVENT_QUEUE_LEN, sizeof(NoteEvent));
   }
-  if (ledTaskHandle == NULL)
+  xQueueReset(noteEventQueue);
+  playbackView = {songIndex, 0, xTaskGetTickCount(), 0, 0, false};
+  NoteEvents_SubscribeQueue(noteEventQueue);
+  if (songRequestQueue == NULL)
   {
-    xTaskCreatePinnedToCore(Led_Rainbow_Task, "Led_Rainbow_Task", 2048, NULL, 1, &ledTaskHandle, 0);
+    songRequestQueue = xQueueCreate(1, sizeof(AppEvent));
   }
+  xQueueReset(songRequestQueue);
+  EventBus_SubscribeQueue(songRequestQueue, EVENT_MASK(EVENT_PLAY_SONG));
+
+  // 灯效交给LED引擎，随音符闪烁 (闪光衰减150ms)
+  LedEffect musicEffect = {LED_EFFECT_MUSIC, 0, 0, 0, 0, 150};
+  LedEngine_Submit(musicEffect);
+
+  playerPlayback = Buzzer_Play(songIndex, currentPlayMode);
 
   unsigned long lastScreenUpdateTime = 0;
 
   while (true) // 播放界面的循环
   {
-    if (g_force_exit_ui)
+    AppEvent request;
+    if (EventBus_Receive(songRequestQueue, &request, 0)) // 远程点歌：退出，由界面循环打开新的播放界面
     {
       stop_buzzer_playback();
-      g_force_exit_ui = false; // 重置标志
       return;
     }
-    if (exitSubMenu || g_alarm_is_ringing)
+    if (g_alarm_is_ringing)
+    {
+      // 闹钟只抢占蜂鸣器：就地显示响铃界面，闹钟停止后回到本界面，音乐从被打断的音符继续
+      Alarm_ShowRingingScreen();
+      exitSubMenu = false; // 响铃时置位的退出标志已由本界面就地处理，不再退出播放
+      lastScreenUpdateTime = 0; // 响铃界面覆盖了屏幕，立即重绘
+      continue;
+    }
+    if (exitSubMenu)
     {
       stop_buzzer_playback();
       return;
@@ -567,7 +1031,8 @@ void play_song_full_ui(int songIndex)
     if (readButton()) // 短按暂停/继续
     {
       isPaused = !isPaused;
-      tone(BUZZER_PIN, 1000, 50);
+      Buzzer_Pause(playerPlayback, isPaused);
+      Buzzer_Tone(1000, 50);
     }
 
     int encoderChange = readEncoder();
@@ -576,15 +1041,42 @@ void play_song_full_ui(int songIndex)
       int mode = (int) currentPlayMode;
       mode = (mode + encoderChange + 3) % 3;
       currentPlayMode = (PlayMode) mode;
+      Buzzer_SetMode(playerPlayback, currentPlayMode);
     }
 
-    // 定期更新屏幕
-    if (millis() - lastScreenUpdateTime > 100)
+    // 等待音符事件 (最多20ms，以便继续响应按键)；新音符到来时立即重绘
+    bool noteStarted = false;
+    NoteEvent event;
+    if (xQueueReceive(noteEventQueue, &event, pdMS_TO_TICKS(20)) == pdTRUE)
+    {
+      do
+      {
+        if (event.playbackId != playerPlayback)
+        {
+          continue; // 不是本界面启动的播放 (如远程点歌替换了音乐)
+        }
+        switch (event.type)
+        {
+        case NOTE_EVENT_SONG_START:
+          playbackView = {event.songIndex, 0, event.tick, 0, 0, false};
+          break;
+        case NOTE_EVENT_NOTE_ON:
+          playbackView = {event.songIndex, event.noteIndex, event.tick, event.frequency, event.durationMs, true};
+          noteStarted = true;
+          break;
+        case NOTE_EVENT_NOTE_OFF:
+        case NOTE_EVENT_SONG_END:
+          playbackView.noteOn = false;
+          break;
+        }
+      } while (xQueueReceive(noteEventQueue, &event, 0) == pdTRUE);
+    }
+
+    // 新音符立即刷新；其余时间每100ms刷新一次时钟和进度条
+    if (noteStarted || millis() - lastScreenUpdateTime > 100)
     {
       displayPlayingSong();
       lastScreenUpdateTime = millis();
     }
-
-    vTaskDelay(pdMS_TO_TICKS(20));
   }
 }
@@ -2,6 +2,8 @@
 #define BUZZER_H
 
 #define BUZZER_PIN 5
+#define BUZZER_SONG_GAP_MS 2000 // 循环播放时两首歌之间的间隔
+#define BUZZER_CMD_QUEUE_LEN 8   // 混音器命令队列深度
 
 #include <Arduino.h>
 
@@ -10,7 +12,19 @@ enum PlayMode
 {
   SINGLE_LOOP,   // 单曲循环
   LIST_LOOP,     // 列表播放
-  RANDOM_PLAY    // 随机播放
+  RANDOM_PLAY,   // 随机播放
+  PLAY_ONCE      // 播放一遍后停止 (开机音乐、整点报时、MQTT点歌)
+};
+
+// 声部，数值越大优先级越高。蜂鸣器同一时刻只发一个声部的声音：
+// 高优先级声部抢占时，被抢占的乐曲停在当前音符，抢占结束后从这个音符继续；被抢占的单音直接丢弃
+enum BuzzerVoice
+{
+  VOICE_CLICK,   // 按键音等界面单音，有其他声音时不发声
+  VOICE_MUSIC,   // 音乐播放器、远程点歌
+  VOICE_NOTIFY,  // 开机音乐、整点报时、计时结束提示
+  VOICE_ALARM,   // 闹钟
+  VOICE_COUNT
 };
 #include <TFT_eSPI.h>
 #include "Music_processed/cai_bu_tou.h"
@@ -120,47 +134,95 @@ typedef struct
 
 extern const Song songs[] PROGMEM;
 extern const int numSongs;
-extern volatile bool stopBuzzerTask;
+
+// 播放进度，供播放界面显示
+typedef struct
+{
+  bool playing;          // 音乐声部正在播放乐曲 (包括暂停和被抢占)
+  bool paused;
+  bool preempted;        // 正被更高优先级的声部抢占
+  int songIndex;
+  int noteIndex;         // 当前音符在歌曲中的序号
+  int totalNotes;
+  uint16_t frequency;    // 当前音符频率，没有发声时为0
+  uint16_t durationMs;   // 当前音符时长
+  TickType_t noteTick;   // 当前音符开始的时刻
+} BuzzerPosition;
+
+/**
+ * @brief 在一个声部上播放歌曲，替换这个声部正在播放的乐曲，立即返回。
+ * @param songIndex 歌曲索引。
+ * @param mode 播放模式，PLAY_ONCE 播放一遍后停止，其余模式在每首歌结束后按模式选下一首。
+ * @param voice 声部。其他声部的播放不受影响，只按优先级决定谁发声。
+ * @param gapMs 循环播放时两首歌之间的间隔。
+ * @return 播放编号，用于 Buzzer_Stop 等函数：只有仍是这个声部最近一次播放时才起作用，
+ *         不会停掉之后在同一声部上开始的其他播放。索引无效时返回0。
+ */
+uint32_t Buzzer_Play(int songIndex, PlayMode mode, BuzzerVoice voice = VOICE_MUSIC, uint32_t gapMs = BUZZER_SONG_GAP_MS);
+
+/**
+ * @brief 在一个声部上发出单音，代替直接调用 tone()，不阻塞。
+ * @details 更高优先级的声部正在发声时直接丢弃。命令队列已满时也丢弃，按键音不等待。
+ *          frequency 为0时替换这个声部上正在响的单音，即让它静音。
+ */
+void Buzzer_Tone(uint16_t frequency, uint16_t durationMs, BuzzerVoice voice = VOICE_CLICK);
+
 /**
- * @brief [FreeRTOS Task] 循环播放音乐的任务。
- * @param pvParameters 指向要开始播放的歌曲索引（int*）的指针。
- * @details 此任务根据当前的播放模式（列表循环、单曲循环、随机播放）持续播放音乐库中的歌曲。
- *          它会处理暂停、停止和模式切换的逻辑。
+ * @brief 停止编号为 id 的播放，返回时它已不再发声。
  */
-void Buzzer_Task(void *pvParameters);
+void Buzzer_Stop(uint32_t id);
 
 /**
- * @brief [FreeRTOS Task] 播放单首音乐的任务。
- * @param pvParameters 指向要播放的歌曲索引（int*）的指针。
- * @details 这是一个一次性的播放任务，用于播放指定的单首歌曲，播放完毕后任务会自行删除。
- *          主要用于如开机音乐、整点报时等短时播放场景。
+ * @brief 暂停或继续编号为 id 的播放。
  */
-void Buzzer_PlayMusic_Task(void *pvParameters);
+void Buzzer_Pause(uint32_t id, bool paused);
+
+/**
+ * @brief 修改编号为 id 的播放的模式，当前歌曲结束后生效。
+ */
+void Buzzer_SetMode(uint32_t id, PlayMode mode);
+
+/**
+ * @brief 编号为 id 的播放是否仍在进行 (包括暂停中)。
+ */
+bool Buzzer_IsPlaying(uint32_t id);
+
+/**
+ * @brief 获取音乐声部的播放进度。
+ */
+BuzzerPosition Buzzer_GetPosition();
 
 /**
  * @brief 初始化蜂鸣器。
- * @details 将蜂鸣器连接的GPIO引脚设置为输出模式。
+ * @details 将蜂鸣器连接的GPIO引脚设置为输出模式，在音频工作任务上启动常驻的混音作业。
+ *          需在 Worker_Init 之后调用。
  */
 void Buzzer_Init();
 
+/**
+ * @brief 处理串口命令 "audio"，输出各声部的状态、抢占次数和混音器每步的最长耗时。
+ * @return 是音频命令时返回 true。
+ */
+bool Buzzer_HandleCommand(const char *line);
+
 /**
  * @brief 音乐播放器的主菜单函数。
  * @details 提供一个交互式菜单，用户可以选择歌曲、播放、暂停、切换播放模式。
- *          它管理着音乐播放任务和LED灯效任务的生命周期。
+ *          它管理着音乐播放任务的生命周期，并通过LED引擎切换播放时的灯效。
  */
 void BuzzerMenu();
 
 /**
  * @brief 在后台播放指定的歌曲。
  * @param songIndex 要播放的歌曲的索引。
- * @details 此函数会停止任何正在后台播放的歌曲，然后创建一个新任务来播放指定的歌曲。
+ * @details 以 PLAY_ONCE 交给音频工作任务，替换正在播放的歌曲。
  */
 void play_song_background(int songIndex);
 
 /**
  * @brief 直接进入指定歌曲的完整播放UI。
  * @param songIndex 要播放的歌曲的索引。
- * @details 此函数会启动播放任务和灯效任务，并直接显示“正在播放”界面，
+ * @details 此函数会启动播放任务并提交彩虹灯效，并直接显示“正在播放”界面，
  *          允许用户控制播放，而不是从歌曲列表开始。
  */
 void play_song_full_ui(int songIndex);
@@ -6,6 +6,8 @@
 #include "Buzzer.h"
 #include "RotaryEncoder.h"
 #include "weather.h"
+#include "Display.h"
+#include "Screen.h"
 
 // --- 状态变量 ---
 static unsigned long countdown_target_millis = 0;   // 倒计时目标结束的毫秒时间戳
@@ -157,155 +159,203 @@ void displayCountdownTime(unsigned long millis_left)
     menuSprite.drawRect(20, menuSprite.height() / 2 + 40, menuSprite.width() - 40, 20, TFT_WHITE); // 边框
     menuSprite.fillRect(22, menuSprite.height() / 2 + 42, (int) ((menuSprite.width() - 44) * progress), 16, TFT_GREEN); // 填充
 
-    menuSprite.pushSprite(0, 0); // 将Sprite内容推送到屏幕
+    Display_Present(); // 将Sprite内容推送到屏幕
 }
 
+// --- 页面状态 ---
+static bool countdown_finished = false;               // 倒计时刚结束，保持显示 FINISHED 直到下一次操作
+static unsigned long last_realtime_clock_update = 0;  // 上次刷新顶部时钟的时刻
+static long last_displayed_countdown_millis = -1;     // 上一帧显示的剩余毫秒数
+
 /**
- * @brief 倒计时功能的主菜单函数
- * @details 此函数是倒计时功能的入口点。它管理着一个循环，处理用户输入（旋转编码器、按钮），
- *          并根据当前状态（设置、运行、暂停）更新倒计时逻辑和UI显示。
+ * @brief 当前应显示的剩余毫秒数
  */
-void CountdownMenu()
+static long countdownReading(unsigned long now)
+{
+    long millis_left;
+    if (countdown_running)
+    {
+        millis_left = countdown_target_millis - now;
+    }
+    else if (countdown_paused)
+    { // 暂停时停在暂停那一刻的剩余时间
+        millis_left = countdown_target_millis - countdown_pause_time;
+    }
+    else
+    {
+        return countdown_finished ? 0 : countdown_duration_seconds * 1000;
+    }
+    return millis_left < 0 ? 0 : millis_left;
+}
+
+/**
+ * @brief [页面] 进入时重置为默认的5分钟，从设置分钟开始
+ */
+static void countdownEnter()
 {
-    // 初始化状态
     countdown_running = false;
     countdown_paused = false;
+    countdown_finished = false;
     countdown_duration_seconds = 5 * 60; // 重置为默认的5分钟
     countdown_setting_mode = MODE_MINUTES; // 从设置分钟模式开始
+    last_realtime_clock_update = millis();
+    last_displayed_countdown_millis = -1;
+}
 
-    displayCountdownTime(countdown_duration_seconds * 1000); // 初始绘制界面
+/**
+ * @brief [页面] 设置阶段调整时间和切换模式，运行阶段暂停/继续，并推进计时
+ * @return 输入改变了界面、百分之一秒变化或顶部时钟需要刷新时请求重绘
+ */
+static ScreenAction countdownUpdate(const ScreenInput &input)
+{
+    if (input.longPress)
+    { // 长按退出
+        Buzzer_Tone(1500, 100);
+        return SCREEN_EXIT;
+    }
 
-    unsigned long last_display_update_time = millis();
+    ScreenAction action = SCREEN_IDLE;
 
-    while (true)
+    // --- 逻辑：当计时器未运行时 (设置阶段) ---
+    if (!countdown_running && !countdown_paused)
     {
-        // 检查全局退出条件
-        if (exitSubMenu) { exitSubMenu = false; return; }
-        if (g_alarm_is_ringing) { return; }
-        if (readButtonLongPress())
-        { // 长按退出
-            tone(BUZZER_PIN, 1500, 100);
-            menuSprite.setTextFont(1); menuSprite.setTextSize(1); // 恢复默认字体
-            return;
-        }
-
-        int encoder_value = readEncoder();
-        bool button_pressed = readButton();
-
-        // --- 逻辑：当计时器未运行时 (设置阶段) ---
-        if (!countdown_running && !countdown_paused)
-        {
-            if (encoder_value != 0)
-            { // 旋转编码器调整时间
-                if (countdown_setting_mode == MODE_MINUTES)
-                {
-                    countdown_duration_seconds += encoder_value * 60;
-                }
-                else if (countdown_setting_mode == MODE_SECONDS)
-                {
-                    long current_minutes = countdown_duration_seconds / 60;
-                    long current_seconds = countdown_duration_seconds % 60;
-                    current_seconds += encoder_value;
-                    // 处理秒数的进位和借位
-                    if (current_seconds >= 60) { current_seconds = 0; current_minutes++; }
-                    else if (current_seconds < 0) { current_seconds = 59; if (current_minutes > 0) current_minutes--; }
-                    countdown_duration_seconds = (current_minutes * 60) + current_seconds;
-                }
-                if (countdown_duration_seconds < 0) countdown_duration_seconds = 0; // 防止负数
-                displayCountdownTime(countdown_duration_seconds * 1000);
-                tone(BUZZER_PIN, 1000, 20); // 提示音
+        if (input.encoder != 0)
+        { // 旋转编码器调整时间
+            if (countdown_setting_mode == MODE_MINUTES)
+            {
+                countdown_duration_seconds += input.encoder * 60;
             }
-
-            if (button_pressed)
-            { // 短按按钮
-                tone(BUZZER_PIN, 2000, 50);
-                if (countdown_setting_mode == MODE_READY_TO_START)
-                {
-                    // 准备就绪，开始计时
-                    if (countdown_duration_seconds > 0)
-                    {
-                        countdown_start_millis = millis();
-                        countdown_target_millis = countdown_start_millis + (countdown_duration_seconds * 1000);
-                        countdown_running = true;
-                        countdown_paused = false;
-                        last_countdown_beep_time = 0; // 重置蜂鸣计时器
-                    }
-                    else
-                    { // 如果时间为0，则重置模式
-                        countdown_setting_mode = MODE_MINUTES;
-                    }
-                }
-                else
-                {
-                    // 循环切换设置模式: 分 -> 秒 -> 准备开始
-                    countdown_setting_mode = (CountdownSettingMode) ((countdown_setting_mode + 1) % 3);
-                }
-                displayCountdownTime(countdown_duration_seconds * 1000);
+            else if (countdown_setting_mode == MODE_SECONDS)
+            {
+                long current_minutes = countdown_duration_seconds / 60;
+                long current_seconds = countdown_duration_seconds % 60;
+                current_seconds += input.encoder;
+                // 处理秒数的进位和借位
+                if (current_seconds >= 60) { current_seconds = 0; current_minutes++; }
+                else if (current_seconds < 0) { current_seconds = 59; if (current_minutes > 0) current_minutes--; }
+                countdown_duration_seconds = (current_minutes * 60) + current_seconds;
             }
+            if (countdown_duration_seconds < 0) countdown_duration_seconds = 0; // 防止负数
+            countdown_finished = false;
+            Buzzer_Tone(1000, 20); // 提示音
+            action = SCREEN_REDRAW;
         }
-        // --- 逻辑：当计时器正在运行或已暂停时 ---
-        else
-        {
-            if (button_pressed)
-            { // 短按按钮用于暂停/继续
-                tone(BUZZER_PIN, 2000, 50);
-                if (countdown_running)
-                { // 如果正在运行 -> 暂停
-                    countdown_pause_time = millis();
-                    countdown_running = false;
-                    countdown_paused = true;
-                }
-                else
-                { // 如果已暂停 -> 继续
-                             // 调整开始时间，以补偿暂停期间经过的时间
-                    countdown_start_millis += (millis() - countdown_pause_time);
+
+        if (input.click)
+        { // 短按按钮
+            Buzzer_Tone(2000, 50);
+            countdown_finished = false;
+            if (countdown_setting_mode == MODE_READY_TO_START)
+            {
+                // 准备就绪，开始计时
+                if (countdown_duration_seconds > 0)
+                {
+                    countdown_start_millis = input.nowMs;
                     countdown_target_millis = countdown_start_millis + (countdown_duration_seconds * 1000);
                     countdown_running = true;
                     countdown_paused = false;
+                    last_countdown_beep_time = 0; // 重置蜂鸣计时器
+                }
+                else
+                { // 如果时间为0，则重置模式
+                    countdown_setting_mode = MODE_MINUTES;
                 }
             }
+            else
+            {
+                // 循环切换设置模式: 分 -> 秒 -> 准备开始
+                countdown_setting_mode = (CountdownSettingMode) ((countdown_setting_mode + 1) % 3);
+            }
+            action = SCREEN_REDRAW;
         }
-
-        // --- 如果正在运行，则更新显示 ---
+    }
+    // --- 逻辑：当计时器正在运行或已暂停时 ---
+    else if (input.click)
+    { // 短按按钮用于暂停/继续
+        Buzzer_Tone(2000, 50);
         if (countdown_running)
-        {
-            unsigned long current_millis = millis();
-            long millis_left = countdown_target_millis - current_millis;
-            if (millis_left < 0) millis_left = 0;
+        { // 如果正在运行 -> 暂停
+            countdown_pause_time = input.nowMs;
+            countdown_running = false;
+            countdown_paused = true;
+        }
+        else
+        { // 如果已暂停 -> 继续
+            // 调整开始时间，以补偿暂停期间经过的时间
+            countdown_start_millis += (input.nowMs - countdown_pause_time);
+            countdown_target_millis = countdown_start_millis + (countdown_duration_seconds * 1000);
+            countdown_running = true;
+            countdown_paused = false;
+        }
+        action = SCREEN_REDRAW;
+    }
 
-            // 频繁更新倒计时显示（每百分之一秒）
-            if (millis_left / 10 != (countdown_target_millis - last_display_update_time) / 10)
-            {
-                displayCountdownTime(millis_left);
-                last_display_update_time = current_millis;
-            }
+    // --- 如果正在运行，则推进计时 ---
+    if (countdown_running)
+    {
+        long millis_left = countdownReading(input.nowMs);
 
-            // 最后5秒警告：每秒蜂鸣一次
-            if (millis_left > 0 && millis_left <= 5000 && (current_millis - last_countdown_beep_time >= 1000 || last_countdown_beep_time == 0))
-            {
-                tone(BUZZER_PIN, 1000, 100);
-                last_countdown_beep_time = current_millis;
-            }
+        // 每百分之一秒重绘一次，实际频率受帧间隔限制
+        if (millis_left / 10 != last_displayed_countdown_millis / 10)
+        {
+            action = SCREEN_REDRAW;
+        }
 
-            // 倒计时结束
-            if (millis_left == 0)
-            {
-                countdown_running = false;
-                countdown_paused = false;
-                tone(BUZZER_PIN, 3000, 2000); // 长鸣2秒作为结束提示
-                displayCountdownTime(0);
-            }
+        // 最后5秒警告：每秒蜂鸣一次
+        if (millis_left > 0 && millis_left <= 5000 && (input.nowMs - last_countdown_beep_time >= 1000 || last_countdown_beep_time == 0))
+        {
+            Buzzer_Tone(1000, 100, VOICE_NOTIFY);
+            last_countdown_beep_time = input.nowMs;
         }
-        else
-        { // 如果倒计时未运行（暂停或设置中），则只更新顶部的实时时钟
-            unsigned long current_millis = millis();
-            if (current_millis - last_display_update_time >= 1000)
-            { // 每秒更新一次
-                displayCountdownTime(countdown_duration_seconds * 1000);
-                last_display_update_time = current_millis;
-            }
+
+        // 倒计时结束
+        if (millis_left == 0)
+        {
+            countdown_running = false;
+            countdown_paused = false;
+            countdown_finished = true;
+            Buzzer_Tone(3000, 2000, VOICE_NOTIFY); // 长鸣2秒作为结束提示
+            action = SCREEN_REDRAW;
         }
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(10)); // 短暂延时，防止CPU空转
+    // 顶部的实时时钟每秒刷新一次 (未运行时只有它会变化)
+    if (input.nowMs - last_realtime_clock_update >= 1000)
+    {
+        last_realtime_clock_update = input.nowMs;
+        action = SCREEN_REDRAW;
     }
-}
\ No newline at end of file
+    return action;
+}
+
+/**
+ * @brief [页面] 绘制当前剩余时间
+ */
+static void countdownRender()
+{
+    last_displayed_countdown_millis = countdownReading(millis());
+    displayCountdownTime(last_displayed_countdown_millis);
+}
+
+/**
+ * @brief [页面] 退出时恢复默认字体
+ */
+static void countdownExit(ScreenExitReason reason)
+{
+    countdown_running = false;
+    countdown_paused = false;
+    menuSprite.setTextFont(1); menuSprite.setTextSize(1); // 恢复默认字体
+}
+
+static const ScreenDef countdownScreen = {"countdown", DISPLAY_MIN_FRAME_MS, true, countdownEnter, countdownUpdate,
+                                          countdownRender, countdownExit};
+
+/**
+ * @brief 倒计时功能的主菜单函数
+ * @details 此函数是倒计时功能的入口点。输入处理、计时和绘制由页面调度器按帧驱动，
+ *          闹钟响铃或远程命令到达时立即退出。
+ */
+void CountdownMenu()
+{
+    Screen_Run(countdownScreen);
+}
@@ -9,12 +9,18 @@
 #include "Menu.h"
 #include "RotaryEncoder.h"
 #include "weather.h"
+#include "HwScroll.h"
+#include "SysMon.h"
+#include "Worker.h"
+#include "EventBus.h"
 
 // --- 图表尺寸和位置定义 ---
 #define TEMP_GRAPH_WIDTH  200 // 图表宽度
 #define TEMP_GRAPH_HEIGHT 135 // 图表高度
 #define TEMP_GRAPH_X      20  // 图表左上角X坐标
 #define TEMP_GRAPH_Y      90  // 图表左上角Y坐标
+#define TEMP_GRAPH_STEP   (TEMP_GRAPH_WIDTH / 100) // 每个数据点的横向像素数
+#define TEMP_HEADER_HEIGHT (TEMP_GRAPH_Y - 5) // 图表上方时间和温度区域的高度
 
 // --- 温度值显示位置 ---
 #define TEMP_VALUE_X      20
@@ -33,7 +39,6 @@ DallasTemperature sensors(&oneWire); // 将OneWire实例传递给DallasTemperatu
 
 // --- 全局变量 ---
 float g_currentTemperature = -127.0; // 全局变量，存储当前温度值。-127.0为设备断开时的特殊值。
-volatile bool stopDS18B20Task = false; // 停止DS18B20任务的标志，volatile确保多任务可见性
 
 // --- TFT_eWidget 图表和描线对象 ---
 GraphWidget gr = GraphWidget(&tft); // 图表控件
@@ -55,13 +60,22 @@ void DS18B20_Init()
  */
 void updateTempTask(void *pvParameters)
 {
+  int32_t lastCentiC = INT32_MIN; // 上次发布的温度 (0.01°C)
+  SysMon_Watch(10000); // 正常2秒一轮，单总线读取卡住时由看门狗复位
   while (1)
   {
+    SysMon_Heartbeat();
     sensors.requestTemperatures(); // 发送命令以获取温度
     float temp = sensors.getTempCByIndex(0); // 从第一个传感器获取摄氏温度
     if (temp != DEVICE_DISCONNECTED_C) // DEVICE_DISCONNECTED_C 是库定义的错误码
     {
       g_currentTemperature = temp; // 更新全局温度值
+      int32_t centiC = (int32_t)lroundf(temp * 100);
+      if (centiC != lastCentiC)
+      {
+        lastCentiC = centiC;
+        EventBus_Publish(EVENT_SENSOR, SENSOR_TEMPERATURE, centiC);
+      }
     }
     vTaskDelay(pdMS_TO_TICKS(2000)); // 任务延时2秒
   }
@@ -92,18 +106,10 @@ float getDS18B20Temp()
 }
 
 /**
- * @brief [FreeRTOS Task] DS18B20数据显示主任务
- * @param pvParameters 未使用
- * @details 此任务负责在屏幕上绘制温度曲线图和实时温度值。
- *          它会初始化图表，然后在一个循环中不断获取温度数据，更新屏幕显示，
- *          并将数据点添加到图表中形成曲线。
+ * @brief 绘制图表框架和坐标轴标签，并重新开始描线
  */
-void DS18B20_Task(void *pvParameters)
+static void drawTempGraphFrame()
 {
-  float lastTemp = -274; // 上一次的温度值，用于比较
-  float gx = 0.0; // 图表X轴的当前位置
-
-  // --- 初始化图表 ---
   gr.createGraph(TEMP_GRAPH_WIDTH, TEMP_GRAPH_HEIGHT, tft.color565(5, 5, 5)); // 创建图表背景
   gr.setGraphScale(0.0, 100.0, 0.0, 40.0); // 设置X轴(0-100)和Y轴(0-40°C)的范围
   gr.setGraphGrid(0.0, 25.0, 0.0, 10.0, TFT_DARKGREY); // 设置网格线
@@ -127,90 +133,199 @@ void DS18B20_Task(void *pvParameters)
   {
     tft.drawNumber(i, gr.getPointX(i), gr.getPointY(0.0) + 5);
   }
+  tft.setTextDatum(TL_DATUM);
+}
 
-  // --- 主循环 ---
-  while (1)
+/**
+ * @brief 绘制顶部的时间和实时温度
+ * @param header 顶部区域的精灵，创建失败时直接画在屏幕上
+ * @details 顶部区域与图表处在相同的列上，滚动图表时它也会被面板移动，所以每次都整块重画，
+ *          经 HwScroll 换算到当前的写入位置。
+ */
+static void drawTempHeader(TFT_eSprite &header, float tempC)
+{
+  TFT_eSPI &g = header.created() ? (TFT_eSPI &)header : tft;
+  g.fillRect(0, 0, tft.width(), TEMP_HEADER_HEIGHT, TFT_BLACK); // 清除图表上方的区域
+
+  // 在顶部显示当前时间
+  if (getLocalTime(&timeinfo, 1))
   {
-    if (stopDS18B20Task) break; // 检查退出标志
+    char time_str[30];
+    strftime(time_str, sizeof(time_str), "%Y-%m-%d %H:%M:%S %a", &timeinfo);
+    g.setTextFont(2);
+    g.setTextSize(1);
+    g.setTextColor(TFT_WHITE, TFT_BLACK);
+    g.setTextDatum(MC_DATUM);
+    g.drawString(time_str, tft.width() / 2, 10);
+  }
 
-    float tempC = getDS18B20Temp(); // 获取最新温度
+  // --- 显示实时温度值 ---
+  char tempStr[10];
+  dtostrf(tempC, 4, 2, tempStr); // 将float转为字符串
+  char fullTempStr[15];
+  sprintf(fullTempStr, "%s C", tempStr);
 
-    if (tempC != DEVICE_DISCONNECTED_C && tempC > -50 && tempC < 150) // 检查温度值是否有效
-    {
-      tft.fillRect(0, 0, tft.width(), TEMP_GRAPH_Y - 5, TFT_BLACK); // 清除图表上方的区域
+  g.setTextFont(7); // 使用大号字体
+  g.setTextSize(1);
+  int text_width = g.textWidth(fullTempStr);
+  int text_height = g.fontHeight();
+  int x_pos = (tft.width() - text_width) / 2;
+  int y_pos = (TEMP_HEADER_HEIGHT - text_height) / 2 + 20; // 计算Y坐标，使其在时间下方居中
 
-      // 在顶部显示当前时间
-      if (getLocalTime(&timeinfo, 1))
-      {
-        char time_str[30];
-        strftime(time_str, sizeof(time_str), "%Y-%m-%d %H:%M:%S %a", &timeinfo);
-        tft.setTextFont(2);
-        tft.setTextSize(1);
-        tft.setTextColor(TFT_WHITE, TFT_BLACK);
-        tft.setTextDatum(MC_DATUM);
-        tft.drawString(time_str, tft.width() / 2, 10);
-        tft.setTextDatum(TL_DATUM);
-      }
+  g.setTextDatum(TL_DATUM);
+  g.setTextColor(TFT_WHITE, TFT_BLACK);
+  g.drawString(fullTempStr, x_pos, y_pos);
+
+  if (header.created())
+  {
+    HwScroll_PushSprite(header, 0, 0);
+  }
+}
 
-      // --- 显示实时温度值 ---
-      char tempStr[10];
-      dtostrf(tempC, 4, 2, tempStr); // 将float转为字符串
-      char fullTempStr[15];
-      sprintf(fullTempStr, "%s C", tempStr);
+/**
+ * @brief 硬件滚动后在图表右端新露出的条带上绘制最新一段曲线
+ * @param gridColumn 该条带是否落在竖向网格线上
+ */
+static void drawTempStrip(TFT_eSprite &strip, float prevTemp, float tempC, bool gridColumn)
+{
+  strip.fillSprite(tft.color565(5, 5, 5));
+  // 与 GraphWidget::drawGraph 相同的网格位置
+  for (int t = 0; t <= 40; t += 10)
+  {
+    strip.drawFastHLine(0, map(t, 0, 40, TEMP_GRAPH_HEIGHT, 0), TEMP_GRAPH_STEP, TFT_DARKGREY);
+  }
+  if (gridColumn)
+  {
+    strip.drawFastVLine(TEMP_GRAPH_STEP - 1, 0, TEMP_GRAPH_HEIGHT + 1, TFT_DARKGREY);
+  }
+  // 从上一点 (位于条带左侧一列) 连到新点，超出条带的部分被精灵裁掉
+  strip.drawLine(-1, gr.getPointY(prevTemp) - TEMP_GRAPH_Y,
+                 TEMP_GRAPH_STEP - 1, gr.getPointY(tempC) - TEMP_GRAPH_Y, TFT_YELLOW);
+  HwScroll_PushSprite(strip, TEMP_GRAPH_X + TEMP_GRAPH_WIDTH - TEMP_GRAPH_STEP, TEMP_GRAPH_Y);
+}
+
+// --- 温度页面作业状态 ---
+static float lastTemp = -274;     // 上一次的温度值，用于比较
+static float gx = 0.0;            // 图表X轴的当前位置
+static bool scrolling = false;    // 图表已画满并开启了硬件滚动
+static uint32_t scrollSamples = 0; // 滚动后追加的数据点数，用于定位竖向网格线
+static bool graphValid = true;    // 传感器错误清屏后需要重画图表
+// 顶部区域和图表条带的精灵，创建失败时退回直接绘制和整图重置
+static TFT_eSprite header = TFT_eSprite(&tft);
+static TFT_eSprite strip = TFT_eSprite(&tft);
 
-      tft.setTextFont(7); // 使用大号字体
-      tft.setTextSize(1);
-      int text_width = tft.textWidth(fullTempStr);
-      int text_height = tft.fontHeight();
-      int x_pos = (tft.width() - text_width) / 2;
-      int y_pos = (TEMP_GRAPH_Y - 5 - text_height) / 2 + 20; // 计算Y坐标，使其在时间下方居中
+/**
+ * @brief [绘制作业] 初始化图表
+ */
+static void tempScreenStart(int arg)
+{
+  lastTemp = -274;
+  gx = 0.0;
+  scrolling = false;
+  scrollSamples = 0;
+  graphValid = true;
 
-      tft.setTextDatum(TL_DATUM);
-      tft.setTextColor(TFT_WHITE, TFT_BLACK);
-      tft.drawString(fullTempStr, x_pos, y_pos);
+  header.setColorDepth(8);
+  header.createSprite(tft.width(), TEMP_HEADER_HEIGHT);
+  strip.createSprite(TEMP_GRAPH_STEP, TEMP_GRAPH_HEIGHT + 1);
 
-      // --- 向图表添加数据点 ---
+  drawTempGraphFrame();
+}
+
+/**
+ * @brief [绘制作业] 取最新温度，更新顶部数值并向图表添加一个数据点
+ * @details 图表画满后改用面板的硬件滚动，每个新数据点只发送一条 TEMP_GRAPH_STEP 像素宽的条带。
+ * @return 每500ms更新一次屏幕
+ */
+static uint32_t tempScreenStep()
+{
+  float tempC = getDS18B20Temp(); // 获取最新温度
+
+  if (tempC != DEVICE_DISCONNECTED_C && tempC > -50 && tempC < 150) // 检查温度值是否有效
+  {
+    if (!graphValid)
+    {
+      tft.fillScreen(TFT_BLACK);
+      drawTempGraphFrame();
+      gx = 0.0;
+      graphValid = true;
+    }
+
+    // --- 向图表添加数据点 ---
+    if (scrolling)
+    {
+      // 面板把整段图表左移一步，只绘制右端新露出的条带
+      HwScroll_Scroll(TEMP_GRAPH_STEP);
+      scrollSamples++;
+      drawTempStrip(strip, lastTemp, tempC, scrollSamples % 25 == 0);
+    }
+    else
+    {
       tr.addPoint(gx, tempC); // 添加当前温度点
       gx += 1.0; // X轴步进
 
-      // 如果图表画满了，则重置
+      // 如果图表画满了，则开始滚动；不支持时按原方式重置
       if (gx > 100.0)
       {
-        gx = 0.0;
-        gr.drawGraph(TEMP_GRAPH_X, TEMP_GRAPH_Y); // 重绘图表背景
-        tr.startTrace(TFT_YELLOW); // 重新开始描线
+        if (header.created() && strip.created() &&
+            HwScroll_Begin(HW_SCROLL_AXIS_X, TEMP_GRAPH_X, TEMP_GRAPH_WIDTH))
+        {
+          // X轴标签与图表在同一列上，滚动后会错位，清掉
+          tft.fillRect(0, TEMP_GRAPH_Y + TEMP_GRAPH_HEIGHT + 1, tft.width(),
+                       tft.height() - (TEMP_GRAPH_Y + TEMP_GRAPH_HEIGHT + 1), TFT_BLACK);
+          scrolling = true;
+          scrollSamples = 0;
+        }
+        else
+        {
+          gx = 0.0;
+          gr.drawGraph(TEMP_GRAPH_X, TEMP_GRAPH_Y); // 重绘图表背景
+          tr.startTrace(TFT_YELLOW); // 重新开始描线
+        }
       }
-
-      lastTemp = tempC;
     }
-    else // 如果传感器读取错误
+
+    drawTempHeader(header, tempC);
+    lastTemp = tempC;
+  }
+  else // 如果传感器读取错误
+  {
+    if (scrolling)
     {
-      if (stopDS18B20Task) break;
-      tft.fillScreen(TFT_BLACK); // 清屏
-      tft.setCursor(10, 30);
-      tft.setTextSize(2);
-      tft.setTextColor(TFT_RED);
-      tft.println("Sensor Error!");
+      HwScroll_End();
+      scrolling = false;
     }
-
-    vTaskDelay(pdMS_TO_TICKS(500)); // 每500ms更新一次屏幕
+    graphValid = false;
+    tft.fillScreen(TFT_BLACK); // 清屏
+    tft.setCursor(10, 30);
+    tft.setTextSize(2);
+    tft.setTextColor(TFT_RED);
+    tft.println("Sensor Error!");
   }
+  return 500;
+}
 
-  vTaskDelete(NULL); // 任务结束时自我删除
+/**
+ * @brief [绘制作业] 退出页面：结束硬件滚动，释放精灵
+ */
+static void tempScreenStop()
+{
+  HwScroll_End();
+  header.deleteSprite();
+  strip.deleteSprite();
 }
 
+static const WorkerJob tempScreenJob = {"ds18b20", tempScreenStart, tempScreenStep, NULL, tempScreenStop};
+
 /**
  * @brief DS18B20温度显示功能的菜单入口函数
- * @details 此函数负责启动DS18B20的显示任务，并处理用户的退出操作。
- *          当用户通过按钮、闹钟或全局退出标志请求退出时，它会设置停止标志并安全地清理任务。
+ * @details 温度曲线由绘制工作任务按500ms一步更新，本函数只等待退出操作，
+ *          退出时 Worker_Stop 返回即表示作业已停止，不再需要等待任务自行删除。
  */
 void DS18B20Menu()
 {
-  stopDS18B20Task = false; // 重置停止标志
   tft.fillScreen(TFT_BLACK); // 清屏
-
-  // 创建并启动DS18B20显示任务，固定在核心0上运行
-  xTaskCreatePinnedToCore(DS18B20_Task, "DS18B20_Task", 4096, NULL, 1, NULL, 0);
+  Worker_Start(WORKER_RENDER, &tempScreenJob, 0);
 
   // 循环等待退出信号
   while (1)
@@ -218,28 +333,13 @@ void DS18B20Menu()
     if (exitSubMenu)
     {
       exitSubMenu = false; // 重置标志
-      stopDS18B20Task = true; // 通知任务停止
-      vTaskDelay(pdMS_TO_TICKS(150)); // 等待任务处理停止信号
-      break; // 退出循环
+      break;
     }
-    if (g_alarm_is_ringing)
+    if (g_alarm_is_ringing || readButton())
     {
-      stopDS18B20Task = true; // 通知任务停止
-      vTaskDelay(pdMS_TO_TICKS(150)); // 等待任务处理停止信号
-      break; // 退出循环
-    }
-    if (readButton())
-    {
-      stopDS18B20Task = true; // 通知任务停止
-      // 等待任务确认删除
-      TaskHandle_t task = xTaskGetHandle("DS18B20_Task");
-      for (int i = 0; i < 150 && task != NULL; i++)
-      {
-        if (eTaskGetState(task) == eDeleted) break;
-        vTaskDelay(pdMS_TO_TICKS(10));
-      }
-      break; // 退出循环
+      break;
     }
     vTaskDelay(pdMS_TO_TICKS(10)); // 短暂延迟，避免CPU空转
   }
-}
\ No newline at end of file
+  Worker_Stop(WORKER_RENDER);
+}
@@ -25,8 +25,8 @@ float getDS18B20Temp();
 
 /**
  * @brief DS18B20温度监控菜单的入口函数。
- * @details 此函数负责启动一个在TFT屏幕上显示实时温度和历史曲线的任务。
- *          同时，它会监听退出信号（如按钮按下或闹钟触发），并负责安全地停止和清理相关任务。
+ * @details 此函数在绘制工作任务上启动显示实时温度和历史曲线的作业，
+ *          同时监听退出信号（如按钮按下或闹钟触发），退出时停止作业。
  */
 void DS18B20Menu();
 
@@ -0,0 +1,296 @@
+// 包含所有必需的头文件
+#include "DigitAtlas.h"
+
+extern TFT_eSprite menuSprite;
+
+// --- 宏定义 ---
+#define ATLAS_GLYPHS 11 // '0'~'9' 和 ':'（':' 正好是 '0' + 10）
+
+/**
+ * @brief 一种 字体+字号 的数字图集。
+ * @details data 中每个字形依次存放若干行组：[行数][线段数][x0][长度][x1][长度]...，
+ *          各组行数之和等于字形高度。线段坐标相对字符格左上角。
+ */
+struct DigitAtlasStyle
+{
+  uint8_t font;                      // TFT_eSPI 字体编号，0表示未使用
+  uint8_t size;                      // 字号倍数
+  uint8_t height;                    // 字符格高度 (已乘字号)
+  uint8_t baseline;                  // 基线位置 (已乘字号)，用于 *_BASELINE 基准
+  uint8_t advance[ATLAS_GLYPHS];     // 字符格宽度 (已乘字号)
+  uint16_t offset[ATLAS_GLYPHS + 1]; // 每个字形在 data 中的起始位置
+  uint8_t *data;
+};
+
+// --- 全局变量 ---
+static DigitAtlasStyle atlasStyles[DIGIT_ATLAS_MAX_STYLES];
+static bool atlasFull = false; // 槽位用完或内存不足后不再尝试生成
+
+// 表盘用到的字号，开机时预先生成
+static const uint8_t presetStyles[][2] = {
+    {1, 1}, {1, 2}, {1, 3}, {1, 4}, {1, 5}, {1, 7}, // GLCD字体：0.1秒、模拟表盘刻度、秒、冒号、时间
+    {7, 1},                                         // 7段字体：分段表盘的时、分、秒、冒号
+    {4, 1},                                         // 4号字体：分段表盘的0.1秒
+};
+
+/**
+ * @brief 把临时精灵中的一个字形编码为行组
+ * @return 写入的字节数，缓冲区不足时返回-1
+ */
+static int encodeGlyph(TFT_eSprite &scratch, int w, int h, uint8_t *out, int capacity)
+{
+  int pos = 0;
+  int groupStart = -1;   // 当前行组在 out 中的位置
+  int prevRunsStart = 0; // 上一行线段数据的位置，用于比较相邻行是否相同
+  int prevRunsBytes = -1;
+
+  for (int y = 0; y < h; y++)
+  {
+    // 先把本行的线段写到缓冲区末尾 (行组头之后)，若与上一行相同再撤销
+    int runsStart = pos + 2;
+    int p = runsStart;
+    int x = 0;
+    while (x < w)
+    {
+      if (!scratch.readPixelValue(x, y))
+      {
+        x++;
+        continue;
+      }
+      int start = x;
+      while (x < w && scratch.readPixelValue(x, y)) x++;
+      if (p + 2 > capacity) return -1;
+      out[p++] = start;
+      out[p++] = x - start;
+    }
+    int runsBytes = p - runsStart;
+
+    bool same = groupStart >= 0 && runsBytes == prevRunsBytes && out[groupStart] < 255 &&
+                memcmp(out + prevRunsStart, out + runsStart, runsBytes) == 0;
+    if (same)
+    {
+      out[groupStart]++; // 与上一行相同，只增加行数
+      continue;
+    }
+    if (pos + 2 > capacity) return -1;
+    groupStart = pos;
+    out[pos] = 1;
+    out[pos + 1] = runsBytes / 2;
+    prevRunsStart = runsStart;
+    prevRunsBytes = runsBytes;
+    pos = p;
+  }
+  return pos;
+}
+
+/**
+ * @brief 用 TFT_eSPI 本身的字体绘制一次所有字形并编码，保证与 drawString 的结果逐像素一致
+ */
+static bool buildStyle(TFT_eSprite &owner, DigitAtlasStyle *style, uint8_t font, uint8_t size)
+{
+  uint8_t *buf = (uint8_t *)malloc(DIGIT_ATLAS_BUILD_BYTES);
+  if (!buf) return false;
+
+  TFT_eSprite scratch = TFT_eSprite(&owner);
+  scratch.setColorDepth(8);
+  scratch.setTextFont(font);
+  scratch.setTextSize(size);
+
+  int height = scratch.fontHeight(font);
+  int maxWidth = 0;
+  char str[2] = {0, 0};
+  for (int i = 0; i < ATLAS_GLYPHS; i++)
+  {
+    str[0] = '0' + i;
+    int w = scratch.textWidth(str, font);
+    if (w > 255 || height > 255) { free(buf); return false; }
+    style->advance[i] = w;
+    if (w > maxWidth) maxWidth = w;
+  }
+  if (maxWidth == 0 || height == 0 || !scratch.createSprite(maxWidth, height))
+  {
+    free(buf);
+    return false;
+  }
+  scratch.setTextColor(TFT_WHITE); // 透明背景，只有笔画像素非零
+  scratch.setTextDatum(TL_DATUM);
+
+  int pos = 0;
+  for (int i = 0; i < ATLAS_GLYPHS; i++)
+  {
+    str[0] = '0' + i;
+    scratch.fillSprite(TFT_BLACK);
+    scratch.drawString(str, 0, 0);
+    style->offset[i] = pos;
+    int bytes = encodeGlyph(scratch, style->advance[i], height, buf + pos, DIGIT_ATLAS_BUILD_BYTES - pos);
+    if (bytes < 0)
+    {
+      scratch.deleteSprite();
+      free(buf);
+      return false;
+    }
+    pos += bytes;
+  }
+  style->offset[ATLAS_GLYPHS] = pos;
+  scratch.deleteSprite();
+
+  style->data = (uint8_t *)realloc(buf, pos ? pos : 1); // 缩小到实际大小
+  if (!style->data)
+  {
+    free(buf);
+    return false;
+  }
+  style->font = font;
+  style->size = size;
+  style->height = height;
+  style->baseline = (font == 1) ? 0 : pgm_read_byte(&fontdata[font].baseline) * size;
+  return true;
+}
+
+/**
+ * @brief 查找某个 字体+字号 的图集，不存在则生成
+ */
+static DigitAtlasStyle *getStyle(TFT_eSprite &sprite, uint8_t font, uint8_t size)
+{
+  for (int i = 0; i < DIGIT_ATLAS_MAX_STYLES; i++)
+  {
+    if (atlasStyles[i].font == font && atlasStyles[i].size == size)
+    {
+      return &atlasStyles[i];
+    }
+  }
+  if (atlasFull) return NULL;
+  for (int i = 0; i < DIGIT_ATLAS_MAX_STYLES; i++)
+  {
+    if (atlasStyles[i].font == 0)
+    {
+      if (buildStyle(sprite, &atlasStyles[i], font, size)) return &atlasStyles[i];
+      break;
+    }
+  }
+  atlasFull = true;
+  return NULL;
+}
+
+/**
+ * @brief 绘制一个字形，只画与 [clipX0, clipX1) x [clipY0, clipY1) 相交的部分
+ */
+static void blitGlyph(TFT_eSprite &sprite, const DigitAtlasStyle *style, int index, int32_t x, int32_t y,
+                      int32_t clipX0, int32_t clipY0, int32_t clipX1, int32_t clipY1)
+{
+  uint32_t fg = sprite.textcolor, bg = sprite.textbgcolor;
+  int32_t w = style->advance[index];
+
+  // 不透明文字先填充整个字符格，与 drawChar 一致
+  if (fg != bg)
+  {
+    int32_t bx0 = max(x, clipX0), by0 = max(y, clipY0);
+    int32_t bx1 = min((int32_t)(x + w), clipX1), by1 = min((int32_t)(y + style->height), clipY1);
+    if (bx1 > bx0 && by1 > by0) sprite.fillRect(bx0, by0, bx1 - bx0, by1 - by0, bg);
+  }
+
+  const uint8_t *p = style->data + style->offset[index];
+  const uint8_t *end = style->data + style->offset[index + 1];
+  int32_t row = y;
+  // 每个行组的每条线段只需一次 fillRect，精灵内部按行连续写入
+  while (p < end && row < clipY1)
+  {
+    uint8_t rows = p[0], runs = p[1];
+    p += 2;
+    int32_t ry0 = max(row, clipY0), ry1 = min((int32_t)(row + rows), clipY1);
+    if (ry1 > ry0)
+    {
+      for (uint8_t r = 0; r < runs; r++)
+      {
+        int32_t runX = x + p[2 * r];
+        int32_t rx0 = max(runX, clipX0), rx1 = min((int32_t)(runX + p[2 * r + 1]), clipX1);
+        if (rx1 > rx0) sprite.fillRect(rx0, ry0, rx1 - rx0, ry1 - ry0, fg);
+      }
+    }
+    p += runs * 2;
+    row += rows;
+  }
+}
+
+/**
+ * @brief 检查字符串是否可以用图集绘制
+ */
+static bool atlasCanDraw(TFT_eSprite &sprite, const char *text)
+{
+  if (sprite.fontLoaded || sprite.getTextPadding() || sprite.textfont == 0 || sprite.textfont > 8)
+  {
+    return false; // 平滑字体、带填充宽度的文本仍交给 drawString
+  }
+  for (const char *c = text; *c; c++)
+  {
+    if (*c < '0' || *c > ':') return false;
+  }
+  return true;
+}
+
+void DigitAtlas_Init()
+{
+  for (unsigned i = 0; i < sizeof(presetStyles) / sizeof(presetStyles[0]); i++)
+  {
+    getStyle(menuSprite, presetStyles[i][0], presetStyles[i][1]);
+  }
+}
+
+int16_t DigitAtlas_DrawString(TFT_eSprite &sprite, const char *text, int32_t x, int32_t y)
+{
+  DigitAtlasStyle *style = atlasCanDraw(sprite, text) ? getStyle(sprite, sprite.textfont, sprite.textsize) : NULL;
+  if (!style)
+  {
+    return sprite.drawString(text, x, y);
+  }
+
+  int32_t width = 0;
+  for (const char *c = text; *c; c++) width += style->advance[*c - '0'];
+  int32_t height = style->height;
+
+  // 与 drawString 相同的基准换算
+  switch (sprite.getTextDatum())
+  {
+    case TC_DATUM: x -= width / 2; break;
+    case TR_DATUM: x -= width; break;
+    case ML_DATUM: y -= height / 2; break;
+    case MC_DATUM: x -= width / 2; y -= height / 2; break;
+    case MR_DATUM: x -= width; y -= height / 2; break;
+    case BL_DATUM: y -= height; break;
+    case BC_DATUM: x -= width / 2; y -= height; break;
+    case BR_DATUM: x -= width; y -= height; break;
+    case L_BASELINE: y -= style->baseline; break;
+    case C_BASELINE: x -= width / 2; y -= style->baseline; break;
+    case R_BASELINE: x -= width; y -= style->baseline; break;
+  }
+
+  // 精灵的 fillRect 会再按视口裁剪，这里不限制范围
+  for (const char *c = text; *c; c++)
+  {
+    int index = *c - '0';
+    blitGlyph(sprite, style, index, x, y, INT16_MIN, INT16_MIN, INT16_MAX, INT16_MAX);
+    x += style->advance[index];
+  }
+  return width;
+}
+
+void DigitAtlas_DrawCharClipped(TFT_eSprite &sprite, char c, int32_t x, int32_t y,
+                                int32_t clipX, int32_t clipY, int32_t clipW, int32_t clipH)
+{
+  if (clipW <= 0 || clipH <= 0) return;
+
+  char str[2] = {c, 0};
+  DigitAtlasStyle *style = atlasCanDraw(sprite, str) ? getStyle(sprite, sprite.textfont, sprite.textsize) : NULL;
+  if (!style)
+  {
+    // 退回视口裁剪
+    uint8_t datum = sprite.getTextDatum();
+    sprite.setTextDatum(TL_DATUM);
+    sprite.setViewport(clipX, clipY, clipW, clipH);
+    sprite.drawString(str, x - clipX, y - clipY);
+    sprite.resetViewport();
+    sprite.setTextDatum(datum);
+    return;
+  }
+  blitGlyph(sprite, style, c - '0', x, y, clipX, clipY, clipX + clipW, clipY + clipH);
+}
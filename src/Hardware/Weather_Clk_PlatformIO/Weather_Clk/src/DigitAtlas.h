@@ -0,0 +1,34 @@
+#ifndef DIGIT_ATLAS_H
+#define DIGIT_ATLAS_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define DIGIT_ATLAS_MAX_STYLES   10   // 最多缓存的 字体+字号 组合数
+#define DIGIT_ATLAS_BUILD_BYTES  4096 // 生成一种字号时使用的临时编码缓冲区大小
+
+/**
+ * @brief 预先生成表盘用到的时钟数字字号。
+ * @details 图集只保存 '0'~'9' 和 ':' 的形状，与颜色无关：每个字形编码为若干“行组”，
+ *          连续相同的像素行合并为一组，每组是若干水平线段，绘制时一段就是一次 fillRect。
+ *          放大的GLCD字体每个点都是一个方块，一个字形只需要十几个矩形；7段字体的笔画也大多是整块矩形。
+ *          未预先生成的字号在第一次使用时生成。
+ */
+void DigitAtlas_Init();
+
+/**
+ * @brief 用图集绘制时间字符串，行为与 sprite.drawString(text, x, y) 相同。
+ * @param sprite 目标精灵，使用其当前的字体、字号、文字颜色、背景色（两者相同时透明）和文本基准 (datum)。
+ * @param text 只包含数字和冒号的字符串；含有其他字符或内存不足时自动退回 drawString。
+ * @return 绘制的像素宽度。
+ */
+int16_t DigitAtlas_DrawString(TFT_eSprite &sprite, const char *text, int32_t x, int32_t y);
+
+/**
+ * @brief 用图集绘制单个字符，只画落在裁剪矩形内的部分（左上角对齐）。
+ * @details 用于数字滚动/扫描动画，代替 setViewport + drawString + resetViewport。
+ */
+void DigitAtlas_DrawCharClipped(TFT_eSprite &sprite, char c, int32_t x, int32_t y,
+                                int32_t clipX, int32_t clipY, int32_t clipW, int32_t clipH);
+
+#endif // DIGIT_ATLAS_H
@@ -0,0 +1,501 @@
+// 包含所有必需的头文件
+#include "Display.h"
+#include "HwScroll.h"
+#include "Profiler.h"
+#include "Power.h"
+
+extern TFT_eSPI tft;
+extern TFT_eSprite menuSprite;
+
+// --- 差分推送 ---
+#define DIFF_COLS ((TFT_WIDTH + DISPLAY_DIFF_TILE - 1) / DISPLAY_DIFF_TILE)
+#define DIFF_ROWS ((TFT_HEIGHT + DISPLAY_DIFF_TILE - 1) / DISPLAY_DIFF_TILE)
+
+/**
+ * @brief 一次推送请求：把精灵中的 (rx, ry, rw, rh) 区域推送到屏幕，精灵原点位于屏幕 (tx, ty)
+ */
+struct DisplayCommand
+{
+  int16_t tx, ty;
+  int16_t rx, ry, rw, rh;
+  TaskHandle_t owner; // 推送完成后通知的任务
+};
+
+// --- 全局变量 ---
+static QueueHandle_t displayQueue = NULL;
+static SemaphoreHandle_t displayMutex = NULL;
+static TaskHandle_t displayTaskHandle = NULL;
+static TickType_t lastPushTick = 0;
+static DisplayStats stats = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+static volatile uint16_t frameIntervalMs = DISPLAY_MIN_FRAME_MS;
+static volatile bool blanked = false;
+static DisplayFrameCallback frameCallback = NULL;
+static uint64_t pushUsTotal = 0;   // 用于计算平均推送耗时
+static uint64_t frameMsTotal = 0;  // 用于计算平均帧间隔
+static uint64_t bytesTotal = 0;    // 用于计算平均每帧发送字节数
+
+static uint32_t tileHash[DIFF_ROWS][DIFF_COLS]; // 上一次发送到屏幕的每个块的哈希
+static bool hashValid = false;                  // 屏幕内容与 tileHash 一致
+static int16_t hashTx = 0, hashTy = 0;          // tileHash 对应的屏幕偏移
+
+/**
+ * @brief 把精灵缓冲区中 (x, y, w, h) 区域用一个地址窗口连续写到屏幕，精灵原点位于屏幕 (tx, ty)
+ * @return 发送的字节数
+ */
+static uint32_t pushWindow(const uint16_t *buf, int32_t stride, int32_t tx, int32_t ty,
+                           int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  // 裁掉屏幕外的部分 (ADC 界面把精灵推送到 y=130，下半部分在屏幕外)
+  if (tx + x + w > tft.width()) w = tft.width() - tx - x;
+  if (ty + y + h > tft.height()) h = tft.height() - ty - y;
+  if (w <= 0 || h <= 0)
+  {
+    return 0;
+  }
+
+  tft.setAddrWindow(tx + x, ty + y, w, h);
+  const uint16_t *p = buf + y * stride + x;
+  if (w == stride)
+  {
+    tft.pushPixels(p, w * h);
+  }
+  else
+  {
+    for (int32_t r = 0; r < h; r++, p += stride)
+    {
+      tft.pushPixels(p, w);
+    }
+  }
+  stats.windowsLast++;
+  return w * h * 2;
+}
+
+/**
+ * @brief 差分推送整帧：只发送哈希与上一帧不同的块
+ * @return 发送的字节数
+ */
+static uint32_t pushDiff(const DisplayCommand &cmd)
+{
+  const uint16_t *buf = (const uint16_t *)menuSprite.getPointer();
+  int32_t width = menuSprite.width(), height = menuSprite.height();
+  int32_t cols = (width + DISPLAY_DIFF_TILE - 1) / DISPLAY_DIFF_TILE;
+  int32_t rows = (height + DISPLAY_DIFF_TILE - 1) / DISPLAY_DIFF_TILE;
+  bool valid = hashValid && hashTx == cmd.tx && hashTy == cmd.ty;
+  if (!valid)
+  {
+    stats.fullFrames++;
+  }
+
+  uint32_t bytes = 0;
+  int32_t pendX = 0, pendW = 0, pendY = 0, pendH = 0; // 等待与下一块行合并的窗口
+
+  bool swap = tft.getSwapBytes();
+  tft.setSwapBytes(false); // 精灵缓冲区已是屏幕字节序
+  tft.startWrite();
+  for (int32_t r = 0; r < rows; r++)
+  {
+    int32_t y0 = r * DISPLAY_DIFF_TILE;
+    int32_t h = min((int32_t)DISPLAY_DIFF_TILE, height - y0);
+
+    // 每个块的哈希 (按32位字的 FNV-1a)，每行一次顺序读取
+    uint32_t hash[DIFF_COLS];
+    for (int32_t c = 0; c < cols; c++) hash[c] = 2166136261u;
+    for (int32_t y = y0; y < y0 + h; y++)
+    {
+      const uint32_t *line = (const uint32_t *)(buf + y * width);
+      for (int32_t c = 0; c < cols; c++)
+      {
+        const uint32_t *p = line + c * (DISPLAY_DIFF_TILE / 2);
+        int32_t words = min((int32_t)DISPLAY_DIFF_TILE, width - c * DISPLAY_DIFF_TILE) / 2;
+        uint32_t v = hash[c];
+        for (int32_t i = 0; i < words; i++) v = (v ^ p[i]) * 16777619u;
+        hash[c] = v;
+      }
+    }
+
+    // 找出本块行中的变化区间，相隔不超过 DISPLAY_DIFF_GAP 块的合并
+    int32_t spanX[DIFF_COLS], spanW[DIFF_COLS];
+    int spans = 0;
+    int32_t lastDirty = -DISPLAY_DIFF_GAP - 2;
+    for (int32_t c = 0; c < cols; c++)
+    {
+      bool dirty = !valid || hash[c] != tileHash[r][c];
+      tileHash[r][c] = hash[c];
+      if (!dirty) continue;
+
+      int32_t x = c * DISPLAY_DIFF_TILE;
+      int32_t w = min((int32_t)DISPLAY_DIFF_TILE, width - x);
+      if (spans > 0 && c - lastDirty <= DISPLAY_DIFF_GAP + 1)
+      {
+        spanW[spans - 1] = x + w - spanX[spans - 1];
+      }
+      else
+      {
+        spanX[spans] = x;
+        spanW[spans] = w;
+        spans++;
+      }
+      lastDirty = c;
+    }
+
+    // 只有一个区间且与上一块行的列范围相同时，向下延长同一个窗口
+    if (spans == 1 && pendH > 0 && spanX[0] == pendX && spanW[0] == pendW)
+    {
+      pendH += h;
+      continue;
+    }
+    if (pendH > 0)
+    {
+      bytes += pushWindow(buf, width, cmd.tx, cmd.ty, pendX, pendY, pendW, pendH);
+      pendH = 0;
+    }
+    if (spans == 1)
+    {
+      pendX = spanX[0];
+      pendW = spanW[0];
+      pendY = y0;
+      pendH = h;
+    }
+    else
+    {
+      for (int i = 0; i < spans; i++)
+      {
+        bytes += pushWindow(buf, width, cmd.tx, cmd.ty, spanX[i], y0, spanW[i], h);
+      }
+    }
+  }
+  if (pendH > 0)
+  {
+    bytes += pushWindow(buf, width, cmd.tx, cmd.ty, pendX, pendY, pendW, pendH);
+  }
+  tft.endWrite();
+  tft.setSwapBytes(swap);
+
+  hashValid = true;
+  hashTx = cmd.tx;
+  hashTy = cmd.ty;
+  return bytes;
+}
+
+/**
+ * @brief 这一次推送能否使用差分
+ */
+static bool canPushDiff(const DisplayCommand &cmd)
+{
+#if DISPLAY_DIFF_PUSH
+  return cmd.rx == 0 && cmd.ry == 0 && cmd.rw == menuSprite.width() && cmd.rh == menuSprite.height() &&
+         cmd.tx >= 0 && cmd.ty >= 0 && menuSprite.getColorDepth() == 16 && (menuSprite.width() & 1) == 0 &&
+         menuSprite.width() <= DIFF_COLS * DISPLAY_DIFF_TILE && menuSprite.height() <= DIFF_ROWS * DISPLAY_DIFF_TILE;
+#else
+  return false;
+#endif
+}
+
+/**
+ * @brief 推送一个区域并更新统计，调用者必须持有总线锁
+ */
+static void pushRegion(const DisplayCommand &cmd)
+{
+  TickType_t now = xTaskGetTickCount();
+  if (stats.frames > 0)
+  {
+    frameMsTotal += pdTICKS_TO_MS(now - lastPushTick);
+  }
+  lastPushTick = now;
+
+  // menuSprite 按固定映射绘制，滚动视图退出后第一次推送时恢复
+  if (HwScroll_IsActive())
+  {
+    HwScroll_End();
+  }
+
+  uint32_t start = micros();
+  uint32_t bytes;
+  stats.windowsLast = 0;
+  if (canPushDiff(cmd))
+  {
+    bytes = pushDiff(cmd);
+  }
+  else
+  {
+    // 局部推送之后屏幕上其余部分与缓存的哈希不再对应
+    hashValid = false;
+    if (cmd.rx == 0 && cmd.ry == 0 && cmd.rw == menuSprite.width() && cmd.rh == menuSprite.height())
+    {
+      menuSprite.pushSprite(cmd.tx, cmd.ty);
+    }
+    else
+    {
+      menuSprite.pushSprite(cmd.tx + cmd.rx, cmd.ty + cmd.ry, cmd.rx, cmd.ry, cmd.rw, cmd.rh);
+    }
+    bytes = cmd.rw * cmd.rh * 2;
+    stats.windowsLast = 1;
+  }
+  uint32_t elapsed = micros() - start;
+
+  stats.frames++;
+  pushUsTotal += elapsed;
+  if (elapsed > stats.pushUsMax) stats.pushUsMax = elapsed;
+  stats.pushUsAvg = pushUsTotal / stats.frames;
+  stats.bytesLast = bytes;
+  bytesTotal += bytes;
+  stats.bytesAvg = bytesTotal / stats.frames;
+  stats.frameMsAvg = (stats.frames > 1) ? frameMsTotal / (stats.frames - 1) : 0;
+}
+
+/**
+ * @brief 获取总线锁但不使差分缓存失效，供本模块自己推送时使用
+ */
+static void lockBus()
+{
+  if (displayMutex != NULL)
+  {
+    xSemaphoreTakeRecursive(displayMutex, portMAX_DELAY);
+  }
+}
+
+static void unlockBus()
+{
+  if (displayMutex != NULL)
+  {
+    xSemaphoreGiveRecursive(displayMutex);
+  }
+}
+
+/**
+ * @brief 按帧间隔下限等待 (类似垂直同步)
+ */
+static void waitFrameSlot()
+{
+  if (stats.frames == 0 && stats.blanked == 0)
+  {
+    return;
+  }
+  bool waited = false;
+  for (;;)
+  {
+    // 每段等待后重新读取间隔，空闲时的长间隔在唤醒后立即失效
+    TickType_t minTicks = pdMS_TO_TICKS(frameIntervalMs);
+    TickType_t since = xTaskGetTickCount() - lastPushTick;
+    if (since >= minTicks)
+    {
+      break;
+    }
+    TickType_t wait = minTicks - since;
+    if (wait > pdMS_TO_TICKS(DISPLAY_WAIT_SLICE_MS)) wait = pdMS_TO_TICKS(DISPLAY_WAIT_SLICE_MS);
+    vTaskDelay(wait);
+    waited = true;
+  }
+  if (waited)
+  {
+    stats.throttled++;
+  }
+}
+
+/**
+ * @brief 推送一个区域；屏幕熄灭时只推进帧节拍，不发送数据
+ */
+static void presentRegion(const DisplayCommand &cmd)
+{
+  if (blanked)
+  {
+    lastPushTick = xTaskGetTickCount();
+    stats.blanked++;
+    return;
+  }
+  Power_LockAcquire(POWER_LOCK_PUSH); // SPI 时钟由 APB 分频，推送期间不能降频
+  lockBus();
+  pushRegion(cmd);
+  unlockBus();
+  Power_LockRelease(POWER_LOCK_PUSH);
+  if (frameCallback != NULL)
+  {
+    frameCallback();
+  }
+}
+
+/**
+ * @brief 把 b 合并进 a 的区域 (两者的屏幕偏移相同)
+ */
+static void unionRegion(DisplayCommand &a, const DisplayCommand &b)
+{
+  int16_t x0 = min(a.rx, b.rx), y0 = min(a.ry, b.ry);
+  int16_t x1 = max((int16_t)(a.rx + a.rw), (int16_t)(b.rx + b.rw));
+  int16_t y1 = max((int16_t)(a.ry + a.rh), (int16_t)(b.ry + b.rh));
+  a.rx = x0;
+  a.ry = y0;
+  a.rw = x1 - x0;
+  a.rh = y1 - y0;
+}
+
+/**
+ * @brief [FreeRTOS Task] 渲染任务，唯一向屏幕推送 menuSprite 的任务
+ * @details 取出一个提交后先按帧间隔等待，再把等待期间到达的、屏幕偏移相同的提交合并成一次推送，
+ *          推送完成后逐个通知提交者。
+ */
+static void Display_Task(void *pvParameters)
+{
+#if DISPLAY_STATS_LOG
+  TickType_t lastLog = xTaskGetTickCount();
+#endif
+  for (;;)
+  {
+    DisplayCommand cmd;
+    if (xQueueReceive(displayQueue, &cmd, pdMS_TO_TICKS(10000)) != pdTRUE)
+    {
+      continue;
+    }
+    waitFrameSlot();
+
+    TaskHandle_t owners[DISPLAY_QUEUE_LEN + 1];
+    int ownerCount = 0;
+    owners[ownerCount++] = cmd.owner;
+
+    DisplayCommand next;
+    while (ownerCount <= DISPLAY_QUEUE_LEN && xQueuePeek(displayQueue, &next, 0) == pdTRUE)
+    {
+      if (next.tx != cmd.tx || next.ty != cmd.ty)
+      {
+        break; // 偏移不同的提交留到下一帧
+      }
+      xQueueReceive(displayQueue, &next, 0);
+      unionRegion(cmd, next);
+      owners[ownerCount++] = next.owner;
+      stats.coalesced++;
+    }
+
+    presentRegion(cmd);
+
+    for (int i = 0; i < ownerCount; i++)
+    {
+      xTaskNotifyGive(owners[i]);
+    }
+
+#if DISPLAY_STATS_LOG
+    if (xTaskGetTickCount() - lastLog > pdMS_TO_TICKS(10000))
+    {
+      lastLog = xTaskGetTickCount();
+      Serial.printf("[Display] frames %lu, interval %lu ms, push avg %lu us max %lu us, throttled %lu, coalesced %lu\n",
+                    (unsigned long)stats.frames, (unsigned long)stats.frameMsAvg, (unsigned long)stats.pushUsAvg,
+                    (unsigned long)stats.pushUsMax, (unsigned long)stats.throttled, (unsigned long)stats.coalesced);
+      Serial.printf("[Display] bytes/frame avg %lu last %lu, windows %lu, full frames %lu\n",
+                    (unsigned long)stats.bytesAvg, (unsigned long)stats.bytesLast,
+                    (unsigned long)stats.windowsLast, (unsigned long)stats.fullFrames);
+    }
+#endif
+  }
+}
+
+/**
+ * @brief 提交一次推送并等待完成
+ */
+static void submit(DisplayCommand cmd)
+{
+  // 渲染任务尚未启动，或调用者已持有总线锁 (等待渲染任务会死锁)，直接在本任务中推送
+  if (displayTaskHandle == NULL || xSemaphoreGetMutexHolder(displayMutex) == xTaskGetCurrentTaskHandle())
+  {
+    lockBus();
+    waitFrameSlot();
+    presentRegion(cmd);
+    unlockBus();
+    return;
+  }
+
+  cmd.owner = xTaskGetCurrentTaskHandle();
+  ulTaskNotifyTake(pdTRUE, 0); // 清除之前超时遗留的通知
+  if (xQueueSend(displayQueue, &cmd, pdMS_TO_TICKS(DISPLAY_PRESENT_TIMEOUT_MS)) != pdTRUE ||
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(DISPLAY_PRESENT_TIMEOUT_MS)) == 0)
+  {
+    stats.timeouts++;
+  }
+}
+
+void Display_Init()
+{
+  if (displayTaskHandle != NULL)
+  {
+    return;
+  }
+  displayMutex = xSemaphoreCreateRecursiveMutex();
+  displayQueue = xQueueCreate(DISPLAY_QUEUE_LEN, sizeof(DisplayCommand));
+  // 优先级高于所有绘制任务，提交后尽快推送
+  xTaskCreatePinnedToCore(Display_Task, "Display", 3072, NULL, 3, &displayTaskHandle, 0);
+}
+
+void Display_Present(int32_t x, int32_t y)
+{
+  if (Profiler_OverlayEnabled())
+  {
+    Profiler_DrawOverlay(menuSprite);
+  }
+  PROF_SCOPE(PROF_STAGE_PUSH);
+  DisplayCommand cmd = {(int16_t)x, (int16_t)y, 0, 0, (int16_t)menuSprite.width(), (int16_t)menuSprite.height(), NULL};
+  submit(cmd);
+}
+
+void Display_PresentRegion(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  // 裁剪到精灵范围内
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > menuSprite.width()) w = menuSprite.width() - x;
+  if (y + h > menuSprite.height()) h = menuSprite.height() - y;
+  if (w <= 0 || h <= 0)
+  {
+    return;
+  }
+  DisplayCommand cmd = {0, 0, (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, NULL};
+  submit(cmd);
+}
+
+void Display_Invalidate()
+{
+  hashValid = false;
+}
+
+void Display_Lock()
+{
+  if (displayMutex != NULL) // 启动阶段只有一个任务，不需要锁
+  {
+    xSemaphoreTakeRecursive(displayMutex, portMAX_DELAY);
+  }
+  hashValid = false; // 持锁者会直接改变屏幕内容
+}
+
+void Display_Unlock()
+{
+  if (displayMutex != NULL)
+  {
+    xSemaphoreGiveRecursive(displayMutex);
+  }
+}
+
+void Display_SetFrameInterval(uint16_t ms)
+{
+  frameIntervalMs = ms < DISPLAY_MIN_FRAME_MS ? DISPLAY_MIN_FRAME_MS : ms;
+}
+
+void Display_SetBlank(bool blank)
+{
+  blanked = blank;
+}
+
+void Display_SetFrameCallback(DisplayFrameCallback cb)
+{
+  frameCallback = cb;
+}
+
+DisplayStats Display_GetStats()
+{
+  return stats;
+}
+
+void Display_ResetStats()
+{
+  lockBus();
+  memset(&stats, 0, sizeof(stats));
+  pushUsTotal = 0;
+  frameMsTotal = 0;
+  bytesTotal = 0;
+  unlockBus();
+}
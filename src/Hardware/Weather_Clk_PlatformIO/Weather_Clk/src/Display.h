@@ -0,0 +1,112 @@
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define DISPLAY_QUEUE_LEN          4    // 提交帧队列深度
+#define DISPLAY_MIN_FRAME_MS       16   // 两次推送之间的最小间隔 (约60fps)，更快的提交会被节流
+#define DISPLAY_PRESENT_TIMEOUT_MS 1000 // 等待渲染任务完成推送的最长时间
+#define DISPLAY_STATS_LOG          0    // 置1则渲染任务每10秒在串口输出一次帧统计
+#define DISPLAY_DIFF_PUSH          1    // 置0则每帧整屏推送，不做差分
+#define DISPLAY_DIFF_TILE          16   // 差分推送按 16x16 的块计算哈希，与上一帧比较
+#define DISPLAY_DIFF_GAP           1    // 同一块行中相隔不超过该块数的变化块合并为一个窗口，减少设置窗口的次数
+#define DISPLAY_WAIT_SLICE_MS      20   // 长帧间隔分段等待，间隔被改短 (如唤醒) 时最多再等这么久
+
+/**
+ * @brief 渲染任务的帧统计。
+ */
+struct DisplayStats
+{
+    uint32_t frames;       ///< 已推送的帧数。
+    uint32_t coalesced;    ///< 与同一次推送合并的提交数。
+    uint32_t throttled;    ///< 因帧间隔下限而等待过的帧数。
+    uint32_t timeouts;     ///< 提交或等待超时的次数。
+    uint32_t pushUsAvg;    ///< 平均每帧SPI推送耗时 (微秒)。
+    uint32_t pushUsMax;    ///< 最长一帧的推送耗时 (微秒)。
+    uint32_t frameMsAvg;   ///< 平均帧间隔 (毫秒)。
+    uint32_t bytesLast;    ///< 最近一帧实际发送的像素字节数。
+    uint32_t bytesAvg;     ///< 平均每帧发送的像素字节数 (整屏为115200)。
+    uint32_t windowsLast;  ///< 最近一帧设置地址窗口的次数。
+    uint32_t fullFrames;   ///< 因缓存失效而整屏发送的帧数。
+    uint32_t blanked;      ///< 屏幕熄灭期间丢弃的帧数。
+};
+
+/**
+ * @brief 每推送完一帧后在渲染任务中调用的回调。
+ */
+typedef void (*DisplayFrameCallback)();
+
+/**
+ * @brief 启动唯一负责向屏幕推送画面的渲染任务。
+ * @details 必须在 menuSprite 创建之后调用一次。此前的 Display_Present 直接在调用者中推送。
+ */
+void Display_Init();
+
+/**
+ * @brief 把 menuSprite 整帧提交给渲染任务推送到屏幕的 (x, y) 处，代替 menuSprite.pushSprite(x, y)。
+ * @details 调用者阻塞到这一帧推送完成后返回，之后可以安全地开始绘制下一帧，不会出现半帧画面；
+ *          渲染任务按 DISPLAY_MIN_FRAME_MS 统一节流，动画循环不需要再自行控制帧率。
+ *          同一时刻多个任务提交的帧合并为一次推送。
+ *          渲染任务保存上一帧每个 16x16 块的哈希，只发送哈希变化的块，
+ *          同一块行中相邻的变化块、上下相邻且列范围相同的块行合并为一次地址窗口连续写入。
+ */
+void Display_Present(int32_t x = 0, int32_t y = 0);
+
+/**
+ * @brief 只把 menuSprite 中 (x, y, w, h) 区域推送到屏幕的相同位置。
+ * @details 用于只有局部变化的界面，减少SPI传输量。
+ */
+void Display_PresentRegion(int32_t x, int32_t y, int32_t w, int32_t h);
+
+/**
+ * @brief 声明屏幕内容已被 menuSprite 之外的绘制改变，下一帧整屏推送。
+ * @details 直接用 tft 绘制 (如 tft.fillScreen) 之后、再次调用 Display_Present 之前必须调用，
+ *          否则差分推送会跳过与上一帧相同、但屏幕上已被覆盖的块。Display_Lock 会自动调用它。
+ */
+void Display_Invalidate();
+
+/**
+ * @brief 获取屏幕总线锁。
+ * @details 直接操作 tft（不经过 menuSprite）的代码在后台任务中绘制时必须持有此锁，
+ *          渲染任务推送期间也持有它，保证SPI总线上不会交错出现两个任务的数据。
+ *          可重入；持有锁的任务调用 Display_Present 时直接在本任务中推送。
+ *          持有锁的任务不能被其他任务删除，删除前先由删除者获取锁。
+ *          持锁者会直接改变屏幕内容，所以同时使差分推送的缓存失效。
+ */
+void Display_Lock();
+
+/**
+ * @brief 释放屏幕总线锁。
+ */
+void Display_Unlock();
+
+/**
+ * @brief 设置两次推送之间的最小间隔，默认 DISPLAY_MIN_FRAME_MS。
+ * @details 空闲时调大可以让所有界面降到低帧率，绘制循环阻塞在 Display_Present 中，CPU得以休眠。
+ *          不能超过 DISPLAY_PRESENT_TIMEOUT_MS，否则提交者会等待超时。
+ */
+void Display_SetFrameInterval(uint16_t ms);
+
+/**
+ * @brief 屏幕熄灭时丢弃所有推送，只按帧间隔让提交者等待。
+ * @details 被丢弃的帧不更新差分缓存，恢复后第一帧只发送与熄灭前屏幕内容不同的块。
+ */
+void Display_SetBlank(bool blank);
+
+/**
+ * @brief 注册推送完成回调，传入 NULL 取消。
+ */
+void Display_SetFrameCallback(DisplayFrameCallback cb);
+
+/**
+ * @brief 获取帧统计。
+ */
+DisplayStats Display_GetStats();
+
+/**
+ * @brief 清零帧统计。
+ */
+void Display_ResetStats();
+
+#endif // DISPLAY_H
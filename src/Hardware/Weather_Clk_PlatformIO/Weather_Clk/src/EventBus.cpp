@@ -0,0 +1,234 @@
+// 包含所有必需的头文件
+#include "EventBus.h"
+#include <esp_timer.h>
+
+static const char *const typeNames[EVENT_TYPE_COUNT] = {"play_song", "alarm_ring", "alarm_stop", "wake", "sensor"};
+
+/**
+ * @brief 订阅者表的一项
+ */
+struct CallbackSub
+{
+  AppEventCallback callback;
+  uint32_t mask;
+};
+
+struct QueueSub
+{
+  QueueHandle_t queue;
+  uint32_t mask;
+};
+
+/**
+ * @brief 一种事件的累计统计
+ */
+struct TypeCounters
+{
+  uint32_t published;
+  uint32_t delivered;
+  uint32_t dropped;
+  uint32_t received;
+  uint32_t latencyMaxUs;
+  uint64_t latencyTotalUs;
+};
+
+// --- 订阅者表 ---
+static CallbackSub callbacks[EVENT_BUS_MAX_CALLBACKS] = {};
+static QueueSub queues[EVENT_BUS_MAX_QUEUES] = {};
+static portMUX_TYPE subscriberMux = portMUX_INITIALIZER_UNLOCKED; // 保护订阅者表的修改
+
+// --- 统计 ---
+static TypeCounters counters[EVENT_TYPE_COUNT] = {};
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+bool EventBus_Subscribe(AppEventCallback callback, uint32_t mask)
+{
+  int slot = -1;
+  portENTER_CRITICAL(&subscriberMux);
+  for (int i = 0; i < EVENT_BUS_MAX_CALLBACKS; i++)
+  {
+    if (callbacks[i].callback == callback)
+    {
+      slot = i;
+      break;
+    }
+    if (callbacks[i].callback == NULL && slot < 0) slot = i;
+  }
+  if (slot >= 0) callbacks[slot] = {callback, mask};
+  portEXIT_CRITICAL(&subscriberMux);
+  return slot >= 0;
+}
+
+void EventBus_Unsubscribe(AppEventCallback callback)
+{
+  portENTER_CRITICAL(&subscriberMux);
+  for (int i = 0; i < EVENT_BUS_MAX_CALLBACKS; i++)
+  {
+    if (callbacks[i].callback == callback) callbacks[i] = {NULL, 0};
+  }
+  portEXIT_CRITICAL(&subscriberMux);
+}
+
+bool EventBus_SubscribeQueue(QueueHandle_t queue, uint32_t mask)
+{
+  int slot = -1;
+  portENTER_CRITICAL(&subscriberMux);
+  for (int i = 0; i < EVENT_BUS_MAX_QUEUES; i++)
+  {
+    if (queues[i].queue == queue)
+    {
+      slot = i;
+      break;
+    }
+    if (queues[i].queue == NULL && slot < 0) slot = i;
+  }
+  if (slot >= 0) queues[slot] = {queue, mask};
+  portEXIT_CRITICAL(&subscriberMux);
+  if (slot < 0)
+  {
+    Serial.println("[EventBus] no free queue slot");
+  }
+  return slot >= 0;
+}
+
+void EventBus_UnsubscribeQueue(QueueHandle_t queue)
+{
+  portENTER_CRITICAL(&subscriberMux);
+  for (int i = 0; i < EVENT_BUS_MAX_QUEUES; i++)
+  {
+    if (queues[i].queue == queue) queues[i] = {NULL, 0};
+  }
+  portEXIT_CRITICAL(&subscriberMux);
+}
+
+void EventBus_Publish(AppEventType type, int32_t a, int32_t b)
+{
+  AppEvent event = {type, a, b, (uint32_t)esp_timer_get_time()};
+  uint32_t bit = EVENT_MASK(type);
+
+  // 先复制订阅者表，回调和队列发送都在临界区之外进行
+  CallbackSub localCallbacks[EVENT_BUS_MAX_CALLBACKS];
+  QueueSub localQueues[EVENT_BUS_MAX_QUEUES];
+  portENTER_CRITICAL(&subscriberMux);
+  memcpy(localCallbacks, callbacks, sizeof(localCallbacks));
+  memcpy(localQueues, queues, sizeof(localQueues));
+  portEXIT_CRITICAL(&subscriberMux);
+
+  uint32_t delivered = 0;
+  uint32_t dropped = 0;
+  for (int i = 0; i < EVENT_BUS_MAX_CALLBACKS; i++)
+  {
+    if (localCallbacks[i].callback != NULL && (localCallbacks[i].mask & bit))
+    {
+      localCallbacks[i].callback(event);
+      delivered++;
+    }
+  }
+  for (int i = 0; i < EVENT_BUS_MAX_QUEUES; i++)
+  {
+    if (localQueues[i].queue == NULL || !(localQueues[i].mask & bit)) continue;
+    if (xQueueSend(localQueues[i].queue, &event, 0) == pdTRUE) delivered++; // 队列满则丢弃，不阻塞发布者
+    else dropped++;
+  }
+
+  portENTER_CRITICAL(&statsMux);
+  counters[type].published++;
+  counters[type].delivered += delivered;
+  counters[type].dropped += dropped;
+  portEXIT_CRITICAL(&statsMux);
+
+  if (dropped)
+  {
+    Serial.printf("[EventBus] %s dropped by %lu subscriber(s)\n", typeNames[type], (unsigned long)dropped);
+  }
+}
+
+bool EventBus_Receive(QueueHandle_t queue, AppEvent *event, uint32_t ms)
+{
+  if (xQueueReceive(queue, event, pdMS_TO_TICKS(ms)) != pdTRUE)
+  {
+    return false;
+  }
+  uint32_t latency = (uint32_t)esp_timer_get_time() - event->publishUs;
+  if (event->type < EVENT_TYPE_COUNT)
+  {
+    portENTER_CRITICAL(&statsMux);
+    TypeCounters &c = counters[event->type];
+    c.received++;
+    c.latencyTotalUs += latency;
+    if (latency > c.latencyMaxUs) c.latencyMaxUs = latency;
+    portEXIT_CRITICAL(&statsMux);
+  }
+  return true;
+}
+
+EventBusStats EventBus_GetStats(AppEventType type)
+{
+  portENTER_CRITICAL(&statsMux);
+  TypeCounters c = counters[type];
+  portEXIT_CRITICAL(&statsMux);
+
+  EventBusStats s;
+  s.published = c.published;
+  s.delivered = c.delivered;
+  s.dropped = c.dropped;
+  s.received = c.received;
+  s.latencyMaxUs = c.latencyMaxUs;
+  s.latencyAvgUs = c.received ? (uint32_t)(c.latencyTotalUs / c.received) : 0;
+  return s;
+}
+
+const char *EventBus_TypeName(AppEventType type)
+{
+  return type < EVENT_TYPE_COUNT ? typeNames[type] : "?";
+}
+
+void EventBus_Dump()
+{
+  Serial.println("[EventBus] event        published delivered dropped received  avg_us  max_us");
+  for (int i = 0; i < EVENT_TYPE_COUNT; i++)
+  {
+    EventBusStats s = EventBus_GetStats((AppEventType)i);
+    Serial.printf("[EventBus] %-12s %9lu %9lu %7lu %8lu %7lu %7lu\n", typeNames[i], (unsigned long)s.published,
+                  (unsigned long)s.delivered, (unsigned long)s.dropped, (unsigned long)s.received,
+                  (unsigned long)s.latencyAvgUs, (unsigned long)s.latencyMaxUs);
+  }
+
+  int callbackCount = 0;
+  int queueCount = 0;
+  portENTER_CRITICAL(&subscriberMux);
+  for (int i = 0; i < EVENT_BUS_MAX_CALLBACKS; i++)
+  {
+    if (callbacks[i].callback != NULL) callbackCount++;
+  }
+  for (int i = 0; i < EVENT_BUS_MAX_QUEUES; i++)
+  {
+    if (queues[i].queue != NULL) queueCount++;
+  }
+  portEXIT_CRITICAL(&subscriberMux);
+  Serial.printf("[EventBus] subscribers: %d/%d callbacks, %d/%d queues\n", callbackCount, EVENT_BUS_MAX_CALLBACKS,
+                queueCount, EVENT_BUS_MAX_QUEUES);
+}
+
+bool EventBus_HandleCommand(const char *line)
+{
+  if (strncmp(line, "events", 6) != 0)
+  {
+    return false;
+  }
+  const char *arg = line + 6;
+  while (*arg == ' ') arg++;
+
+  if (strncmp(arg, "reset", 5) == 0)
+  {
+    portENTER_CRITICAL(&statsMux);
+    memset(counters, 0, sizeof(counters));
+    portEXIT_CRITICAL(&statsMux);
+    Serial.println("[EventBus] stats reset");
+  }
+  else
+  {
+    EventBus_Dump();
+  }
+  return true;
+}
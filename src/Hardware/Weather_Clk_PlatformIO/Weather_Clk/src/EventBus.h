@@ -0,0 +1,136 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <Arduino.h>
+#include "freertos/queue.h"
+
+#define EVENT_BUS_MAX_CALLBACKS 4 // 回调订阅者上限
+#define EVENT_BUS_MAX_QUEUES    6 // 队列订阅者上限
+
+#define EVENT_MASK(type) (1UL << (type)) // 订阅时选择事件类型
+#define EVENT_MASK_ALL   0xFFFFFFFFUL
+
+/**
+ * @brief 跨任务事件类型。
+ */
+enum AppEventType
+{
+    EVENT_PLAY_SONG,  ///< 远程点歌：a 为歌曲索引，b 为 SongUi。正在播放的界面收到后退出，界面循环随后打开新的播放界面。
+    EVENT_ALARM_RING, ///< 闹钟开始响铃：a 为闹钟序号。
+    EVENT_ALARM_STOP, ///< 闹钟被用户停止。
+    EVENT_WAKE,       ///< 屏幕从熄屏中唤醒：a 为 PowerWakeSource，旋转编码器等输入经电源任务由此送达界面。
+    EVENT_SENSOR,     ///< 传感器读数变化：a 为 SensorId，b 为读数 (温度为0.01°C，光照为lux)。
+    EVENT_TYPE_COUNT
+};
+
+/**
+ * @brief EVENT_PLAY_SONG 使用的播放界面。
+ */
+enum SongUi
+{
+    SONG_UI_FULL, ///< play_song_full_ui
+    SONG_UI_LITE  ///< play_song_lite_ui
+};
+
+/**
+ * @brief EVENT_SENSOR 的传感器。
+ */
+enum SensorId
+{
+    SENSOR_TEMPERATURE, ///< DS18B20 温度。
+    SENSOR_LIGHT        ///< 光敏电阻估算的光照。
+};
+
+/**
+ * @brief 事件记录，定长，按值复制到订阅者的队列中。
+ */
+struct AppEvent
+{
+    AppEventType type;
+    int32_t a;          ///< 参数，含义见 AppEventType。
+    int32_t b;          ///< 参数，含义见 AppEventType。
+    uint32_t publishUs; ///< 发布时刻 (esp_timer 的低32位)，用于统计反应延迟。
+};
+
+/**
+ * @brief 一种事件的统计。
+ */
+struct EventBusStats
+{
+    uint32_t published;    ///< 发布次数。
+    uint32_t delivered;    ///< 送入订阅者队列或回调的次数。
+    uint32_t dropped;      ///< 订阅者队列已满而丢弃的次数。
+    uint32_t received;     ///< 经 EventBus_Receive 取出的次数。
+    uint32_t latencyMaxUs; ///< 从发布到订阅者取出的最长时间。
+    uint32_t latencyAvgUs; ///< 平均时间。
+};
+
+/**
+ * @brief 回调订阅函数类型。
+ * @details 在发布者的任务中同步调用，必须非常短小且不能阻塞，通常只用来唤醒订阅者自己的任务。
+ */
+typedef void (*AppEventCallback)(const AppEvent &event);
+
+/**
+ * @brief 以回调方式订阅事件。
+ * @param mask 关心的事件类型 (EVENT_MASK 的组合)。重复订阅时更新 mask。
+ * @return 有空闲槽位返回true。
+ */
+bool EventBus_Subscribe(AppEventCallback callback, uint32_t mask);
+
+/**
+ * @brief 取消回调订阅。
+ */
+void EventBus_Unsubscribe(AppEventCallback callback);
+
+/**
+ * @brief 以队列方式订阅事件。
+ * @param queue 元素大小为 sizeof(AppEvent) 的队列。
+ * @param mask 关心的事件类型 (EVENT_MASK 的组合)。重复订阅时更新 mask。
+ * @return 有空闲槽位返回true。
+ * @details 订阅者阻塞在队列上 (EventBus_Receive)，事件到达时立即被唤醒，不再轮询全局标志。
+ *          队列满时事件被丢弃并计数，发布者永远不会因订阅者而阻塞。
+ */
+bool EventBus_SubscribeQueue(QueueHandle_t queue, uint32_t mask);
+
+/**
+ * @brief 取消队列订阅。
+ */
+void EventBus_UnsubscribeQueue(QueueHandle_t queue);
+
+/**
+ * @brief 发布一个事件，不阻塞。不能在中断中调用。
+ */
+void EventBus_Publish(AppEventType type, int32_t a = 0, int32_t b = 0);
+
+/**
+ * @brief 从订阅的队列中取出一个事件，并记录它从发布到取出的延迟。
+ * @param ms 最长等待时间，0 表示不等待。
+ * @return 取到事件返回true。
+ */
+bool EventBus_Receive(QueueHandle_t queue, AppEvent *event, uint32_t ms);
+
+/**
+ * @brief 获取一种事件的统计。
+ */
+EventBusStats EventBus_GetStats(AppEventType type);
+
+/**
+ * @brief 事件类型的显示名。
+ */
+const char *EventBus_TypeName(AppEventType type);
+
+/**
+ * @brief 在串口输出各类事件的发布、丢弃次数和最坏反应延迟。
+ */
+void EventBus_Dump();
+
+/**
+ * @brief 处理串口命令 "events"。
+ * @details events         输出统计
+ *          events reset   清零统计
+ * @return 是事件总线命令时返回 true。
+ */
+bool EventBus_HandleCommand(const char *line);
+
+#endif // EVENT_BUS_H
@@ -0,0 +1,493 @@
+// 包含所有必需的头文件
+#include "FontCache.h"
+#include "font_12.h" // 中文字体 (VLW格式)，只在本文件中引用，避免多个编译单元各自保存一份
+
+#if !FONT_12_SORTED
+#error "font_12.h 需要用 create_font/subset_font.py 生成 (字形按码点排序并带码点表)"
+#endif
+
+// --- 宏定义 ---
+#define VLW_HEADER_BYTES   24     // 文件头：6个32位整数
+#define VLW_METRICS_BYTES  28     // 每个字形的度量：7个32位整数
+#define SLOT_NONE          0xFF   // 字形不在缓存中
+#define GLYPH_NONE         0xFFFF // 缓存槽为空
+#define FONT_CACHE_BENCH_RUNS 5   // 基准测试每种方式重复的次数
+
+/**
+ * @brief 缓存中的一个字形：度量信息和灰度位图。
+ */
+struct CachedGlyph
+{
+  uint16_t glyph;      // 字形在字体中的序号
+  uint8_t width;       // 位图宽度
+  uint8_t height;      // 位图高度
+  uint8_t xAdvance;    // 光标前进量
+  int8_t dX;           // 位图左边相对光标的偏移
+  int16_t dY;          // 位图顶部相对基线的高度
+  uint8_t prev, next;  // LRU双向链表
+  const uint8_t *pixels;                  // 指向 bitmap 或Flash中的原始位图
+  uint8_t bitmap[FONT_CACHE_SLOT_BYTES];  // 从Flash拷贝出的灰度位图
+};
+
+// --- 全局变量 ---
+static bool fontReady = false;
+static uint16_t glyphCount = 0;
+static int16_t fontAscent = 0;     // 基线以上高度
+static int16_t fontMaxDescent = 0; // 基线以下最大深度
+static uint16_t lineHeight = 0;    // 行高
+static uint16_t spaceWidth = 0;    // 空格宽度
+static uint16_t missingWidth = 0;  // 缺字方框的宽度
+
+static uint8_t *glyphSlots = NULL; // 每个字形所在的缓存槽，SLOT_NONE表示不在缓存中
+
+static CachedGlyph *slots = NULL;
+static uint8_t lruHead = 0; // 最近使用
+static uint8_t lruTail = 0; // 最久未使用，下一个被替换
+static FontCacheStats stats = {0, 0, 0, 0};
+
+/**
+ * @brief 从字体数组中读取一个大端32位整数
+ */
+static uint32_t readBE32(uint32_t offset)
+{
+  const uint8_t *p = font_12 + offset;
+  return ((uint32_t)pgm_read_byte(p) << 24) | ((uint32_t)pgm_read_byte(p + 1) << 16) |
+         ((uint32_t)pgm_read_byte(p + 2) << 8) | (uint32_t)pgm_read_byte(p + 3);
+}
+
+/**
+ * @brief 在Flash中的有序码点表上二分查找字形序号
+ */
+static bool findGlyph(uint16_t code, uint16_t *index)
+{
+  int32_t low = 0;
+  int32_t high = (int32_t)glyphCount - 1;
+  while (low <= high)
+  {
+    int32_t mid = (low + high) >> 1;
+    uint16_t midCode = pgm_read_word(&font_12_codepoints[mid]);
+    if (midCode == code)
+    {
+      *index = (uint16_t)mid;
+      return true;
+    }
+    if (midCode < code)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid - 1;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief 把缓存槽移动到LRU链表头部
+ */
+static void touchSlot(uint8_t s)
+{
+  if (s == lruHead)
+  {
+    return;
+  }
+  // 从链表中摘下
+  slots[slots[s].prev].next = slots[s].next;
+  if (s == lruTail)
+  {
+    lruTail = slots[s].prev;
+  }
+  else
+  {
+    slots[slots[s].next].prev = slots[s].prev;
+  }
+  // 插入头部
+  slots[s].next = lruHead;
+  slots[lruHead].prev = s;
+  lruHead = s;
+}
+
+/**
+ * @brief 清空LRU缓存（字形索引保持不变）
+ */
+static void resetSlots()
+{
+  for (int i = 0; i < FONT_CACHE_SLOTS; i++)
+  {
+    if (slots[i].glyph != GLYPH_NONE)
+    {
+      glyphSlots[slots[i].glyph] = SLOT_NONE;
+    }
+    slots[i].glyph = GLYPH_NONE;
+    slots[i].prev = (i == 0) ? 0 : i - 1;
+    slots[i].next = (i == FONT_CACHE_SLOTS - 1) ? 0 : i + 1;
+  }
+  lruHead = 0;
+  lruTail = FONT_CACHE_SLOTS - 1;
+}
+
+/**
+ * @brief 取得码点对应的字形，未命中时从Flash解码到最久未使用的缓存槽
+ * @return 字体中不存在该字符时返回NULL
+ */
+static const CachedGlyph *getGlyph(uint16_t code)
+{
+  stats.lookups++;
+  uint16_t index;
+  if (!findGlyph(code, &index))
+  {
+    stats.missing++;
+    return NULL;
+  }
+
+  uint8_t s = glyphSlots[index];
+  if (s != SLOT_NONE)
+  {
+    stats.hits++;
+    touchSlot(s);
+    return &slots[s];
+  }
+
+  stats.misses++;
+  s = lruTail;
+  CachedGlyph *g = &slots[s];
+  if (g->glyph != GLYPH_NONE)
+  {
+    glyphSlots[g->glyph] = SLOT_NONE; // 替换掉最久未使用的字形
+  }
+
+  uint32_t offset = VLW_HEADER_BYTES + (uint32_t)index * VLW_METRICS_BYTES;
+  g->glyph = index;
+  g->height = (uint8_t)readBE32(offset + 4);
+  g->width = (uint8_t)readBE32(offset + 8);
+  g->xAdvance = (uint8_t)readBE32(offset + 12);
+  g->dY = (int16_t)readBE32(offset + 16);
+  g->dX = (int8_t)readBE32(offset + 20);
+
+  const uint8_t *src = font_12 + pgm_read_dword(&font_12_bitmaps[index]);
+  uint16_t size = g->width * g->height;
+  if (size <= FONT_CACHE_SLOT_BYTES)
+  {
+    memcpy_P(g->bitmap, src, size);
+    g->pixels = g->bitmap;
+  }
+  else
+  {
+    g->pixels = src;
+  }
+
+  glyphSlots[index] = s;
+  touchSlot(s);
+  return g;
+}
+
+/**
+ * @brief 解码一个UTF-8字符 (只支持基本多文种平面)
+ */
+static uint16_t nextCodepoint(const uint8_t *s, uint16_t *index, uint16_t len)
+{
+  uint8_t c = s[(*index)++];
+  if (c < 0x80)
+  {
+    return c;
+  }
+  if ((c & 0xE0) == 0xC0 && *index < len)
+  {
+    return ((c & 0x1F) << 6) | (s[(*index)++] & 0x3F);
+  }
+  if ((c & 0xF0) == 0xE0 && *index + 1 < len)
+  {
+    uint16_t code = ((c & 0x0F) << 12) | ((s[*index] & 0x3F) << 6) | (s[*index + 1] & 0x3F);
+    *index += 2;
+    return code;
+  }
+  if ((c & 0xF8) == 0xF0 && *index + 2 < len)
+  {
+    *index += 3;
+    return 0xFFFF; // 超出BMP的字符字体中不可能存在，按缺字处理
+  }
+  return c;
+}
+
+/**
+ * @brief 在光标处绘制一个字形
+ * @return 光标前进量
+ */
+static int32_t drawGlyph(TFT_eSprite &sprite, const CachedGlyph *g, int32_t cursorX, int32_t cursorY, uint16_t fg, uint16_t bg, bool transparent)
+{
+  if (g == NULL)
+  {
+    // 字体中没有的字符画一个占满字符格的方框，一眼就能看出缺字
+    sprite.drawRect(cursorX + 1, cursorY + 1, missingWidth - 2, fontAscent - 1, fg);
+    return missingWidth;
+  }
+
+  int32_t cy = cursorY + fontAscent - g->dY;
+  int32_t cx = cursorX + g->dX;
+  const uint8_t *pixels = g->pixels;
+
+  for (int32_t y = 0; y < g->height; y++)
+  {
+    int32_t runStart = 0;
+    int32_t runLength = 0; // 连续的完全不透明像素
+    for (int32_t x = 0; x < g->width; x++)
+    {
+      uint8_t alpha = pgm_read_byte(pixels++);
+      if (alpha == 0xFF)
+      {
+        if (runLength == 0) runStart = x;
+        runLength++;
+        continue;
+      }
+      if (runLength)
+      {
+        sprite.drawFastHLine(cx + runStart, cy + y, runLength, fg);
+        runLength = 0;
+      }
+      if (alpha)
+      {
+        uint16_t under = transparent ? sprite.readPixel(cx + x, cy + y) : bg;
+        sprite.drawPixel(cx + x, cy + y, sprite.alphaBlend(alpha, fg, under));
+      }
+    }
+    if (runLength)
+    {
+      sprite.drawFastHLine(cx + runStart, cy + y, runLength, fg);
+    }
+  }
+  return g->xAdvance;
+}
+
+/**
+ * @brief 绘制文本，wrap为true时在 x+maxWidth 处自动换行
+ */
+static void renderText(TFT_eSprite &sprite, const String &text, int32_t x, int32_t y, int32_t maxWidth, bool wrap)
+{
+  uint16_t fg = sprite.textcolor;
+  uint16_t bg = sprite.textbgcolor;
+  bool transparent = (fg == bg); // 与库的行为一致：前景色等于背景色时叠加在已有内容上
+
+  int32_t cursorX = x;
+  int32_t cursorY = y;
+  const uint8_t *s = (const uint8_t *)text.c_str();
+  uint16_t len = text.length();
+  uint16_t n = 0;
+
+  while (n < len)
+  {
+    uint16_t code = nextCodepoint(s, &n, len);
+    if (code == '\n')
+    {
+      cursorX = x;
+      cursorY += lineHeight;
+      continue;
+    }
+    if (code == '\r')
+    {
+      continue;
+    }
+    if (code == ' ')
+    {
+      cursorX += spaceWidth;
+      continue;
+    }
+
+    const CachedGlyph *g = getGlyph(code);
+    int32_t right = g ? (g->dX + g->width) : missingWidth;
+    if (wrap && cursorX > x && cursorX + right > x + maxWidth)
+    {
+      cursorX = x;
+      cursorY += lineHeight;
+    }
+    cursorX += drawGlyph(sprite, g, cursorX, cursorY, fg, bg, transparent);
+  }
+
+  sprite.setCursor(cursorX, cursorY);
+}
+
+bool FontCache_Init()
+{
+  if (fontReady)
+  {
+    return true;
+  }
+
+  glyphCount = (uint16_t)readBE32(0);
+  fontAscent = (int16_t)readBE32(16);
+  int16_t descent = (int16_t)readBE32(20);
+  fontMaxDescent = descent;
+
+  glyphSlots = (uint8_t *)malloc(glyphCount);
+  slots = (CachedGlyph *)malloc(FONT_CACHE_SLOTS * sizeof(CachedGlyph));
+  if (!glyphSlots || !slots)
+  {
+    Serial.println("FontCache: out of memory");
+    free(glyphSlots);
+    free(slots);
+    glyphSlots = NULL;
+    slots = NULL;
+    return false;
+  }
+  memset(glyphSlots, SLOT_NONE, glyphCount);
+
+  // 遍历一次字形度量表求最大下沉，码点和位图偏移表由子集化工具生成在Flash中
+  for (uint16_t i = 0; i < glyphCount; i++)
+  {
+    uint32_t offset = VLW_HEADER_BYTES + (uint32_t)i * VLW_METRICS_BYTES;
+    uint16_t code = (uint16_t)readBE32(offset);
+    uint8_t height = (uint8_t)readBE32(offset + 4);
+    int16_t dY = (int16_t)readBE32(offset + 16);
+
+    // 与TFT_eSPI相同的规则，跳过容易给出错误值的控制字符
+    if ((height - dY) > fontMaxDescent &&
+        (((code > 0x20) && (code < 0xA0) && (code != 0x7F)) || (code > 0xFF)))
+    {
+      fontMaxDescent = height - dY;
+    }
+  }
+
+  lineHeight = fontAscent + fontMaxDescent;
+  spaceWidth = (fontAscent + descent) * 2 / 7;
+  missingWidth = fontAscent + 1; // 与汉字的前进量相当
+
+  for (int i = 0; i < FONT_CACHE_SLOTS; i++) slots[i].glyph = GLYPH_NONE;
+  resetSlots();
+
+  fontReady = true;
+  Serial.printf("FontCache: %u glyphs, %u bytes resident\n",
+                glyphCount, (unsigned)(glyphCount + FONT_CACHE_SLOTS * sizeof(CachedGlyph)));
+  return true;
+}
+
+void FontCache_Print(TFT_eSprite &sprite, const String &text, int32_t x, int32_t y, int32_t maxWidth)
+{
+  if (!fontReady)
+  {
+    return;
+  }
+  renderText(sprite, text, x, y, maxWidth, true);
+}
+
+void FontCache_DrawString(TFT_eSprite &sprite, const String &text, int32_t x, int32_t y)
+{
+  if (!fontReady)
+  {
+    return;
+  }
+
+  // 与 drawString 相同的对齐规则
+  int32_t width = FontCache_TextWidth(text);
+  switch (sprite.getTextDatum())
+  {
+  case TC_DATUM: x -= width / 2; break;
+  case TR_DATUM: x -= width; break;
+  case ML_DATUM: y -= lineHeight / 2; break;
+  case MC_DATUM: x -= width / 2; y -= lineHeight / 2; break;
+  case MR_DATUM: x -= width; y -= lineHeight / 2; break;
+  case BL_DATUM: y -= lineHeight; break;
+  case BC_DATUM: x -= width / 2; y -= lineHeight; break;
+  case BR_DATUM: x -= width; y -= lineHeight; break;
+  case L_BASELINE: y -= fontAscent; break;
+  case C_BASELINE: x -= width / 2; y -= fontAscent; break;
+  case R_BASELINE: x -= width; y -= fontAscent; break;
+  default: break;
+  }
+  renderText(sprite, text, x, y, 0, false);
+}
+
+int16_t FontCache_TextWidth(const String &text)
+{
+  if (!fontReady)
+  {
+    return 0;
+  }
+
+  int32_t width = 0;
+  const uint8_t *s = (const uint8_t *)text.c_str();
+  uint16_t len = text.length();
+  uint16_t n = 0;
+  while (n < len)
+  {
+    uint16_t code = nextCodepoint(s, &n, len);
+    if (code == ' ')
+    {
+      width += spaceWidth;
+      continue;
+    }
+    const CachedGlyph *g = getGlyph(code);
+    if (g == NULL)
+    {
+      width += missingWidth;
+      continue;
+    }
+    if (width == 0 && g->dX < 0) width -= g->dX;
+    width += (n < len) ? g->xAdvance : (g->dX + g->width); // 最后一个字只算到位图右边缘
+  }
+  return width;
+}
+
+uint16_t FontCache_LineHeight()
+{
+  return lineHeight;
+}
+
+FontCacheStats FontCache_GetStats()
+{
+  return stats;
+}
+
+void FontCache_Benchmark(TFT_eSprite &sprite)
+{
+  // 一段典型的中文新闻文本，约110个字、80个不同的字
+  static const char benchPage[] =
+      "今天上午，杭州市发布最新天气预报：受冷空气影响，未来三天全市将有一次明显降温过程，"
+      "最高气温下降六到八度，局部地区有小雨。气象部门提醒市民注意添衣保暖，出行请带好雨具，"
+      "关注交通安全。同时，本周末将迎来好天气，适合外出游玩。";
+  String page(benchPage);
+
+  if (!FontCache_Init())
+  {
+    return;
+  }
+
+  sprite.fillSprite(TFT_BLACK);
+  sprite.setTextColor(TFT_WHITE);
+
+  // 旧方式：每次绘制都重新解析字体并线性查找字形
+  uint32_t start = micros();
+  for (int i = 0; i < FONT_CACHE_BENCH_RUNS; i++)
+  {
+    sprite.loadFont(font_12);
+    sprite.setTextWrap(true);
+    sprite.setCursor(5, 45);
+    sprite.print(page);
+    sprite.unloadFont();
+  }
+  uint32_t legacyUs = (micros() - start) / FONT_CACHE_BENCH_RUNS;
+
+  // 常驻字体，缓存为空
+  resetSlots();
+  FontCacheStats before = stats;
+  start = micros();
+  FontCache_Print(sprite, page, 5, 45, sprite.width() - 10);
+  uint32_t coldUs = micros() - start;
+
+  // 常驻字体，缓存已热
+  start = micros();
+  for (int i = 0; i < FONT_CACHE_BENCH_RUNS; i++)
+  {
+    FontCache_Print(sprite, page, 5, 45, sprite.width() - 10);
+  }
+  uint32_t warmUs = (micros() - start) / FONT_CACHE_BENCH_RUNS;
+
+  Serial.printf("FontCache benchmark (%u bytes of text per page):\n", (unsigned)page.length());
+  Serial.printf("  loadFont + print + unloadFont: %lu us/page\n", (unsigned long)legacyUs);
+  Serial.printf("  resident font, cold cache:     %lu us/page\n", (unsigned long)coldUs);
+  Serial.printf("  resident font, warm cache:     %lu us/page\n", (unsigned long)warmUs);
+  Serial.printf("  lookups %lu, hits %lu, misses %lu, missing %lu\n",
+                (unsigned long)(stats.lookups - before.lookups), (unsigned long)(stats.hits - before.hits),
+                (unsigned long)(stats.misses - before.misses), (unsigned long)(stats.missing - before.missing));
+
+  sprite.fillSprite(TFT_BLACK);
+}
@@ -0,0 +1,70 @@
+#ifndef FONT_CACHE_H
+#define FONT_CACHE_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define FONT_CACHE_SLOTS       96  // LRU缓存的字形数量，一页新闻通常用到80~100个不同的字
+#define FONT_CACHE_SLOT_BYTES  240 // 每个缓存槽的灰度位图大小，font_12中最大的字形为240字节，更大的字形直接从Flash读取
+#define FONT_CACHE_BENCHMARK   0   // 置1则开机时在串口输出新旧两种渲染方式的耗时对比
+
+/**
+ * @brief 字形缓存的统计信息。
+ */
+struct FontCacheStats
+{
+    uint32_t lookups; ///< 字形查找次数。
+    uint32_t hits;    ///< 命中LRU缓存的次数。
+    uint32_t misses;  ///< 未命中、从Flash拷贝位图的次数。
+    uint32_t missing; ///< 字体中不存在的字符次数。
+};
+
+/**
+ * @brief 把 font_12 常驻加载。
+ * @details 只解析一次VLW文件头并分配LRU字形缓存。字形按码点排序，码点表和位图偏移表由
+ *          create_font/subset_font.py 生成在Flash中，查找时直接二分，不占用RAM。
+ *          之后的绘制不再需要 loadFont()/unloadFont()，也不会改变精灵当前的字体设置；
+ *          字体中没有的字符画成一个字符格大小的方框。
+ * @return 内存不足时返回false，此时绘制函数不做任何事。
+ */
+bool FontCache_Init();
+
+/**
+ * @brief 用常驻字体在精灵中绘制自动换行的文本。
+ * @param sprite 目标精灵，使用其当前的文字颜色和背景色（两者相同时透明叠加）。
+ * @param text UTF-8文本。
+ * @param x 起始X坐标，换行后回到此处。
+ * @param y 第一行顶部的Y坐标。
+ * @param maxWidth 每行的最大宽度。
+ * @details 结束后把精灵的光标设置到最后一个字符之后，调用者可以继续用 getCursorY() 排版。
+ */
+void FontCache_Print(TFT_eSprite &sprite, const String &text, int32_t x, int32_t y, int32_t maxWidth);
+
+/**
+ * @brief 用常驻字体绘制单行文本，按精灵当前的文本基准 (datum) 对齐。
+ */
+void FontCache_DrawString(TFT_eSprite &sprite, const String &text, int32_t x, int32_t y);
+
+/**
+ * @brief 计算单行文本在常驻字体下的像素宽度。
+ */
+int16_t FontCache_TextWidth(const String &text);
+
+/**
+ * @brief 常驻字体的行高。
+ */
+uint16_t FontCache_LineHeight();
+
+/**
+ * @brief 获取缓存统计信息。
+ */
+FontCacheStats FontCache_GetStats();
+
+/**
+ * @brief 在串口输出渲染一页中文文本的耗时对比。
+ * @param sprite 用于绘制的精灵，测试结束后会被清空。
+ * @details 分别测量旧方式 (loadFont + print + unloadFont) 和常驻缓存方式（冷启动和缓存已热）。
+ */
+void FontCache_Benchmark(TFT_eSprite &sprite);
+
+#endif // FONT_CACHE_H
@@ -1,5 +1,4 @@
 #include "RotaryEncoder.h"
-#include <Preferences.h>
 #include <TFT_eSPI.h>
 #include "img.h"
 #include "LED.h"
@@ -11,6 +10,8 @@
 #include "animation.h"
 #include "Games.h"
 #include "MQTT.h"
+#include "Display.h"
+#include "Screen.h"
 
 // --- 布局配置 ---
 static const int ICON_SIZE = 200;      // 游戏图标大小
@@ -118,91 +119,122 @@ void drawGameIcons(int16_t offset)
     menuSprite.drawString("GAMES:", 10, 10);
     menuSprite.drawString(gameItems[game_picture_flag].name, 60, 10);
 
-    menuSprite.pushSprite(0, 0); // 将sprite内容推送到屏幕
+    Display_Present(); // 将sprite内容推送到屏幕
 }
 
+// --- 游戏菜单页面状态 ---
+static int16_t anim_start_display = INITIAL_X_OFFSET;  // 滚动动画的起点
+static int16_t anim_target_display = INITIAL_X_OFFSET; // 滚动动画的终点
+static int8_t anim_step = -1;                          // 滚动动画的当前步，-1 表示没有动画
+static unsigned long gamesMenuLastClickTime = 0;       // 用于处理单击/双击逻辑
+static bool gamesMenuSingleClickPending = false;
+
 /**
- * @brief 游戏选择的主菜单函数
+ * @brief [页面] 进入游戏菜单时清屏并重置状态
  */
-void GamesMenu()
+static void gamesMenuEnter()
 {
     tft.fillScreen(TFT_BLACK);
+    Display_Invalidate(); // 屏幕已被直接清空，下一帧整屏推送
 
     // 重置菜单状态
     game_picture_flag = 0;
     game_display = INITIAL_X_OFFSET;
-    drawGameIcons(game_display);
+    anim_step = -1;
+    gamesMenuSingleClickPending = false;
 
     gamesDetectDoubleClick(true); // 进入菜单时重置双击检测
+}
 
-    // 用于处理单击/双击逻辑的变量
-    static unsigned long gamesMenuLastClickTime = 0;
-    static bool gamesMenuSingleClickPending = false;
+/**
+ * @brief [页面] 旋转切换游戏，单击进入，双击或长按退出
+ * @details 滚动动画每帧前进一步，动画期间旋转会从当前位置重新开始滚动。
+ *          单击要等双击窗口过去后才执行，游戏作为嵌套页面在此运行。
+ */
+static ScreenAction gamesMenuUpdate(const ScreenInput &input)
+{
+    if (input.longPress) { return SCREEN_EXIT; } // 长按退出
 
-    while (true)
-    {
-        // 检查全局退出条件
-        if (exitSubMenu || g_alarm_is_ringing) { return; }
-        if (readButtonLongPress()) { return; } // 长按退出
-
-        int direction = readEncoder();
-        if (direction != 0)
-        { // 旋转编码器切换游戏
-            if (direction == 1)
-            {
-                game_picture_flag = (game_picture_flag + 1) % GAME_ITEM_COUNT;
-            }
-            else if (direction == -1)
-            {
-                game_picture_flag = (game_picture_flag == 0) ? GAME_ITEM_COUNT - 1 : game_picture_flag - 1;
-            }
-            tone(BUZZER_PIN, 1000 * (game_picture_flag + 1), 20); // 播放提示音
+    ScreenAction action = SCREEN_IDLE;
+    if (input.encoder != 0)
+    { // 旋转编码器切换游戏
+        if (input.encoder == 1)
+        {
+            game_picture_flag = (game_picture_flag + 1) % GAME_ITEM_COUNT;
+        }
+        else if (input.encoder == -1)
+        {
+            game_picture_flag = (game_picture_flag == 0) ? GAME_ITEM_COUNT - 1 : game_picture_flag - 1;
+        }
+        Buzzer_Tone(1000 * (game_picture_flag + 1), 20); // 播放提示音
 
-            // --- 带缓动效果的滚动动画 ---
-            int16_t target_display = INITIAL_X_OFFSET - (game_picture_flag * ICON_SPACING);
-            int16_t start_display = game_display;
-            for (uint8_t i = 0; i <= ANIMATION_STEPS; i++)
-            {
-                float t = (float) i / ANIMATION_STEPS;
-                float eased_t = 0.5 * (1 - cos(t * PI)); // 使用余弦缓动
-                game_display = start_display + (target_display - start_display) * eased_t;
-                drawGameIcons(game_display);
-                vTaskDelay(pdMS_TO_TICKS(15));
-            }
-            game_display = target_display;
-            drawGameIcons(game_display);
+        // --- 带缓动效果的滚动动画，从当前位置开始 ---
+        anim_start_display = game_display;
+        anim_target_display = INITIAL_X_OFFSET - (game_picture_flag * ICON_SPACING);
+        anim_step = 0;
+    }
+
+    if (anim_step >= 0 && input.frame)
+    {
+        float t = (float) anim_step / ANIMATION_STEPS;
+        float eased_t = 0.5 * (1 - cos(t * PI)); // 使用余弦缓动
+        game_display = anim_start_display + (anim_target_display - anim_start_display) * eased_t;
+        if (++anim_step > ANIMATION_STEPS)
+        {
+            game_display = anim_target_display;
+            anim_step = -1;
         }
+        action = SCREEN_REDRAW;
+    }
 
-        if (readButton())
-        { // 检测到按钮点击
-            if (gamesDetectDoubleClick())
-            { // 如果是双击
-                gamesMenuSingleClickPending = false; // 取消待处理的单击
-                return; // 退出游戏菜单
-            }
-            else
-            { // 否则是单击
-                gamesMenuLastClickTime = millis();
-                gamesMenuSingleClickPending = true; // 标记为有待处理的单击
-            }
+    if (input.click)
+    { // 检测到按钮点击
+        if (gamesDetectDoubleClick())
+        { // 如果是双击
+            gamesMenuSingleClickPending = false; // 取消待处理的单击
+            return SCREEN_EXIT; // 退出游戏菜单
         }
+        // 否则是单击
+        gamesMenuLastClickTime = input.nowMs;
+        gamesMenuSingleClickPending = true; // 标记为有待处理的单击
+    }
 
-        // 检查待处理的单击事件是否应该被执行 (即等待双击窗口超时后)
-        if (gamesMenuSingleClickPending && (millis() - gamesMenuLastClickTime > 500))
+    // 检查待处理的单击事件是否应该被执行 (即等待双击窗口超时后)
+    if (gamesMenuSingleClickPending && (input.nowMs - gamesMenuLastClickTime > 500))
+    {
+        gamesMenuSingleClickPending = false; // 消费掉这个单击事件
+        Buzzer_Tone(2000, 50);
+        vTaskDelay(pdMS_TO_TICKS(50));
+        if (gameItems[game_picture_flag].function)
         {
-            gamesMenuSingleClickPending = false; // 消费掉这个单击事件
-            tone(BUZZER_PIN, 2000, 50);
-            vTaskDelay(pdMS_TO_TICKS(50));
-            if (gameItems[game_picture_flag].function)
-            {
-                gameItems[game_picture_flag].function(); // 执行对应的游戏函数
-            }
-            // 游戏结束后，重绘菜单
-            tft.fillScreen(TFT_BLACK);
-            drawGameIcons(game_display);
+            gameItems[game_picture_flag].function(); // 执行对应的游戏函数
         }
-        vTaskDelay(pdMS_TO_TICKS(10));
+        // 游戏结束后，重绘菜单
+        tft.fillScreen(TFT_BLACK);
+        Display_Invalidate(); // 部分游戏直接用 tft 绘制
+        action = SCREEN_REDRAW;
     }
+    return action;
+}
+
+/**
+ * @brief [页面] 按当前滚动位置绘制菜单
+ */
+static void gamesMenuRender()
+{
+    drawGameIcons(game_display);
+}
+
+// 滚动动画每帧一步，与原来每步15ms的节奏接近
+static const ScreenDef gamesMenuScreen = {"games", DISPLAY_MIN_FRAME_MS, true, gamesMenuEnter, gamesMenuUpdate,
+                                          gamesMenuRender, NULL};
+
+/**
+ * @brief 游戏选择的主菜单函数
+ */
+void GamesMenu()
+{
+    Screen_Run(gamesMenuScreen);
 }
 //... 后续游戏实现
 // --- 康威生命游戏实现 ---
@@ -301,153 +333,182 @@ void updateConwayGrid()
 }
 
 /**
- * @brief 康威生命游戏主函数
+ * @brief [页面] 随机生成初始网格
  */
-void ConwayGame()
+static void conwayEnter()
 {
     tft.fillScreen(TFT_BLACK);
     initConwayGrid();
-    drawConwayGrid();
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
     tft.setTextSize(1);
     tft.setCursor(35, 220);
     tft.print("Auto-running, Double-click to exit");
+    gamesDetectDoubleClick(true);
+}
 
-    unsigned long lastUpdateTime = millis();
-    const unsigned long UPDATE_INTERVAL = 200; // 每200ms更新一代
-
-    while (true)
+/**
+ * @brief [页面] 每帧演化一代，双击退出
+ */
+static ScreenAction conwayUpdate(const ScreenInput &input)
+{
+    // 按钮处理，双击退出
+    if (input.click && gamesDetectDoubleClick())
+    {
+        return SCREEN_EXIT;
+    }
+    // 自动演化
+    if (input.frame)
     {
-        if (exitSubMenu || g_alarm_is_ringing) { return; }
+        updateConwayGrid();
+        return SCREEN_REDRAW;
+    }
+    return SCREEN_IDLE;
+}
 
-        // 自动演化
-        if (millis() - lastUpdateTime > UPDATE_INTERVAL)
-        {
-            updateConwayGrid();
-            drawConwayGrid();
-            lastUpdateTime = millis();
-        }
+// 帧间隔即每一代的间隔；直接在 tft 上绘制
+static const ScreenDef conwayScreen = {"conway", 200, false, conwayEnter, conwayUpdate, drawConwayGrid, NULL};
 
-        // 按钮处理，双击退出
-        if (readButton())
-        {
-            if (gamesDetectDoubleClick())
-            {
-                return;
-            }
-        }
-        vTaskDelay(pdMS_TO_TICKS(10));
-    }
+/**
+ * @brief 康威生命游戏主函数
+ */
+void ConwayGame()
+{
+    Screen_Run(conwayScreen);
 }
 
+// --- 反应力测试游戏状态 ---
+static GameState tap_state = STATE_INITIAL;
+static unsigned long tap_wait_start = 0;     // 开始等待变红的时刻
+static long tap_random_delay = 0;            // 本轮等待变红的时长
+static unsigned long tap_reaction_start = 0; // 屏幕变红的时刻
+static unsigned long tap_reaction_time = 0;  // 本轮的反应时间
+
 // 辅助函数：设置反应力测试游戏的初始状态
-void setupBuzzerTapInitialState(TFT_eSPI &tft_obj, GameState &state_ref, unsigned long &waitStartTime_ref, long &randomDelay_ref)
+static void setupBuzzerTapInitialState()
 {
-    tft_obj.fillScreen(TFT_GREEN);
-    tft_obj.setTextColor(TFT_WHITE, TFT_GREEN);
-    tft_obj.setTextDatum(MC_DATUM);
-    tft_obj.setTextFont(4);
-    tft_obj.setTextSize(1);
-    tft_obj.drawString("Wait for Red", SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2);
-    tft_obj.setTextFont(1);
-    tft_obj.setTextSize(1);
-    tft_obj.setTextDatum(BC_DATUM); // Bottom Center
-    tft_obj.drawString("Double-click to exit", SCREEN_WIDTH / 2, SCREEN_HEIGHT - 10);
-    waitStartTime_ref = millis();
-    randomDelay_ref = random(2000, 4001);
-    state_ref = STATE_INITIAL;
+    tap_wait_start = millis();
+    tap_random_delay = random(2000, 4001);
+    tap_state = STATE_INITIAL;
     gamesDetectDoubleClick(true); // 重置双击检测
 }
 
 /**
- * @brief 反应力测试游戏
- * @details 模仿 humanbenchmark.com/tests/reactiontime。
- *          屏幕开始为绿色，随机2-4秒后变为红色，此时计时开始。
- *          玩家需尽快按下按钮，屏幕会显示反应时间。
- *          再次按下可重新开始。双击可退出。
+ * @brief [页面] 等待变红、计时和显示结果的状态机，双击退出
  */
-void BuzzerTapGame()
+static ScreenAction buzzerTapUpdate(const ScreenInput &input)
 {
-    GameState state = STATE_INITIAL;
-    unsigned long waitStartTime = 0;
-    unsigned long reactionStartTime = 0;
-    long randomDelay = 0;
-
-    setupBuzzerTapInitialState(tft, state, waitStartTime, randomDelay);
+    ScreenAction action = SCREEN_IDLE;
 
-    while (true)
+    // 检查是否到达变红时间
+    if (tap_state == STATE_INITIAL && input.nowMs - tap_wait_start >= tap_random_delay)
     {
-        if (exitSubMenu || g_alarm_is_ringing) { return; }
-
-        unsigned long currentTime = millis();
+        tap_state = STATE_TIMING;
+        action = SCREEN_REDRAW;
+    }
 
-        // 状态机主体
-        if (state == STATE_INITIAL)
+    // 统一处理按钮输入
+    if (input.click)
+    {
+        if (gamesDetectDoubleClick())
         {
-            // 检查是否到达变红时间
-            if (currentTime - waitStartTime >= randomDelay)
-            {
-                tft.fillScreen(TFT_RED);
-                reactionStartTime = millis();
-                state = STATE_TIMING;
-            }
+            return SCREEN_EXIT; // 双击退出
         }
 
-        // 统一处理按钮输入
-        if (readButton())
+        // 单击逻辑
+        switch (tap_state)
         {
-            if (gamesDetectDoubleClick())
-            {
-                return; // 双击退出
-            }
+        case STATE_INITIAL: // 在变红前点击
+            tap_state = STATE_TOO_SOON;
+            break;
 
-            // 单击逻辑
-            switch (state)
-            {
-            case STATE_INITIAL: // 在变红前点击
-                tft.fillScreen(TFT_BLUE);
-                tft.setTextColor(TFT_WHITE, TFT_BLUE);
-                tft.setTextDatum(MC_DATUM);
-                tft.setTextFont(4);
-                tft.setTextSize(1);
-                tft.drawString("Too Soon!", SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 - 20);
-                tft.drawString("Click to restart", SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 + 20);
-                state = STATE_TOO_SOON;
-                break;
-
-            case STATE_TIMING: // 成功点击
-            {
-                unsigned long reactionTime = millis() - reactionStartTime;
-                tft.fillScreen(TFT_BLACK);
-                tft.setTextColor(TFT_WHITE, TFT_BLACK);
-                tft.setTextDatum(MC_DATUM);
-
-                // 用数码管字体显示时长
-                tft.setTextFont(7);
-                tft.setTextSize(1);
-                char timeStr[20];
-                sprintf(timeStr, "%lu", reactionTime);
-                tft.drawString(timeStr, SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 - 10);
-
-                // 显示提示文字
-                tft.setTextFont(4);
-                tft.setTextSize(1);
-                tft.drawString("Click to restart", SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 + 40);
-                state = STATE_RESULT;
-            }
+        case STATE_TIMING: // 成功点击
+            tap_reaction_time = input.nowMs - tap_reaction_start;
+            tap_state = STATE_RESULT;
             break;
 
-            case STATE_RESULT:
-            case STATE_TOO_SOON: // 在结果界面点击，重新开始
-                setupBuzzerTapInitialState(tft, state, waitStartTime, randomDelay);
-                break;
-            }
+        case STATE_RESULT:
+        case STATE_TOO_SOON: // 在结果界面点击，重新开始
+            setupBuzzerTapInitialState();
+            break;
         }
+        action = SCREEN_REDRAW;
+    }
+    return action;
+}
 
-        vTaskDelay(pdMS_TO_TICKS(10));
+/**
+ * @brief [页面] 按状态直接在 tft 上绘制整屏
+ */
+static void buzzerTapRender()
+{
+    switch (tap_state)
+    {
+    case STATE_INITIAL:
+        tft.fillScreen(TFT_GREEN);
+        tft.setTextColor(TFT_WHITE, TFT_GREEN);
+        tft.setTextDatum(MC_DATUM);
+        tft.setTextFont(4);
+        tft.setTextSize(1);
+        tft.drawString("Wait for Red", SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2);
+        tft.setTextFont(1);
+        tft.setTextSize(1);
+        tft.setTextDatum(BC_DATUM); // Bottom Center
+        tft.drawString("Double-click to exit", SCREEN_WIDTH / 2, SCREEN_HEIGHT - 10);
+        break;
+
+    case STATE_TIMING:
+        tft.fillScreen(TFT_RED);
+        tap_reaction_start = millis(); // 从屏幕真正变红开始计时
+        break;
+
+    case STATE_TOO_SOON:
+        tft.fillScreen(TFT_BLUE);
+        tft.setTextColor(TFT_WHITE, TFT_BLUE);
+        tft.setTextDatum(MC_DATUM);
+        tft.setTextFont(4);
+        tft.setTextSize(1);
+        tft.drawString("Too Soon!", SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 - 20);
+        tft.drawString("Click to restart", SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 + 20);
+        break;
+
+    case STATE_RESULT:
+    {
+        tft.fillScreen(TFT_BLACK);
+        tft.setTextColor(TFT_WHITE, TFT_BLACK);
+        tft.setTextDatum(MC_DATUM);
+
+        // 用数码管字体显示时长
+        tft.setTextFont(7);
+        tft.setTextSize(1);
+        char timeStr[20];
+        sprintf(timeStr, "%lu", tap_reaction_time);
+        tft.drawString(timeStr, SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 - 10);
+
+        // 显示提示文字
+        tft.setTextFont(4);
+        tft.setTextSize(1);
+        tft.drawString("Click to restart", SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 + 40);
+    }
+    break;
     }
 }
 
+// 帧间隔取输入周期，变红不会因等待帧时刻而推迟
+static const ScreenDef buzzerTapScreen = {"buzzer_tap", SCREEN_INPUT_MS, false, setupBuzzerTapInitialState,
+                                          buzzerTapUpdate, buzzerTapRender, NULL};
+
+/**
+ * @brief 反应力测试游戏
+ * @details 模仿 humanbenchmark.com/tests/reactiontime。
+ *          屏幕开始为绿色，随机2-4秒后变为红色，此时计时开始。
+ *          玩家需尽快按下按钮，屏幕会显示反应时间。
+ *          再次按下可重新开始。双击可退出。
+ */
+void BuzzerTapGame()
+{
+    Screen_Run(buzzerTapScreen);
+}
+
 // --- 时间挑战游戏常量 ---
 static const int PROGRESS_BAR_X = 20;
 static const int PROGRESS_BAR_Y = 180;
@@ -456,83 +517,104 @@ static const int PROGRESS_BAR_HEIGHT = 10;
 static const uint16_t PROGRESS_BAR_COLOR = TFT_GREEN;
 static const uint16_t PROGRESS_BAR_BG_COLOR = TFT_DARKGREY;
 
+static const unsigned long BUZZER_INTERVAL_MS = 1000;
+
+// --- 时间挑战游戏状态 ---
+static unsigned long tc_target_ms = 0;   // 随机的目标时间
+static unsigned long tc_start_time = 0;
+static unsigned long tc_press_time = 0;
+static unsigned long tc_last_buzzer_time = 0;
+static bool tc_game_ended = false;
+
 /**
- * @brief 时间挑战游戏
+ * @brief [页面] 随机选择目标时间并开始计时
  */
-void TimeChallengeGame()
+static void timeChallengeEnter()
 {
-    menuSprite.fillSprite(TFT_BLACK);
-    menuSprite.setTextColor(TFT_WHITE, TFT_BLACK);
-    menuSprite.setTextSize(2);
+    tc_target_ms = random(8000, 12001); // 随机目标时间 8-12秒
+    tc_start_time = millis();
+    tc_press_time = 0;
+    tc_last_buzzer_time = 0;
+    tc_game_ended = false;
+    gamesDetectDoubleClick(true);
+}
 
-    unsigned long lastBuzzerTime = 0;
-    const unsigned long BUZZER_INTERVAL_MS = 1000;
+/**
+ * @brief [页面] 计时中每秒蜂鸣，单击停止计时，双击退出
+ */
+static ScreenAction timeChallengeUpdate(const ScreenInput &input)
+{
+    if (input.click)
+    {
+        if (gamesDetectDoubleClick()) { return SCREEN_EXIT; } // 双击退出
+        if (!tc_game_ended)
+        { // 首次单击结束游戏
+            tc_press_time = input.nowMs;
+            tc_game_ended = true;
+            Buzzer_Tone(1500, 100); // 确认音
+            return SCREEN_REDRAW;
+        }
+    }
 
-    unsigned long targetTimeMs = random(8000, 12001); // 随机目标时间 8-12秒
-    float targetTimeSec = targetTimeMs / 1000.0;
+    if (tc_game_ended)
+    {
+        return SCREEN_IDLE;
+    }
+    // 每秒蜂鸣一次
+    if (input.nowMs - tc_last_buzzer_time >= BUZZER_INTERVAL_MS)
+    {
+        Buzzer_Tone(1000, 50);
+        tc_last_buzzer_time = input.nowMs;
+    }
+    return SCREEN_REDRAW; // 计时器和进度条每帧更新
+}
 
+/**
+ * @brief [页面] 绘制目标、计时器、进度条，结束后显示时间差
+ */
+static void timeChallengeRender()
+{
+    unsigned long elapsed = (tc_game_ended ? tc_press_time : millis()) - tc_start_time;
+
+    menuSprite.fillSprite(TFT_BLACK);
+    menuSprite.setTextColor(TFT_WHITE, TFT_BLACK);
+    menuSprite.setTextSize(2);
     menuSprite.setCursor(20, 30);
-    menuSprite.printf("Target: %.1f s", targetTimeSec);
+    menuSprite.printf("Target: %.1f s", tc_target_ms / 1000.0);
     menuSprite.setCursor(20, 80);
-    menuSprite.print("Timer: 0.0 s");
+    menuSprite.print("Timer:");
+    menuSprite.setTextSize(3);
+    menuSprite.setCursor(100, 80);
+    menuSprite.printf("%.1f s", elapsed / 1000.0);
+    menuSprite.setTextSize(2);
 
-    // 绘制进度条背景
+    // 进度条
+    float progressRatio = (float) elapsed / tc_target_ms;
+    int filledWidth = (int) (progressRatio * (PROGRESS_BAR_WIDTH - 2));
+    if (filledWidth > PROGRESS_BAR_WIDTH - 2) filledWidth = PROGRESS_BAR_WIDTH - 2;
     menuSprite.drawRect(PROGRESS_BAR_X, PROGRESS_BAR_Y, PROGRESS_BAR_WIDTH, PROGRESS_BAR_HEIGHT, TFT_WHITE);
     menuSprite.fillRect(PROGRESS_BAR_X + 1, PROGRESS_BAR_Y + 1, PROGRESS_BAR_WIDTH - 2, PROGRESS_BAR_HEIGHT - 2, PROGRESS_BAR_BG_COLOR);
+    menuSprite.fillRect(PROGRESS_BAR_X + 1, PROGRESS_BAR_Y + 1, filledWidth, PROGRESS_BAR_HEIGHT - 2, PROGRESS_BAR_COLOR);
 
-    unsigned long startTime = millis();
-    unsigned long pressTime = 0;
-    bool gameEnded = false;
+    if (tc_game_ended)
+    { // 计算并显示时间差
+        float diffSec = (float) ((long) elapsed - (long) tc_target_ms) / 1000.0;
+        menuSprite.setCursor(20, 130);
+        menuSprite.printf("Diff: %.2f s", diffSec);
+    }
+    Display_Present(); // 推送到屏幕
+}
 
-    while (true)
-    {
-        if (exitSubMenu || g_alarm_is_ringing) { return; }
-
-        unsigned long currentTime = millis();
-
-        if (!gameEnded)
-        { // 如果游戏未结束
-            float elapsedSec = (currentTime - startTime) / 1000.0;
-            menuSprite.fillRect(100, 80, 120, 20, TFT_BLACK);
-            menuSprite.setTextSize(3);
-            menuSprite.setCursor(100, 80);
-            menuSprite.printf("%.1f s", elapsedSec); // 更新计时器显示
-            menuSprite.setTextSize(2);
-
-            // 更新进度条
-            float progressRatio = (float) (currentTime - startTime) / targetTimeMs;
-            int filledWidth = (int) (progressRatio * (PROGRESS_BAR_WIDTH - 2));
-            if (filledWidth > PROGRESS_BAR_WIDTH - 2) filledWidth = PROGRESS_BAR_WIDTH - 2;
-            menuSprite.fillRect(PROGRESS_BAR_X + 1, PROGRESS_BAR_Y + 1, filledWidth, PROGRESS_BAR_HEIGHT - 2, PROGRESS_BAR_COLOR);
-
-            // 每秒蜂鸣一次
-            if (currentTime - lastBuzzerTime >= BUZZER_INTERVAL_MS)
-            {
-                tone(BUZZER_PIN, 1000, 50);
-                lastBuzzerTime = currentTime;
-            }
-        }
-        menuSprite.pushSprite(0, 0); // 推送到屏幕
+// 计时器显示到0.1秒，进度条每秒约20像素，不需要更高的帧率
+static const ScreenDef timeChallengeScreen = {"time_challenge", 50, false, timeChallengeEnter, timeChallengeUpdate,
+                                              timeChallengeRender, NULL};
 
-        if (readButton())
-        {
-            if (gamesDetectDoubleClick()) { return; } // 双击退出
-            if (!gameEnded)
-            { // 首次单击结束游戏
-                pressTime = currentTime;
-                gameEnded = true;
-                tone(BUZZER_PIN, 1500, 100); // 确认音
-
-                // 计算并显示时间差
-                float diffSec = (float) ((long) (pressTime - startTime) - (long) targetTimeMs) / 1000.0;
-                menuSprite.setTextSize(2);
-                menuSprite.setCursor(20, 130);
-                menuSprite.printf("Diff: %.2f s", diffSec);
-                menuSprite.pushSprite(0, 0);
-            }
-        }
-        vTaskDelay(pdMS_TO_TICKS(10));
-    }
+/**
+ * @brief 时间挑战游戏
+ */
+void TimeChallengeGame()
+{
+    Screen_Run(timeChallengeScreen);
 }
 
 // --- Flappy Bird 游戏实现 ---
@@ -545,148 +627,162 @@ void TimeChallengeGame()
 #define PIPE_SPEED 2
 #define PIPE_INTERVAL 120 // 管道之间的水平距离
 
+// --- Flappy Bird 游戏状态 ---
+static float bird_y = SCREEN_HEIGHT / 2;
+static float bird_vy = 0;
+static int pipes_x[2], pipes_y[2];
+static int flappy_score = 0;
+static bool flappy_game_over = false;
+static bool flappy_started = false;
+
 /**
- * @brief Flappy Bird 游戏主函数
+ * @brief 把小鸟和管道放回初始位置
  */
-void flappy_bird_game()
+static void flappyReset()
 {
-    float bird_y = SCREEN_HEIGHT / 2;
-    float bird_vy = 0;
-    int pipes_x[2], pipes_y[2];
-    int score = 0;
-    bool game_over = false;
-    bool start_game = false;
-
-    // 初始化管道
-    pipes_x[0] = SCREEN_WIDTH;
-    pipes_y[0] = random(40, SCREEN_HEIGHT - 40 - PIPE_GAP);
-    pipes_x[1] = SCREEN_WIDTH + PIPE_INTERVAL + (PIPE_WIDTH / 2);
-    pipes_y[1] = random(40, SCREEN_HEIGHT - 40 - PIPE_GAP);
-
-    unsigned long lastFrameTime = millis();
-    unsigned long lastClickTime = 0;
-
-    while (true)
-    {
-        if (exitSubMenu || g_alarm_is_ringing) { return; }
-        if (readButtonLongPress()) { return; }
-        if (readButton())
+    bird_y = SCREEN_HEIGHT / 2; bird_vy = 0; flappy_score = 0;
+    pipes_x[0] = SCREEN_WIDTH; pipes_y[0] = random(40, SCREEN_HEIGHT - 40 - PIPE_GAP);
+    pipes_x[1] = SCREEN_WIDTH + PIPE_INTERVAL + (PIPE_WIDTH / 2); pipes_y[1] = random(40, SCREEN_HEIGHT - 40 - PIPE_GAP);
+    flappy_game_over = false; flappy_started = false;
+}
+
+/**
+ * @brief [页面] 进入时重置游戏
+ */
+static void flappyEnter()
+{
+    flappyReset();
+    gamesDetectDoubleClick(true);
+}
+
+/**
+ * @brief [页面] 单击开始/跳跃/重开，每帧推进一步物理模拟，双击或长按退出
+ */
+static ScreenAction flappyUpdate(const ScreenInput &input)
+{
+    if (input.longPress) { return SCREEN_EXIT; }
+    if (input.click && gamesDetectDoubleClick()) { return SCREEN_EXIT; }
+
+    // 游戏逻辑
+    if (!flappy_started)
+    { // 等待开始
+        if (input.click)
         {
-            if (gamesDetectDoubleClick()) { return; }
-            lastClickTime = millis();
+            flappy_started = true;
+            return SCREEN_REDRAW;
         }
-
-        // 游戏逻辑
-        if (!start_game)
-        { // 等待开始
-            if (millis() - lastClickTime < 500 && lastClickTime != 0)
-            {
-                start_game = true;
-                lastClickTime = 0;
-            }
+        return SCREEN_IDLE;
+    }
+    if (flappy_game_over)
+    { // 游戏结束，单击以重置游戏
+        if (input.click)
+        {
+            flappyReset();
+            return SCREEN_REDRAW;
         }
-        else if (!game_over)
-        { // 游戏进行中
-// 帧率控制
-            unsigned long currentTime = millis();
-            if (currentTime - lastFrameTime < 30) { vTaskDelay(pdMS_TO_TICKS(1)); continue; }
-            lastFrameTime = currentTime;
-
-            // 输入，让小鸟跳跃
-            if (millis() - lastClickTime < 500 && lastClickTime != 0)
-            {
-                bird_vy = JUMP_FORCE;
-                tone(BUZZER_PIN, 1500, 20);
-                lastClickTime = 0;
-            }
-
-            // 物理模拟
-            bird_vy += GRAVITY;
-            bird_y += bird_vy;
+        return SCREEN_IDLE;
+    }
 
-            // 管道逻辑
-            for (int i = 0; i < 2; i++)
-            {
-                pipes_x[i] -= PIPE_SPEED;
-                // 管道移出屏幕后重置
-                if (pipes_x[i] < -PIPE_WIDTH)
-                {
-                    pipes_x[i] = SCREEN_WIDTH;
-                    pipes_y[i] = random(40, SCREEN_HEIGHT - 40 - PIPE_GAP);
-                }
-                // 通过管道得分
-                if (pipes_x[i] + PIPE_WIDTH < BIRD_X && pipes_x[i] + PIPE_WIDTH + PIPE_SPEED >= BIRD_X)
-                {
-                    score++;
-                    tone(BUZZER_PIN, 2500, 20);
-                }
-            }
+    // 游戏进行中，输入让小鸟跳跃
+    if (input.click)
+    {
+        bird_vy = JUMP_FORCE;
+        Buzzer_Tone(1500, 20);
+    }
+    if (!input.frame)
+    {
+        return SCREEN_IDLE;
+    }
 
-            // 碰撞检测
-            if (bird_y + BIRD_RADIUS > SCREEN_HEIGHT || bird_y - BIRD_RADIUS < 0) game_over = true; // 撞到上下边界
-            for (int i = 0; i < 2; i++)
-            {
-                if (BIRD_X + BIRD_RADIUS > pipes_x[i] && BIRD_X - BIRD_RADIUS < pipes_x[i] + PIPE_WIDTH)
-                {
-                    if (bird_y - BIRD_RADIUS < pipes_y[i] || bird_y + BIRD_RADIUS > pipes_y[i] + PIPE_GAP)
-                    {
-                        game_over = true; // 撞到管道
-                    }
-                }
-            }
-            if (game_over) tone(BUZZER_PIN, 500, 200);
+    // 物理模拟
+    bird_vy += GRAVITY;
+    bird_y += bird_vy;
 
+    // 管道逻辑
+    for (int i = 0; i < 2; i++)
+    {
+        pipes_x[i] -= PIPE_SPEED;
+        // 管道移出屏幕后重置
+        if (pipes_x[i] < -PIPE_WIDTH)
+        {
+            pipes_x[i] = SCREEN_WIDTH;
+            pipes_y[i] = random(40, SCREEN_HEIGHT - 40 - PIPE_GAP);
+        }
+        // 通过管道得分
+        if (pipes_x[i] + PIPE_WIDTH < BIRD_X && pipes_x[i] + PIPE_WIDTH + PIPE_SPEED >= BIRD_X)
+        {
+            flappy_score++;
+            Buzzer_Tone(2500, 20);
         }
-        else
-        { // 游戏结束
-            if (millis() - lastClickTime < 500 && lastClickTime != 0)
+    }
+
+    // 碰撞检测
+    if (bird_y + BIRD_RADIUS > SCREEN_HEIGHT || bird_y - BIRD_RADIUS < 0) flappy_game_over = true; // 撞到上下边界
+    for (int i = 0; i < 2; i++)
+    {
+        if (BIRD_X + BIRD_RADIUS > pipes_x[i] && BIRD_X - BIRD_RADIUS < pipes_x[i] + PIPE_WIDTH)
+        {
+            if (bird_y - BIRD_RADIUS < pipes_y[i] || bird_y + BIRD_RADIUS > pipes_y[i] + PIPE_GAP)
             {
-                // 单击以重置游戏
-                bird_y = SCREEN_HEIGHT / 2; bird_vy = 0; score = 0;
-                pipes_x[0] = SCREEN_WIDTH; pipes_y[0] = random(40, SCREEN_HEIGHT - 40 - PIPE_GAP);
-                pipes_x[1] = SCREEN_WIDTH + PIPE_INTERVAL + (PIPE_WIDTH / 2); pipes_y[1] = random(40, SCREEN_HEIGHT - 40 - PIPE_GAP);
-                game_over = false; start_game = false; lastClickTime = 0;
+                flappy_game_over = true; // 撞到管道
             }
         }
+    }
+    if (flappy_game_over) Buzzer_Tone(500, 200);
+    return SCREEN_REDRAW;
+}
 
-        // --- 绘图 ---
-        menuSprite.fillSprite(TFT_BLACK);
+/**
+ * @brief [页面] 绘制小鸟、管道和分数
+ */
+static void flappyRender()
+{
+    menuSprite.fillSprite(TFT_BLACK);
 
-        if (!start_game)
+    if (!flappy_started)
+    {
+        menuSprite.setTextSize(2);
+        menuSprite.setCursor(50, SCREEN_HEIGHT / 2 + 10);
+        menuSprite.print("Click to start");
+    }
+    else
+    {
+        // 画小鸟
+        menuSprite.pushImage(BIRD_X - 5, (int) bird_y - 4, 11, 8, bird);
+        // 画管道
+        for (int i = 0; i < 2; i++)
         {
-            menuSprite.setTextSize(2);
-            menuSprite.setCursor(50, SCREEN_HEIGHT / 2 + 10);
-            menuSprite.print("Click to start");
+            menuSprite.fillRect(pipes_x[i], 0, PIPE_WIDTH, pipes_y[i], TFT_GREEN);
+            menuSprite.fillRect(pipes_x[i] - 2, pipes_y[i] - 10, PIPE_WIDTH + 4, 10, TFT_GREEN);
+            menuSprite.fillRect(pipes_x[i], pipes_y[i] + PIPE_GAP, PIPE_WIDTH, SCREEN_HEIGHT - (pipes_y[i] + PIPE_GAP), TFT_GREEN);
+            menuSprite.fillRect(pipes_x[i] - 2, pipes_y[i] + PIPE_GAP, PIPE_WIDTH + 4, 10, TFT_GREEN);
         }
-        else
-        {
-            // 画小鸟
-            menuSprite.pushImage(BIRD_X - 5, (int) bird_y - 4, 11, 8, bird);
-            // 画管道
-            for (int i = 0; i < 2; i++)
-            {
-                menuSprite.fillRect(pipes_x[i], 0, PIPE_WIDTH, pipes_y[i], TFT_GREEN);
-                menuSprite.fillRect(pipes_x[i] - 2, pipes_y[i] - 10, PIPE_WIDTH + 4, 10, TFT_GREEN);
-                menuSprite.fillRect(pipes_x[i], pipes_y[i] + PIPE_GAP, PIPE_WIDTH, SCREEN_HEIGHT - (pipes_y[i] + PIPE_GAP), TFT_GREEN);
-                menuSprite.fillRect(pipes_x[i] - 2, pipes_y[i] + PIPE_GAP, PIPE_WIDTH + 4, 10, TFT_GREEN);
-            }
-            // 画分数
-            menuSprite.setTextSize(2);
-            menuSprite.setCursor(10, 10);
-            menuSprite.printf("Score: %d", score);
+        // 画分数
+        menuSprite.setTextSize(2);
+        menuSprite.setCursor(10, 10);
+        menuSprite.printf("Score: %d", flappy_score);
 
-            if (game_over)
-            {
-                menuSprite.setTextSize(3); menuSprite.setCursor(40, SCREEN_HEIGHT / 2 - 30); menuSprite.print("Game Over");
-                menuSprite.setTextSize(2); menuSprite.setCursor(50, SCREEN_HEIGHT / 2 + 10); menuSprite.print("Click to restart");
-            }
+        if (flappy_game_over)
+        {
+            menuSprite.setTextSize(3); menuSprite.setCursor(40, SCREEN_HEIGHT / 2 - 30); menuSprite.print("Game Over");
+            menuSprite.setTextSize(2); menuSprite.setCursor(50, SCREEN_HEIGHT / 2 + 10); menuSprite.print("Click to restart");
         }
-        menuSprite.setTextSize(1);
-        menuSprite.setTextColor(TFT_WHITE, TFT_BLACK);
-        menuSprite.setCursor(20, 220);
-        menuSprite.print("Click to jump, Double-click to exit");
-
-        menuSprite.pushSprite(0, 0);
-        vTaskDelay(pdMS_TO_TICKS(10));
     }
-}
\ No newline at end of file
+    menuSprite.setTextSize(1);
+    menuSprite.setTextColor(TFT_WHITE, TFT_BLACK);
+    menuSprite.setCursor(20, 220);
+    menuSprite.print("Click to jump, Double-click to exit");
+
+    Display_Present();
+}
+
+// 物理模拟按30ms一步，与原来的帧率控制相同
+static const ScreenDef flappyScreen = {"flappy_bird", 30, true, flappyEnter, flappyUpdate, flappyRender, NULL};
+
+/**
+ * @brief Flappy Bird 游戏主函数
+ */
+void flappy_bird_game()
+{
+    Screen_Run(flappyScreen);
+}
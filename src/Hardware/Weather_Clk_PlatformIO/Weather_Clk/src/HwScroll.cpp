@@ -0,0 +1,190 @@
+// 包含所有必需的头文件
+#include "HwScroll.h"
+#include "Display.h"
+
+extern TFT_eSPI tft;
+
+/**
+ * @brief 一段连续的写入：源偏移 src 处的 len 个像素写到地址坐标 dst
+ */
+struct ScrollSpan
+{
+  int32_t src;
+  int32_t dst;
+  int32_t len;
+};
+
+// --- 全局变量 ---
+static bool scrollActive = false;
+static HwScrollAxis scrollAxis = HW_SCROLL_AXIS_Y;
+static bool scrollMirrored = false; // 旋转2/3下屏幕坐标增大对应帧存储器行号减小
+static int32_t scrollStart = 0;     // 滚动区起始屏幕坐标
+static int32_t scrollLength = 0;    // 滚动区长度
+static int32_t scrollOffset = 0;    // 内容已向起始方向移动的像素数 (0 ~ scrollLength-1)
+static uint16_t scrollTop = 0;      // 滚动区在帧存储器中的起始行
+
+/**
+ * @brief 发送一条带若干16位参数的命令，调用者必须持有总线锁
+ */
+static void writeCommand16(uint8_t cmd, const uint16_t *params, int count)
+{
+  tft.startWrite();
+  tft.writecommand(cmd);
+  for (int i = 0; i < count; i++)
+  {
+    tft.writedata(params[i] >> 8);
+    tft.writedata(params[i] & 0xFF);
+  }
+  tft.endWrite();
+}
+
+/**
+ * @brief 按当前偏移设置 VSCSAD
+ */
+static void writeStartAddress()
+{
+  // 镜像方向下内容向屏幕起始方向移动，等于帧存储器中向反方向滚动
+  int32_t lines = scrollMirrored ? (scrollLength - scrollOffset) % scrollLength : scrollOffset;
+  uint16_t ssa = scrollTop + lines;
+  writeCommand16(ST7789_VSCRSADD, &ssa, 1);
+}
+
+/**
+ * @brief 把 [pos, pos+len) 拆成若干段连续写入：滚动区前、滚动区内 (最多两段)、滚动区后
+ * @return 段数
+ */
+static int splitSpan(int32_t pos, int32_t len, ScrollSpan out[4])
+{
+  if (!scrollActive)
+  {
+    out[0] = {0, pos, len};
+    return 1;
+  }
+
+  int count = 0;
+  int32_t end = pos + len;
+  int32_t areaEnd = scrollStart + scrollLength;
+
+  if (pos < scrollStart)
+  {
+    int32_t e = min(end, scrollStart);
+    out[count++] = {0, pos, e - pos};
+  }
+  int32_t s = max(pos, scrollStart);
+  int32_t e = min(end, areaEnd);
+  while (s < e)
+  {
+    int32_t dst = HwScroll_Map(s);
+    int32_t n = min(e - s, areaEnd - dst); // 写到滚动区末尾后从起点继续
+    out[count++] = {s - pos, dst, n};
+    s += n;
+  }
+  if (end > areaEnd)
+  {
+    s = max(pos, areaEnd);
+    out[count++] = {s - pos, s, end - s};
+  }
+  return count;
+}
+
+bool HwScroll_Begin(HwScrollAxis axis, int32_t start, int32_t length)
+{
+  uint8_t rotation = tft.getRotation();
+  HwScrollAxis panelAxis = (rotation & 1) ? HW_SCROLL_AXIS_X : HW_SCROLL_AXIS_Y;
+  if (axis != panelAxis || length <= 0 || start < 0 || start + length > HW_SCROLL_VISIBLE_LINES)
+  {
+    return false;
+  }
+
+  Display_Lock();
+  scrollAxis = axis;
+  scrollMirrored = rotation >= 2;
+  scrollStart = start;
+  scrollLength = length;
+  scrollOffset = 0;
+  scrollTop = scrollMirrored ? HW_SCROLL_VISIBLE_LINES - start - length : start;
+
+  // 顶部固定区、滚动区、底部固定区 (含面板不显示的帧存储器行)
+  uint16_t def[3] = {scrollTop, (uint16_t)length, (uint16_t)(HW_SCROLL_GRAM_LINES - scrollTop - length)};
+  writeCommand16(ST7789_VSCRDEF, def, 3);
+  writeStartAddress();
+  scrollActive = true;
+  Display_Unlock();
+  return true;
+}
+
+void HwScroll_Scroll(int32_t lines)
+{
+  if (!scrollActive) return;
+
+  Display_Lock();
+  scrollOffset = ((scrollOffset + lines) % scrollLength + scrollLength) % scrollLength;
+  writeStartAddress();
+  Display_Unlock();
+}
+
+int32_t HwScroll_Map(int32_t pos)
+{
+  if (!scrollActive || pos < scrollStart || pos >= scrollStart + scrollLength)
+  {
+    return pos;
+  }
+  return scrollStart + (pos - scrollStart + scrollOffset) % scrollLength;
+}
+
+void HwScroll_PushSprite(TFT_eSprite &sprite, int32_t x, int32_t y)
+{
+  int32_t w = sprite.width(), h = sprite.height();
+  ScrollSpan spans[4];
+  int count = splitSpan(scrollAxis == HW_SCROLL_AXIS_X ? x : y, scrollAxis == HW_SCROLL_AXIS_X ? w : h, spans);
+
+  Display_Lock();
+  if (count == 1 && spans[0].src == 0)
+  {
+    if (scrollAxis == HW_SCROLL_AXIS_X) sprite.pushSprite(spans[0].dst, y);
+    else sprite.pushSprite(x, spans[0].dst);
+  }
+  else
+  {
+    for (int i = 0; i < count; i++)
+    {
+      const ScrollSpan &s = spans[i];
+      if (scrollAxis == HW_SCROLL_AXIS_X) sprite.pushSprite(s.dst, y, s.src, 0, s.len, h);
+      else sprite.pushSprite(x, s.dst, 0, s.src, w, s.len);
+    }
+  }
+  Display_Unlock();
+}
+
+void HwScroll_FillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  ScrollSpan spans[4];
+  int count = splitSpan(scrollAxis == HW_SCROLL_AXIS_X ? x : y, scrollAxis == HW_SCROLL_AXIS_X ? w : h, spans);
+
+  Display_Lock();
+  for (int i = 0; i < count; i++)
+  {
+    const ScrollSpan &s = spans[i];
+    if (scrollAxis == HW_SCROLL_AXIS_X) tft.fillRect(s.dst, y, s.len, h, color);
+    else tft.fillRect(x, s.dst, w, s.len, color);
+  }
+  Display_Unlock();
+}
+
+void HwScroll_End()
+{
+  if (!scrollActive) return;
+
+  Display_Lock();
+  uint16_t def[3] = {0, HW_SCROLL_GRAM_LINES, 0};
+  uint16_t ssa = 0;
+  writeCommand16(ST7789_VSCRDEF, def, 3);
+  writeCommand16(ST7789_VSCRSADD, &ssa, 1);
+  scrollActive = false;
+  Display_Unlock();
+}
+
+bool HwScroll_IsActive()
+{
+  return scrollActive;
+}
@@ -0,0 +1,66 @@
+#ifndef HW_SCROLL_H
+#define HW_SCROLL_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define HW_SCROLL_GRAM_LINES    320        // ST7789 帧存储器的总行数，VSCRDEF 的三段之和必须等于它
+#define HW_SCROLL_VISIBLE_LINES TFT_HEIGHT // 面板实际显示的帧存储器行数 (240x240 面板为第0~239行)
+
+/**
+ * @brief 屏幕坐标中的滚动方向。
+ */
+enum HwScrollAxis
+{
+    HW_SCROLL_AXIS_X, ///< 内容沿屏幕X方向移动 (横向滚动，如曲线图)。
+    HW_SCROLL_AXIS_Y  ///< 内容沿屏幕Y方向移动 (纵向滚动，如日志)。
+};
+
+/**
+ * @brief 用 ST7789 的 VSCRDEF/VSCSAD 在屏幕的一段区域内开启硬件滚动。
+ * @param axis 需要的滚动方向。
+ * @param start 滚动区在该方向上的起始屏幕坐标。
+ * @param length 滚动区长度 (像素)。
+ * @details 面板只能沿扫描线方向滚动，且滚动区横跨整个屏幕：横屏 (旋转1/3) 下只能横向滚动整列，
+ *          竖屏 (旋转0/2) 下只能纵向滚动整行。滚动区内不随内容移动的元素需要调用者每次重画。
+ *          开启时不改变屏幕上的内容。
+ * @return 当前旋转方向不支持所需的滚动方向或参数无效时返回false，调用者应退回重绘方式。
+ */
+bool HwScroll_Begin(HwScrollAxis axis, int32_t start, int32_t length);
+
+/**
+ * @brief 把滚动区的内容向起始方向移动若干像素。
+ * @details 只发送一条 VSCSAD 命令。移出起点的内容从末端重新出现，调用者随后应在
+ *          末端新露出的 lines 个像素宽的条带上绘制新内容 (用 HwScroll_Map 换算坐标)。
+ */
+void HwScroll_Scroll(int32_t lines);
+
+/**
+ * @brief 把 "未滚动时" 的屏幕坐标换算为当前应写入的地址坐标。
+ * @param pos 滚动方向上的屏幕坐标，滚动区外的坐标原样返回。
+ * @details 滚动区内连续的一段在写入时可能被拆成两段，整块绘制请用 HwScroll_PushSprite 或 HwScroll_FillRect。
+ */
+int32_t HwScroll_Map(int32_t pos);
+
+/**
+ * @brief 把精灵推送到 "未滚动时" 的屏幕位置 (x, y)，跨越滚动区回绕点时自动拆成两次推送。
+ */
+void HwScroll_PushSprite(TFT_eSprite &sprite, int32_t x, int32_t y);
+
+/**
+ * @brief 在 "未滚动时" 的屏幕位置填充矩形，规则同 HwScroll_PushSprite。
+ */
+void HwScroll_FillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+
+/**
+ * @brief 关闭硬件滚动，恢复全屏固定的显示映射。
+ * @details 滚动区内的内容会因此错位，调用者之后应重画该区域。整帧推送 (Display_Present) 时会自动调用。
+ */
+void HwScroll_End();
+
+/**
+ * @brief 硬件滚动是否处于开启状态。
+ */
+bool HwScroll_IsActive();
+
+#endif // HW_SCROLL_H
@@ -6,7 +6,10 @@
 #include <WiFiClientSecure.h>
 #include <HTTPClient.h>
 #include <WiFi.h>
-#include "font_12.h"       // 包含自定义的中文字体
+#include "FontCache.h"      // 常驻的中文字体 (font_12)
+#include "Display.h"        // 屏幕渲染任务
+#include "Memory.h"         // 界面内存池
+#include "Screen.h"         // 页面调度器
 
 // 全局显示对象 (在其他文件中定义)
 extern TFT_eSPI tft;
@@ -186,7 +189,8 @@ void fetchSayLove()
     String payload = httpGETRequest(url.c_str());
     if (payload != "N/A")
     {
-        DynamicJsonDocument doc(1024);
+        ArenaScope scope; // 解析用的临时内存在离开作用域时一次回收
+        JsonDocument doc(ArenaJsonAllocator::instance());
         if (deserializeJson(doc, payload).code() == DeserializationError::Ok)
         {
             g_say_love_data.content = doc["result"]["content"].as<String>();
@@ -208,7 +212,8 @@ void fetchEverydayEnglish()
     String payload = httpGETRequest(url.c_str());
     if (payload != "N/A")
     {
-        DynamicJsonDocument doc(1024);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         if (deserializeJson(doc, payload).code() == DeserializationError::Ok)
         {
             g_everyday_english_data.content = doc["result"]["content"].as<String>();
@@ -229,7 +234,8 @@ void fetchFortune()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0)
     {
-        DynamicJsonDocument doc(1024);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error)
         {
@@ -266,7 +272,8 @@ void fetchShici()
     String payload = httpGETRequest(url.c_str());
     if (payload != "N/A")
     {
-        DynamicJsonDocument doc(4096); // 为完整诗歌内容增加容量
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         if (deserializeJson(doc, payload).code() == DeserializationError::Ok)
         {
             g_shici_data.title = doc["data"]["origin"]["title"].as<String>();
@@ -295,7 +302,8 @@ void fetchDuilian()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0)
     {
-        DynamicJsonDocument doc(1024);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error)
         {
@@ -316,7 +324,8 @@ void fetchFxRate()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0)
     {
-        DynamicJsonDocument doc(1024);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error)
         {
@@ -337,7 +346,8 @@ void fetchRandomEnWord()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0)
     {
-        DynamicJsonDocument doc(2048); // Increased capacity for potentially larger word data
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error)
         {
@@ -374,7 +384,8 @@ void fetchYiyan()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0)
     {
-        DynamicJsonDocument doc(1024);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error)
         {
@@ -395,7 +406,8 @@ void fetchLzmy()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0)
     {
-        DynamicJsonDocument doc(1024);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error && doc["code"] == 200)
         {
@@ -418,7 +430,8 @@ void fetchVerse()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0)
     {
-        DynamicJsonDocument doc(1024);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error && doc["code"] == 200)
         {
@@ -442,7 +455,8 @@ void fetchTianqishiju()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0)
     {
-        DynamicJsonDocument doc(1024);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error && doc["code"] == 200)
         {
@@ -468,7 +482,8 @@ void fetchHsjz()
     if (payload.length() > 0)
     {
 
-        DynamicJsonDocument doc(1024);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
 
         DeserializationError error = deserializeJson(doc, payload);
 
@@ -498,7 +513,8 @@ void fetchBrainTeaser()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0)
     {
-        DynamicJsonDocument doc(2048);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error && doc["code"] == 200)
         {
@@ -531,7 +547,8 @@ void fetchHealthTip()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0 && payload != "N/A")
     {
-        DynamicJsonDocument doc(1024);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error && doc["code"] == 200)
         {
@@ -552,7 +569,8 @@ void fetchGitHubTrending()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0 && payload != "N/A")
     {
-        DynamicJsonDocument doc(8192);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error && doc["status"] == "success")
         {
@@ -584,7 +602,8 @@ void fetchHistory()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0 && payload != "N/A")
     {
-        DynamicJsonDocument doc(8192);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error && doc["code"] == 200)
         {
@@ -615,7 +634,8 @@ void fetchTenWhy()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0 && payload != "N/A")
     {
-        DynamicJsonDocument doc(2048);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error && doc["code"] == 200)
         {
@@ -638,7 +658,8 @@ void fetchonlineweather()
     String payload = httpGETRequest(url.c_str());
     if (payload.length() > 0 && payload != "N/A")
     {
-        DynamicJsonDocument doc(2048);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
         if (!error && doc["status"].as<int>() == 1)
         {
@@ -670,7 +691,8 @@ void fetchStockData()
         String payload = httpGETRequest(STOCK_API_URLS[i]);
         if (payload.length() > 0 && payload != "N/A")
         {
-            DynamicJsonDocument doc(4096);
+            ArenaScope scope;
+            JsonDocument doc(ArenaJsonAllocator::instance());
             DeserializationError error = deserializeJson(doc, payload);
             if (!error)
             {
@@ -721,7 +743,8 @@ void fetchCurrencyData()
         String payload = httpGETRequest(CURRENCY_API_URLS[i]);
         if (payload.length() > 0 && payload != "N/A")
         {
-            DynamicJsonDocument doc(1024);
+            ArenaScope scope;
+            JsonDocument doc(ArenaJsonAllocator::instance());
             DeserializationError error = deserializeJson(doc, payload);
             if (!error && doc["error"] == 0)
             {
@@ -778,7 +801,7 @@ void internet_menu_init()
     menuSprite.setTextColor(TFT_WHITE);
     menuSprite.setTextDatum(MC_DATUM);
     menuSprite.drawString("Loading Data...", tft.width() / 2, tft.height() / 2);
-    menuSprite.pushSprite(0, 0);
+    Display_Present();
 
     // 首次进入时获取所有数据
     // (可以根据需要取消注释)
@@ -817,7 +840,7 @@ void internet_menu_init()
  * @param font 字体编号 (如果为0则使用已加载的字体)
  * @param color 文本颜色
  */
-void drawWrappedText(TFT_eSprite &sprite, String text, int x, int y, int maxWidth, int font, uint16_t color)
+void drawWrappedText(TFT_eSprite &sprite, const String &text, int x, int y, int maxWidth, int font, uint16_t color)
 {
     sprite.setTextColor(color);
     if (font > 0) sprite.setTextFont(font);
@@ -826,6 +849,22 @@ void drawWrappedText(TFT_eSprite &sprite, String text, int x, int y, int maxWidt
     sprite.print(text);
 }
 
+/**
+ * @brief 用常驻的中文字体在Sprite上绘制带自动换行的文本
+ * @param sprite 要绘制的TFT_eSprite对象
+ * @param text 要绘制的文本
+ * @param x 起始X坐标
+ * @param y 起始Y坐标
+ * @param maxWidth 最大宽度
+ * @param color 文本颜色
+ * @details 字体在开机时加载一次，不需要在每次绘制前后 loadFont()/unloadFont()。
+ */
+void drawWrappedChineseText(TFT_eSprite &sprite, const String &text, int x, int y, int maxWidth, uint16_t color)
+{
+    sprite.setTextColor(color);
+    FontCache_Print(sprite, text, x, y, maxWidth);
+}
+
 /**
  * @brief 绘制当前页面的内容
  */
@@ -840,7 +879,9 @@ void internet_menu_draw()
     menuSprite.setTextSize(2);
     menuSprite.setTextDatum(TR_DATUM);
     menuSprite.setTextColor(TFT_LIGHTGREY);
-    menuSprite.drawString(String(g_current_internet_page + 1) + "/" + String(MAX_INTERNET_PAGES), menuSprite.width() - 5, 5);
+    char pageStr[8];
+    snprintf(pageStr, sizeof(pageStr), "%d/%d", g_current_internet_page + 1, MAX_INTERNET_PAGES);
+    menuSprite.drawString(pageStr, menuSprite.width() - 5, 5);
     menuSprite.setTextDatum(TL_DATUM);
 
     int content_x = 5;
@@ -856,9 +897,7 @@ void internet_menu_draw()
         menuSprite.setTextSize(2);
         menuSprite.setTextColor(TFT_PINK);
         menuSprite.drawString("Love Talk", 5, 25);
-        menuSprite.loadFont(font_12); // 加载中文字体
-        drawWrappedText(menuSprite, g_say_love_data.content, content_x, content_y, content_width, 0, TFT_WHITE);
-        menuSprite.unloadFont(); // 卸载中文字体
+        drawWrappedChineseText(menuSprite, g_say_love_data.content, content_x, content_y, content_width, TFT_WHITE);
         break;
     case 1: // 每日英语
         menuSprite.setTextFont(1);
@@ -867,9 +906,7 @@ void internet_menu_draw()
         menuSprite.drawString("Daily English", 5, 25);
         drawWrappedText(menuSprite, g_everyday_english_data.content, content_x, content_y, content_width, english_font_num, TFT_WHITE);
         content_y = menuSprite.getCursorY() + 20;
-        menuSprite.loadFont(font_12);
-        drawWrappedText(menuSprite, g_everyday_english_data.note, content_x, content_y, content_width, 0, TFT_YELLOW);
-        menuSprite.unloadFont();
+        drawWrappedChineseText(menuSprite, g_everyday_english_data.note, content_x, content_y, content_width, TFT_YELLOW);
         break;
     case 2: // Fortune
         menuSprite.setTextFont(1);
@@ -878,13 +915,11 @@ void internet_menu_draw()
         menuSprite.drawString("Daily Fortune", 5, 25);
         if (g_fortune_data.success)
         {
-            menuSprite.loadFont(font_12);
-            drawWrappedText(menuSprite, "签：" + g_fortune_data.sign, content_x, content_y, content_width, 0, TFT_WHITE);
+            drawWrappedChineseText(menuSprite, "签：" + g_fortune_data.sign, content_x, content_y, content_width, TFT_WHITE);
             content_y = menuSprite.getCursorY() + 15;
-            drawWrappedText(menuSprite, "描述: " + g_fortune_data.description, content_x, content_y, content_width, 0, TFT_WHITE);
+            drawWrappedChineseText(menuSprite, "描述: " + g_fortune_data.description, content_x, content_y, content_width, TFT_WHITE);
             content_y = menuSprite.getCursorY() + 15;
-            drawWrappedText(menuSprite, "颜色: " + g_fortune_data.luckyColor, content_x, content_y, content_width, 0, TFT_WHITE);
-            menuSprite.unloadFont();
+            drawWrappedChineseText(menuSprite, "颜色: " + g_fortune_data.luckyColor, content_x, content_y, content_width, TFT_WHITE);
             content_y = menuSprite.getCursorY() + 15;
             menuSprite.setTextFont(1);
             menuSprite.setTextSize(2);
@@ -892,29 +927,23 @@ void internet_menu_draw()
         }
         else
         {
-            menuSprite.loadFont(font_12);
-            drawWrappedText(menuSprite, g_fortune_data.message, content_x, content_y, content_width, 0, TFT_WHITE);
-            menuSprite.unloadFont();
+            drawWrappedChineseText(menuSprite, g_fortune_data.message, content_x, content_y, content_width, TFT_WHITE);
         }
         break;
     case 3: // Shici (Poem)
     {
-        menuSprite.loadFont(font_12);
         menuSprite.setTextColor(TFT_CYAN, TFT_BLACK);
         menuSprite.setTextDatum(MC_DATUM);
-        menuSprite.drawString(g_shici_data.title, menuSprite.width() / 2, 20);
+        FontCache_DrawString(menuSprite, g_shici_data.title, menuSprite.width() / 2, 20);
         String author_info = g_shici_data.author + "[ " + g_shici_data.dynasty + "]";
-        menuSprite.drawString(author_info, menuSprite.width() / 2, 45);
-        menuSprite.unloadFont();
+        FontCache_DrawString(menuSprite, author_info, menuSprite.width() / 2, 45);
         menuSprite.setTextFont(1);
         menuSprite.setTextSize(2);
         menuSprite.setTextColor(TFT_ORANGE, TFT_BLACK);
         menuSprite.setTextDatum(BC_DATUM);
         menuSprite.drawString("Popularity: " + String(g_shici_data.popularity), 120, 240 - 5);
         menuSprite.setTextDatum(TL_DATUM);
-        menuSprite.loadFont(font_12);
-        drawWrappedText(menuSprite, g_shici_data.full_content, content_x, 70, content_width, 0, TFT_WHITE);
-        menuSprite.unloadFont();
+        drawWrappedChineseText(menuSprite, g_shici_data.full_content, content_x, 70, content_width, TFT_WHITE);
     }
     break;
     case 4: // Duilian (Couplet)
@@ -922,9 +951,7 @@ void internet_menu_draw()
         menuSprite.setTextSize(2);
         menuSprite.setTextColor(TFT_BLUE);
         menuSprite.drawString("Couplet", 5, 25);
-        menuSprite.loadFont(font_12);
-        drawWrappedText(menuSprite, g_duilian_data.content, content_x, content_y, content_width, 0, TFT_WHITE);
-        menuSprite.unloadFont();
+        drawWrappedChineseText(menuSprite, g_duilian_data.content, content_x, content_y, content_width, TFT_WHITE);
         break;
     case 5: // FxRate (Exchange Rate)
         menuSprite.setTextFont(1);
@@ -948,9 +975,7 @@ void internet_menu_draw()
         menuSprite.setTextSize(2);
         drawWrappedText(menuSprite, g_random_en_word_data.headWord, content_x, content_y, content_width, english_font_num, TFT_WHITE);
         content_y = menuSprite.getCursorY() + 15;
-        menuSprite.loadFont(font_12);
-        drawWrappedText(menuSprite, g_random_en_word_data.tranCn, content_x, content_y, content_width, 0, TFT_WHITE);
-        menuSprite.unloadFont();
+        drawWrappedChineseText(menuSprite, g_random_en_word_data.tranCn, content_x, content_y, content_width, TFT_WHITE);
         if (g_random_en_word_data.phrases_en.length() > 0)
         {
             content_y = menuSprite.getCursorY() + 15;
@@ -958,9 +983,7 @@ void internet_menu_draw()
             menuSprite.setTextSize(2);
             drawWrappedText(menuSprite, g_random_en_word_data.phrases_en, content_x, content_y, content_width, english_font_num, TFT_WHITE);
             content_y = menuSprite.getCursorY() + 15;
-            menuSprite.loadFont(font_12);
-            drawWrappedText(menuSprite, g_random_en_word_data.phrases_cn, content_x, content_y, content_width, 0, TFT_WHITE);
-            menuSprite.unloadFont();
+            drawWrappedChineseText(menuSprite, g_random_en_word_data.phrases_cn, content_x, content_y, content_width, TFT_WHITE);
         }
         break;
     case 7: // Yiyan
@@ -968,83 +991,69 @@ void internet_menu_draw()
         menuSprite.setTextSize(2);
         menuSprite.setTextColor(TFT_SKYBLUE);
         menuSprite.drawString("Daily Saying", 5, 25);
-        menuSprite.loadFont(font_12);
-        drawWrappedText(menuSprite, g_yiyan_data.hitokoto, content_x, content_y, content_width, 0, TFT_WHITE);
-        menuSprite.unloadFont();
+        drawWrappedChineseText(menuSprite, g_yiyan_data.hitokoto, content_x, content_y, content_width, TFT_WHITE);
         break;
     case 8: // Lzmy
         menuSprite.setTextFont(1);
         menuSprite.setTextSize(2);
         menuSprite.setTextColor(TFT_GOLD);
         menuSprite.drawString("Inspiring Saying", 5, 25);
-        menuSprite.loadFont(font_12);
-        drawWrappedText(menuSprite, g_lzmy_data.saying, content_x, content_y, content_width, 0, TFT_WHITE);
+        drawWrappedChineseText(menuSprite, g_lzmy_data.saying, content_x, content_y, content_width, TFT_WHITE);
         content_y = menuSprite.getCursorY() + 15;
-        drawWrappedText(menuSprite, g_lzmy_data.transl, content_x, content_y, content_width, 0, TFT_YELLOW);
+        drawWrappedChineseText(menuSprite, g_lzmy_data.transl, content_x, content_y, content_width, TFT_YELLOW);
         content_y = menuSprite.getCursorY() + 15;
-        drawWrappedText(menuSprite, g_lzmy_data.source, content_x, content_y, content_width, 0, TFT_YELLOW);
-        menuSprite.unloadFont();
+        drawWrappedChineseText(menuSprite, g_lzmy_data.source, content_x, content_y, content_width, TFT_YELLOW);
         break;
     case 9: // Verse
         menuSprite.setTextFont(1);
         menuSprite.setTextSize(2);
         menuSprite.setTextColor(TFT_CYAN);
         menuSprite.drawString("Beautiful Verse", 5, 25);
-        menuSprite.loadFont(font_12);
-        drawWrappedText(menuSprite, g_verse_data.content, content_x, content_y, content_width, 0, TFT_WHITE);
+        drawWrappedChineseText(menuSprite, g_verse_data.content, content_x, content_y, content_width, TFT_WHITE);
         content_y = menuSprite.getCursorY() + 15;
-        drawWrappedText(menuSprite, g_verse_data.author + "《 " + g_verse_data.source + " 》", content_x, content_y, content_width, 0, TFT_YELLOW);
-        menuSprite.unloadFont();
+        drawWrappedChineseText(menuSprite, g_verse_data.author + "《 " + g_verse_data.source + " 》", content_x, content_y, content_width, TFT_YELLOW);
         break;
     case 10: // Tianqishiju
         menuSprite.setTextFont(1);
         menuSprite.setTextSize(2);
         menuSprite.setTextColor(TFT_YELLOW);
         menuSprite.drawString("Weather Poem", 5, 25);
-        menuSprite.loadFont(font_12);
-        drawWrappedText(menuSprite, g_tianqishiju_data.content, content_x, content_y, content_width, 0, TFT_WHITE);
+        drawWrappedChineseText(menuSprite, g_tianqishiju_data.content, content_x, content_y, content_width, TFT_WHITE);
         content_y = menuSprite.getCursorY() + 15;
-        drawWrappedText(menuSprite, g_tianqishiju_data.author + "《 " + g_tianqishiju_data.source + " 》", content_x, content_y, content_width, 0, TFT_YELLOW);
-        menuSprite.unloadFont();
+        drawWrappedChineseText(menuSprite, g_tianqishiju_data.author + "《 " + g_tianqishiju_data.source + " 》", content_x, content_y, content_width, TFT_YELLOW);
         break;
     case 11: // Hsjz
         menuSprite.setTextFont(1);
         menuSprite.setTextSize(2);
         menuSprite.setTextColor(TFT_WHITE);
         menuSprite.drawString("Sad Sentence", 5, 25);
-        menuSprite.loadFont(font_12);
-        drawWrappedText(menuSprite, g_hsjz_data.content, content_x, content_y, content_width, 0, TFT_WHITE);
-        menuSprite.unloadFont();
+        drawWrappedChineseText(menuSprite, g_hsjz_data.content, content_x, content_y, content_width, TFT_WHITE);
         break;
     case 12: // 脑筋急转弯
         menuSprite.setTextFont(1);
         menuSprite.setTextSize(2);
         menuSprite.setTextColor(TFT_MAGENTA);
         menuSprite.drawString("Brain Teaser", 5, 25);
-        menuSprite.loadFont(font_12);
         if (g_brain_teaser_data.count > 0)
         {
-            drawWrappedText(menuSprite, g_brain_teaser_data.teasers[g_brain_teaser_index].quest, content_x, content_y, content_width, 0, TFT_WHITE);
+            drawWrappedChineseText(menuSprite, g_brain_teaser_data.teasers[g_brain_teaser_index].quest, content_x, content_y, content_width, TFT_WHITE);
             if (g_show_brain_teaser_answer)
             { // 如果需要显示答案
                 content_y = menuSprite.getCursorY() + 15;
-                drawWrappedText(menuSprite, g_brain_teaser_data.teasers[g_brain_teaser_index].result, content_x, content_y, content_width, 0, TFT_GREEN);
+                drawWrappedChineseText(menuSprite, g_brain_teaser_data.teasers[g_brain_teaser_index].result, content_x, content_y, content_width, TFT_GREEN);
             }
         }
         else
         {
-            drawWrappedText(menuSprite, "Loading...", content_x, content_y, content_width, 0, TFT_WHITE);
+            drawWrappedChineseText(menuSprite, "Loading...", content_x, content_y, content_width, TFT_WHITE);
         }
-        menuSprite.unloadFont();
         break;
     case 13: // Health Tip
         menuSprite.setTextFont(1);
         menuSprite.setTextSize(2);
         menuSprite.setTextColor(TFT_GREEN);
         menuSprite.drawString("Health Tip", 5, 25);
-        menuSprite.loadFont(font_12);
-        drawWrappedText(menuSprite, g_health_tip_data.content, content_x, content_y, content_width, 0, TFT_WHITE);
-        menuSprite.unloadFont();
+        drawWrappedChineseText(menuSprite, g_health_tip_data.content, content_x, content_y, content_width, TFT_WHITE);
         break;
     case 14: // GitHub Trending
     {
@@ -1068,24 +1077,20 @@ void internet_menu_draw()
         menuSprite.setTextSize(2);
         menuSprite.setTextColor(TFT_YELLOW);
         menuSprite.drawString("History Today", 5, 5);
-        menuSprite.loadFont(font_12);
         String history_text = "";
         for (int i = 0; i < g_history_data.count; i++)
         {
             history_text += g_history_data.events[i].lsdate.substring(0, 4) + " " + g_history_data.events[i].title + "\n";
         }
-        drawWrappedText(menuSprite, history_text, content_x, content_y - 20, content_width, 0, TFT_WHITE);
-        menuSprite.unloadFont();
+        drawWrappedChineseText(menuSprite, history_text, content_x, content_y - 20, content_width, TFT_WHITE);
     }
     break;
     case 16: // Ten Why
         menuSprite.setTextFont(1);
         menuSprite.setTextSize(2);
         menuSprite.setTextColor(TFT_ORANGE);
-        menuSprite.loadFont(font_12);
-        menuSprite.drawString(g_ten_why_data.title, 5, 25);
-        drawWrappedText(menuSprite, g_ten_why_data.content, content_x, content_y, content_width, 0, TFT_WHITE);
-        menuSprite.unloadFont();
+        FontCache_DrawString(menuSprite, g_ten_why_data.title, 5, 25);
+        drawWrappedChineseText(menuSprite, g_ten_why_data.content, content_x, content_y, content_width, TFT_WHITE);
         break;
     case 17: // Weather
     {
@@ -1184,7 +1189,7 @@ void internet_menu_draw()
     break;
     }
 
-    menuSprite.pushSprite(0, 0); // 将Sprite内容推送到屏幕
+    Display_Present(); // 将Sprite内容推送到屏幕
 }
 
 /**
@@ -1213,88 +1218,91 @@ bool internet_menu_back_press()
 }
 
 /**
- * @brief 互联网信息菜单的主屏幕函数
- * @details 包含主循环，处理用户输入并调用相应的绘制和数据获取函数。
+ * @brief [页面] 旋转翻页，短按重新获取当前页的数据，长按退出
+ * @details 获取数据是阻塞的HTTP请求，期间到达的闹钟要等请求结束后才能结束页面。
  */
-void InternetMenuScreen()
+static ScreenAction internetMenuUpdate(const ScreenInput &input)
 {
-    internet_menu_init(); // 初始化
-    while (true)
-    {
-        int rotation = readEncoder();
-        bool button_clicked = readButton();
-        bool long_press = readButtonLongPress();
-
-        if (long_press)
-        { // 长按退出
-            internet_menu_back_press();
-            return;
+    if (input.longPress)
+    { // 长按退出
+        internet_menu_back_press();
+        return SCREEN_EXIT;
+    }
+
+    if (input.encoder != 0)
+    { // 旋转编码器翻页
+        if (input.encoder > 0)
+        {
+            internet_menu_next_page();
         }
+        else
+        {
+            internet_menu_prev_page();
+        }
+        return SCREEN_REDRAW; // 翻页后重绘
+    }
 
-        if (rotation != 0)
-        { // 旋转编码器翻页
-            if (rotation > 0)
+    if (input.click)
+    { // 短按按钮
+        if (g_current_internet_page == 12)
+        { // 特殊处理脑筋急转弯页面
+            if (!g_show_brain_teaser_answer)
             {
-                internet_menu_next_page();
+                g_show_brain_teaser_answer = true; // 显示答案
             }
             else
             {
-                internet_menu_prev_page();
-            }
-            internet_menu_draw(); // 翻页后重绘
-        }
-
-        if (button_clicked)
-        { // 短按按钮
-            if (g_current_internet_page == 12)
-            { // 特殊处理脑筋急转弯页面
-                if (!g_show_brain_teaser_answer)
-                {
-                    g_show_brain_teaser_answer = true; // 显示答案
-                }
-                else
+                g_brain_teaser_index++; // 切换到下一个问题
+                g_show_brain_teaser_answer = false;
+                if (g_brain_teaser_index >= g_brain_teaser_data.count)
                 {
-                    g_brain_teaser_index++; // 切换到下一个问题
-                    g_show_brain_teaser_answer = false;
-                    if (g_brain_teaser_index >= g_brain_teaser_data.count)
-                    {
-                        tftClearLog();
-                        tftLogInfo("Fetching new brain teasers...");
-                        fetchBrainTeaser(); // 看完所有题目后重新获取
-                    }
+                    tftClearLog();
+                    tftLogInfo("Fetching new brain teasers...");
+                    fetchBrainTeaser(); // 看完所有题目后重新获取
                 }
             }
-            else
+        }
+        else
+        {
+            // 对于其他页面，短按重新获取当前页面的数据
+            tftClearLog();
+            tftLogInfo("Re-fetching data for current page...");
+            switch (g_current_internet_page)
             {
-                // 对于其他页面，短按重新获取当前页面的数据
-                tftClearLog();
-                tftLogInfo("Re-fetching data for current page...");
-                switch (g_current_internet_page)
-                {
-                case 0: fetchSayLove(); break;
-                case 1: fetchEverydayEnglish(); break;
-                case 2: fetchFortune(); break;
-                case 3: fetchShici(); break;
-                case 4: fetchDuilian(); break;
-                case 5: fetchFxRate(); break;
-                case 6: fetchRandomEnWord(); break;
-                case 7: fetchYiyan(); break;
-                case 8: fetchLzmy(); break;
-                case 9: fetchVerse(); break;
-                case 10: fetchTianqishiju(); break;
-                case 11: fetchHsjz(); break;
-                case 13: fetchHealthTip(); break;
-                case 14: fetchGitHubTrending(); break;
-                case 15: fetchHistory(); break;
-                case 16: fetchTenWhy(); break;
-                case 17: fetchonlineweather(); break;
-                case 18: fetchStockData(); break;
-                case 19: fetchCurrencyData(); break;
-                }
+            case 0: fetchSayLove(); break;
+            case 1: fetchEverydayEnglish(); break;
+            case 2: fetchFortune(); break;
+            case 3: fetchShici(); break;
+            case 4: fetchDuilian(); break;
+            case 5: fetchFxRate(); break;
+            case 6: fetchRandomEnWord(); break;
+            case 7: fetchYiyan(); break;
+            case 8: fetchLzmy(); break;
+            case 9: fetchVerse(); break;
+            case 10: fetchTianqishiju(); break;
+            case 11: fetchHsjz(); break;
+            case 13: fetchHealthTip(); break;
+            case 14: fetchGitHubTrending(); break;
+            case 15: fetchHistory(); break;
+            case 16: fetchTenWhy(); break;
+            case 17: fetchonlineweather(); break;
+            case 18: fetchStockData(); break;
+            case 19: fetchCurrencyData(); break;
             }
-            internet_menu_draw(); // 重绘以显示新数据或新状态
         }
-
-        vTaskDelay(pdMS_TO_TICKS(10)); // 短暂延时
+        return SCREEN_REDRAW; // 重绘以显示新数据或新状态
     }
-}
\ No newline at end of file
+    return SCREEN_IDLE;
+}
+
+static const ScreenDef internetMenuScreen = {"internet", DISPLAY_MIN_FRAME_MS, true, internet_menu_init,
+                                             internetMenuUpdate, internet_menu_draw, NULL};
+
+/**
+ * @brief 互联网信息菜单的主屏幕函数
+ * @details 由页面调度器驱动：处理用户输入并调用相应的绘制和数据获取函数。
+ */
+void InternetMenuScreen()
+{
+    Screen_Run(internetMenuScreen);
+}
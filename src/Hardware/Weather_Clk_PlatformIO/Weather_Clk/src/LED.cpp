@@ -5,15 +5,7 @@
 #include <TFT_eSPI.h>
 #include "Menu.h"
 #include "MQTT.h" 
-#include <Adafruit_NeoPixel.h>
-
-// 初始化NeoPixel灯带对象
-Adafruit_NeoPixel strip = Adafruit_NeoPixel(NUM_LEDS, LED_PIN, NEO_GRB + NEO_KHZ800);
-
-// 彩虹动画任务的句柄
-TaskHandle_t rainbowTaskHandle = NULL;
-// 彩虹动画的速度
-uint16_t rainbowSpeed = 20;
+#include "Display.h"
 
 // 定义控制模式的枚举
 enum ControlMode { 
@@ -21,91 +13,34 @@ enum ControlMode {
     COLOR_MODE       
 };
 
-// 函数前向声明
-void stop_rainbow_task_if_running();
-
-/**
- * @brief 将0-255范围内的值转换为彩虹色。
- * @param WheelPos 色轮上的位置 (0-255)。
- * @return 32位颜色值。
- */
-uint32_t wheel(byte WheelPos) {
-  WheelPos = 255 - WheelPos;
-  if(WheelPos < 85) {
-    return strip.Color(255 - WheelPos * 3, 0, WheelPos * 3);
-  }
-  if(WheelPos < 170) {
-    WheelPos -= 85;
-    return strip.Color(0, WheelPos * 3, 255 - WheelPos * 3);
-  }
-  WheelPos -= 170;
-  return strip.Color(WheelPos * 3, 255 - WheelPos * 3, 0);
-}
-
-/**
- * @brief [FreeRTOS Task] 彩虹动画任务
- * @param pvParameters 未使用。
- */
-void rainbow_task(void *pvParameters) {
-    uint16_t j = 0;
-    for(;;) { // 无限循环
-        for(int i=0; i<strip.numPixels(); i++) {
-            strip.setPixelColor(i, wheel(((i * 256 / strip.numPixels()) + j) & 255));
-        }
-        strip.show();
-        j++;
-        if(j >= 256*5) j=0; // 循环5次后重置
-        vTaskDelay(pdMS_TO_TICKS(rainbowSpeed));
-    }
-}
-
-/**
- * @brief 如果彩虹动画任务正在运行，则停止它。
- */
-void stop_rainbow_task_if_running() {
-    if (rainbowTaskHandle != NULL) {
-        vTaskDelete(rainbowTaskHandle);
-        rainbowTaskHandle = NULL;
-        led_off(); // 关闭LED
-    }
-}
-
 /**
  * @brief 设置单个LED的颜色。
  */
 void led_set_single(uint8_t index, uint8_t r, uint8_t g, uint8_t b) {
-    stop_rainbow_task_if_running();
-    if (index < strip.numPixels()) {
-        strip.setPixelColor(index, r, g, b);
-        strip.show();
-    }
+    LedEffect effect = {LED_EFFECT_PIXEL, r, g, b, index, 0};
+    LedEngine_Submit(effect);
 }
 
 /**
  * @brief 将所有LED设置为相同的颜色。
  */
 void led_set_all(uint8_t r, uint8_t g, uint8_t b) {
-    stop_rainbow_task_if_running();
-    strip.fill(strip.Color(r, g, b));
-    strip.show();
+    LedEngine_Solid(r, g, b);
 }
 
 /**
  * @brief 启动或更新彩虹动画模式。
  */
 void led_rainbow_mode(uint16_t speed) {
-    stop_rainbow_task_if_running();
-    rainbowSpeed = speed;
-    xTaskCreate(rainbow_task, "RainbowTask", 1024, NULL, 5, &rainbowTaskHandle);
+    LedEffect effect = {LED_EFFECT_RAINBOW, 0, 0, 0, 0, speed};
+    LedEngine_Submit(effect);
 }
 
 /**
  * @brief 关闭所有LED。
  */
 void led_off() {
-    stop_rainbow_task_if_running();
-    strip.clear();
-    strip.show();
+    LedEngine_Off();
 }
 
 
@@ -152,10 +87,8 @@ void drawLedControl(uint8_t brightness, uint16_t hue, ControlMode currentMode) {
     }
     menuSprite.setTextColor(TFT_WHITE, TFT_BLACK);
     int hueBarWidth = map(hue, 0, 65535, 0, 200);
-    uint32_t color = strip.ColorHSV(hue);
-    uint16_t r = (color >> 16) & 0xFF;
-    uint16_t g = (color >> 8) & 0xFF;
-    uint16_t b = color & 0xFF;
+    uint8_t r, g, b;
+    LedEngine_HueToRGB(hue >> 8, &r, &g, &b);
     uint16_t barColor = tft.color565(r, g, b);
     menuSprite.fillRect(20, 120, 200, 20, TFT_DARKGREY); 
     menuSprite.fillRect(20, 120, hueBarWidth, 20, barColor); 
@@ -170,22 +103,22 @@ void drawLedControl(uint8_t brightness, uint16_t hue, ControlMode currentMode) {
  * @brief LED控制的主菜单函数
  */
 void LEDMenu() {
-    stop_rainbow_task_if_running(); // 确保彩虹模式已停止
     initRotaryEncoder(); 
 
     ControlMode currentMode = BRIGHTNESS_MODE;
-    uint8_t brightness = strip.getBrightness();
+    uint8_t brightness = LedEngine_GetBrightness();
     if (brightness == 0) { 
         brightness = 128;
     }
     uint16_t hue = 0; 
+    uint8_t r, g, b;
 
-    strip.setBrightness(brightness);
-    strip.fill(strip.ColorHSV(hue));
-    strip.show();
+    LedEngine_SetBrightness(brightness);
+    LedEngine_HueToRGB(hue >> 8, &r, &g, &b);
+    LedEngine_Solid(r, g, b); // 同时替换掉之前的彩虹等动画灯效
 
     drawLedControl(brightness, hue, currentMode);
-    menuSprite.pushSprite(0, 0);
+    Display_Present();
 
     bool needsRedraw = true; 
 
@@ -203,7 +136,7 @@ void LEDMenu() {
                 if (newBrightness < 0) newBrightness = 0;
                 if (newBrightness > 255) newBrightness = 255;
                 brightness = newBrightness;
-                strip.setBrightness(brightness);
+                LedEngine_SetBrightness(brightness);
             } else { 
                 int newHue = hue + (encoderChange * 2048); 
                 if (newHue < 0) newHue = 65535 + newHue;
@@ -221,10 +154,10 @@ void LEDMenu() {
         }
 
         if (needsRedraw) { 
-            strip.fill(strip.ColorHSV(hue)); 
-            strip.show(); 
+            LedEngine_HueToRGB(hue >> 8, &r, &g, &b);
+            LedEngine_Solid(r, g, b); 
             drawLedControl(brightness, hue, currentMode); 
-            menuSprite.pushSprite(0, 0); 
+            Display_Present(); 
             needsRedraw = false; 
         }
 
@@ -0,0 +1,411 @@
+// 包含所有必需的头文件
+#include "LEDEngine.h"
+#include "NoteEvents.h"
+#include "driver/rmt.h"
+#include "freertos/queue.h"
+#include <math.h>
+
+// --- RMT 配置 ---
+#define LED_RMT_CHANNEL RMT_CHANNEL_0
+#define LED_BYTES       (NUM_LEDS * 3)
+
+// WS2812 位时序 (ns)
+#define WS2812_T0H_NS 400
+#define WS2812_T0L_NS 850
+#define WS2812_T1H_NS 800
+#define WS2812_T1L_NS 450
+
+// --- 查找表 ---
+static uint8_t gammaTable[256];    // 伽马2.6校正表
+static uint8_t hueTable[256][3];   // 色相 -> RGB，与原来的 wheel() 色轮一致
+
+// --- 帧缓冲 ---
+// 线性颜色 (未做伽马/亮度处理)，引擎内部渲染使用
+static uint8_t linearFrame[NUM_LEDS][3];
+// 输出缓冲 (GRB顺序)，双缓冲：front正在由RMT发送，back用于准备下一帧
+static uint8_t outputBuffers[2][LED_BYTES];
+static uint8_t *frontBuffer = outputBuffers[0];
+static uint8_t *backBuffer = outputBuffers[1];
+
+// --- 引擎状态 ---
+static QueueHandle_t effectQueue = NULL;
+static volatile uint8_t globalBrightness = 255;
+static volatile uint8_t musicHue = 0;          // 最近一个音符对应的色相
+static volatile TickType_t musicNoteTick = 0;  // 最近一个音符的开始时间
+static volatile bool musicNoteActive = false;  // 是否已经收到过音符
+static volatile LedEffectType activeEffect = LED_EFFECT_OFF; // 引擎当前的灯效，供音符事件判断是否需要立即唤醒
+
+// RMT 转换器使用的位编码，初始化时按计数时钟计算
+static rmt_item32_t rmtBit0;
+static rmt_item32_t rmtBit1;
+static bool rmtInstalled = false; // 驱动只在发送期间安装：开启电源管理时它持有 APB 最高频率锁
+
+/**
+ * @brief RMT 转换回调：把像素字节逐位展开为 WS2812 波形 (在中断中运行)
+ */
+static void IRAM_ATTR ledRmtAdapter(const void *src, rmt_item32_t *dest, size_t src_size,
+                                    size_t wanted_num, size_t *translated_size, size_t *item_num)
+{
+  if (src == NULL || dest == NULL)
+  {
+    *translated_size = 0;
+    *item_num = 0;
+    return;
+  }
+  const uint8_t *psrc = (const uint8_t *) src;
+  size_t size = 0;
+  size_t num = 0;
+  while (size < src_size && num + 8 <= wanted_num)
+  {
+    uint8_t value = *psrc++;
+    for (int bit = 7; bit >= 0; bit--)
+    {
+      (dest++)->val = (value & (1 << bit)) ? rmtBit1.val : rmtBit0.val;
+    }
+    num += 8;
+    size++;
+  }
+  *translated_size = size;
+  *item_num = num;
+}
+
+/**
+ * @brief 预计算伽马表和色相表
+ */
+static void buildTables()
+{
+  for (int i = 0; i < 256; i++)
+  {
+    gammaTable[i] = (uint8_t) (powf(i / 255.0f, 2.6f) * 255.0f + 0.5f);
+
+    uint8_t pos = 255 - i;
+    uint8_t *rgb = hueTable[i];
+    if (pos < 85)
+    {
+      rgb[0] = 255 - pos * 3; rgb[1] = 0; rgb[2] = pos * 3;
+    }
+    else if (pos < 170)
+    {
+      pos -= 85;
+      rgb[0] = 0; rgb[1] = pos * 3; rgb[2] = 255 - pos * 3;
+    }
+    else
+    {
+      pos -= 170;
+      rgb[0] = pos * 3; rgb[1] = 255 - pos * 3; rgb[2] = 0;
+    }
+  }
+}
+
+/**
+ * @brief 配置RMT通道并安装驱动，已安装时直接返回
+ * @details 动画期间一直保持安装；静态灯效发送完后由 releaseRmt 卸载，
+ *          否则驱动持有的 APB 频率锁会让动态调频和自动浅睡眠一直无法生效。
+ */
+static void acquireRmt()
+{
+  if (rmtInstalled)
+  {
+    return;
+  }
+  rmt_config_t config = {};
+  config.rmt_mode = RMT_MODE_TX;
+  config.channel = LED_RMT_CHANNEL;
+  config.gpio_num = (gpio_num_t) LED_PIN;
+  config.clk_div = 2; // 40MHz 计数时钟，25ns分辨率
+  config.mem_block_num = 1;
+  config.tx_config.idle_level = RMT_IDLE_LEVEL_LOW;
+  config.tx_config.idle_output_en = true;
+  rmt_config(&config);
+  rmt_driver_install(config.channel, 0, 0);
+
+  uint32_t counterHz = 0;
+  rmt_get_counter_clock(config.channel, &counterHz);
+  float ticksPerNs = counterHz / 1e9f;
+  rmtBit0.level0 = 1; rmtBit0.duration0 = (uint32_t) (ticksPerNs * WS2812_T0H_NS);
+  rmtBit0.level1 = 0; rmtBit0.duration1 = (uint32_t) (ticksPerNs * WS2812_T0L_NS);
+  rmtBit1.level0 = 1; rmtBit1.duration0 = (uint32_t) (ticksPerNs * WS2812_T1H_NS);
+  rmtBit1.level1 = 0; rmtBit1.duration1 = (uint32_t) (ticksPerNs * WS2812_T1L_NS);
+
+  rmt_translator_init(config.channel, ledRmtAdapter);
+  rmtInstalled = true;
+}
+
+/**
+ * @brief 等最后一帧发完后卸载RMT驱动，释放它的电源管理锁
+ * @details 灯带锁存最后一帧，数据线交还普通GPIO并保持低电平。
+ */
+static void releaseRmt()
+{
+  if (!rmtInstalled)
+  {
+    return;
+  }
+  rmt_wait_tx_done(LED_RMT_CHANNEL, pdMS_TO_TICKS(10));
+  rmt_driver_uninstall(LED_RMT_CHANNEL);
+  rmtInstalled = false;
+  pinMode(LED_PIN, OUTPUT);
+  digitalWrite(LED_PIN, LOW);
+}
+
+/**
+ * @brief 该灯效是否需要逐帧刷新
+ */
+static bool isAnimated(LedEffectType type)
+{
+  return type == LED_EFFECT_RAINBOW || type == LED_EFFECT_BREATHE || type == LED_EFFECT_MUSIC;
+}
+
+static inline uint8_t scale8(uint8_t value, uint8_t scale)
+{
+  return ((uint16_t) value * (scale + 1)) >> 8;
+}
+
+/**
+ * @brief 按当前灯效渲染一帧线性颜色
+ * @param effect 当前灯效
+ * @param elapsedMs 灯效开始后经过的时间
+ */
+static void renderFrame(const LedEffect &effect, uint32_t elapsedMs)
+{
+  switch (effect.type)
+  {
+  case LED_EFFECT_OFF:
+    memset(linearFrame, 0, sizeof(linearFrame));
+    break;
+
+  case LED_EFFECT_SOLID:
+    for (int i = 0; i < NUM_LEDS; i++)
+    {
+      linearFrame[i][0] = effect.r; linearFrame[i][1] = effect.g; linearFrame[i][2] = effect.b;
+    }
+    break;
+
+  case LED_EFFECT_PIXEL:
+    break; // 像素层在收到描述符时已经修改过
+
+  case LED_EFFECT_RAINBOW:
+  {
+    uint8_t offset = elapsedMs / max<uint16_t>(effect.periodMs, 1);
+    for (int i = 0; i < NUM_LEDS; i++)
+    {
+      memcpy(linearFrame[i], hueTable[(uint8_t) (i * 256 / NUM_LEDS + offset)], 3);
+    }
+    break;
+  }
+
+  case LED_EFFECT_BREATHE:
+  {
+    uint16_t period = max<uint16_t>(effect.periodMs, 1);
+    uint16_t phase = (elapsedMs % period) * 512 / period;
+    uint8_t level = phase < 256 ? phase : 511 - phase; // 三角波，经伽马后接近人眼感知的呼吸曲线
+    for (int i = 0; i < NUM_LEDS; i++)
+    {
+      linearFrame[i][0] = scale8(effect.r, level);
+      linearFrame[i][1] = scale8(effect.g, level);
+      linearFrame[i][2] = scale8(effect.b, level);
+    }
+    break;
+  }
+
+  case LED_EFFECT_MUSIC:
+  {
+    // 闪光强度随音符开始后的时间线性衰减
+    uint8_t flash = 0;
+    if (musicNoteActive)
+    {
+      uint32_t sinceNote = pdTICKS_TO_MS(xTaskGetTickCount() - musicNoteTick);
+      uint16_t decay = max<uint16_t>(effect.periodMs, 1);
+      flash = sinceNote >= decay ? 0 : 255 - sinceNote * 255 / decay;
+    }
+    uint8_t baseLevel = 40 + scale8(215, flash);
+    uint8_t hue = musicHue;
+    for (int i = 0; i < NUM_LEDS; i++)
+    {
+      // 以音符色相为中心向两侧展开一小段色带
+      const uint8_t *rgb = hueTable[(uint8_t) (hue + (i - NUM_LEDS / 2) * 4)];
+      linearFrame[i][0] = scale8(rgb[0], baseLevel);
+      linearFrame[i][1] = scale8(rgb[1], baseLevel);
+      linearFrame[i][2] = scale8(rgb[2], baseLevel);
+    }
+    break;
+  }
+
+  default:
+    break;
+  }
+}
+
+/**
+ * @brief 把线性帧转换为输出格式并在内容变化时发送
+ */
+static void outputFrame()
+{
+  uint8_t brightness = globalBrightness;
+  for (int i = 0; i < NUM_LEDS; i++)
+  {
+    // NEO_GRB 顺序
+    backBuffer[i * 3 + 0] = scale8(gammaTable[linearFrame[i][1]], brightness);
+    backBuffer[i * 3 + 1] = scale8(gammaTable[linearFrame[i][0]], brightness);
+    backBuffer[i * 3 + 2] = scale8(gammaTable[linearFrame[i][2]], brightness);
+  }
+
+  if (memcmp(backBuffer, frontBuffer, LED_BYTES) == 0)
+  {
+    return; // 画面没有变化，不占用总线
+  }
+
+  acquireRmt();
+  // 上一帧早已发完 (10颗灯约0.3ms)，这里只是保证front不再被RMT读取
+  rmt_wait_tx_done(LED_RMT_CHANNEL, pdMS_TO_TICKS(10));
+  uint8_t *sent = backBuffer;
+  backBuffer = frontBuffer;
+  frontBuffer = sent;
+  rmt_write_sample(LED_RMT_CHANNEL, frontBuffer, LED_BYTES, false);
+}
+
+/**
+ * @brief [FreeRTOS Task] LED引擎任务，唯一直接驱动灯带的任务
+ * @details 静态灯效时阻塞在描述符队列上不占CPU；动画灯效时按固定帧间隔渲染。
+ */
+static void LedEngine_Task(void *pvParameters)
+{
+  LedEffect current = {LED_EFFECT_OFF, 0, 0, 0, 0, 0};
+  TickType_t effectStart = xTaskGetTickCount();
+  TickType_t nextFrame = effectStart;
+  const TickType_t frameTicks = pdMS_TO_TICKS(LED_ENGINE_FRAME_MS);
+
+  // 上电时先输出一帧全黑，front初始为0，需强制发送
+  memset(linearFrame, 0, sizeof(linearFrame));
+  acquireRmt();
+  rmt_write_sample(LED_RMT_CHANNEL, frontBuffer, LED_BYTES, false);
+
+  for (;;)
+  {
+    TickType_t wait = portMAX_DELAY;
+    if (isAnimated(current.type))
+    {
+      TickType_t now = xTaskGetTickCount();
+      wait = ((int32_t) (nextFrame - now) > 0) ? nextFrame - now : 0;
+    }
+    else
+    {
+      releaseRmt(); // 静态灯效已发出，阻塞等待期间不占用电源管理锁
+    }
+
+    LedEffect incoming;
+    if (xQueueReceive(effectQueue, &incoming, wait) == pdTRUE)
+    {
+      if (incoming.type == LED_EFFECT_PIXEL)
+      {
+        // 在当前画面的基础上修改单个灯；从动画切换过来时先熄灭其余灯
+        if (isAnimated(current.type))
+        {
+          memset(linearFrame, 0, sizeof(linearFrame));
+        }
+        if (incoming.index < NUM_LEDS)
+        {
+          linearFrame[incoming.index][0] = incoming.r;
+          linearFrame[incoming.index][1] = incoming.g;
+          linearFrame[incoming.index][2] = incoming.b;
+        }
+        current.type = LED_EFFECT_PIXEL;
+      }
+      else if (incoming.type != LED_EFFECT_REFRESH)
+      {
+        current = incoming;
+        effectStart = xTaskGetTickCount();
+      }
+      nextFrame = xTaskGetTickCount() + frameTicks; // 新灯效立即渲染，下一帧按帧间隔
+    }
+    else
+    {
+      nextFrame += frameTicks;
+    }
+
+    activeEffect = current.type;
+    renderFrame(current, pdTICKS_TO_MS(xTaskGetTickCount() - effectStart));
+    outputFrame();
+  }
+}
+
+/**
+ * @brief 音符事件回调，在播放任务中同步调用
+ */
+static void onNoteEvent(const NoteEvent &event)
+{
+  if (event.type == NOTE_EVENT_NOTE_ON)
+  {
+    LedEngine_NoteOn(event.frequency, event.durationMs);
+  }
+}
+
+void LedEngine_Init()
+{
+  if (effectQueue != NULL)
+  {
+    return;
+  }
+  buildTables();
+  effectQueue = xQueueCreate(LED_ENGINE_QUEUE_LEN, sizeof(LedEffect));
+  xTaskCreatePinnedToCore(LedEngine_Task, "LED_Engine", 2048, NULL, 4, NULL, 0);
+  NoteEvents_Subscribe(onNoteEvent);
+}
+
+bool LedEngine_Submit(const LedEffect &effect)
+{
+  if (effectQueue == NULL)
+  {
+    return false;
+  }
+  return xQueueSend(effectQueue, &effect, pdMS_TO_TICKS(10)) == pdTRUE;
+}
+
+void LedEngine_Solid(uint8_t r, uint8_t g, uint8_t b)
+{
+  LedEffect effect = {LED_EFFECT_SOLID, r, g, b, 0, 0};
+  LedEngine_Submit(effect);
+}
+
+void LedEngine_Off()
+{
+  LedEffect effect = {LED_EFFECT_OFF, 0, 0, 0, 0, 0};
+  LedEngine_Submit(effect);
+}
+
+void LedEngine_SetBrightness(uint8_t brightness)
+{
+  globalBrightness = brightness;
+  LedEffect effect = {LED_EFFECT_REFRESH, 0, 0, 0, 0, 0};
+  LedEngine_Submit(effect);
+}
+
+uint8_t LedEngine_GetBrightness()
+{
+  return globalBrightness;
+}
+
+void LedEngine_NoteOn(uint16_t frequency, uint16_t durationMs)
+{
+  if (frequency == 0)
+  {
+    return; // 休止符不触发闪光
+  }
+  musicHue = NoteEvents_PitchToHue(frequency);
+  musicNoteTick = xTaskGetTickCount();
+  musicNoteActive = true;
+
+  // 音乐灯效下立即唤醒引擎渲染这一帧，而不是等到下一个20ms帧
+  if (activeEffect == LED_EFFECT_MUSIC && effectQueue != NULL)
+  {
+    LedEffect refresh = {LED_EFFECT_REFRESH, 0, 0, 0, 0, 0};
+    xQueueSend(effectQueue, &refresh, 0);
+  }
+}
+
+void LedEngine_HueToRGB(uint8_t hue, uint8_t *r, uint8_t *g, uint8_t *b)
+{
+  *r = hueTable[hue][0];
+  *g = hueTable[hue][1];
+  *b = hueTable[hue][2];
+}
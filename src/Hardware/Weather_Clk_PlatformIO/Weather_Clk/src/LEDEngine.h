@@ -0,0 +1,94 @@
+#ifndef LED_ENGINE_H
+#define LED_ENGINE_H
+
+#include <Arduino.h>
+
+#define LED_PIN 3
+#define NUM_LEDS 10
+
+#define LED_ENGINE_FRAME_MS   20 // 动画帧间隔，50fps
+#define LED_ENGINE_QUEUE_LEN  8  // 灯效描述符队列深度
+
+/**
+ * @brief 灯效类型。
+ */
+enum LedEffectType
+{
+    LED_EFFECT_OFF,      ///< 全部熄灭。
+    LED_EFFECT_SOLID,    ///< 全部显示 r/g/b 颜色。
+    LED_EFFECT_PIXEL,    ///< 只修改第 index 个灯为 r/g/b，其余灯保持当前颜色。
+    LED_EFFECT_RAINBOW,  ///< 流动彩虹，periodMs 为色相每前进一步的间隔。
+    LED_EFFECT_BREATHE,  ///< 以 r/g/b 颜色呼吸，periodMs 为一个呼吸周期。
+    LED_EFFECT_MUSIC,    ///< 随音符闪烁：暗色彩虹底色叠加由 LedEngine_NoteOn 触发的闪光，periodMs 为闪光衰减时间。
+    LED_EFFECT_REFRESH   ///< 内部使用：不改变灯效，仅按新的亮度重新输出一帧。
+};
+
+/**
+ * @brief 灯效描述符。
+ * @details 调用者只需要描述“想要什么效果”，由LED引擎任务负责逐帧渲染和输出，
+ *          不需要为每种效果单独创建任务。
+ */
+struct LedEffect
+{
+    LedEffectType type;
+    uint8_t r, g, b;    ///< 效果的主颜色 (SOLID / PIXEL / BREATHE)。
+    uint8_t index;      ///< 灯的序号 (PIXEL)。
+    uint16_t periodMs;  ///< 时间参数，含义见 LedEffectType。
+};
+
+/**
+ * @brief 初始化LED引擎。
+ * @details 配置一个RMT发送通道并保持占用，预计算伽马和色相查找表，
+ *          然后创建唯一拥有灯带的引擎任务并订阅音符事件。必须在任何灯效函数之前调用一次。
+ */
+void LedEngine_Init();
+
+/**
+ * @brief 提交一个灯效描述符。
+ * @param effect 要切换到的灯效。
+ * @return 成功放入队列返回true。
+ * @details 非阻塞（最多等待10ms）。引擎任务在下一帧开始时应用新效果。
+ */
+bool LedEngine_Submit(const LedEffect &effect);
+
+/**
+ * @brief 所有灯显示同一颜色。
+ */
+void LedEngine_Solid(uint8_t r, uint8_t g, uint8_t b);
+
+/**
+ * @brief 关闭所有灯。
+ */
+void LedEngine_Off();
+
+/**
+ * @brief 设置全局亮度。
+ * @param brightness 亮度 (0-255)，在伽马校正之后应用。
+ */
+void LedEngine_SetBrightness(uint8_t brightness);
+
+/**
+ * @brief 获取当前全局亮度。
+ */
+uint8_t LedEngine_GetBrightness();
+
+/**
+ * @brief 通知引擎一个音符开始发声。
+ * @param frequency 音符频率 (Hz)，0表示休止符。
+ * @param durationMs 音符时长 (ms)。
+ * @details 仅在 LED_EFFECT_MUSIC 下产生效果：音高决定闪光的色相，每个音符触发一次闪光，
+ *          并立即唤醒引擎输出，不必等待下一帧。引擎初始化时已订阅音符事件，
+ *          播放任务发布的 NOTE_ON 会自动调用本函数。
+ */
+void LedEngine_NoteOn(uint16_t frequency, uint16_t durationMs);
+
+/**
+ * @brief 从预计算的色相表中取颜色。
+ * @param hue 色相 (0-255)。
+ * @param[out] r 红色分量。
+ * @param[out] g 绿色分量。
+ * @param[out] b 蓝色分量。
+ */
+void LedEngine_HueToRGB(uint8_t hue, uint8_t *r, uint8_t *g, uint8_t *b);
+
+#endif // LED_ENGINE_H
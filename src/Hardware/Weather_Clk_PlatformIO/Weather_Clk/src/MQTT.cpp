@@ -8,7 +8,10 @@
 #include "performance.h"
 #include "LED.h"
 #include "Alarm.h"
-#include "MusicMenuLite.h"
+#include "Power.h"
+#include "SysMon.h"
+#include "EventBus.h"
+#include <lwip/sockets.h>
 
 // --- 配置信息 ---
 #define WIFI_SSID "xiaomiao_hotspot"
@@ -28,6 +31,9 @@ const int   MQTT_PORT = 1883;
 #define MQTT_TOPIC_GET         "$oc/devices/" DEVICE_ID "/sys/messages/down"
 #define MQTT_TOPIC_COMMANDS    "$oc/devices/" DEVICE_ID "/sys/commands/"
 #define MQTT_TOPIC_CMD_RESPONSE "$oc/devices/" DEVICE_ID "/sys/commands/response/request_id="
+#define MQTT_IDLE_REPORT_MS 30000 // 空闲 (调暗/熄屏) 时的上报间隔
+#define MQTT_IDLE_WAIT_MS   5000  // 空闲时在套接字上等待下行消息的最长时间，须小于心跳间隔
+#define MQTT_HEARTBEAT_TIMEOUT_MS 60000 // 循环心跳超时：重连时 connect() 可能阻塞十几秒
 #define RESPONSE_DATA     "{\"result_code\": 0,\"response_name\": \"COMMAND_RESPONSE\",\"paras\": {\"result\": \"success\"}}"
 
 // --- 全局变量 ---
@@ -35,11 +41,11 @@ WiFiClient espClient;
 PubSubClient client(espClient);
 long Time = 0;
 volatile bool exitSubMenu = false;
+static volatile bool mqttConnected = false; // 由 MQTT_Task 维护，其他任务查询时不直接访问客户端
 extern float g_currentTemperature;
 extern float g_lux;
 extern struct PCData pcData;
 extern float esp32c3_temp;
-extern volatile bool g_force_exit_ui; // 引用在main.cpp中定义的全局UI退出标志
 
 // --- 函数前向声明 ---
 void callback(char *topic, byte *payload, unsigned int length);
@@ -58,6 +64,25 @@ void setupMQTT()
   xTaskCreate(MQTT_Task, "MQTT_Task", 4096, NULL, 5, NULL);
 }
 
+/**
+ * @brief 阻塞到MQTT连接上有数据可读或超时
+ * @details 空闲时代替10ms轮询，下行消息到达时立即返回，其余时间任务不占CPU，芯片可以浅睡眠。
+ */
+static void waitForMqttData(uint32_t ms)
+{
+  int fd = espClient.fd();
+  if (fd < 0)
+  {
+    vTaskDelay(pdMS_TO_TICKS(ms));
+    return;
+  }
+  fd_set readSet;
+  FD_ZERO(&readSet);
+  FD_SET(fd, &readSet);
+  struct timeval tv = {(time_t)(ms / 1000), (suseconds_t)((ms % 1000) * 1000)};
+  select(fd + 1, &readSet, NULL, NULL, &tv);
+}
+
 /**
  * @brief [FreeRTOS Task] MQTT主任务
  * @details 此任务全权负责所有MQTT相关活动：
@@ -69,12 +94,15 @@ void setupMQTT()
 void MQTT_Task(void *pvParameters)
 {
   long lastReportTime = 0;
+  SysMon_Watch(MQTT_HEARTBEAT_TIMEOUT_MS);
 
   for (;;)
   {
+    SysMon_Heartbeat();
     // 检查WiFi和MQTT连接，如果断开则循环重连
     if (!client.connected())
     {
+      mqttConnected = false;
       Serial.println("MQTT断开连接，尝试重连...");
       while (!client.connected())
       {
@@ -84,12 +112,14 @@ void MQTT_Task(void *pvParameters)
           // 重新订阅主题
           client.subscribe(MQTT_TOPIC_COMMANDS);
           client.subscribe(MQTT_TOPIC_GET);
+          mqttConnected = true;
         }
         else
         {
           Serial.printf("MQTT连接失败, rc=%d. 3秒后重试\n", client.state());
           // 等待3秒再重试，避免频繁失败导致系统不稳定
           vTaskDelay(pdMS_TO_TICKS(3000));
+          SysMon_Heartbeat(); // 重连失败不算卡住，connect() 本身阻塞不超过套接字超时
         }
       }
     }
@@ -97,15 +127,23 @@ void MQTT_Task(void *pvParameters)
     // 保持客户端心跳和处理传入消息
     client.loop();
 
-    // 定时上报数据(每1秒)
-    if (millis() - lastReportTime > 1000)
+    // 定时上报数据(每1秒，空闲时每 MQTT_IDLE_REPORT_MS)
+    bool idle = Power_IsIdle();
+    if (millis() - lastReportTime > (idle ? MQTT_IDLE_REPORT_MS : 1000))
     {
       lastReportTime = millis();
       publishData(g_currentTemperature, &pcData, g_lux);
     }
 
-    // 短暂延时，让出CPU给其他任务
-    vTaskDelay(pdMS_TO_TICKS(10));
+    if (idle)
+    {
+      waitForMqttData(MQTT_IDLE_WAIT_MS);
+    }
+    else
+    {
+      // 短暂延时，让出CPU给其他任务
+      vTaskDelay(pdMS_TO_TICKS(10));
+    }
   }
 }
 
@@ -149,6 +187,11 @@ void connectMQTT()
   }
 }
 
+bool isMQTTConnected()
+{
+  return mqttConnected;
+}
+
 /**
  *@brief 向华为云发布数据
  */
@@ -156,10 +199,11 @@ void publishData(float Temp, struct PCData *pcdata, float lux)
 {
   Time++;
 
-  char properties[256];
-  char jsonBuf[300];
-  sprintf(properties, "\"Temperature\":%.2f,\"Time\":%ld,\"Lux\":%.2f,\"GPULoad\":%d,\"CPULoad\":%d,\"GPUTemp\":%d,\"RAMLoad\":%.1f,\"ESP32Temp\":%.1f",
+  char properties[384];
+  char jsonBuf[448];
+  int len = snprintf(properties, sizeof(properties), "\"Temperature\":%.2f,\"Time\":%ld,\"Lux\":%.2f,\"GPULoad\":%d,\"CPULoad\":%d,\"GPUTemp\":%d,\"RAMLoad\":%.1f,\"ESP32Temp\":%.1f,",
     Temp, Time, lux, pcdata->gpuLoad, pcdata->cpuLoad, pcdata->gpuTemp, pcdata->ramLoad, esp32c3_temp);
+  SysMon_FormatMqtt(properties + len, sizeof(properties) - len); // 设备自身的CPU占用、最小栈余量和心跳超时数
   sprintf(jsonBuf, MQTT_BODY_FORMAT, properties);
 
   if (client.publish(MQTT_TOPIC_REPORT, jsonBuf))
@@ -180,6 +224,7 @@ void publishData(float Temp, struct PCData *pcdata, float lux)
  */
 void callback(char *topic, byte *payload, unsigned int length)
 {
+  Power_NoteActivity(POWER_WAKE_MQTT); // 远程命令可能要显示界面，先唤醒屏幕
   Serial.println("\n收到平台下发消息:");
   Serial.print("主题: ");
   Serial.println(topic);
@@ -250,26 +295,17 @@ void callback(char *topic, byte *payload, unsigned int length)
     }
     else if (command_name && strcmp(command_name, "play_song") == 0)
     {
-      // 如果当前正在播放歌曲（通过检查requestedSongAction是否被占用），
-      // 则先强制退出当前的UI，以便开始新的播放。
-      if (requestedSongAction != NULL)
-      {
-        g_force_exit_ui = true;
-        vTaskDelay(pdMS_TO_TICKS(50)); // 等待UI任务响应并退出
-      }
-
+      // 播放界面在界面任务中运行，交给事件总线：正在播放的界面收到后退出，界面循环再打开新的界面
       int songIndex = paras["Song_index"];
       const char *ui_mode = paras["UI"];
 
       if (strcmp(ui_mode, "Full") == 0)
       {
-        requestedSongIndex = songIndex;
-        requestedSongAction = (volatile void (*)(int)) & play_song_full_ui;
+        EventBus_Publish(EVENT_PLAY_SONG, songIndex, SONG_UI_FULL);
       }
       else if (strcmp(ui_mode, "Lite") == 0)
       {
-        requestedSongIndex = songIndex;
-        requestedSongAction = (volatile void (*)(int)) & play_song_lite_ui;
+        EventBus_Publish(EVENT_PLAY_SONG, songIndex, SONG_UI_LITE);
       }
       else if (strcmp(ui_mode, "No") == 0)
       {
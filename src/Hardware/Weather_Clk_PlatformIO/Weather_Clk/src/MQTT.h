@@ -4,9 +4,6 @@
 #include <Arduino.h>
 #include "performance.h"
 
-extern volatile void (*requestedSongAction)(int);
-extern volatile int requestedSongIndex;
-
 extern volatile bool exitSubMenu;
 
 /**
@@ -23,6 +20,11 @@ void setupMQTT();
  */
 void connectMQTT();
 
+/**
+ * @brief MQTT 客户端当前是否已连接到服务器。
+ */
+bool isMQTTConnected();
+
 /**
  *@brief 向华为云发布数据
  *
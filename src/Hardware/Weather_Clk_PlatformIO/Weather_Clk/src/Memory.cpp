@@ -0,0 +1,203 @@
+// 包含所有必需的头文件
+#include "Memory.h"
+#include <esp_heap_caps.h>
+
+/**
+ * @brief 每块分配前的头部，8字节以保持对齐
+ */
+struct ArenaBlock
+{
+  uint32_t size; // 用户可用的字节数
+  uint32_t prev; // 前一块头部的偏移，用于释放最后一块后继续原地伸缩
+};
+
+#define ARENA_NONE 0xFFFFFFFFu
+#define ARENA_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+// --- 全局变量 ---
+static uint8_t arenaBuf[ARENA_SIZE] __attribute__((aligned(8)));
+static size_t arenaTop = 0;             // 下一次分配的位置
+static uint32_t arenaLast = ARENA_NONE; // 最后一块的头部偏移
+static TaskHandle_t arenaOwner = NULL;
+static uint32_t arenaPeak = 0;
+static uint32_t arenaFallbacks = 0;
+static uint32_t minLargestBlock = UINT32_MAX;
+
+/**
+ * @brief 由用户指针得到块头部
+ */
+static inline ArenaBlock *blockOf(void *ptr)
+{
+  return (ArenaBlock *)((uint8_t *)ptr - sizeof(ArenaBlock));
+}
+
+void Arena_Init()
+{
+  arenaOwner = xTaskGetCurrentTaskHandle();
+  Arena_Reset();
+}
+
+void *Arena_Alloc(size_t size)
+{
+  if (arenaOwner == NULL || xTaskGetCurrentTaskHandle() != arenaOwner)
+  {
+    return NULL; // 内存池不加锁，只给 UI 任务使用
+  }
+  size_t need = sizeof(ArenaBlock) + ARENA_ALIGN(size);
+  if (arenaTop + need > ARENA_SIZE)
+  {
+    arenaFallbacks++;
+    return NULL;
+  }
+
+  ArenaBlock *block = (ArenaBlock *)(arenaBuf + arenaTop);
+  block->size = ARENA_ALIGN(size);
+  block->prev = arenaLast;
+  arenaLast = arenaTop;
+  arenaTop += need;
+  if (arenaTop > arenaPeak) arenaPeak = arenaTop;
+  return block + 1;
+}
+
+void *Arena_Realloc(void *ptr, size_t size)
+{
+  if (ptr == NULL)
+  {
+    return Arena_Alloc(size);
+  }
+  ArenaBlock *block = blockOf(ptr);
+  size_t offset = (uint8_t *)block - arenaBuf;
+
+  // 最后一块直接移动池顶
+  if (offset == arenaLast)
+  {
+    size_t end = offset + sizeof(ArenaBlock) + ARENA_ALIGN(size);
+    if (end > ARENA_SIZE)
+    {
+      arenaFallbacks++;
+      return NULL;
+    }
+    block->size = ARENA_ALIGN(size);
+    arenaTop = end;
+    if (arenaTop > arenaPeak) arenaPeak = arenaTop;
+    return ptr;
+  }
+
+  if (size <= block->size)
+  {
+    return ptr; // 缩小时原地保留
+  }
+  void *moved = Arena_Alloc(size);
+  if (moved)
+  {
+    memcpy(moved, ptr, block->size);
+  }
+  return moved;
+}
+
+void Arena_Free(void *ptr)
+{
+  if (ptr == NULL) return;
+  ArenaBlock *block = blockOf(ptr);
+  size_t offset = (uint8_t *)block - arenaBuf;
+  if (offset == arenaLast)
+  {
+    arenaTop = offset;
+    arenaLast = block->prev;
+  }
+}
+
+bool Arena_Owns(const void *ptr)
+{
+  return ptr >= (const void *)arenaBuf && ptr < (const void *)(arenaBuf + ARENA_SIZE);
+}
+
+size_t Arena_Mark()
+{
+  return arenaTop;
+}
+
+void Arena_Release(size_t mark)
+{
+  if (mark < arenaTop)
+  {
+    arenaTop = mark;
+    arenaLast = ARENA_NONE; // 标记之前的块不再原地伸缩
+  }
+}
+
+void Arena_Reset()
+{
+  arenaTop = 0;
+  arenaLast = ARENA_NONE;
+}
+
+// --- ArduinoJson 分配器 ---
+
+void *ArenaJsonAllocator::allocate(size_t size)
+{
+  void *ptr = Arena_Alloc(size);
+  return ptr ? ptr : malloc(size);
+}
+
+void ArenaJsonAllocator::deallocate(void *ptr)
+{
+  if (Arena_Owns(ptr)) Arena_Free(ptr);
+  else free(ptr);
+}
+
+void *ArenaJsonAllocator::reallocate(void *ptr, size_t newSize)
+{
+  if (!Arena_Owns(ptr))
+  {
+    return realloc(ptr, newSize);
+  }
+  void *moved = Arena_Realloc(ptr, newSize);
+  if (moved)
+  {
+    return moved;
+  }
+  // 内存池放不下，搬到堆上
+  moved = malloc(newSize);
+  if (moved)
+  {
+    memcpy(moved, ptr, min((size_t)blockOf(ptr)->size, newSize));
+    Arena_Free(ptr);
+  }
+  return moved;
+}
+
+ArenaJsonAllocator *ArenaJsonAllocator::instance()
+{
+  static ArenaJsonAllocator allocator;
+  return &allocator;
+}
+
+// --- 堆内存统计 ---
+
+HeapStats Heap_GetStats()
+{
+  HeapStats s;
+  s.freeBytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  s.largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  s.minFreeBytes = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+  if (s.largestBlock < minLargestBlock) minLargestBlock = s.largestBlock;
+  s.minLargestBlock = minLargestBlock;
+  s.fragmentation = s.freeBytes ? 100 - (uint64_t)s.largestBlock * 100 / s.freeBytes : 0;
+  s.arenaPeak = arenaPeak;
+  s.arenaFallbacks = arenaFallbacks;
+  return s;
+}
+
+void Heap_Log(const char *tag)
+{
+#if HEAP_STATS_LOG
+  HeapStats s = Heap_GetStats();
+  Serial.printf("[Heap] %s up %lus free %lu largest %lu (min %lu) minFree %lu frag %u%% arena peak %lu fallback %lu\n",
+                tag, (unsigned long)(millis() / 1000), (unsigned long)s.freeBytes, (unsigned long)s.largestBlock,
+                (unsigned long)s.minLargestBlock, (unsigned long)s.minFreeBytes, s.fragmentation,
+                (unsigned long)s.arenaPeak, (unsigned long)s.arenaFallbacks);
+#else
+  (void)tag;
+#endif
+}
@@ -0,0 +1,107 @@
+#ifndef MEMORY_H
+#define MEMORY_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#define ARENA_SIZE       16384 // 界面临时内存池大小，Internet 页面最大的JSON响应解析约需10KB
+#define HEAP_STATS_LOG   0     // 置1则每次退出界面时在串口输出一行堆内存统计
+
+/**
+ * @brief 堆内存碎片统计。
+ */
+struct HeapStats
+{
+    uint32_t freeBytes;        ///< 当前空闲字节数。
+    uint32_t largestBlock;     ///< 当前最大的连续空闲块。
+    uint32_t minFreeBytes;     ///< 开机以来的最低空闲字节数。
+    uint32_t minLargestBlock;  ///< 历次采样中最大连续空闲块的最小值，长时间运行后仍能分配大块内存的下限。
+    uint8_t fragmentation;     ///< 碎片率 (%)：100 - 最大块 / 空闲字节。
+    uint32_t arenaPeak;        ///< 内存池的最高使用量。
+    uint32_t arenaFallbacks;   ///< 内存池放不下而改用堆的次数。
+};
+
+/**
+ * @brief 初始化界面内存池，只允许调用它的任务 (UI 任务) 使用内存池。
+ * @details 内存池是一块静态缓冲区，不占用堆，也就不会与 WiFi 等长期存在的分配交错产生碎片。
+ *          其他任务的请求返回NULL，调用者退回堆分配。
+ */
+void Arena_Init();
+
+/**
+ * @brief 从内存池分配一块8字节对齐的内存。
+ * @return 空间不足或不在 UI 任务中时返回NULL。
+ */
+void *Arena_Alloc(size_t size);
+
+/**
+ * @brief 调整内存池中一块内存的大小。
+ * @details 最后分配的一块原地伸缩，其他块搬到池顶，旧块在作用域结束时一起回收。
+ * @return 失败时返回NULL，原来的内存保持不变。
+ */
+void *Arena_Realloc(void *ptr, size_t size);
+
+/**
+ * @brief 释放内存池中的一块内存。
+ * @details 只有最后分配的一块会立即回收，其余的在作用域结束或界面退出时一起回收。
+ */
+void Arena_Free(void *ptr);
+
+/**
+ * @brief ptr 是否位于内存池中。
+ */
+bool Arena_Owns(const void *ptr);
+
+/**
+ * @brief 记录当前池顶，配合 Arena_Release 回收其后的所有分配。
+ */
+size_t Arena_Mark();
+
+/**
+ * @brief 回收 mark 之后的所有分配。
+ */
+void Arena_Release(size_t mark);
+
+/**
+ * @brief 清空内存池，在退出界面时调用。
+ */
+void Arena_Reset();
+
+/**
+ * @brief 作用域内存池标记：构造时记录池顶，析构时回收作用域内的所有分配。
+ */
+struct ArenaScope
+{
+    size_t mark;
+    ArenaScope() : mark(Arena_Mark()) {}
+    ~ArenaScope() { Arena_Release(mark); }
+};
+
+/**
+ * @brief 把 ArduinoJson 的内部分配放进内存池的分配器。
+ * @details 用法：先声明一个 ArenaScope，再声明 JsonDocument doc(ArenaJsonAllocator::instance())，
+ *          解析过程中的对象池和字符串都在内存池里，离开作用域时一次回收，不会在堆上留下空洞。
+ *          内存池放不下时自动改用堆。
+ */
+class ArenaJsonAllocator : public ArduinoJson::Allocator
+{
+public:
+    void *allocate(size_t size) override;
+    void deallocate(void *ptr) override;
+    void *reallocate(void *ptr, size_t newSize) override;
+
+    static ArenaJsonAllocator *instance();
+};
+
+/**
+ * @brief 采样并返回堆内存统计。
+ */
+HeapStats Heap_GetStats();
+
+/**
+ * @brief 在串口输出一行堆内存统计 (受 HEAP_STATS_LOG 控制)。
+ * @param tag 输出时的标签，如退出的界面名称。
+ */
+void Heap_Log(const char *tag);
+
+#endif // MEMORY_H
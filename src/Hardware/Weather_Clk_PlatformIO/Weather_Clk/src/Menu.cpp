@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include "Alarm.h"
 #include "img.h"
+#include "menu_icons.h" // 由 create_icons/compress_icons.py 从 img.h 生成
 #include "LED.h"
 #include "Buzzer.h"
 #include "Pomodoro.h"
@@ -20,6 +21,11 @@
 #include <TFT_eSPI.h>
 #include "Countdown.h"
 #include "Stopwatch.h"
+#include "SecondScreen.h"
+#include "Display.h"
+#include "Memory.h"
+#include "Profiler.h"
+#include "SysMon.h"
 
 // --- 布局配置 ---
 // 调整这些值可以改变菜单布局
@@ -59,21 +65,23 @@ uint8_t picture_flag = 0;           // 当前选中的菜单项索引
 //     {"ADC", ADC, &ADCMenu},
 // };
 const MenuItem menuItems[] = {
-    {"Clock", Weather, &weatherMenu},
-    {"Music", Music, &BuzzerMenu},
-    {"Internet", Internet, &InternetMenuScreen},
-    {"Space", Space_img, &SpaceMenuScreen},
-    {"Alarm", alarm_img, &AlarmMenu},
-    {"Countdown", Timer, &CountdownMenu},
-    {"Pomodoro", Timer, &PomodoroMenu},
-    {"Stopwatch", Timer, &StopwatchMenu},
-    {"Music Lite", Music, &MusicMenuLite},
-    {"Performance", Performance, &performanceMenu},
-    {"Temperature", Temperature, &DS18B20Menu},
-    {"Animation", LED, &AnimationMenu},
-    {"Games", Games, &GamesMenu},
-    {"ADC", ADC, &ADCMenu},
-    {"LED", LED, &LEDMenu},
+    {"Clock", &Weather_icon, &weatherMenu},
+    {"Music", &Music_icon, &BuzzerMenu},
+    {"Internet", &Internet_icon, &InternetMenuScreen},
+    {"Space", &Space_img_icon, &SpaceMenuScreen},
+    {"Alarm", &alarm_img_icon, &AlarmMenu},
+    {"Countdown", &Timer_icon, &CountdownMenu},
+    {"Pomodoro", &Timer_icon, &PomodoroMenu},
+    {"Stopwatch", &Timer_icon, &StopwatchMenu},
+    {"Music Lite", &Music_icon, &MusicMenuLite},
+    {"Performance", &Performance_icon, &performanceMenu},
+    {"PC Screen", &Performance_icon, &SecondScreenMenu},
+    {"Temperature", &Temperature_icon, &DS18B20Menu},
+    {"Animation", &LED_icon, &AnimationMenu},
+    {"Games", &Games_icon, &GamesMenu},
+    {"ADC", &ADC_icon, &ADCMenu},
+    {"LED", &LED_icon, &LEDMenu},
+    {"System", &Performance_icon, &SystemMonitorMenu},
 };
 const uint8_t MENU_ITEM_COUNT = sizeof(menuItems) / sizeof(menuItems[0]); // 菜单项总数
 
@@ -126,7 +134,7 @@ void drawMenuIcons(int16_t offset)
         int16_t x = offset + (i * ICON_SPACING);
         if (x >= -ICON_SIZE && x < SCREEN_WIDTH)
         {
-            menuSprite.pushImage(x, ICON_Y_POS, ICON_SIZE, ICON_SIZE, menuItems[i].image);
+            MenuIcon_Draw(menuSprite, menuItems[i].icon, x, ICON_Y_POS); // 逐行解码，只写入屏幕内的部分
         }
     }
 
@@ -136,7 +144,7 @@ void drawMenuIcons(int16_t offset)
     menuSprite.setTextDatum(TC_DATUM); // 文本基准居中
     menuSprite.drawString(menuItems[picture_flag].name, SCREEN_WIDTH / 2, 10);
 
-    menuSprite.pushSprite(0, 0); // 将Sprite内容推送到屏幕
+    Display_Present(); // 将Sprite内容推送到屏幕
 }
 
 /**
@@ -145,6 +153,7 @@ void drawMenuIcons(int16_t offset)
 void showMenuConfig()
 {
     tft.fillScreen(TFT_BLACK);
+    Display_Invalidate(); // 屏幕已被直接清空，下一帧整屏推送
     drawMenuIcons(display);
 }
 
@@ -189,8 +198,10 @@ void showMenu()
         {
             float t = (float) i / ANIMATION_STEPS;
             float eased_t = easeOutBack(t); // 应用回弹缓动效果
+            Profiler_FrameBegin();
             display = start_display + (target_display - start_display) * eased_t;
             drawMenuIcons(display);
+            Profiler_FrameEnd(5);
             vTaskDelay(pdMS_TO_TICKS(5));
         }
 
@@ -206,7 +217,10 @@ void showMenu()
         if (menuItems[picture_flag].action)
         {
             exitSubMenu = false; // 在进入子菜单前重置退出标志
+            Display_Invalidate(); // 子菜单可能直接用 tft 绘制
             menuItems[picture_flag].action(); // 执行选定菜单项对应的函数
+            Arena_Reset(); // 界面退出，回收它在内存池中的所有临时分配
+            Heap_Log(menuItems[picture_flag].name);
             showMenuConfig(); // 从子菜单返回后，重绘主菜单
         }
     }
@@ -4,6 +4,7 @@
 #include "RotaryEncoder.h"
 #include <TFT_eSPI.h>
 #include "img.h"
+#include "MenuIcon.h"
 #include "Internet.h"
 /**
  * @brief 主菜单项结构体。
@@ -12,7 +13,7 @@
 struct MenuItem
 {
     const char *name;              ///< 菜单项显示的名称。
-    const uint16_t *image;         ///< 指向菜单项图标图像数据的指针。
+    const MenuIcon *icon;          ///< 菜单项的压缩图标 (menu_icons.h)。
     void (*action)();              ///< 当菜单项被选中时要调用的函数指针。
 };
 
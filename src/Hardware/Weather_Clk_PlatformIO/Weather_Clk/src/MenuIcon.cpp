@@ -0,0 +1,90 @@
+// 包含所有必需的头文件
+#include "MenuIcon.h"
+
+/**
+ * @brief 16位字节交换
+ */
+static inline uint16_t swap16(uint16_t v)
+{
+  return (v >> 8) | (v << 8);
+}
+
+/**
+ * @brief 把一段同色像素写入精灵的第 y 行，超出 [0, width) 的部分被裁掉
+ * @param raw 与 img.h 数组中相同的原始像素值
+ */
+static inline void writeSpan(TFT_eSprite &sprite, uint16_t *buf, int32_t width, int32_t y,
+                             int32_t x, int32_t n, uint16_t raw, bool swap)
+{
+  int32_t x0 = x < 0 ? 0 : x;
+  int32_t x1 = x + n > width ? width : x + n;
+  if (x1 <= x0) return;
+
+  if (buf)
+  {
+    // 与 pushImage 相同：16位精灵缓冲区中直接存放原始值 (开启 swapBytes 时交换字节)
+    uint16_t v = swap ? swap16(raw) : raw;
+    uint16_t *p = buf + y * width + x0;
+    for (int32_t i = x1 - x0; i > 0; i--) *p++ = v;
+  }
+  else
+  {
+    // drawFastHLine 接收的是普通RGB565颜色，内部会再交换一次
+    sprite.drawFastHLine(x0, y, x1 - x0, swap ? raw : swap16(raw));
+  }
+}
+
+void MenuIcon_Draw(TFT_eSprite &sprite, const MenuIcon *icon, int32_t x, int32_t y)
+{
+  if (!icon) return;
+
+  int32_t width = sprite.width();
+  int32_t height = sprite.height();
+  uint16_t *buf = (sprite.getColorDepth() == 16) ? (uint16_t *)sprite.getPointer() : NULL;
+  bool swap = sprite.getSwapBytes();
+
+  // 整个图标在左右边界之外则什么都不做
+  if (x >= width || x + icon->width <= 0) return;
+
+  const uint8_t *row = icon->data;
+  for (int32_t r = 0; r < icon->height; r++)
+  {
+    uint16_t len = pgm_read_byte(row) | (pgm_read_byte(row + 1) << 8);
+    const uint8_t *p = row + 2;
+    const uint8_t *end = p + len;
+    row = end;
+
+    int32_t py = y + r;
+    if (py < 0) continue;   // 上方不可见的行直接跳过
+    if (py >= height) break; // 之后的行都不可见
+
+    int32_t px = x;
+    uint16_t prev = 0;
+    while (p < end && px < width) // 超出右边界后不再解码本行
+    {
+      uint8_t op = pgm_read_byte(p++);
+      if (op < MENU_ICON_OP_INDEX)
+      {
+        int32_t n = op - MENU_ICON_OP_RUN + 1;
+        writeSpan(sprite, buf, width, py, px, n, prev, swap);
+        px += n;
+      }
+      else if (op < MENU_ICON_OP_LITERAL)
+      {
+        prev = pgm_read_word(&icon->palette[op - MENU_ICON_OP_INDEX]);
+        writeSpan(sprite, buf, width, py, px, 1, prev, swap);
+        px++;
+      }
+      else
+      {
+        for (int32_t n = op - MENU_ICON_OP_LITERAL + 1; n > 0; n--)
+        {
+          prev = pgm_read_byte(p) | (pgm_read_byte(p + 1) << 8);
+          p += 2;
+          writeSpan(sprite, buf, width, py, px, 1, prev, swap);
+          px++;
+        }
+      }
+    }
+  }
+}
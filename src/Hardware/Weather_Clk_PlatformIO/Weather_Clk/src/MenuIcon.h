@@ -0,0 +1,38 @@
+#ifndef MENU_ICON_H
+#define MENU_ICON_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// --- 压缩图标的操作码 (由 create_icons/compress_icons.py 生成) ---
+#define MENU_ICON_OP_RUN      0x00 // 0x00~0x7F: 重复上一个像素 (n+1) 次
+#define MENU_ICON_OP_INDEX    0x80 // 0x80~0xEF: 调色板中的第 (n-0x80) 个颜色，1个像素
+#define MENU_ICON_OP_LITERAL  0xF0 // 0xF0~0xFF: 后面跟 (n-0xF0+1) 个16位原始像素 (小端)
+#define MENU_ICON_PALETTE_MAX (MENU_ICON_OP_LITERAL - MENU_ICON_OP_INDEX)
+
+/**
+ * @brief 压缩后的菜单图标。
+ * @details 每一行独立编码，行首是该行压缩数据的字节数 (16位小端)，解码时可以直接跳过不可见的行；
+ *          行内由“调色板索引 / 重复上一个像素 / 原始像素块”三种操作组成，类似QOI。
+ *          像素值与原始 img.h 数组完全相同，解码结果与 pushImage() 逐像素一致。
+ */
+struct MenuIcon
+{
+    uint16_t width;          ///< 图标宽度。
+    uint16_t height;         ///< 图标高度。
+    const uint16_t *palette; ///< 出现最多的颜色，最多 MENU_ICON_PALETTE_MAX 个。
+    const uint8_t *data;     ///< 逐行压缩数据。
+};
+
+/**
+ * @brief 把压缩图标逐行解码并直接写入精灵。
+ * @param sprite 目标精灵，16位色深时直接写入其缓冲区（不考虑视口），否则逐段 drawFastHLine。
+ * @param icon 压缩图标。
+ * @param x 图标左上角X坐标，可以部分或全部在精灵之外。
+ * @param y 图标左上角Y坐标。
+ * @details 超出精灵左右边界的像素只解码不写入，一行中超出右边界的部分和整行不可见的行直接跳过，
+ *          滑动动画中只露出一部分的图标只付出可见部分的代价。
+ */
+void MenuIcon_Draw(TFT_eSprite &sprite, const MenuIcon *icon, int32_t x, int32_t y);
+
+#endif // MENU_ICON_H
@@ -6,6 +6,8 @@
 #include "weather.h" // 用于 getLocalTime
 #include "Alarm.h"   // 用于 g_alarm_is_ringing
 #include <freertos/task.h>
+#include "Display.h"
+#include "EventBus.h"
 
 // --- 进度条颜色定义 ---
 static const uint16_t song_colors[] = {
@@ -13,29 +15,18 @@ static const uint16_t song_colors[] = {
 };
 static const int num_song_colors = sizeof(song_colors) / sizeof(song_colors[0]);
 
-// --- 任务和状态管理 ---
-static TaskHandle_t musicLiteTaskHandle = NULL; // 音乐播放任务的句柄
-static volatile bool stopMusicLiteTask = false; // 停止任务的标志
-static volatile bool isPaused = false;          // 暂停标志
-extern volatile bool g_force_exit_ui; // 引用在main.cpp中定义的全局UI退出标志
-
-// --- UI和播放任务之间的共享状态 ---
-// 使用 volatile 关键字确保在多任务环境下变量被正确访问
-static volatile int shared_song_index = 0;           // 当前播放歌曲的索引
-static volatile int shared_note_index = 0;           // 当前歌曲中正在播放的音符索引
-static volatile int shared_total_notes = 0;          // 当前歌曲的总音符数
-static volatile PlayMode shared_play_mode = LIST_LOOP; // 当前播放模式
-static volatile TickType_t current_note_start_tick = 0; // 当前音符开始播放的时间点
-static volatile int shared_current_note_duration = 0;  // 当前音符的时长
-static volatile int shared_current_note_frequency = 0; // 当前音符的频率
+// --- 播放状态 ---
+static uint32_t litePlayback = 0;     // 本界面启动的播放编号
+static bool isPaused = false;         // 暂停标志
+static PlayMode play_mode = LIST_LOOP; // 当前播放模式
+static QueueHandle_t songRequestQueue = NULL; // 播放界面订阅远程点歌的队列，收到即退出
 
 // --- 函数前向声明 ---
-static void MusicLite_Playback_Task(void *pvParameters);
 static void displaySongList_Lite(int selectedIndex, int displayOffset);
 static void displayPlayingScreen_Lite(uint16_t progress_bar_color);
 static void stop_lite_playback();
 static uint32_t calculateSongDuration_ms(int songIndex);
-static uint32_t calculateElapsedTime_ms();
+static uint32_t calculateElapsedTime_ms(const BuzzerPosition &pos);
 
 // --- 辅助函数 ---
 
@@ -57,94 +48,33 @@ static uint32_t calculateSongDuration_ms(int songIndex) {
 
 /**
  * @brief 计算当前歌曲已播放的时长（毫秒）
+ * @param pos 音频工作任务的播放进度
  * @return 已播放的时长（毫秒）
  */
-static uint32_t calculateElapsedTime_ms() {
-    if (shared_song_index < 0 || shared_song_index >= numSongs) return 0;
+static uint32_t calculateElapsedTime_ms(const BuzzerPosition &pos) {
+    if (pos.songIndex < 0 || pos.songIndex >= numSongs) return 0;
     Song song;
-    memcpy_P(&song, &songs[shared_song_index], sizeof(Song));
+    memcpy_P(&song, &songs[pos.songIndex], sizeof(Song));
     uint32_t elapsed_ms = 0;
     // 累加已播放音符的时长
-    for (int i = 0; i < shared_note_index; i++) {
+    for (int i = 0; i < pos.noteIndex && i < song.length; i++) {
         elapsed_ms += pgm_read_word(song.durations + i);
     }
-    // 加上当前正在播放音符所经过的时间
-    TickType_t current_note_elapsed_ticks = xTaskGetTickCount() - current_note_start_tick;
-    elapsed_ms += (current_note_elapsed_ticks * 1000) / configTICK_RATE_HZ;
-    return elapsed_ms;
-}
-
-/**
- * @brief [FreeRTOS Task] 音乐播放后台任务
- * @param pvParameters 指向要播放的歌曲索引的指针
- */
-void MusicLite_Playback_Task(void *pvParameters) {
-    int songIndex = *(int*)pvParameters;
-
-    for (;;) { // 无限循环以支持不同播放模式下的歌曲切换
-        shared_song_index = songIndex;
-        Song song;
-        memcpy_P(&song, &songs[songIndex], sizeof(Song));
-        shared_total_notes = song.length;
-        shared_note_index = 0;
-
-        // 遍历并播放当前歌曲的每个音符
-        for (int i = 0; i < song.length; i++) {
-            if (stopMusicLiteTask) { noTone(BUZZER_PIN); vTaskDelete(NULL); } // 检查停止标志
-
-            while (isPaused) { // 如果暂停，则在此循环等待
-                if (stopMusicLiteTask) { noTone(BUZZER_PIN); vTaskDelete(NULL); }
-                noTone(BUZZER_PIN);
-                shared_current_note_duration = 0;
-                shared_current_note_frequency = 0;
-                current_note_start_tick = xTaskGetTickCount(); // 暂停时重置开始时间，避免进度条跳跃
-                vTaskDelay(pdMS_TO_TICKS(50));
-            }
-
-            shared_note_index = i;
-            current_note_start_tick = xTaskGetTickCount();
-            int note = pgm_read_word(song.melody + i);
-            int duration = pgm_read_word(song.durations + i);
-
-            // 更新共享变量以供UI显示
-            shared_current_note_duration = duration;
-            shared_current_note_frequency = note;
-
-            if (note > 0) { tone(BUZZER_PIN, note, duration); }
-            
-            vTaskDelay(pdMS_TO_TICKS(duration)); // 等待音符时长
-        }
-        
-        shared_current_note_duration = 0;
-        shared_current_note_frequency = 0;
-
-        vTaskDelay(pdMS_TO_TICKS(2000)); // 歌曲结束后暂停2秒
-
-        // 根据播放模式决定下一首歌曲
-        if (shared_play_mode == SINGLE_LOOP) {
-            // 单曲循环，songIndex不变
-        } else if (shared_play_mode == LIST_LOOP) {
-            songIndex = (songIndex + 1) % numSongs; // 列表循环
-        } else if (shared_play_mode == RANDOM_PLAY) {
-            if (numSongs > 1) { // 随机播放
-                int currentSong = songIndex;
-                do { songIndex = random(numSongs); } while (songIndex == currentSong);
-            }
-        }
+    // 加上当前正在播放音符所经过的时间 (暂停时停在音符开头)
+    if (pos.frequency > 0 || pos.durationMs > 0) {
+        TickType_t current_note_elapsed_ticks = xTaskGetTickCount() - pos.noteTick;
+        elapsed_ms += (current_note_elapsed_ticks * 1000) / configTICK_RATE_HZ;
     }
+    return elapsed_ms;
 }
 
 /**
- * @brief 停止音乐播放相关的任务和硬件
+ * @brief 停止本界面启动的播放
  */
 void stop_lite_playback() {
-    if (musicLiteTaskHandle != NULL) {
-        vTaskDelete(musicLiteTaskHandle);
-        musicLiteTaskHandle = NULL;
-    }
-    noTone(BUZZER_PIN);
+    Buzzer_Stop(litePlayback); // 返回时已静音
+    if (songRequestQueue != NULL) EventBus_UnsubscribeQueue(songRequestQueue);
     isPaused = false;
-    stopMusicLiteTask = false;
 }
 
 // --- UI绘制函数 ---
@@ -182,7 +112,7 @@ void displaySongList_Lite(int selectedIndex, int displayOffset) {
   }
   
   menuSprite.setTextDatum(TL_DATUM);
-  menuSprite.pushSprite(0, 0);
+  Display_Present();
 }
 
 /**
@@ -190,8 +120,9 @@ void displaySongList_Lite(int selectedIndex, int displayOffset) {
  * @param progress_bar_color 进度条的颜色
  */
 void displayPlayingScreen_Lite(uint16_t progress_bar_color) {
-    uint32_t elapsed_ms = calculateElapsedTime_ms();
-    uint32_t total_ms = calculateSongDuration_ms(shared_song_index);
+    BuzzerPosition pos = Buzzer_GetPosition();
+    uint32_t elapsed_ms = calculateElapsedTime_ms(pos);
+    uint32_t total_ms = calculateSongDuration_ms(pos.songIndex);
 
     menuSprite.fillScreen(TFT_BLACK);
     menuSprite.setTextDatum(MC_DATUM);
@@ -199,18 +130,19 @@ void displayPlayingScreen_Lite(uint16_t progress_bar_color) {
 
     // 歌曲名称
     menuSprite.setTextSize(2);
-    menuSprite.drawString(songs[shared_song_index].name, 120, 20);
+    menuSprite.drawString(songs[pos.songIndex].name, 120, 20);
 
     // 当前音符信息
     char noteInfoStr[30];
-    snprintf(noteInfoStr, sizeof(noteInfoStr), "%d Hz  %d ms", shared_current_note_frequency, shared_current_note_duration);
+    snprintf(noteInfoStr, sizeof(noteInfoStr), "%d Hz  %d ms", pos.frequency, pos.durationMs);
     menuSprite.drawString(noteInfoStr, 120, 50);
 
     // 播放模式
-    switch (shared_play_mode) {
+    switch (play_mode) {
         case SINGLE_LOOP: menuSprite.drawString("Single Loop", 120, 80); break;
         case LIST_LOOP: menuSprite.drawString("List Loop", 120, 80); break;
         case RANDOM_PLAY: menuSprite.drawString("Random", 120, 80); break;
+        default: break;
     }
 
     // 系统时间
@@ -239,10 +171,10 @@ void displayPlayingScreen_Lite(uint16_t progress_bar_color) {
 
     // 音符计数显示
     char note_count_buf[20];
-    snprintf(note_count_buf, sizeof(note_count_buf), "%d / %d", shared_note_index + 1, shared_total_notes);
+    snprintf(note_count_buf, sizeof(note_count_buf), "%d / %d", pos.noteIndex + 1, pos.totalNotes);
     menuSprite.drawString(note_count_buf, 120, 210);
 
-    menuSprite.pushSprite(0, 0);
+    Display_Present();
 }
 
 /**
@@ -268,11 +200,11 @@ void MusicMenuLite() {
                 if (selectedSongIndex < displayOffset) displayOffset = selectedSongIndex;
                 else if (selectedSongIndex >= displayOffset + visibleSongs) displayOffset = selectedSongIndex - visibleSongs + 1;
                 displaySongList_Lite(selectedSongIndex, displayOffset);
-                tone(BUZZER_PIN, 1000, 50);
+                Buzzer_Tone(1000, 50);
             }
             
             if (readButton()) { // 短按进入播放界面
-                tone(BUZZER_PIN, 1500, 50);
+                Buzzer_Tone(1500, 50);
                 play_song_lite_ui(selectedSongIndex); // Call the new playback function
                 inListMenu = false;
             }
@@ -287,23 +219,28 @@ void play_song_lite_ui(int songIndex) {
     if (songIndex < 0 || songIndex >= numSongs) return;
 
     // --- 播放界面循环 ---
-    stopMusicLiteTask = false;
     isPaused = false;
-    shared_play_mode = LIST_LOOP;
-    
-    if (musicLiteTaskHandle == NULL) { // 创建播放任务
-        xTaskCreatePinnedToCore(MusicLite_Playback_Task, "MusicLite_Playback_Task", 4096, &songIndex, 2, &musicLiteTaskHandle, 0);
+    play_mode = LIST_LOOP;
+    litePlayback = Buzzer_Play(songIndex, play_mode); // 交给音频工作任务
+    if (songRequestQueue == NULL) {
+        songRequestQueue = xQueueCreate(1, sizeof(AppEvent));
     }
+    xQueueReset(songRequestQueue);
+    EventBus_SubscribeQueue(songRequestQueue, EVENT_MASK(EVENT_PLAY_SONG));
 
     unsigned long lastScreenUpdateTime = 0;
 
     while(true) {
-        if (g_force_exit_ui) {
+        AppEvent request;
+        if (EventBus_Receive(songRequestQueue, &request, 0)) { // 远程点歌：退出，由界面循环打开新的播放界面
             stop_lite_playback();
-            g_force_exit_ui = false; // 重置标志
             return;
         }
-        if (g_alarm_is_ringing) { stop_lite_playback(); return; }
+        if (g_alarm_is_ringing) { // 闹钟只抢占蜂鸣器：就地显示响铃界面，停止后音乐从被打断的音符继续
+            Alarm_ShowRingingScreen();
+            lastScreenUpdateTime = 0; // 强制刷新屏幕
+            continue;
+        }
 
         if (readButtonLongPress()) { // 长按停止播放并返回
             stop_lite_playback();
@@ -312,22 +249,24 @@ void play_song_lite_ui(int songIndex) {
 
         if (readButton()) { // 短按暂停/继续
             isPaused = !isPaused;
-            tone(BUZZER_PIN, 1000, 50);
+            Buzzer_Pause(litePlayback, isPaused);
+            Buzzer_Tone(1000, 50);
             lastScreenUpdateTime = 0; // 强制刷新屏幕
         }
 
         int encoderChange = readEncoder();
         if (encoderChange != 0) { // 旋转编码器切换播放模式
-            int mode = (int)shared_play_mode;
+            int mode = (int)play_mode;
             mode = (mode + encoderChange + 3) % 3;
-            shared_play_mode = (PlayMode)mode;
-            tone(BUZZER_PIN, 1200, 50);
+            play_mode = (PlayMode)mode;
+            Buzzer_SetMode(litePlayback, play_mode);
+            Buzzer_Tone(1200, 50);
             lastScreenUpdateTime = 0; // 强制刷新屏幕
         }
 
         // 定期更新屏幕
         if (millis() - lastScreenUpdateTime > 200) {
-            uint16_t current_color = song_colors[shared_song_index % num_song_colors];
+            uint16_t current_color = song_colors[Buzzer_GetPosition().songIndex % num_song_colors];
             displayPlayingScreen_Lite(current_color);
             lastScreenUpdateTime = millis();
         }
@@ -0,0 +1,101 @@
+// 包含所有必需的头文件
+#include "NoteEvents.h"
+#include <math.h>
+
+// --- 订阅者表 ---
+static NoteEventCallback callbacks[NOTE_EVENTS_MAX_CALLBACKS] = {NULL};
+static QueueHandle_t queues[NOTE_EVENTS_MAX_QUEUES] = {NULL};
+static portMUX_TYPE subscriberMux = portMUX_INITIALIZER_UNLOCKED; // 保护订阅者表的修改
+
+bool NoteEvents_Subscribe(NoteEventCallback callback)
+{
+  bool added = false;
+  portENTER_CRITICAL(&subscriberMux);
+  for (int i = 0; i < NOTE_EVENTS_MAX_CALLBACKS && !added; i++)
+  {
+    if (callbacks[i] == NULL || callbacks[i] == callback)
+    {
+      callbacks[i] = callback;
+      added = true;
+    }
+  }
+  portEXIT_CRITICAL(&subscriberMux);
+  return added;
+}
+
+void NoteEvents_Unsubscribe(NoteEventCallback callback)
+{
+  portENTER_CRITICAL(&subscriberMux);
+  for (int i = 0; i < NOTE_EVENTS_MAX_CALLBACKS; i++)
+  {
+    if (callbacks[i] == callback) callbacks[i] = NULL;
+  }
+  portEXIT_CRITICAL(&subscriberMux);
+}
+
+bool NoteEvents_SubscribeQueue(QueueHandle_t queue)
+{
+  bool added = false;
+  portENTER_CRITICAL(&subscriberMux);
+  for (int i = 0; i < NOTE_EVENTS_MAX_QUEUES && !added; i++)
+  {
+    if (queues[i] == NULL || queues[i] == queue)
+    {
+      queues[i] = queue;
+      added = true;
+    }
+  }
+  portEXIT_CRITICAL(&subscriberMux);
+  return added;
+}
+
+void NoteEvents_UnsubscribeQueue(QueueHandle_t queue)
+{
+  portENTER_CRITICAL(&subscriberMux);
+  for (int i = 0; i < NOTE_EVENTS_MAX_QUEUES; i++)
+  {
+    if (queues[i] == queue) queues[i] = NULL;
+  }
+  portEXIT_CRITICAL(&subscriberMux);
+}
+
+void NoteEvents_Publish(NoteEventType type, uint32_t playbackId, int songIndex, int noteIndex, int frequency, int durationMs)
+{
+  NoteEvent event;
+  event.type = type;
+  event.frequency = frequency;
+  event.durationMs = durationMs;
+  event.songIndex = songIndex;
+  event.noteIndex = noteIndex;
+  event.tick = xTaskGetTickCount();
+  event.playbackId = playbackId;
+
+  // 先复制订阅者表，回调和队列发送都在临界区之外进行
+  NoteEventCallback localCallbacks[NOTE_EVENTS_MAX_CALLBACKS];
+  QueueHandle_t localQueues[NOTE_EVENTS_MAX_QUEUES];
+  portENTER_CRITICAL(&subscriberMux);
+  memcpy(localCallbacks, callbacks, sizeof(localCallbacks));
+  memcpy(localQueues, queues, sizeof(localQueues));
+  portEXIT_CRITICAL(&subscriberMux);
+
+  for (int i = 0; i < NOTE_EVENTS_MAX_CALLBACKS; i++)
+  {
+    if (localCallbacks[i] != NULL) localCallbacks[i](event);
+  }
+  for (int i = 0; i < NOTE_EVENTS_MAX_QUEUES; i++)
+  {
+    if (localQueues[i] != NULL) xQueueSend(localQueues[i], &event, 0); // 队列满则丢弃，不阻塞播放
+  }
+}
+
+uint8_t NoteEvents_PitchToHue(uint16_t frequency)
+{
+  if (frequency == 0)
+  {
+    return 0;
+  }
+  // 频率 -> MIDI音符号 -> 音级(0-11)
+  int note = (int) (69.0f + 12.0f * log2f(frequency / 440.0f) + 0.5f);
+  if (note < 0) note = 0;
+  return (uint8_t) ((note % 12) * 256 / 12 + (note / 12) * 8);
+}
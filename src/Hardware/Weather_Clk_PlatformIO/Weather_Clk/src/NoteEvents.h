@@ -0,0 +1,87 @@
+#ifndef NOTE_EVENTS_H
+#define NOTE_EVENTS_H
+
+#include <Arduino.h>
+#include "freertos/queue.h"
+
+#define NOTE_EVENTS_MAX_CALLBACKS 4 // 回调订阅者上限
+#define NOTE_EVENTS_MAX_QUEUES    4 // 队列订阅者上限
+
+/**
+ * @brief 音符事件类型。
+ */
+enum NoteEventType
+{
+    NOTE_EVENT_SONG_START, ///< 开始播放一首歌，songIndex有效。
+    NOTE_EVENT_NOTE_ON,    ///< 音符开始发声 (frequency为0表示休止符)。
+    NOTE_EVENT_NOTE_OFF,   ///< 音符结束或被暂停打断。
+    NOTE_EVENT_SONG_END    ///< 一首歌播放完毕或被停止。
+};
+
+/**
+ * @brief 音符事件。
+ */
+struct NoteEvent
+{
+    NoteEventType type;
+    uint16_t frequency;  ///< 频率 (Hz)。
+    uint16_t durationMs; ///< 音符时长 (ms)。
+    int16_t songIndex;   ///< 歌曲在 songs[] 中的索引。
+    uint16_t noteIndex;  ///< 音符在歌曲中的序号。
+    TickType_t tick;     ///< 事件发生时的系统tick。
+    uint32_t playbackId; ///< Buzzer_Play 返回的播放编号，订阅者据此只跟随自己启动的播放。
+};
+
+/**
+ * @brief 回调订阅函数类型。
+ * @details 在发布者（播放任务）中同步调用，必须非常短小且不能阻塞。
+ */
+typedef void (*NoteEventCallback)(const NoteEvent &event);
+
+/**
+ * @brief 以回调方式订阅音符事件。
+ * @param callback 回调函数。
+ * @return 有空闲槽位返回true。
+ * @details 适合开销极小的订阅者（例如只更新几个变量的LED引擎），延迟为零。
+ */
+bool NoteEvents_Subscribe(NoteEventCallback callback);
+
+/**
+ * @brief 取消回调订阅。
+ */
+void NoteEvents_Unsubscribe(NoteEventCallback callback);
+
+/**
+ * @brief 以队列方式订阅音符事件。
+ * @param queue 元素大小为 sizeof(NoteEvent) 的队列。
+ * @return 有空闲槽位返回true。
+ * @details 适合需要做较多工作的订阅者（例如界面），订阅者阻塞在队列上即可被及时唤醒。
+ *          队列满时事件会被丢弃，发布者永远不会因订阅者而阻塞。
+ */
+bool NoteEvents_SubscribeQueue(QueueHandle_t queue);
+
+/**
+ * @brief 取消队列订阅。
+ */
+void NoteEvents_UnsubscribeQueue(QueueHandle_t queue);
+
+/**
+ * @brief 发布一个音符事件。
+ * @param type 事件类型。
+ * @param playbackId 播放编号。
+ * @param songIndex 歌曲索引。
+ * @param noteIndex 音符序号。
+ * @param frequency 频率 (Hz)。
+ * @param durationMs 时长 (ms)。
+ * @details 由播放任务在调用 tone() 的同一位置调用。
+ */
+void NoteEvents_Publish(NoteEventType type, uint32_t playbackId, int songIndex, int noteIndex, int frequency, int durationMs);
+
+/**
+ * @brief 把音高映射为色相。
+ * @param frequency 频率 (Hz)。
+ * @return 色相 (0-255)。同一音名在不同八度颜色相近，按八度略微偏移。
+ */
+uint8_t NoteEvents_PitchToHue(uint16_t frequency);
+
+#endif // NOTE_EVENTS_H
@@ -0,0 +1,157 @@
+// 包含所有必需的头文件
+#include "PCLink.h"
+
+// --- 解析器状态 ---
+enum PCLinkState
+{
+  LINK_WAIT_SYNC0,
+  LINK_WAIT_SYNC1,
+  LINK_HEADER,
+  LINK_PAYLOAD,
+  LINK_CRC
+};
+
+static PCLinkState linkState = LINK_WAIT_SYNC0;
+static uint8_t headerBuf[PC_LINK_HEADER_SIZE - 2]; // VER | TYPE | LEN_L | LEN_H
+static uint8_t payloadBuf[PC_LINK_MAX_PAYLOAD] __attribute__((aligned(4))); // 对齐以便处理函数按uint16读取像素
+static uint8_t crcBuf[PC_LINK_CRC_SIZE];
+static uint16_t stateIndex = 0;    // 当前状态下已接收的字节数
+static uint16_t payloadLength = 0; // 本帧负载长度
+static bool discardPayload = false; // 超长帧只做同步，不保存负载
+
+static PCLinkFrameHandler frameHandlers[256] = {NULL}; // 按帧类型索引的处理函数表
+static PCLinkStats linkStats = {0, 0, 0, 0};
+
+// CRC16-CCITT 半字节查找表，仅占32字节
+static const uint16_t crcNibbleTable[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF};
+
+uint16_t PCLink_CRC16(uint16_t crc, const uint8_t *data, size_t length)
+{
+  while (length--)
+  {
+    crc = (crc << 4) ^ crcNibbleTable[((crc >> 12) ^ (*data >> 4)) & 0x0F];
+    crc = (crc << 4) ^ crcNibbleTable[((crc >> 12) ^ (*data & 0x0F)) & 0x0F];
+    data++;
+  }
+  return crc;
+}
+
+void PCLink_RegisterHandler(uint8_t type, PCLinkFrameHandler handler)
+{
+  frameHandlers[type] = handler;
+}
+
+void PCLink_Reset()
+{
+  linkState = LINK_WAIT_SYNC0;
+  stateIndex = 0;
+}
+
+bool PCLink_InFrame()
+{
+  return linkState != LINK_WAIT_SYNC0;
+}
+
+void PCLink_Send(uint8_t type, const uint8_t *payload, uint16_t length)
+{
+  uint8_t header[PC_LINK_HEADER_SIZE] = {PC_LINK_SYNC0, PC_LINK_SYNC1, PC_LINK_VERSION, type,
+                                         (uint8_t) (length & 0xFF), (uint8_t) (length >> 8)};
+  uint16_t crc = PCLink_CRC16(0xFFFF, header + 2, PC_LINK_HEADER_SIZE - 2);
+  crc = PCLink_CRC16(crc, payload, length);
+  uint8_t crcBytes[PC_LINK_CRC_SIZE] = {(uint8_t) (crc & 0xFF), (uint8_t) (crc >> 8)};
+
+  Serial.write(header, sizeof(header));
+  Serial.write(payload, length);
+  Serial.write(crcBytes, sizeof(crcBytes));
+}
+
+PCLinkStats PCLink_GetStats()
+{
+  return linkStats;
+}
+
+/**
+ * @brief 校验并分发一帧完整的数据。
+ */
+static void dispatchFrame()
+{
+  uint16_t crc = PCLink_CRC16(0xFFFF, headerBuf, sizeof(headerBuf));
+  crc = PCLink_CRC16(crc, payloadBuf, payloadLength);
+  uint16_t received = crcBuf[0] | (crcBuf[1] << 8);
+  if (crc != received)
+  {
+    linkStats.crcErrors++;
+    return;
+  }
+
+  PCLinkFrameHandler handler = frameHandlers[headerBuf[1]];
+  if (handler == NULL)
+  {
+    linkStats.unhandled++;
+    return;
+  }
+  linkStats.frames++;
+  handler(headerBuf[0], payloadBuf, payloadLength);
+}
+
+bool PCLink_Feed(uint8_t byte)
+{
+  switch (linkState)
+  {
+  case LINK_WAIT_SYNC0:
+    if (byte != PC_LINK_SYNC0)
+    {
+      return false; // 不是帧起始，交给文本协议
+    }
+    linkState = LINK_WAIT_SYNC1;
+    return true;
+
+  case LINK_WAIT_SYNC1:
+    // 连续的SYNC0仍然可能是帧起始
+    linkState = (byte == PC_LINK_SYNC1) ? LINK_HEADER : (byte == PC_LINK_SYNC0 ? LINK_WAIT_SYNC1 : LINK_WAIT_SYNC0);
+    stateIndex = 0;
+    return true;
+
+  case LINK_HEADER:
+    headerBuf[stateIndex++] = byte;
+    if (stateIndex == sizeof(headerBuf))
+    {
+      payloadLength = headerBuf[2] | (headerBuf[3] << 8);
+      discardPayload = payloadLength > PC_LINK_MAX_PAYLOAD;
+      stateIndex = 0;
+      linkState = (payloadLength == 0) ? LINK_CRC : LINK_PAYLOAD;
+    }
+    return true;
+
+  case LINK_PAYLOAD:
+    if (!discardPayload)
+    {
+      payloadBuf[stateIndex] = byte;
+    }
+    if (++stateIndex == payloadLength)
+    {
+      stateIndex = 0;
+      linkState = LINK_CRC;
+    }
+    return true;
+
+  case LINK_CRC:
+    crcBuf[stateIndex++] = byte;
+    if (stateIndex == PC_LINK_CRC_SIZE)
+    {
+      if (discardPayload)
+      {
+        linkStats.overflows++;
+      }
+      else
+      {
+        dispatchFrame();
+      }
+      PCLink_Reset();
+    }
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,111 @@
+#ifndef PCLINK_H
+#define PCLINK_H
+
+#include <Arduino.h>
+
+// -----------------------------
+// 帧格式定义
+// -----------------------------
+// | SYNC0 | SYNC1 | VER | TYPE | LEN_L | LEN_H | PAYLOAD[LEN] | CRC_L | CRC_H |
+// CRC16-CCITT (多项式0x1021, 初值0xFFFF) 覆盖 VER 到 PAYLOAD 末尾。
+#define PC_LINK_SYNC0          0xA5
+#define PC_LINK_SYNC1          0x5A
+#define PC_LINK_VERSION        1
+#define PC_LINK_HEADER_SIZE    6
+#define PC_LINK_CRC_SIZE       2
+#define PC_LINK_MAX_PAYLOAD    4096 // 副屏模式的像素块较大，减少每帧的固定开销
+
+// 帧类型
+#define PC_LINK_TYPE_TELEMETRY 0x01
+#define PC_LINK_TYPE_SCREEN    0x02 // 副屏像素数据 (见 SecondScreen.h)
+#define PC_LINK_TYPE_SCREEN_ACK 0x82 // 设备 -> PC: 一帧画面已显示完毕
+
+// 遥测帧中的字段ID (TLV: ID[1] | LEN[1] | VALUE[LEN], 多字节数值均为小端)
+// 新增字段只能追加新ID，接收端会跳过不认识的字段，保证新旧版本互相兼容。
+#define PC_FIELD_CPU_LOAD      0x01 // uint8   CPU总负载 %
+#define PC_FIELD_CPU_TEMP      0x02 // int16   CPU温度 ℃
+#define PC_FIELD_GPU_LOAD      0x03 // uint8   GPU负载 %
+#define PC_FIELD_GPU_TEMP      0x04 // int16   GPU温度 ℃
+#define PC_FIELD_RAM_LOAD      0x05 // uint16  内存占用 0.1%
+#define PC_FIELD_CORE_LOADS    0x06 // uint8[] 每个逻辑核心的负载 %
+#define PC_FIELD_CPU_CLOCK     0x07 // uint16  CPU频率 MHz
+#define PC_FIELD_GPU_CLOCK     0x08 // uint16  GPU频率 MHz
+#define PC_FIELD_FAN_RPM       0x09 // uint16[] 各风扇转速 RPM
+#define PC_FIELD_NET_RX        0x0A // uint32  网络下行 KB/s
+#define PC_FIELD_NET_TX        0x0B // uint32  网络上行 KB/s
+#define PC_FIELD_DISK_READ     0x0C // uint32  磁盘读 KB/s
+#define PC_FIELD_DISK_WRITE    0x0D // uint32  磁盘写 KB/s
+#define PC_FIELD_CPU_NAME      0x0E // char[]  CPU名称 (无结束符)
+#define PC_FIELD_GPU_NAME      0x0F // char[]  GPU名称 (无结束符)
+
+/**
+ * @brief 帧处理回调函数类型。
+ * @param version 帧头中的协议版本号。
+ * @param payload 指向帧负载数据的指针，仅在回调期间有效。
+ * @param length 负载数据的字节数。
+ */
+typedef void (*PCLinkFrameHandler)(uint8_t version, const uint8_t *payload, uint16_t length);
+
+/**
+ * @brief 链路统计信息。
+ */
+struct PCLinkStats
+{
+    uint32_t frames;      ///< 校验通过并被分发的帧数。
+    uint32_t crcErrors;   ///< CRC校验失败的帧数。
+    uint32_t overflows;   ///< 长度超过 PC_LINK_MAX_PAYLOAD 被丢弃的帧数。
+    uint32_t unhandled;   ///< 没有注册处理函数的帧数。
+};
+
+/**
+ * @brief 为指定的帧类型注册处理函数。
+ * @param type 帧类型 (例如 PC_LINK_TYPE_TELEMETRY)。
+ * @param handler 处理函数，传入NULL表示取消注册。
+ */
+void PCLink_RegisterHandler(uint8_t type, PCLinkFrameHandler handler);
+
+/**
+ * @brief 向帧解析状态机输入一个字节。
+ * @param byte 从串口读到的字节。
+ * @return 如果该字节属于二进制帧（包括帧头同步字节），返回true；
+ *         如果解析器处于空闲状态且该字节不是帧起始，返回false，
+ *         调用者应将其交给旧的文本协议处理。
+ */
+bool PCLink_Feed(uint8_t byte);
+
+/**
+ * @brief 解析器是否正处于一帧的中间。
+ * @return 正在接收二进制帧时返回true。
+ */
+bool PCLink_InFrame();
+
+/**
+ * @brief 丢弃当前未完成的帧，使解析器回到空闲状态。
+ * @details 用于串口长时间无数据时的超时复位。
+ */
+void PCLink_Reset();
+
+/**
+ * @brief 计算CRC16-CCITT校验值。
+ * @param crc 初始值 (首次调用传入0xFFFF)，可用于分段累加。
+ * @param data 数据指针。
+ * @param length 数据长度。
+ * @return 更新后的CRC值。
+ */
+uint16_t PCLink_CRC16(uint16_t crc, const uint8_t *data, size_t length);
+
+/**
+ * @brief 向PC发送一帧数据。
+ * @param type 帧类型。
+ * @param payload 负载数据。
+ * @param length 负载长度，不得超过 PC_LINK_MAX_PAYLOAD。
+ * @details 按与接收相同的帧格式打包并写入 Serial，用于应答等设备到PC的消息。
+ */
+void PCLink_Send(uint8_t type, const uint8_t *payload, uint16_t length);
+
+/**
+ * @brief 获取链路统计信息的副本。
+ */
+PCLinkStats PCLink_GetStats();
+
+#endif // PCLINK_H
@@ -5,6 +5,8 @@
 #include "Buzzer.h"
 #include "animation.h" // 用于 drawSmoothArc
 #include "weather.h"
+#include "Display.h"
+#include "Screen.h"
 
 // --- 配置常量 ---
 const unsigned long WORK_DURATION_SECS = 25 * 60;       // 工作时长（25分钟）
@@ -112,13 +114,47 @@ static void drawPomodoroUI(unsigned long remaining_secs, unsigned long total_sec
         }
     }
 
-    menuSprite.pushSprite(0, 0); // 将Sprite内容推送到屏幕
+    Display_Present(); // 将Sprite内容推送到屏幕
 }
 
 // =====================================================================================
 //                                     核心逻辑
 // =====================================================================================
 
+// --- 页面状态 ---
+static unsigned long last_displayed_secs = 0;          // 上一帧显示的剩余秒数
+static unsigned long last_realtime_clock_update = 0;   // 上次刷新顶部时钟的时刻
+
+/**
+ * @brief 一个会话状态的总时长（秒）
+ */
+static unsigned long sessionDurationSecs(PomodoroState state)
+{
+    switch (state)
+    {
+    case STATE_WORK:        return WORK_DURATION_SECS;
+    case STATE_SHORT_BREAK: return SHORT_BREAK_DURATION_SECS;
+    case STATE_LONG_BREAK:  return LONG_BREAK_DURATION_SECS;
+    default:                return WORK_DURATION_SECS; // 空闲时显示一个工作会话
+    }
+}
+
+/**
+ * @brief 当前会话剩余的毫秒数
+ */
+static unsigned long pomodoroRemainingMs(unsigned long now)
+{
+    if (currentState == STATE_IDLE)
+    {
+        return WORK_DURATION_SECS * 1000;
+    }
+    if (currentState == STATE_PAUSED)
+    {
+        return remaining_on_pause;
+    }
+    return (now >= session_end_millis) ? 0 : session_end_millis - now;
+}
+
 /**
  * @brief 开始一个新的会话（工作或休息）
  * @param nextState 要进入的下一个状态
@@ -126,155 +162,138 @@ static void drawPomodoroUI(unsigned long remaining_secs, unsigned long total_sec
 static void startNewSession(PomodoroState nextState)
 {
     currentState = nextState;
-    unsigned long duration_secs = 0;
-
-    switch (currentState)
+    unsigned long duration_secs = sessionDurationSecs(currentState);
+    if (currentState == STATE_LONG_BREAK)
     {
-    case STATE_WORK:        duration_secs = WORK_DURATION_SECS; break;
-    case STATE_SHORT_BREAK: duration_secs = SHORT_BREAK_DURATION_SECS; break;
-    case STATE_LONG_BREAK:
-        duration_secs = LONG_BREAK_DURATION_SECS;
         sessions_completed = 0; // 长休息后重置计数
-        break;
-    default: break;
     }
 
     session_end_millis = millis() + (duration_secs * 1000); // 计算结束时间戳
-    drawPomodoroUI(duration_secs, duration_secs);
     last_pomodoro_beep_time = 0; // 重置蜂鸣计时器
 }
 
 /**
- * @brief 番茄钟功能的主菜单函数
+ * @brief [页面] 进入时回到空闲状态
  */
-void PomodoroMenu()
+static void pomodoroEnter()
 {
     currentState = STATE_IDLE;
     sessions_completed = 0;
-    drawPomodoroUI(WORK_DURATION_SECS, WORK_DURATION_SECS); // 初始绘制IDLE界面
-    unsigned long last_draw_time = 0;
-    unsigned long last_realtime_clock_update = millis();
+    last_displayed_secs = WORK_DURATION_SECS;
+    last_realtime_clock_update = millis();
+}
 
-    while (true)
+/**
+ * @brief [页面] 短按开始/暂停/恢复，推进会话计时
+ * @return 状态改变、剩余秒数变化或顶部时钟需要刷新时请求重绘
+ */
+static ScreenAction pomodoroUpdate(const ScreenInput &input)
+{
+    if (input.longPress)
     {
-        // 检查全局退出条件
-        if (g_alarm_is_ringing) { return; }
-        if (readButtonLongPress())
-        {
-            tone(BUZZER_PIN, 1500, 100);
-            menuSprite.setTextFont(1); menuSprite.setTextSize(1); // 恢复默认字体
-            return; // 退出菜单
-        }
+        Buzzer_Tone(1500, 100);
+        return SCREEN_EXIT; // 退出菜单
+    }
 
-        if (readButton())
-        { // 短按按钮逻辑
-            tone(BUZZER_PIN, 2000, 50);
-            if (currentState == STATE_IDLE)
-            { // 如果是空闲状态，则开始工作
-                startNewSession(STATE_WORK);
-            }
-            else if (currentState == STATE_PAUSED)
-            { // 如果是暂停状态，则恢复
-                currentState = stateBeforePause;
-                session_end_millis = millis() + remaining_on_pause;
-            }
-            else
-            { // 如果正在运行，则暂停
-                remaining_on_pause = session_end_millis - millis();
-                stateBeforePause = currentState;
-                currentState = STATE_PAUSED;
-                // 计算暂停时总时长用于UI显示
-                unsigned long total_secs_on_pause = 0;
-                switch (stateBeforePause)
-                {
-                case STATE_WORK: total_secs_on_pause = WORK_DURATION_SECS; break;
-                case STATE_SHORT_BREAK: total_secs_on_pause = SHORT_BREAK_DURATION_SECS; break;
-                case STATE_LONG_BREAK: total_secs_on_pause = LONG_BREAK_DURATION_SECS; break;
-                default: break;
-                }
-                drawPomodoroUI(remaining_on_pause / 1000, total_secs_on_pause);
-            }
+    ScreenAction action = SCREEN_IDLE;
+    if (input.click)
+    { // 短按按钮逻辑
+        Buzzer_Tone(2000, 50);
+        if (currentState == STATE_IDLE)
+        { // 如果是空闲状态，则开始工作
+            startNewSession(STATE_WORK);
+        }
+        else if (currentState == STATE_PAUSED)
+        { // 如果是暂停状态，则恢复
+            currentState = stateBeforePause;
+            session_end_millis = input.nowMs + remaining_on_pause;
+        }
+        else
+        { // 如果正在运行，则暂停
+            remaining_on_pause = pomodoroRemainingMs(input.nowMs);
+            stateBeforePause = currentState;
+            currentState = STATE_PAUSED;
         }
+        action = SCREEN_REDRAW;
+    }
 
-        // --- 计时器运行逻辑 ---
-        if (currentState != STATE_IDLE && currentState != STATE_PAUSED)
-        {
-            unsigned long time_now = millis();
-            unsigned long remaining_ms = (time_now >= session_end_millis) ? 0 : session_end_millis - time_now;
+    // --- 计时器运行逻辑 ---
+    if (currentState != STATE_IDLE && currentState != STATE_PAUSED)
+    {
+        unsigned long remaining_ms = pomodoroRemainingMs(input.nowMs);
 
-            // 每秒重绘一次UI以更新倒计时
-            if (time_now - last_draw_time >= 990)
-            {
-                unsigned long total_secs = 0;
-                switch (currentState)
-                {
-                case STATE_WORK: total_secs = WORK_DURATION_SECS; break;
-                case STATE_SHORT_BREAK: total_secs = SHORT_BREAK_DURATION_SECS; break;
-                case STATE_LONG_BREAK: total_secs = LONG_BREAK_DURATION_SECS; break;
-                default: break;
-                }
-                drawPomodoroUI(remaining_ms / 1000, total_secs);
-                last_draw_time = time_now;
-            }
+        // 剩余秒数变化时重绘
+        if (remaining_ms / 1000 != last_displayed_secs)
+        {
+            action = SCREEN_REDRAW;
+        }
 
-            // 最后5秒警告：每秒蜂鸣一次
-            if (remaining_ms > 0 && remaining_ms <= 5000 && (time_now - last_pomodoro_beep_time >= 1000 || last_pomodoro_beep_time == 0))
-            {
-                tone(BUZZER_PIN, 1000, 100);
-                last_pomodoro_beep_time = time_now;
-            }
+        // 最后5秒警告：每秒蜂鸣一次
+        if (remaining_ms > 0 && remaining_ms <= 5000 && (input.nowMs - last_pomodoro_beep_time >= 1000 || last_pomodoro_beep_time == 0))
+        {
+            Buzzer_Tone(1000, 100, VOICE_NOTIFY);
+            last_pomodoro_beep_time = input.nowMs;
+        }
 
-            // 当前会话结束
-            if (remaining_ms == 0)
+        // 当前会话结束
+        if (remaining_ms == 0)
+        {
+            Buzzer_Tone(3000, 3000, VOICE_NOTIFY); // 长鸣提示结束
+            if (currentState == STATE_WORK)
             {
-                tone(BUZZER_PIN, 3000, 3000); // 长鸣提示结束
-                if (currentState == STATE_WORK)
+                sessions_completed++;
+                if (sessions_completed >= SESSIONS_BEFORE_LONG_BREAK)
                 {
-                    sessions_completed++;
-                    if (sessions_completed >= SESSIONS_BEFORE_LONG_BREAK)
-                    {
-                        startNewSession(STATE_LONG_BREAK); // 开始长休息
-                    }
-                    else
-                    {
-                        startNewSession(STATE_SHORT_BREAK); // 开始短休息
-                    }
+                    startNewSession(STATE_LONG_BREAK); // 开始长休息
                 }
                 else
-                { // 休息结束
-                    startNewSession(STATE_WORK); // 开始新的工作
-                }
-            }
-        }
-        else
-        { // 如果未在运行状态（空闲或暂停），则只更新顶部的实时时钟
-            unsigned long current_millis = millis();
-            if (current_millis - last_realtime_clock_update >= 1000)
-            {
-                unsigned long current_remaining_secs = 0;
-                unsigned long current_total_secs = 0;
-
-                if (currentState == STATE_IDLE)
-                {
-                    current_remaining_secs = WORK_DURATION_SECS;
-                    current_total_secs = WORK_DURATION_SECS;
-                }
-                else if (currentState == STATE_PAUSED)
                 {
-                    current_remaining_secs = remaining_on_pause / 1000;
-                    switch (stateBeforePause)
-                    {
-                    case STATE_WORK: current_total_secs = WORK_DURATION_SECS; break;
-                    case STATE_SHORT_BREAK: current_total_secs = SHORT_BREAK_DURATION_SECS; break;
-                    case STATE_LONG_BREAK: current_total_secs = LONG_BREAK_DURATION_SECS; break;
-                    default: current_total_secs = WORK_DURATION_SECS; break; // Fallback
-                    }
+                    startNewSession(STATE_SHORT_BREAK); // 开始短休息
                 }
-                drawPomodoroUI((currentState == STATE_IDLE) ? WORK_DURATION_SECS : remaining_on_pause / 1000,
-                    (currentState == STATE_IDLE) ? WORK_DURATION_SECS : ((stateBeforePause == STATE_WORK) ? WORK_DURATION_SECS : ((stateBeforePause == STATE_SHORT_BREAK) ? SHORT_BREAK_DURATION_SECS : LONG_BREAK_DURATION_SECS)));
-                last_realtime_clock_update = current_millis;
             }
+            else
+            { // 休息结束
+                startNewSession(STATE_WORK); // 开始新的工作
+            }
+            action = SCREEN_REDRAW;
         }
-        vTaskDelay(pdMS_TO_TICKS(20)); // 短暂延时，避免CPU空转
     }
-}
\ No newline at end of file
+
+    // 顶部的实时时钟每秒刷新一次
+    if (input.nowMs - last_realtime_clock_update >= 1000)
+    {
+        last_realtime_clock_update = input.nowMs;
+        action = SCREEN_REDRAW;
+    }
+    return action;
+}
+
+/**
+ * @brief [页面] 绘制当前会话
+ */
+static void pomodoroRender()
+{
+    last_displayed_secs = pomodoroRemainingMs(millis()) / 1000;
+    PomodoroState shown = (currentState == STATE_PAUSED) ? stateBeforePause : currentState;
+    drawPomodoroUI(last_displayed_secs, sessionDurationSecs(shown));
+}
+
+/**
+ * @brief [页面] 退出时恢复默认字体
+ */
+static void pomodoroExit(ScreenExitReason reason)
+{
+    menuSprite.setTextFont(1); menuSprite.setTextSize(1); // 恢复默认字体
+}
+
+// 界面按秒变化，不需要高帧率
+static const ScreenDef pomodoroScreen = {"pomodoro", 100, true, pomodoroEnter, pomodoroUpdate, pomodoroRender,
+                                         pomodoroExit};
+
+/**
+ * @brief 番茄钟功能的主菜单函数
+ */
+void PomodoroMenu()
+{
+    Screen_Run(pomodoroScreen);
+}
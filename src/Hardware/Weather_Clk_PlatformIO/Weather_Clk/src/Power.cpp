@@ -0,0 +1,681 @@
+#include "Power.h"
+#include "Display.h"
+#include "Settings.h"
+#include "RotaryEncoder.h"
+#include "Alarm.h"
+#include "Profiler.h"
+#include "EventBus.h"
+#include <WiFi.h>
+#include <esp_wifi.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <esp_freertos_hooks.h>
+#include <esp_rom_sys.h>
+#include <driver/gpio.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#define POWER_SCHEMA_VERSION 1    // 设置存储中电源记录的格式版本
+#define POWER_REASON_TIMEOUT 0xFF // 日志中因无操作超时而切换的原因
+
+extern TFT_eSPI tft;
+
+/**
+ * @brief 保存在设置存储中的空闲时间设置
+ */
+struct PowerConfig
+{
+  uint16_t dimAfterS;
+  uint16_t sleepAfterS;
+  uint8_t dimDuty;
+  uint8_t reserved[3];
+};
+
+/**
+ * @brief 电源日志中的一次状态切换
+ */
+struct PowerLogEntry
+{
+  uint32_t atMs;
+  uint8_t from;
+  uint8_t to;
+  uint8_t reason; // PowerWakeSource 或 POWER_REASON_TIMEOUT
+};
+
+static const char *const stateNames[POWER_STATE_COUNT] = {"active", "dim", "sleep"};
+static const char *const sourceNames[POWER_WAKE_SOURCE_COUNT] = {"input", "alarm", "mqtt", "command"};
+static const char *const lockNames[POWER_LOCK_COUNT] = {"render", "push", "audio"};
+static const char *const freqNames[POWER_FREQ_COUNT] = {"160MHz", "80MHz", "40MHz", "sleep"};
+static const uint8_t wakePins[] = {ENCODER_CLK, ENCODER_DT, ENCODER_SW};
+
+// --- 全局变量 ---
+static PowerConfig config = {POWER_DIM_AFTER_S, POWER_SLEEP_AFTER_S, POWER_DIM_DUTY, {0, 0, 0}};
+static volatile PowerState state = POWER_ACTIVE;
+static volatile uint32_t lastActivityMs = 0;
+static volatile uint8_t wakeSource = POWER_WAKE_INPUT;
+static volatile int64_t wakeUs = 0;    // 空闲时第一次操作的时刻，等待唤醒后的第一帧时非0
+static volatile bool wakeArmed = false; // 编码器引脚处于电平唤醒模式
+static TaskHandle_t powerTaskHandle = NULL;
+static bool lightSleepOk = false;
+static bool lightSleepTried = false;
+static bool dfsOn = POWER_DFS_DEFAULT;
+static bool dfsOk = false;
+
+// --- 性能锁 ---
+static esp_pm_lock_handle_t pmLocks[POWER_LOCK_COUNT];
+static esp_timer_handle_t leaseTimers[POWER_LOCK_COUNT];
+static volatile bool leased[POWER_LOCK_COUNT];
+static uint8_t lockDepth[POWER_LOCK_COUNT];
+static uint32_t lockCount[POWER_LOCK_COUNT];
+static int64_t lockSinceUs[POWER_LOCK_COUNT];
+static uint64_t lockHeldUs[POWER_LOCK_COUNT];
+static portMUX_TYPE lockMux = portMUX_INITIALIZER_UNLOCKED;
+
+// --- 频率分布：每个系统节拍采样一次当前频率，浅睡眠期间没有节拍 ---
+static volatile uint32_t freqTicks[POWER_FREQ_SLEEP];
+static uint32_t freqSinceMs = 0;
+
+static uint32_t stateMs[POWER_STATE_COUNT];
+static uint32_t stateSinceMs = 0;
+static uint32_t wakes[POWER_WAKE_SOURCE_COUNT];
+static uint32_t latencyCount = 0;
+static uint32_t latencyMsMin = 0;
+static uint32_t latencyMsMax = 0;
+static uint64_t latencyMsTotal = 0;
+static PowerLogEntry powerLog[POWER_LOG_LEN];
+static uint8_t logHead = 0;
+static uint8_t logCount = 0;
+
+/**
+ * @brief 设置背光亮度，没有背光引脚时什么都不做
+ */
+static void setBacklight(uint8_t duty)
+{
+#if POWER_BACKLIGHT_PIN >= 0
+#if TFT_BACKLIGHT_ON == LOW
+  duty = 255 - duty;
+#endif
+  ledcWrite(POWER_BACKLIGHT_CHANNEL, duty);
+#else
+  (void)duty;
+#endif
+}
+
+/**
+ * @brief 让 ST7789 进入或退出睡眠，熄屏时面板停止扫描，显存内容保留
+ */
+static void setPanelSleep(bool sleep)
+{
+  Display_Lock();
+  if (sleep)
+  {
+    tft.writecommand(TFT_DISPOFF);
+    tft.writecommand(TFT_SLPIN);
+  }
+  else
+  {
+    tft.writecommand(TFT_SLPOUT);
+    vTaskDelay(pdMS_TO_TICKS(5)); // 退出睡眠后至少等5ms才能发下一条命令
+    tft.writecommand(TFT_DISPON);
+  }
+  Display_Unlock();
+}
+
+/**
+ * @brief 按状态配置电源管理：动态调频的最低频率和自动浅睡眠
+ * @details 没有性能锁时CPU降到最低频率，有人操作时不低于 80MHz，调暗和熄屏时可降到 40MHz；
+ *          熄屏时再打开自动浅睡眠，所有任务都阻塞时芯片进入浅睡眠，由最近的任务超时
+ *          (如闹钟任务等到的响铃时刻)、WiFi 监听间隔或编码器引脚电平唤醒。
+ *          浅睡眠需要固件开启 tickless idle，不支持时只配置调频；调频也不支持 (未开启 CONFIG_PM_ENABLE) 时频率固定。
+ */
+static void configurePm(PowerState s)
+{
+  int minMhz = !dfsOn ? POWER_CPU_MAX_MHZ : (s == POWER_ACTIVE ? POWER_CPU_ACTIVE_MIN_MHZ : POWER_CPU_IDLE_MIN_MHZ);
+  bool sleep = s == POWER_SLEEP;
+  esp_pm_config_esp32c3_t pm = {POWER_CPU_MAX_MHZ, minMhz, sleep};
+  esp_err_t err = esp_pm_configure(&pm);
+  if (sleep)
+  {
+    if (!lightSleepTried && err != ESP_OK)
+    {
+      Serial.printf("[Power] auto light sleep unavailable: %s\n", esp_err_to_name(err));
+    }
+    lightSleepTried = true;
+    lightSleepOk = err == ESP_OK;
+    if (err != ESP_OK)
+    {
+      pm.light_sleep_enable = false;
+      err = esp_pm_configure(&pm);
+    }
+  }
+  dfsOk = err == ESP_OK && minMhz < POWER_CPU_MAX_MHZ;
+}
+
+/**
+ * @brief [系统节拍钩子] 记录当前CPU频率，在中断中运行
+ */
+static void IRAM_ATTR freqTickHook()
+{
+  uint32_t mhz = esp_rom_get_cpu_ticks_per_us();
+  freqTicks[mhz >= 160 ? POWER_FREQ_160 : (mhz >= 80 ? POWER_FREQ_80 : POWER_FREQ_40)]++;
+}
+
+/**
+ * @brief 租约到期，释放 Power_LockFor 获取的锁 (在 esp_timer 任务中运行)
+ */
+static void onLeaseExpired(void *arg)
+{
+  PowerLock lock = (PowerLock)(intptr_t)arg;
+  if (leased[lock])
+  {
+    leased[lock] = false;
+    Power_LockRelease(lock);
+  }
+}
+
+/**
+ * @brief 把编码器引脚切换为电平唤醒：每个引脚在与当前电平相反时唤醒并触发中断
+ */
+static void armWakePins()
+{
+  for (uint8_t pin : wakePins)
+  {
+    gpio_wakeup_enable((gpio_num_t)pin, digitalRead(pin) ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+  }
+  wakeArmed = true;
+}
+
+/**
+ * @brief 恢复编码器引脚的边沿中断，可在中断中调用
+ */
+static void IRAM_ATTR disarmWakePins()
+{
+  if (!wakeArmed)
+  {
+    return;
+  }
+  wakeArmed = false;
+  for (uint8_t pin : wakePins)
+  {
+    gpio_wakeup_disable((gpio_num_t)pin);
+    gpio_set_intr_type((gpio_num_t)pin, GPIO_INTR_ANYEDGE);
+  }
+}
+
+/**
+ * @brief 编码器引脚的中断：记录操作时间，空闲时唤醒调节任务
+ * @details 电平唤醒模式下中断会持续触发，先切回边沿中断。编码器的读取仍由界面轮询完成。
+ */
+static void IRAM_ATTR encoderEdgeISR()
+{
+  disarmWakePins();
+  lastActivityMs = millis();
+  if (state != POWER_ACTIVE && wakeUs == 0 && powerTaskHandle != NULL)
+  {
+    wakeUs = esp_timer_get_time();
+    wakeSource = POWER_WAKE_INPUT;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(powerTaskHandle, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+}
+
+/**
+ * @brief 渲染任务每推送一帧调用：唤醒后的第一帧记为唤醒延迟
+ */
+static void onFramePushed()
+{
+  if (wakeUs == 0 || state != POWER_ACTIVE)
+  {
+    return;
+  }
+  uint32_t ms = (uint32_t)((esp_timer_get_time() - wakeUs) / 1000);
+  wakeUs = 0;
+  if (ms > POWER_LATENCY_MAX_MS)
+  {
+    return;
+  }
+  if (latencyCount == 0 || ms < latencyMsMin) latencyMsMin = ms;
+  if (ms > latencyMsMax) latencyMsMax = ms;
+  latencyMsTotal += ms;
+  latencyCount++;
+}
+
+/**
+ * @brief 按无操作时间决定应处的状态
+ */
+static PowerState targetState(uint32_t idleMs)
+{
+  if (g_alarm_is_ringing)
+  {
+    return POWER_ACTIVE;
+  }
+  if (config.sleepAfterS && idleMs >= config.sleepAfterS * 1000UL)
+  {
+    return POWER_SLEEP;
+  }
+  if (config.dimAfterS && idleMs >= config.dimAfterS * 1000UL)
+  {
+    return POWER_DIM;
+  }
+  return POWER_ACTIVE;
+}
+
+/**
+ * @brief 距下一次因超时切换状态还有多少毫秒，没有时返回 portMAX_DELAY
+ */
+static TickType_t ticksToNextTimeout(uint32_t idleMs)
+{
+  uint32_t next = UINT32_MAX;
+  uint32_t limits[] = {config.dimAfterS * 1000UL, config.sleepAfterS * 1000UL};
+  for (uint32_t limit : limits)
+  {
+    if (limit && limit > idleMs && limit - idleMs < next)
+    {
+      next = limit - idleMs;
+    }
+  }
+  return next == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(next) + 1;
+}
+
+/**
+ * @brief 切换到新状态：背光、帧率、面板、WiFi 睡眠和自动浅睡眠
+ */
+static void applyState(PowerState to, uint8_t reason)
+{
+  PowerState from = state;
+  uint32_t now = millis();
+  stateMs[from] += now - stateSinceMs;
+  stateSinceMs = now;
+
+  powerLog[logHead] = {now, (uint8_t)from, (uint8_t)to, reason};
+  logHead = (logHead + 1) % POWER_LOG_LEN;
+  if (logCount < POWER_LOG_LEN) logCount++;
+
+  bool wifiOn = WiFi.getMode() != WIFI_OFF;
+  switch (to)
+  {
+  case POWER_ACTIVE:
+    disarmWakePins();
+    configurePm(to);
+    if (from == POWER_SLEEP) setPanelSleep(false);
+    Display_SetBlank(false);
+    Display_SetFrameInterval(DISPLAY_MIN_FRAME_MS);
+    setBacklight(255);
+    if (wifiOn) esp_wifi_set_ps(WIFI_PS_NONE);
+    if (reason < POWER_WAKE_SOURCE_COUNT) wakes[reason]++;
+    break;
+
+  case POWER_DIM:
+    disarmWakePins();
+    configurePm(to);
+    if (from == POWER_SLEEP) setPanelSleep(false);
+    Display_SetBlank(false);
+    Display_SetFrameInterval(POWER_IDLE_FRAME_MS);
+    setBacklight(config.dimDuty);
+    if (wifiOn) esp_wifi_set_ps(WIFI_PS_MIN_MODEM); // 每个 DTIM 醒来接收
+    break;
+
+  case POWER_SLEEP:
+    Display_SetFrameInterval(POWER_IDLE_FRAME_MS);
+    Display_SetBlank(true);
+    setBacklight(0);
+    setPanelSleep(true);
+    if (wifiOn) esp_wifi_set_ps(WIFI_PS_MAX_MODEM); // 按关联时的监听间隔醒来
+    armWakePins();
+    configurePm(to);
+    break;
+
+  default:
+    break;
+  }
+
+  state = to;
+  if (from == POWER_SLEEP)
+  {
+    EventBus_Publish(EVENT_WAKE, reason); // 界面循环阻塞在事件队列上，立即开始绘制
+  }
+}
+
+/**
+ * @brief 事件总线回调：闹钟停止后重新计算空闲状态，响铃期间不再需要定时检查
+ */
+static void onAlarmEvent(const AppEvent &event)
+{
+  if (powerTaskHandle != NULL)
+  {
+    xTaskNotifyGive(powerTaskHandle);
+  }
+}
+
+/**
+ * @brief 距最后一次操作的时间
+ * @details 先复制 lastActivityMs 再读 millis()：两次读取之间编码器中断更新了操作时间时，
+ *          差值不会变成负数后回绕成极大的空闲时间。
+ */
+static uint32_t idleSinceActivity()
+{
+  uint32_t last = lastActivityMs;
+  int32_t idle = (int32_t)(millis() - last);
+  return idle > 0 ? (uint32_t)idle : 0;
+}
+
+/**
+ * @brief [FreeRTOS Task] 空闲调节任务
+ * @details 平时阻塞到下一次超时切换的时刻；空闲状态下的第一次操作通过任务通知立即唤醒它。
+ *          操作活跃时不会唤醒它，到期后按最新的操作时间重新计算等待时间。
+ */
+static void Power_Task(void *pvParameters)
+{
+  for (;;)
+  {
+    uint32_t idle = idleSinceActivity();
+    PowerState target = targetState(idle);
+    if (target != state)
+    {
+      uint8_t reason = target == POWER_ACTIVE ? wakeSource : POWER_REASON_TIMEOUT;
+      applyState(target, reason);
+    }
+
+    // 响铃期间不计空闲，停止时由 EVENT_ALARM_STOP 唤醒
+    ulTaskNotifyTake(pdTRUE, ticksToNextTimeout(idle));
+  }
+}
+
+void Power_Init()
+{
+  PowerConfig saved;
+  uint8_t version = 0;
+  if (Settings_Read(SETTINGS_KEY_POWER, &saved, sizeof(saved), &version) == sizeof(saved) &&
+      version == POWER_SCHEMA_VERSION)
+  {
+    config = saved;
+  }
+
+#if POWER_BACKLIGHT_PIN >= 0
+  ledcSetup(POWER_BACKLIGHT_CHANNEL, 5000, 8);
+  ledcAttachPin(POWER_BACKLIGHT_PIN, POWER_BACKLIGHT_CHANNEL);
+  setBacklight(255);
+#endif
+
+  esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "render", &pmLocks[POWER_LOCK_RENDER]);
+  esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "push", &pmLocks[POWER_LOCK_PUSH]);
+  esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "audio", &pmLocks[POWER_LOCK_AUDIO]);
+  for (int i = 0; i < POWER_LOCK_COUNT; i++)
+  {
+    esp_timer_create_args_t args = {};
+    args.callback = onLeaseExpired;
+    args.arg = (void *)(intptr_t)i;
+    args.name = "power_lease";
+    esp_timer_create(&args, &leaseTimers[i]);
+  }
+  configurePm(POWER_ACTIVE);
+  freqSinceMs = millis();
+  esp_register_freertos_tick_hook(freqTickHook);
+
+  lastActivityMs = millis();
+  stateSinceMs = millis();
+  Display_SetFrameCallback(onFramePushed);
+
+  esp_sleep_enable_gpio_wakeup();
+  for (uint8_t pin : wakePins)
+  {
+    attachInterrupt(pin, encoderEdgeISR, CHANGE);
+  }
+  xTaskCreate(Power_Task, "Power", 3072, NULL, 4, &powerTaskHandle);
+  EventBus_Subscribe(onAlarmEvent, EVENT_MASK(EVENT_ALARM_STOP));
+}
+
+void Power_NoteActivity(PowerWakeSource source)
+{
+  lastActivityMs = millis();
+  if (state != POWER_ACTIVE && powerTaskHandle != NULL)
+  {
+    if (wakeUs == 0)
+    {
+      wakeUs = esp_timer_get_time();
+    }
+    wakeSource = source;
+    xTaskNotifyGive(powerTaskHandle);
+  }
+}
+
+PowerState Power_GetState()
+{
+  return state;
+}
+
+bool Power_IsIdle()
+{
+  return state != POWER_ACTIVE;
+}
+
+uint32_t Power_IdleWaitMs(uint32_t ms)
+{
+  return state == POWER_SLEEP ? POWER_SLEEP_POLL_MS : ms;
+}
+
+void Power_LockAcquire(PowerLock lock)
+{
+  portENTER_CRITICAL(&lockMux);
+  if (lockDepth[lock]++ == 0)
+  {
+    lockSinceUs[lock] = esp_timer_get_time();
+    lockCount[lock]++;
+  }
+  portEXIT_CRITICAL(&lockMux);
+  if (pmLocks[lock] != NULL)
+  {
+    esp_pm_lock_acquire(pmLocks[lock]);
+  }
+}
+
+void Power_LockRelease(PowerLock lock)
+{
+  portENTER_CRITICAL(&lockMux);
+  bool held = lockDepth[lock] > 0;
+  if (held && --lockDepth[lock] == 0)
+  {
+    lockHeldUs[lock] += esp_timer_get_time() - lockSinceUs[lock];
+  }
+  portEXIT_CRITICAL(&lockMux);
+  if (held && pmLocks[lock] != NULL)
+  {
+    esp_pm_lock_release(pmLocks[lock]);
+  }
+}
+
+void Power_LockFor(PowerLock lock, uint32_t ms)
+{
+  if (leaseTimers[lock] == NULL)
+  {
+    return;
+  }
+  esp_timer_stop(leaseTimers[lock]);
+  if (!leased[lock])
+  {
+    leased[lock] = true;
+    Power_LockAcquire(lock);
+  }
+  esp_timer_start_once(leaseTimers[lock], (uint64_t)ms * 1000);
+}
+
+PowerStats Power_GetStats()
+{
+  PowerStats s;
+  uint32_t now = millis();
+  s.state = state;
+  s.idleMs = idleSinceActivity();
+  memcpy(s.stateMs, stateMs, sizeof(stateMs));
+  s.stateMs[state] += now - stateSinceMs;
+  memcpy(s.wakes, wakes, sizeof(wakes));
+  s.latencyCount = latencyCount;
+  s.latencyMsMin = latencyMsMin;
+  s.latencyMsMax = latencyMsMax;
+  s.latencyMsAvg = latencyCount ? (uint32_t)(latencyMsTotal / latencyCount) : 0;
+  s.lightSleep = lightSleepOk;
+  s.dfs = dfsOk;
+
+  uint32_t ticked = 0;
+  for (int i = 0; i < POWER_FREQ_SLEEP; i++)
+  {
+    s.freqMs[i] = freqTicks[i] * portTICK_PERIOD_MS;
+    ticked += s.freqMs[i];
+  }
+  uint32_t elapsed = freqSinceMs ? now - freqSinceMs : 0;
+  s.freqMs[POWER_FREQ_SLEEP] = elapsed > ticked ? elapsed - ticked : 0;
+
+  int64_t nowUs = esp_timer_get_time();
+  portENTER_CRITICAL(&lockMux);
+  for (int i = 0; i < POWER_LOCK_COUNT; i++)
+  {
+    uint64_t held = lockHeldUs[i] + (lockDepth[i] ? nowUs - lockSinceUs[i] : 0);
+    s.lockCount[i] = lockCount[i];
+    s.lockHeldMs[i] = (uint32_t)(held / 1000);
+  }
+  portEXIT_CRITICAL(&lockMux);
+
+  uint32_t sleepMa = (lightSleepOk || !lightSleepTried) ? POWER_EST_MA_SLEEP : POWER_EST_MA_NOLS;
+  const uint32_t ma[POWER_STATE_COUNT] = {POWER_EST_MA_ACTIVE, POWER_EST_MA_DIM, sleepMa};
+  uint64_t weighted = 0, total = 0;
+  for (int i = 0; i < POWER_STATE_COUNT; i++)
+  {
+    weighted += (uint64_t)s.stateMs[i] * ma[i];
+    total += s.stateMs[i];
+  }
+  s.avgMaX10 = total ? (uint32_t)(weighted * 10 / total) : POWER_EST_MA_ACTIVE * 10;
+  return s;
+}
+
+void Power_Dump()
+{
+  PowerStats s = Power_GetStats();
+  Serial.printf("[Power] state %s, idle %lu s, dim after %u s, sleep after %u s, dim duty %u\n",
+                stateNames[s.state], (unsigned long)(s.idleMs / 1000), config.dimAfterS, config.sleepAfterS,
+                config.dimDuty);
+  Serial.printf("[Power] backlight %s, auto light sleep %s\n",
+                POWER_BACKLIGHT_PIN >= 0 ? "LEDC" : "fixed (panel sleep only)",
+                !lightSleepTried ? "not tried yet" : (s.lightSleep ? "on" : "unavailable"));
+
+  uint32_t total = 0;
+  for (int i = 0; i < POWER_STATE_COUNT; i++) total += s.stateMs[i];
+  for (int i = 0; i < POWER_STATE_COUNT; i++)
+  {
+    Serial.printf("[Power] %-6s %8lu s %3lu%%\n", stateNames[i], (unsigned long)(s.stateMs[i] / 1000),
+                  (unsigned long)(total ? (uint64_t)s.stateMs[i] * 100 / total : 0));
+  }
+  Serial.printf("[Power] est. average current %lu.%lu mA (per-state estimates in Power.h)\n",
+                (unsigned long)(s.avgMaX10 / 10), (unsigned long)(s.avgMaX10 % 10));
+
+  Serial.printf("[Power] dfs %s (%d-%d MHz)\n", s.dfs ? "on" : (dfsOn ? "unavailable" : "off"),
+                dfsOn ? (s.state == POWER_ACTIVE ? POWER_CPU_ACTIVE_MIN_MHZ : POWER_CPU_IDLE_MIN_MHZ) : POWER_CPU_MAX_MHZ,
+                POWER_CPU_MAX_MHZ);
+  uint32_t freqTotal = 0;
+  for (int i = 0; i < POWER_FREQ_COUNT; i++) freqTotal += s.freqMs[i];
+  for (int i = 0; i < POWER_FREQ_COUNT; i++)
+  {
+    Serial.printf("[Power] %-6s %8lu s %3lu%%\n", freqNames[i], (unsigned long)(s.freqMs[i] / 1000),
+                  (unsigned long)(freqTotal ? (uint64_t)s.freqMs[i] * 100 / freqTotal : 0));
+  }
+  for (int i = 0; i < POWER_LOCK_COUNT; i++)
+  {
+    Serial.printf("[Power] lock %-6s %8lu times, held %lu ms\n", lockNames[i], (unsigned long)s.lockCount[i],
+                  (unsigned long)s.lockHeldMs[i]);
+  }
+  ProfilerStats ps = Profiler_GetStats();
+  Serial.printf("[Power] frames %lu: work avg %lu us max %lu us, push avg %lu us, %lu.%lu fps\n",
+                (unsigned long)ps.frames, (unsigned long)ps.stage[PROF_STAGE_FRAME].avgUs,
+                (unsigned long)ps.stage[PROF_STAGE_FRAME].maxUs, (unsigned long)ps.stage[PROF_STAGE_PUSH].avgUs,
+                (unsigned long)(ps.fpsX10 / 10), (unsigned long)(ps.fpsX10 % 10));
+
+  Serial.printf("[Power] wakes: input %lu, alarm %lu, mqtt %lu, command %lu\n",
+                (unsigned long)s.wakes[POWER_WAKE_INPUT], (unsigned long)s.wakes[POWER_WAKE_ALARM],
+                (unsigned long)s.wakes[POWER_WAKE_MQTT], (unsigned long)s.wakes[POWER_WAKE_COMMAND]);
+  Serial.printf("[Power] wake-to-first-frame: %lu samples, min %lu ms, avg %lu ms, max %lu ms\n",
+                (unsigned long)s.latencyCount, (unsigned long)s.latencyMsMin, (unsigned long)s.latencyMsAvg,
+                (unsigned long)s.latencyMsMax);
+
+  time_t nextAlarm = Alarm_GetNextFireTime();
+  if (nextAlarm)
+  {
+    Serial.printf("[Power] next alarm in %ld s\n", (long)(nextAlarm - time(NULL)));
+  }
+
+  uint8_t start = (logHead + POWER_LOG_LEN - logCount) % POWER_LOG_LEN;
+  for (uint8_t i = 0; i < logCount; i++)
+  {
+    const PowerLogEntry &e = powerLog[(start + i) % POWER_LOG_LEN];
+    Serial.printf("[Power] %10lu ms  %s -> %s (%s)\n", (unsigned long)e.atMs, stateNames[e.from], stateNames[e.to],
+                  e.reason < POWER_WAKE_SOURCE_COUNT ? sourceNames[e.reason] : "timeout");
+  }
+}
+
+/**
+ * @brief 保存空闲时间设置并按新设置重新判断状态
+ */
+static void saveConfig()
+{
+  Settings_Write(SETTINGS_KEY_POWER, POWER_SCHEMA_VERSION, &config, sizeof(config));
+  if (powerTaskHandle != NULL)
+  {
+    xTaskNotifyGive(powerTaskHandle);
+  }
+}
+
+bool Power_HandleCommand(const char *line)
+{
+  if (strncmp(line, "power", 5) != 0)
+  {
+    return false;
+  }
+  const char *arg = line + 5;
+  while (*arg == ' ') arg++;
+
+  unsigned dimS, sleepS, duty;
+  if (sscanf(arg, "idle %u %u", &dimS, &sleepS) == 2)
+  {
+    config.dimAfterS = dimS;
+    config.sleepAfterS = sleepS;
+    saveConfig();
+    Serial.printf("[Power] dim after %u s, sleep after %u s\n", dimS, sleepS);
+  }
+  else if (sscanf(arg, "duty %u", &duty) == 1)
+  {
+    config.dimDuty = duty > 255 ? 255 : duty;
+    saveConfig();
+    Serial.printf("[Power] dim duty %u\n", config.dimDuty);
+  }
+  else if (strncmp(arg, "sleep", 5) == 0)
+  {
+    if (config.sleepAfterS && powerTaskHandle != NULL)
+    {
+      lastActivityMs = millis() - config.sleepAfterS * 1000UL;
+      xTaskNotifyGive(powerTaskHandle);
+    }
+  }
+  else if (strncmp(arg, "dfs", 3) == 0)
+  {
+    dfsOn = strstr(arg, "off") == NULL;
+    configurePm(state);
+    Profiler_Reset();
+    Display_ResetStats();
+    Serial.printf("[Power] dfs %s, frame stats reset\n", dfsOk ? "on" : (dfsOn ? "unavailable" : "off"));
+  }
+  else if (strncmp(arg, "wake", 4) == 0)
+  {
+    Power_NoteActivity(POWER_WAKE_COMMAND);
+  }
+  else if (strncmp(arg, "locks", 5) == 0)
+  {
+    // 列出所有电源管理锁 (包括驱动创建的) 及其持有状态，空闲时不应有锁被持有
+    Serial.flush();
+    esp_pm_dump_locks(stdout);
+    fflush(stdout);
+  }
+  else
+  {
+    Power_Dump();
+  }
+  return true;
+}
@@ -0,0 +1,170 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define POWER_DIM_AFTER_S     60   // 默认无操作多少秒后调暗背光并降到低帧率，0 表示不调暗
+#define POWER_SLEEP_AFTER_S   300  // 默认无操作多少秒后熄屏并允许自动浅睡眠，0 表示不熄屏
+#define POWER_DIM_DUTY        40   // 调暗时的背光亮度 (0~255)
+#define POWER_IDLE_FRAME_MS   500  // 调暗和熄屏时的帧间隔，须小于 DISPLAY_PRESENT_TIMEOUT_MS
+#define POWER_SLEEP_POLL_MS   1000 // 熄屏时界面循环的最长阻塞时间
+#define POWER_LOG_LEN         16   // 电源日志保留的最近状态切换条数
+#define POWER_LATENCY_MAX_MS  2000 // 唤醒后超过这么久才出现的帧不计入唤醒延迟 (界面没有重绘)
+#define POWER_BACKLIGHT_CHANNEL 2  // 背光使用的 LEDC 通道，tone() 占用通道0
+
+#ifdef TFT_BL
+#define POWER_BACKLIGHT_PIN TFT_BL
+#else
+#define POWER_BACKLIGHT_PIN -1 // 背光直接接电源，无法调光，熄屏时只让面板进入睡眠
+#endif
+
+#define POWER_DFS_DEFAULT        1   // 开机时是否启用动态调频，可用串口命令 "power dfs on|off" 切换对比
+#define POWER_CPU_MAX_MHZ        160 // 持有性能锁时的CPU频率
+#define POWER_CPU_ACTIVE_MIN_MHZ 80  // 有人操作时的最低频率，APB 保持 80MHz，直接绘制 tft 的代码和按键音不受影响
+#define POWER_CPU_IDLE_MIN_MHZ   40  // 调暗和熄屏时的最低频率 (晶振直接驱动)
+#define POWER_AUDIO_HOLD_MS      100 // 音符结束后音频锁多保持的时间，连续的音符之间不释放
+
+// 各状态的估算电流 (mA)，电源日志按各状态停留时间加权得到平均电流。用电流表实测后改成实际值
+#define POWER_EST_MA_ACTIVE   85 // 80~160MHz、WiFi 常开、背光全亮
+#define POWER_EST_MA_DIM      45 // 背光调暗、2fps、WiFi 按 DTIM 睡眠
+#define POWER_EST_MA_SLEEP    8  // 自动浅睡眠、WiFi 按监听间隔醒来、面板睡眠
+#define POWER_EST_MA_NOLS     30 // 熄屏但自动浅睡眠不可用 (固件未开启 tickless idle)
+
+/**
+ * @brief 空闲调节器的状态，按无操作时间依次进入。
+ */
+enum PowerState
+{
+    POWER_ACTIVE, ///< 正常亮度和帧率，WiFi 不睡眠。
+    POWER_DIM,    ///< 背光调暗，所有界面降到 POWER_IDLE_FRAME_MS 一帧，WiFi 按 DTIM 睡眠。
+    POWER_SLEEP,  ///< 熄屏丢弃画面，WiFi 按监听间隔睡眠，CPU 空闲时自动浅睡眠。
+    POWER_STATE_COUNT
+};
+
+/**
+ * @brief 回到 POWER_ACTIVE 的原因。
+ */
+enum PowerWakeSource
+{
+    POWER_WAKE_INPUT,   ///< 旋转编码器或按钮。
+    POWER_WAKE_ALARM,   ///< 闹钟响铃。
+    POWER_WAKE_MQTT,    ///< 收到MQTT下行消息。
+    POWER_WAKE_COMMAND, ///< 串口命令 "power wake"。
+    POWER_WAKE_SOURCE_COUNT
+};
+
+/**
+ * @brief 性能锁：持有期间CPU不降频。
+ */
+enum PowerLock
+{
+    POWER_LOCK_RENDER, ///< UI 任务计算和绘制一帧 (Profiler_FrameBegin 到 Profiler_FrameEnd)，锁定最高频率。
+    POWER_LOCK_PUSH,   ///< 渲染任务向屏幕推送，锁定最高频率；SPI 时钟由 APB 分频，也不能降。
+    POWER_LOCK_AUDIO,  ///< 播放音符，锁定 APB 80MHz：蜂鸣器 LEDC 的分频按 80MHz 计算，降频会让音调变低。
+    POWER_LOCK_COUNT
+};
+
+/**
+ * @brief CPU 频率分布的统计档位。
+ */
+enum PowerFreq
+{
+    POWER_FREQ_160, ///< 160MHz
+    POWER_FREQ_80,  ///< 80MHz
+    POWER_FREQ_40,  ///< 40MHz 及以下
+    POWER_FREQ_SLEEP, ///< 浅睡眠 (没有系统节拍的时间)
+    POWER_FREQ_COUNT
+};
+
+/**
+ * @brief 电源统计。
+ */
+struct PowerStats
+{
+    PowerState state;                          ///< 当前状态。
+    uint32_t idleMs;                           ///< 距最近一次操作的时间。
+    uint32_t stateMs[POWER_STATE_COUNT];       ///< 开机以来在各状态停留的总时间。
+    uint32_t wakes[POWER_WAKE_SOURCE_COUNT];   ///< 按原因统计的唤醒次数。
+    uint32_t latencyCount;                     ///< 测得唤醒延迟的次数。
+    uint32_t latencyMsMin;                     ///< 从唤醒输入到第一帧推送完成的最短时间。
+    uint32_t latencyMsAvg;                     ///< 平均唤醒延迟。
+    uint32_t latencyMsMax;                     ///< 最长唤醒延迟。
+    uint32_t avgMaX10;                         ///< 按估算电流加权的平均电流 (mA x10)。
+    bool lightSleep;                           ///< 自动浅睡眠是否可用。
+    bool dfs;                                  ///< 动态调频是否生效。
+    uint32_t freqMs[POWER_FREQ_COUNT];         ///< 按每个系统节拍采样的CPU频率分布 (毫秒)。
+    uint32_t lockCount[POWER_LOCK_COUNT];      ///< 各性能锁从空闲到持有的次数。
+    uint32_t lockHeldMs[POWER_LOCK_COUNT];     ///< 各性能锁被持有的总时间。
+};
+
+/**
+ * @brief 启动空闲调节器。
+ * @details 读取保存的空闲时间设置，在编码器引脚上挂接边沿中断记录操作，启动调节任务。
+ *          应在 Display_Init 之后、启动完成时调用，启动过程本身不计入空闲时间。
+ */
+void Power_Init();
+
+/**
+ * @brief 记录一次用户或远程操作，空闲时立即恢复到 POWER_ACTIVE。
+ * @details 编码器由中断自动记录，其他来源 (闹钟、MQTT) 由各模块调用。
+ */
+void Power_NoteActivity(PowerWakeSource source);
+
+/**
+ * @brief 当前状态。
+ */
+PowerState Power_GetState();
+
+/**
+ * @brief 是否处于调暗或熄屏状态，后台任务据此降低轮询和上报频率。
+ */
+bool Power_IsIdle();
+
+/**
+ * @brief 界面循环在事件队列上的等待时间。
+ * @details 熄屏时返回 POWER_SLEEP_POLL_MS，让CPU能长时间浅睡眠，唤醒时由 EVENT_WAKE 立即结束等待；其他状态返回 ms。
+ */
+uint32_t Power_IdleWaitMs(uint32_t ms);
+
+/**
+ * @brief 获取性能锁，可重入，与 Power_LockRelease 成对调用。
+ * @details Power_Init 之前调用不起作用 (此时频率固定为最高)。
+ */
+void Power_LockAcquire(PowerLock lock);
+
+/**
+ * @brief 释放性能锁。
+ */
+void Power_LockRelease(PowerLock lock);
+
+/**
+ * @brief 持有性能锁 ms 毫秒，期间再次调用则从当前时刻重新计时。
+ * @details 用于可能被其他任务直接 vTaskDelete 的播放任务：即使任务中途被删除，锁也会按时释放。
+ */
+void Power_LockFor(PowerLock lock, uint32_t ms);
+
+/**
+ * @brief 获取电源统计。
+ */
+PowerStats Power_GetStats();
+
+/**
+ * @brief 在串口输出电源日志：设置、各状态停留时间、估算电流、CPU频率分布、性能锁、
+ *        当前帧耗时、唤醒延迟和最近的状态切换。
+ */
+void Power_Dump();
+
+/**
+ * @brief 处理串口命令 "power"。
+ * @details power                     输出电源日志
+ *          power idle <调暗秒> <熄屏秒>  修改并保存空闲时间
+ *          power duty <0~255>         修改并保存调暗亮度
+ *          power sleep | power wake   立即熄屏 / 唤醒，用于测量
+ *          power dfs on|off           开关动态调频，同时清零帧统计，便于用 "prof" 对比帧耗时
+ *          power locks                列出电源管理锁 (esp_pm_dump_locks)，确认空闲时没有驱动阻止调频和浅睡眠
+ * @return 是电源命令时返回 true。
+ */
+bool Power_HandleCommand(const char *line);
+
+#endif // POWER_H
@@ -0,0 +1,227 @@
+// 包含所有必需的头文件
+#include "Profiler.h"
+#include "Display.h"
+#include "Memory.h"
+#include "Power.h"
+#include <esp_heap_caps.h>
+
+#define FRAME_GAP_US   1000000 // 两帧间隔超过1秒视为重新开始 (切换界面、阻塞的同步)
+#define OVERLAY_WIDTH  84
+#define OVERLAY_HEIGHT 36
+
+// 直方图各桶的上界 (微秒)，最后一桶不设上界
+static const uint32_t bucketUs[PROFILER_BUCKETS - 1] = {250, 500, 1000, 2000, 4000, 8000, 16000, 33000, 66000};
+static const char *const bucketNames[PROFILER_BUCKETS] = {"<250u", "<500u", "<1m", "<2m", "<4m", "<8m", "<16m", "<33m", "<66m", ">66m"};
+static const char *const stageNames[PROF_STAGE_COUNT] = {"sim", "draw", "push", "frame"};
+
+// --- 全局变量 ---
+static ProfilerStats stats;
+static uint32_t windowCount[PROF_STAGE_COUNT]; // 当前窗口内的采样数
+static uint32_t windowMax[PROF_STAGE_COUNT];   // 上一个窗口的最长耗时
+static bool overlayOn = PROFILER_OVERLAY_DEFAULT;
+static TaskHandle_t frameTask = NULL; // 调用 Profiler_FrameBegin 的任务
+static bool frameOpen = false;
+static uint32_t frameStart = 0;
+static uint32_t lastFrameStart = 0;
+static bool lastFrameValid = false;
+static uint32_t frameUs[PROF_STAGE_COUNT]; // 当前帧内各阶段累计的耗时
+static bool renderLocked = false;          // 帧内持有 POWER_LOCK_RENDER
+
+/**
+ * @brief 记录一次采样
+ */
+static void record(ProfStage stage, uint32_t us)
+{
+  ProfStageStats &s = stats.stage[stage];
+  if (++windowCount[stage] > PROFILER_WINDOW)
+  {
+    // 滚动窗口：旧的采样逐次减半
+    for (int i = 0; i < PROFILER_BUCKETS; i++) s.hist[i] >>= 1;
+    windowMax[stage] = s.maxUs;
+    s.maxUs = 0;
+    windowCount[stage] = 1;
+  }
+
+  int bucket = 0;
+  while (bucket < PROFILER_BUCKETS - 1 && us >= bucketUs[bucket]) bucket++;
+  if (s.hist[bucket] < UINT16_MAX) s.hist[bucket]++;
+
+  s.avgUs = s.count ? s.avgUs + ((int32_t)us - (int32_t)s.avgUs) / 16 : us;
+  s.count++;
+  s.lastUs = us;
+  if (us > s.maxUs) s.maxUs = us;
+}
+
+void Profiler_Add(ProfStage stage, uint32_t us)
+{
+#if PROFILER_ENABLE
+  if (xTaskGetCurrentTaskHandle() != frameTask) return;
+  if (frameOpen) frameUs[stage] += us;
+  else record(stage, us);
+#endif
+}
+
+void Profiler_FrameBegin()
+{
+  if (!renderLocked)
+  {
+    Power_LockAcquire(POWER_LOCK_RENDER);
+    renderLocked = true;
+  }
+#if PROFILER_ENABLE
+  uint32_t now = Profiler_Now();
+  frameTask = xTaskGetCurrentTaskHandle();
+
+  uint32_t intervalUs = now - lastFrameStart;
+  if (lastFrameValid && intervalUs < FRAME_GAP_US)
+  {
+    stats.intervalUs = stats.intervalUs ? stats.intervalUs + ((int32_t)intervalUs - (int32_t)stats.intervalUs) / 16 : intervalUs;
+    stats.fpsX10 = stats.intervalUs ? 10000000 / stats.intervalUs : 0;
+  }
+  lastFrameStart = now;
+  lastFrameValid = true;
+
+  memset(frameUs, 0, sizeof(frameUs));
+  frameStart = now;
+  frameOpen = true;
+#endif
+}
+
+void Profiler_FrameEnd(uint32_t budgetMs)
+{
+  if (renderLocked)
+  {
+    Power_LockRelease(POWER_LOCK_RENDER);
+    renderLocked = false;
+  }
+#if PROFILER_ENABLE
+  if (!frameOpen || xTaskGetCurrentTaskHandle() != frameTask) return;
+  frameOpen = false;
+
+  uint32_t work = Profiler_Now() - frameStart;
+  uint32_t other = frameUs[PROF_STAGE_SIM] + frameUs[PROF_STAGE_PUSH];
+  frameUs[PROF_STAGE_DRAW] += work > other ? work - other : 0;
+  frameUs[PROF_STAGE_FRAME] = work;
+
+  for (int i = 0; i < PROF_STAGE_COUNT; i++)
+  {
+    // 没有标注模拟的表盘不记录 sim，避免直方图被0填满
+    if (i == PROF_STAGE_SIM && frameUs[i] == 0) continue;
+    record((ProfStage)i, frameUs[i]);
+  }
+  stats.frames++;
+  if (work > budgetMs * 1000) stats.missed++;
+#endif
+}
+
+void Profiler_SetOverlay(bool on)
+{
+  overlayOn = on;
+}
+
+bool Profiler_OverlayEnabled()
+{
+  return overlayOn;
+}
+
+void Profiler_DrawOverlay(TFT_eSprite &sprite)
+{
+  // 保存调用者的文字设置
+  uint8_t font = sprite.textfont, size = sprite.textsize, datum = sprite.textdatum;
+  uint32_t fg = sprite.textcolor, bg = sprite.textbgcolor;
+
+  DisplayStats ds = Display_GetStats();
+  char line[24];
+  sprite.fillRect(0, 0, OVERLAY_WIDTH, OVERLAY_HEIGHT, TFT_BLACK);
+  sprite.setTextFont(1);
+  sprite.setTextSize(1);
+  sprite.setTextDatum(TL_DATUM);
+  sprite.setTextColor(TFT_GREEN, TFT_BLACK);
+  snprintf(line, sizeof(line), "fps %lu.%lu", (unsigned long)(stats.fpsX10 / 10), (unsigned long)(stats.fpsX10 % 10));
+  sprite.drawString(line, 2, 2);
+  snprintf(line, sizeof(line), "frame %lu.%lums", (unsigned long)(stats.stage[PROF_STAGE_FRAME].avgUs / 1000),
+           (unsigned long)(stats.stage[PROF_STAGE_FRAME].avgUs / 100 % 10));
+  sprite.drawString(line, 2, 10);
+  snprintf(line, sizeof(line), "push %lu.%lums", (unsigned long)(ds.pushUsAvg / 1000), (unsigned long)(ds.pushUsAvg / 100 % 10));
+  sprite.drawString(line, 2, 18);
+  snprintf(line, sizeof(line), "heap %luk", (unsigned long)(heap_caps_get_free_size(MALLOC_CAP_8BIT) / 1024));
+  sprite.drawString(line, 2, 26);
+
+  sprite.setTextFont(font);
+  sprite.setTextSize(size);
+  sprite.setTextDatum(datum);
+  sprite.setTextColor(fg, bg);
+}
+
+ProfilerStats Profiler_GetStats()
+{
+  ProfilerStats s = stats;
+  for (int i = 0; i < PROF_STAGE_COUNT; i++)
+  {
+    if (windowMax[i] > s.stage[i].maxUs) s.stage[i].maxUs = windowMax[i];
+  }
+  return s;
+}
+
+void Profiler_Reset()
+{
+  memset(&stats, 0, sizeof(stats));
+  memset(windowCount, 0, sizeof(windowCount));
+  memset(windowMax, 0, sizeof(windowMax));
+  lastFrameValid = false;
+  frameOpen = false;
+}
+
+void Profiler_Dump()
+{
+  ProfilerStats s = Profiler_GetStats();
+  uint32_t missPct = s.frames ? s.missed * 1000 / s.frames : 0;
+  Serial.printf("[Prof] frames %lu missed %lu (%lu.%lu%%) fps %lu.%lu\n", (unsigned long)s.frames, (unsigned long)s.missed,
+                (unsigned long)(missPct / 10), (unsigned long)(missPct % 10),
+                (unsigned long)(s.fpsX10 / 10), (unsigned long)(s.fpsX10 % 10));
+
+  Serial.print("[Prof] stage      n   last    avg    max |");
+  for (int i = 0; i < PROFILER_BUCKETS; i++) Serial.printf(" %5s", bucketNames[i]);
+  Serial.println();
+  for (int i = 0; i < PROF_STAGE_COUNT; i++)
+  {
+    const ProfStageStats &st = s.stage[i];
+    Serial.printf("[Prof] %-5s %6lu %6lu %6lu %6lu |", stageNames[i], (unsigned long)st.count,
+                  (unsigned long)st.lastUs, (unsigned long)st.avgUs, (unsigned long)st.maxUs);
+    for (int b = 0; b < PROFILER_BUCKETS; b++) Serial.printf(" %5u", st.hist[b]);
+    Serial.println();
+  }
+
+  DisplayStats ds = Display_GetStats();
+  Serial.printf("[Prof] display frames %lu spi avg %luus max %luus bytes avg %lu full %lu\n",
+                (unsigned long)ds.frames, (unsigned long)ds.pushUsAvg, (unsigned long)ds.pushUsMax,
+                (unsigned long)ds.bytesAvg, (unsigned long)ds.fullFrames);
+  Heap_Log("prof");
+}
+
+bool Profiler_HandleCommand(const char *line)
+{
+  if (strncmp(line, "prof", 4) != 0)
+  {
+    return false;
+  }
+  const char *arg = line + 4;
+  while (*arg == ' ') arg++;
+
+  if (strncmp(arg, "reset", 5) == 0)
+  {
+    Profiler_Reset();
+    Display_ResetStats();
+    Serial.println("[Prof] reset");
+  }
+  else if (strncmp(arg, "overlay", 7) == 0)
+  {
+    Profiler_SetOverlay(!overlayOn);
+    Serial.printf("[Prof] overlay %s\n", overlayOn ? "on" : "off");
+  }
+  else
+  {
+    Profiler_Dump();
+  }
+  return true;
+}
@@ -0,0 +1,132 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <esp_timer.h>
+
+#define PROFILER_ENABLE          1   // 置0则 PROF_SCOPE 和帧计时全部编译为空
+#define PROFILER_OVERLAY_DEFAULT 0   // 开机时是否显示性能浮层，运行中可用串口命令 "prof overlay" 切换
+#define PROFILER_WINDOW          256 // 每个阶段累计这么多次采样后直方图减半，只反映最近的情况
+#define PROFILER_BUCKETS         10  // 直方图桶数，上界见 Profiler.cpp 中的 bucketUs
+
+/**
+ * @brief 一帧中分别计时的阶段。
+ */
+enum ProfStage
+{
+    PROF_STAGE_SIM,   ///< 模拟 (粒子、物理、几何变换)，由 PROF_SCOPE 标注。
+    PROF_STAGE_DRAW,  ///< 绘制到 menuSprite：整帧工作时间减去模拟和推送。
+    PROF_STAGE_PUSH,  ///< 在 Display_Present 中等待推送完成的时间。
+    PROF_STAGE_FRAME, ///< 整帧工作时间，从 Profiler_FrameBegin 到 Profiler_FrameEnd。
+    PROF_STAGE_COUNT
+};
+
+/**
+ * @brief 单个阶段的耗时统计。
+ */
+struct ProfStageStats
+{
+    uint32_t count;                     ///< 总采样次数。
+    uint32_t lastUs;                    ///< 最近一次耗时 (微秒)。
+    uint32_t avgUs;                     ///< 滑动平均耗时 (微秒)。
+    uint32_t maxUs;                     ///< 最近一到两个窗口内的最长耗时 (微秒)。
+    uint16_t hist[PROFILER_BUCKETS];    ///< 滚动直方图，旧的采样按窗口逐次减半。
+};
+
+/**
+ * @brief 帧统计。
+ */
+struct ProfilerStats
+{
+    uint32_t frames;                            ///< 完成的帧数。
+    uint32_t missed;                            ///< 工作时间超过预算的帧数。
+    uint32_t intervalUs;                        ///< 滑动平均帧间隔 (微秒)。
+    uint32_t fpsX10;                            ///< 帧率 x10。
+    ProfStageStats stage[PROF_STAGE_COUNT];
+};
+
+/**
+ * @brief 读取微秒计时器。
+ * @details 动态调频下CPU频率在一帧之内也会变化，周期计数无法换算成时间，所以统一用 esp_timer 计时。
+ */
+static inline uint32_t Profiler_Now()
+{
+    return (uint32_t)esp_timer_get_time();
+}
+
+/**
+ * @brief 把一段耗时 (Profiler_Now 的差值，微秒) 计入某个阶段。
+ * @details 在帧内调用时先累加到当前帧，Profiler_FrameEnd 时统一记录；帧外直接记录。
+ *          只统计 UI 任务 (调用 Profiler_FrameBegin 的任务)，其他任务的调用被忽略。
+ */
+void Profiler_Add(ProfStage stage, uint32_t us);
+
+/**
+ * @brief 开始一帧的计时，放在动画循环中读取输入、处理退出之后，开始计算和绘制之前。
+ * @details 上一帧没有结束 (如中途 return) 时直接丢弃。
+ *          同时获取 POWER_LOCK_RENDER，计算和绘制期间CPU保持最高频率，到 Profiler_FrameEnd 释放。
+ */
+void Profiler_FrameBegin();
+
+/**
+ * @brief 结束一帧的计时，放在 Display_Present 之后、循环的 vTaskDelay 之前。
+ * @param budgetMs 本帧的预算，一般等于循环随后的延时：工作时间超过它说明帧率已不到设计值的一半，
+ *                 记为一次超预算。
+ */
+void Profiler_FrameEnd(uint32_t budgetMs);
+
+/**
+ * @brief 开关性能浮层。开启后 Display_Present 在推送前把帧率、帧耗时、推送耗时和空闲堆画在左上角。
+ */
+void Profiler_SetOverlay(bool on);
+
+/**
+ * @brief 性能浮层是否开启。
+ */
+bool Profiler_OverlayEnabled();
+
+/**
+ * @brief 在精灵左上角绘制性能浮层，不改变精灵的文字设置。
+ */
+void Profiler_DrawOverlay(TFT_eSprite &sprite);
+
+/**
+ * @brief 获取帧统计。
+ */
+ProfilerStats Profiler_GetStats();
+
+/**
+ * @brief 清零帧统计。
+ */
+void Profiler_Reset();
+
+/**
+ * @brief 在串口输出各阶段的耗时表和直方图，以及渲染任务和堆内存统计。
+ */
+void Profiler_Dump();
+
+/**
+ * @brief 处理串口文本命令："prof" 输出统计，"prof reset" 清零，"prof overlay" 切换浮层。
+ * @return 是 prof 命令时返回true。
+ */
+bool Profiler_HandleCommand(const char *line);
+
+/**
+ * @brief 作用域计时器：构造时读取计时器，析构时计入指定阶段。
+ */
+struct ProfScope
+{
+    ProfStage stage;
+    uint32_t start;
+    ProfScope(ProfStage s) : stage(s), start(Profiler_Now()) {}
+    ~ProfScope() { Profiler_Add(stage, Profiler_Now() - start); }
+};
+
+#if PROFILER_ENABLE
+#define PROF_SCOPE(stage) ProfScope profScope(stage) // 每个作用域只能使用一次
+#else
+#define PROF_SCOPE(stage)
+#endif
+
+#endif // PROFILER_H
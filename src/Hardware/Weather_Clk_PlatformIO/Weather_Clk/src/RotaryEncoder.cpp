@@ -1,6 +1,7 @@
 #include "RotaryEncoder.h"
 #include <TFT_eSPI.h>
 #include "Menu.h"
+#include "Display.h"
 
 // --- 旋转编码器状态变量 ---
 static volatile int encoderPos = 0; // 编码器的绝对位置（累加值）
@@ -142,7 +143,7 @@ bool readButtonLongPress()
 
       menuSprite.drawRect(BAR_X, BAR_Y, BAR_WIDTH, BAR_HEIGHT, TFT_WHITE);
       menuSprite.fillRect(BAR_X + 2, BAR_Y + 2, (int) ((BAR_WIDTH - 4) * progress), BAR_HEIGHT - 4, TFT_BLUE);
-      menuSprite.pushSprite(0, 0);
+      Display_Present();
     }
 
     // 检查是否达到长按阈值
@@ -160,7 +161,7 @@ bool readButtonLongPress()
     if (millis() - buttonPressStartTime < longPressThreshold && millis() - buttonPressStartTime > progressBarStartTime)
     {
       menuSprite.fillRect(BAR_X, BAR_Y, BAR_WIDTH, BAR_HEIGHT, TFT_BLACK); // 用背景色覆盖
-      menuSprite.pushSprite(0, 0);
+      Display_Present();
     }
   }
 
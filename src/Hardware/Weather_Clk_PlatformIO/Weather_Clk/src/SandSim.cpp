@@ -0,0 +1,173 @@
+// 包含所有必需的头文件
+#include "SandSim.h"
+
+// 最后一个字中超出 SAND_COLS 的位视为“已占用”，沙粒不会落到区域之外
+#define SAND_LAST_WORD_MASK ((SAND_COLS % 32) ? ((1UL << (SAND_COLS % 32)) - 1) : 0xFFFFFFFFUL)
+
+// --- 全局变量 ---
+static uint32_t sandGrid[SAND_ROWS][SAND_ROW_WORDS]; // 按位存储的网格，第x列对应第 x/32 个字的第 x%32 位
+static uint8_t activeRows[SAND_ROWS];                // 本步需要处理的行
+static uint8_t nextActiveRows[SAND_ROWS];            // 下一步需要处理的行
+static uint8_t dirtyRows[SAND_ROWS];                 // 内容发生变化、需要重绘的行
+
+void SandSim_Init()
+{
+  memset(sandGrid, 0, sizeof(sandGrid));
+  memset(activeRows, 0, sizeof(activeRows));
+  memset(nextActiveRows, 0, sizeof(nextActiveRows));
+  memset(dirtyRows, 1, sizeof(dirtyRows));
+}
+
+bool SandSim_Spawn(int x)
+{
+  if (x < 0 || x >= SAND_COLS)
+  {
+    return false;
+  }
+  uint32_t bit = 1UL << (x & 31);
+  if (sandGrid[0][x >> 5] & bit)
+  {
+    return false;
+  }
+  sandGrid[0][x >> 5] |= bit;
+  activeRows[0] = 1;
+  dirtyRows[0] = 1;
+  return true;
+}
+
+/**
+ * @brief 计算下一行中空位的位图 (区域外的位为0，即不可进入)
+ */
+static inline uint32_t emptyWord(const uint32_t *row, int w)
+{
+  uint32_t empty = ~row[w];
+  if (w == SAND_ROW_WORDS - 1)
+  {
+    empty &= SAND_LAST_WORD_MASK;
+  }
+  return empty;
+}
+
+/**
+ * @brief 处理第 y 行的沙粒向第 y+1 行移动
+ * @return 是否有沙粒移动
+ */
+static bool stepRow(int y)
+{
+  uint32_t *cur = sandGrid[y];
+  uint32_t *below = sandGrid[y + 1];
+  uint32_t moved = 0;
+
+  // 1. 正下方为空则直接下落
+  for (int w = 0; w < SAND_ROW_WORDS; w++)
+  {
+    uint32_t down = cur[w] & emptyWord(below, w);
+    below[w] |= down;
+    cur[w] &= ~down;
+    moved |= down;
+  }
+
+  // 2. 左下方为空则落向左下 (第x列的沙粒看下一行第x-1列)
+  uint32_t carryIn = 0; // 左移时从更低的字移入的最高位
+  for (int w = 0; w < SAND_ROW_WORDS; w++)
+  {
+    uint32_t emptyLeft = (emptyWord(below, w) << 1) | carryIn;
+    carryIn = emptyWord(below, w) >> 31;
+    uint32_t left = cur[w] & emptyLeft;
+    if (left)
+    {
+      cur[w] &= ~left;
+      below[w] |= left >> 1;
+      if (w > 0)
+      {
+        below[w - 1] |= (left & 1) << 31; // 第0位落到前一个字的最高位
+      }
+      moved |= left;
+    }
+  }
+
+  // 3. 右下方为空则落向右下 (第x列的沙粒看下一行第x+1列)
+  for (int w = 0; w < SAND_ROW_WORDS; w++)
+  {
+    uint32_t emptyRight = emptyWord(below, w) >> 1;
+    if (w + 1 < SAND_ROW_WORDS)
+    {
+      emptyRight |= emptyWord(below, w + 1) << 31;
+    }
+    uint32_t right = cur[w] & emptyRight;
+    if (right)
+    {
+      cur[w] &= ~right;
+      below[w] |= right << 1;
+      if (w + 1 < SAND_ROW_WORDS)
+      {
+        below[w + 1] |= right >> 31; // 最高位落到后一个字的第0位
+      }
+      moved |= right;
+    }
+  }
+
+  return moved != 0;
+}
+
+bool SandSim_Step()
+{
+  bool anyMoved = false;
+  memset(nextActiveRows, 0, sizeof(nextActiveRows));
+
+  // 自下而上处理，本步刚落到下一行的沙粒不会在同一步内再次移动
+  for (int y = SAND_ROWS - 2; y >= 0; y--)
+  {
+    if (!activeRows[y])
+    {
+      continue; // 已经静止的行直接跳过
+    }
+    if (stepRow(y))
+    {
+      anyMoved = true;
+      dirtyRows[y] = 1;
+      dirtyRows[y + 1] = 1;
+      // 移动的沙粒下一步可能继续下落，上一行的沙粒可能落入空出来的位置
+      nextActiveRows[y] = 1;
+      if (y + 1 < SAND_ROWS - 1) nextActiveRows[y + 1] = 1;
+      if (y > 0) nextActiveRows[y - 1] = 1;
+    }
+  }
+
+  memcpy(activeRows, nextActiveRows, sizeof(activeRows));
+  return anyMoved;
+}
+
+void SandSim_Render(TFT_eSprite *sprite, uint16_t color, uint16_t bgColor, bool full)
+{
+  for (int y = 0; y < SAND_ROWS; y++)
+  {
+    if (!full && !dirtyRows[y])
+    {
+      continue;
+    }
+    dirtyRows[y] = 0;
+    sprite->drawFastHLine(0, y, SAND_COLS, bgColor);
+
+    // 按位扫描出连续的沙粒段
+    int x = 0;
+    while (x < SAND_COLS)
+    {
+      uint32_t word = sandGrid[y][x >> 5] >> (x & 31);
+      if (word == 0)
+      {
+        x = (x | 31) + 1; // 本字剩余部分为空，跳到下一个字
+        continue;
+      }
+      x += __builtin_ctz(word); // 跳过空位，找到段起点
+      int start = x;
+      while (x < SAND_COLS && (sandGrid[y][x >> 5] & (1UL << (x & 31))))
+      {
+        uint32_t rest = ~sandGrid[y][x >> 5] >> (x & 31);
+        x += rest ? __builtin_ctz(rest) : 32 - (x & 31); // 一次跳过连续的1
+      }
+      if (x > SAND_COLS) x = SAND_COLS;
+      sprite->drawFastHLine(start, y, x - start, color);
+    }
+  }
+}
@@ -0,0 +1,42 @@
+#ifndef SAND_SIM_H
+#define SAND_SIM_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define SAND_COLS       240 // 模拟区域宽度 (1像素一颗沙粒)
+#define SAND_ROWS       240 // 模拟区域高度
+#define SAND_ROW_WORDS  ((SAND_COLS + 31) / 32) // 每行占用的32位字数
+
+/**
+ * @brief 清空沙盒并把所有行标记为需要重绘。
+ */
+void SandSim_Init();
+
+/**
+ * @brief 在顶部第 x 列放入一颗沙粒。
+ * @return 该位置已被占用（沙堆已经堆到顶部）时返回false。
+ */
+bool SandSim_Spawn(int x);
+
+/**
+ * @brief 推进一步模拟。
+ * @details 网格按位存储，每行用若干32位字表示，同一行的所有沙粒按字并行下落：
+ *          先尝试正下方，再尝试左下、右下。只处理“活跃”行——上一步有沙粒移动过的行及其上下邻行，
+ *          已经静止的沙堆完全不参与计算。
+ * @return 本步是否有沙粒移动。
+ */
+bool SandSim_Step();
+
+/**
+ * @brief 把发生变化的行以水平线段的形式绘制到精灵中。
+ * @param sprite 目标精灵，必须为 SAND_COLS x SAND_ROWS 或更大。
+ * @param color 沙粒颜色。
+ * @param bgColor 背景颜色。
+ * @param full 为true时重绘所有行（用于清除上一帧叠加的文字残留）。
+ * @details 每行先用一条背景线段覆盖，再按位扫描出连续的沙粒段逐段绘制，
+ *          不再逐颗调用 drawPixel；未变化的行保持精灵中原有内容。
+ */
+void SandSim_Render(TFT_eSprite *sprite, uint16_t color, uint16_t bgColor, bool full);
+
+#endif // SAND_SIM_H
@@ -0,0 +1,235 @@
+// 包含所有必需的头文件
+#include "Screen.h"
+#include "EventBus.h"
+#include "RotaryEncoder.h"
+#include "Alarm.h"
+#include "MQTT.h"
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+
+#define SCREEN_NO_REASON SCREEN_EXIT_REASON_COUNT // 尚未被抢占
+
+static const char *const reasonNames[SCREEN_EXIT_REASON_COUNT] = {"user", "alarm", "remote", "menu"};
+
+// --- 全局变量 ---
+static QueueHandle_t preemptQueue = NULL; // 最外层页面运行期间订阅闹钟响铃和远程点歌
+static int depth = 0;                     // 正在运行的页面层数
+static int pendingReason = SCREEN_NO_REASON; // 被抢占后各层依次退出，回到最外层时复位
+static bool pendingTimed = false;         // 抢占来自事件，pendingPublishUs 有效
+static uint32_t pendingPublishUs = 0;
+static int64_t childUs = 0;               // 本周期 update 中嵌套运行的页面耗时，不计入外层的周期耗时
+
+// --- 统计 ---
+static ScreenStats stats[SCREEN_MAX_STATS];
+static int statsCount = 0;
+static uint32_t lastPreemptUs = 0;
+static const char *lastPreemptName = NULL;
+static int lastPreemptReason = SCREEN_NO_REASON;
+
+/**
+ * @brief 找到页面的统计项，第一次运行时新建
+ */
+static ScreenStats *statsFor(const ScreenDef &screen)
+{
+  for (int i = 0; i < statsCount; i++)
+  {
+    if (strcmp(stats[i].name, screen.name) == 0)
+    {
+      return &stats[i];
+    }
+  }
+  if (statsCount == SCREEN_MAX_STATS)
+  {
+    return NULL;
+  }
+  ScreenStats &s = stats[statsCount++];
+  memset(&s, 0, sizeof(s));
+  s.name = screen.name;
+  s.frameMs = screen.frameMs;
+  return &s;
+}
+
+/**
+ * @brief 记下抢占事件，只保留第一个
+ */
+static void latchEvent(const AppEvent &event)
+{
+  if (pendingReason != SCREEN_NO_REASON)
+  {
+    return;
+  }
+  pendingReason = event.type == EVENT_ALARM_RING ? SCREEN_EXIT_ALARM : SCREEN_EXIT_REMOTE;
+  pendingTimed = true;
+  pendingPublishUs = event.publishUs;
+}
+
+/**
+ * @brief 是否应结束页面：先看事件队列，再看仍由其他页面使用的全局标志
+ */
+static bool checkPreempt()
+{
+  if (pendingReason != SCREEN_NO_REASON)
+  {
+    return true;
+  }
+  AppEvent event;
+  if (EventBus_Receive(preemptQueue, &event, 0))
+  {
+    latchEvent(event);
+  }
+  else if (g_alarm_is_ringing)
+  {
+    pendingReason = SCREEN_EXIT_ALARM;
+  }
+  else if (exitSubMenu)
+  {
+    exitSubMenu = false; // 与原来各页面的处理相同：谁退出谁复位
+    pendingReason = SCREEN_EXIT_MENU;
+  }
+  return pendingReason != SCREEN_NO_REASON;
+}
+
+ScreenExitReason Screen_Run(const ScreenDef &screen)
+{
+  if (depth == 0)
+  {
+    pendingReason = SCREEN_NO_REASON;
+    pendingTimed = false;
+    if (preemptQueue == NULL)
+    {
+      preemptQueue = xQueueCreate(SCREEN_PREEMPT_QUEUE_LEN, sizeof(AppEvent));
+    }
+    xQueueReset(preemptQueue);
+    EventBus_SubscribeQueue(preemptQueue, EVENT_MASK(EVENT_ALARM_RING) | EVENT_MASK(EVENT_PLAY_SONG));
+  }
+  depth++;
+  int64_t runStartUs = esp_timer_get_time();
+  int64_t savedChildUs = childUs;
+
+  ScreenStats *st = statsFor(screen);
+  if (st) st->runs++;
+
+  uint32_t frameMs = screen.frameMs ? screen.frameMs : SCREEN_INPUT_MS;
+  ScreenExitReason reason = SCREEN_EXIT_USER;
+  bool dirty = true; // 进入后的第一帧总要绘制
+  uint32_t nextFrameMs = millis();
+
+  if (screen.enter) screen.enter();
+
+  for (;;)
+  {
+    if (checkPreempt())
+    {
+      reason = (ScreenExitReason)pendingReason;
+      break;
+    }
+
+    ScreenInput input;
+    input.longPress = screen.longPress && readButtonLongPress();
+    input.click = readButton();
+    input.encoder = readEncoder();
+    input.nowMs = millis();
+    input.frame = (int32_t)(input.nowMs - nextFrameMs) >= 0;
+    if (input.frame)
+    {
+      if (st && input.nowMs - nextFrameMs >= frameMs) st->lateFrames++;
+      // 按帧时刻排下一帧，落后时不补帧
+      nextFrameMs += frameMs;
+      if ((int32_t)(input.nowMs - nextFrameMs) >= 0) nextFrameMs = input.nowMs + frameMs;
+    }
+
+    int64_t startUs = esp_timer_get_time();
+    childUs = 0;
+    ScreenAction action = screen.update(input);
+    if (action == SCREEN_EXIT)
+    {
+      break;
+    }
+    if (action == SCREEN_REDRAW) dirty = true;
+    if (childUs > 0)
+    {
+      // update 中运行了另一个页面，画面已被覆盖，帧时刻从现在重新开始
+      dirty = true;
+      nextFrameMs = millis();
+    }
+    else if (dirty && input.frame)
+    {
+      screen.render();
+      dirty = false;
+      if (st) st->frames++;
+    }
+    uint32_t busyUs = (uint32_t)(esp_timer_get_time() - startUs - childUs);
+    if (st && busyUs > st->busyMaxUs) st->busyMaxUs = busyUs;
+
+    // 阻塞到下一个输入周期或帧时刻，期间到达的抢占事件立即唤醒
+    int32_t untilFrame = (int32_t)(nextFrameMs - millis());
+    uint32_t wait = SCREEN_INPUT_MS;
+    if (untilFrame < (int32_t)wait) wait = untilFrame > 0 ? untilFrame : 0;
+    AppEvent event;
+    if (EventBus_Receive(preemptQueue, &event, wait))
+    {
+      latchEvent(event);
+    }
+  }
+
+  if (screen.exit) screen.exit(reason);
+
+  if (reason != SCREEN_EXIT_USER)
+  {
+    uint32_t latencyUs = pendingTimed ? (uint32_t)esp_timer_get_time() - pendingPublishUs : 0;
+    if (st)
+    {
+      st->preempts++;
+      if (latencyUs > st->preemptMaxUs) st->preemptMaxUs = latencyUs;
+    }
+    lastPreemptUs = latencyUs;
+    lastPreemptName = screen.name;
+    lastPreemptReason = reason;
+  }
+
+  depth--;
+  if (depth == 0)
+  {
+    EventBus_UnsubscribeQueue(preemptQueue);
+  }
+  childUs = savedChildUs + (esp_timer_get_time() - runStartUs);
+  return reason;
+}
+
+bool Screen_GetStats(int index, ScreenStats *out)
+{
+  if (index < 0 || index >= statsCount)
+  {
+    return false;
+  }
+  *out = stats[index];
+  return true;
+}
+
+void Screen_Dump()
+{
+  Serial.println("[Screen] screen           frame_ms  runs  frames  late  busy_max_us  preempts  preempt_max_us");
+  for (int i = 0; i < statsCount; i++)
+  {
+    const ScreenStats &s = stats[i];
+    Serial.printf("[Screen] %-16s %8u %5lu %7lu %5lu %12lu %9lu %15lu\n", s.name, s.frameMs, (unsigned long)s.runs,
+                  (unsigned long)s.frames, (unsigned long)s.lateFrames, (unsigned long)s.busyMaxUs,
+                  (unsigned long)s.preempts, (unsigned long)s.preemptMaxUs);
+  }
+  if (lastPreemptName != NULL)
+  {
+    Serial.printf("[Screen] last preempt: %s by %s, %lu us\n", lastPreemptName, reasonNames[lastPreemptReason],
+                  (unsigned long)lastPreemptUs);
+  }
+}
+
+bool Screen_HandleCommand(const char *line)
+{
+  if (strncmp(line, "screens", 7) != 0)
+  {
+    return false;
+  }
+  Screen_Dump();
+  return true;
+}
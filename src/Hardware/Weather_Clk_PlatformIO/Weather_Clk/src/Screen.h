@@ -0,0 +1,100 @@
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#include <Arduino.h>
+
+#define SCREEN_INPUT_MS          10 // 读取输入和调用 update 的间隔
+#define SCREEN_PREEMPT_QUEUE_LEN 4  // 页面运行期间订阅抢占事件的队列深度
+#define SCREEN_MAX_STATS         16 // 记录统计的页面数 (按页面名)
+
+/**
+ * @brief update 的返回值。
+ */
+enum ScreenAction
+{
+    SCREEN_IDLE,   ///< 画面不变。
+    SCREEN_REDRAW, ///< 需要重绘，在下一帧调用 render。
+    SCREEN_EXIT    ///< 用户退出页面。
+};
+
+/**
+ * @brief 页面结束的原因。
+ */
+enum ScreenExitReason
+{
+    SCREEN_EXIT_USER,   ///< update 返回 SCREEN_EXIT。
+    SCREEN_EXIT_ALARM,  ///< 闹钟响铃。
+    SCREEN_EXIT_REMOTE, ///< 远程命令 (点歌) 需要界面循环。
+    SCREEN_EXIT_MENU,   ///< exitSubMenu 被置位。
+    SCREEN_EXIT_REASON_COUNT
+};
+
+/**
+ * @brief 调度器每个输入周期读到的输入。
+ */
+struct ScreenInput
+{
+    int encoder;    ///< readEncoder() 的结果：1 顺时针，-1 逆时针，0 没有旋转。
+    bool click;     ///< 短按。
+    bool longPress; ///< 长按 (只在 ScreenDef::longPress 为 true 时读取)。
+    bool frame;     ///< 本周期是一帧的开始：按帧推进的动画和计时在此时更新。
+    uint32_t nowMs; ///< 读取输入时的 millis()。
+};
+
+/**
+ * @brief 一个页面：原来的“while(true) 轮询 + vTaskDelay”改写成的回调。
+ * @details 所有回调都在界面任务中由 Screen_Run 调用。页面状态放在各模块的静态变量中。
+ */
+struct ScreenDef
+{
+    const char *name;                                  ///< 页面名，用于统计。
+    uint16_t frameMs;                                  ///< 声明的帧间隔：render 最多每帧调用一次，按帧推进的逻辑以此为节拍。
+    bool longPress;                                    ///< 是否读取长按。读取时按住按钮会在屏幕上画进度条。
+    void (*enter)();                                   ///< 进入页面时调用一次，初始化状态。可为 NULL。
+    ScreenAction (*update)(const ScreenInput &input);  ///< 每个输入周期调用，处理输入、推进状态。
+    void (*render)();                                  ///< 绘制一帧。进入页面后的第一帧总会调用。
+    void (*exit)(ScreenExitReason reason);             ///< 离开页面时调用一次，无论原因。可为 NULL。
+};
+
+/**
+ * @brief 一个页面的运行统计。
+ */
+struct ScreenStats
+{
+    const char *name;       ///< 页面名。
+    uint16_t frameMs;       ///< 声明的帧间隔。
+    uint32_t runs;          ///< 进入次数。
+    uint32_t frames;        ///< render 次数。
+    uint32_t lateFrames;    ///< 晚于帧时刻超过一帧才开始的帧数。
+    uint32_t busyMaxUs;     ///< 一个周期中 update + render 的最长耗时，即抢占延迟的上界。
+    uint32_t preempts;      ///< 被闹钟、远程命令或 exitSubMenu 结束的次数。
+    uint32_t preemptMaxUs;  ///< 从事件发布到页面退出完成的最长时间。
+};
+
+/**
+ * @brief 运行一个页面直到它退出或被抢占，在界面任务中调用，可以嵌套 (如游戏菜单中运行游戏)。
+ * @details 每 SCREEN_INPUT_MS 读取一次输入并调用 update，帧时刻到来且需要重绘时调用 render。
+ *          两个周期之间阻塞在订阅了闹钟响铃和远程点歌的事件队列上：事件到达时立即结束页面，
+ *          抢占延迟不超过一次 update + render 的时间。嵌套运行时内层被抢占后外层也随之退出。
+ * @return 页面结束的原因。
+ */
+ScreenExitReason Screen_Run(const ScreenDef &screen);
+
+/**
+ * @brief 获取第 index 个页面的统计。
+ * @return index 超出已记录的页面数时返回 false。
+ */
+bool Screen_GetStats(int index, ScreenStats *out);
+
+/**
+ * @brief 在串口输出各页面的帧数、最长周期耗时和抢占延迟。
+ */
+void Screen_Dump();
+
+/**
+ * @brief 处理串口命令 "screens"。
+ * @return 是页面命令时返回 true。
+ */
+bool Screen_HandleCommand(const char *line);
+
+#endif // SCREEN_H
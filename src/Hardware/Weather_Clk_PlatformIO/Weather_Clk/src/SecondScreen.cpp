@@ -0,0 +1,196 @@
+// 包含所有必需的头文件
+#include "SecondScreen.h"
+#include "PCLink.h"
+#include "Alarm.h"
+#include "Menu.h"
+#include "MQTT.h"
+#include "RotaryEncoder.h"
+#include <TFT_eSPI.h>
+#include "freertos/queue.h"
+#include "Display.h"
+
+// 应答帧的标志位
+#define SCREEN_ACK_RESYNC 0x01 // 设备画面与PC的参考帧不一致，请求PC下一帧发送完整画面
+
+// --- 接收缓冲区 ---
+struct ScreenChunk
+{
+  uint16_t length;                                           // 有效数据长度
+  uint8_t data[PC_LINK_MAX_PAYLOAD] __attribute__((aligned(4))); // 与PC_LINK帧负载相同的内容
+};
+
+static ScreenChunk screenChunks[SCREEN_RX_BUFFERS]; // 双缓冲：一块在接收，另一块在显示
+static QueueHandle_t freeChunkQueue = NULL;  // 空闲缓冲区
+static QueueHandle_t readyChunkQueue = NULL; // 已收到、等待显示的缓冲区
+static volatile bool resyncRequested = true; // 丢块或被提示界面覆盖后需要PC重发完整画面
+
+/**
+ * @brief 副屏帧的处理函数，运行在串口接收任务中
+ * @details 只负责把负载复制到空闲缓冲区并交给显示循环，不直接操作屏幕。
+ *          没有空闲缓冲区时短暂等待，这会让USB接收变慢，从而自然地对PC形成背压。
+ */
+static void onScreenFrame(uint8_t version, const uint8_t *payload, uint16_t length)
+{
+  if (length < SCREEN_CHUNK_HEADER)
+  {
+    return;
+  }
+
+  ScreenChunk *chunk;
+  if (xQueueReceive(freeChunkQueue, &chunk, pdMS_TO_TICKS(100)) != pdTRUE)
+  {
+    resyncRequested = true; // 这一块被丢弃，后续差分数据不再可靠
+    return;
+  }
+  memcpy(chunk->data, payload, length);
+  chunk->length = length;
+  xQueueSend(readyChunkQueue, &chunk, 0);
+}
+
+/**
+ * @brief 把一个数据块中的所有像素段写入屏幕
+ * @return 数据块格式正确返回true
+ */
+static bool blitChunk(const ScreenChunk *chunk)
+{
+  const uint8_t *p = chunk->data + SCREEN_CHUNK_HEADER;
+  const uint8_t *end = chunk->data + chunk->length;
+  bool ok = true;
+
+  Display_Lock();
+  tft.startWrite();
+  while (p + SCREEN_SPAN_HEADER <= end)
+  {
+    uint8_t op = p[0];
+    uint8_t y = p[1];
+    uint8_t x = p[2];
+    uint8_t n = p[3];
+    p += SCREEN_SPAN_HEADER;
+
+    if (n == 0 || y >= SCREEN_HEIGHT_PX || x + n > SCREEN_WIDTH_PX)
+    {
+      ok = false;
+      break;
+    }
+
+    if (op == SCREEN_OP_RAW && p + n * 2 <= end)
+    {
+      // 像素已是屏幕线序，关闭字节交换后按内存顺序直接发送
+      tft.pushImage(x, y, n, 1, (uint16_t *) p);
+      p += n * 2;
+    }
+    else if (op == SCREEN_OP_FILL && p + 2 <= end)
+    {
+      tft.drawFastHLine(x, y, n, (p[0] << 8) | p[1]);
+      p += 2;
+    }
+    else
+    {
+      ok = false;
+      break;
+    }
+  }
+  tft.endWrite();
+  Display_Unlock();
+  return ok;
+}
+
+/**
+ * @brief 向PC回送一帧显示完成的应答
+ * @param frameId 刚显示完的帧号
+ * @param blitUs 该帧所有数据块写屏所用的时间(us)
+ */
+static void sendFrameAck(uint16_t frameId, uint32_t blitUs)
+{
+  uint8_t ack[8];
+  ack[0] = frameId & 0xFF;
+  ack[1] = frameId >> 8;
+  ack[2] = resyncRequested ? SCREEN_ACK_RESYNC : 0;
+  ack[3] = 0;
+  memcpy(ack + 4, &blitUs, sizeof(blitUs)); // 小端
+  resyncRequested = false;
+  PCLink_Send(PC_LINK_TYPE_SCREEN_ACK, ack, sizeof(ack));
+}
+
+/**
+ * @brief 绘制等待PC连接的提示
+ */
+static void drawWaitingHint()
+{
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextFont(1);
+  tft.setTextSize(2);
+  tft.setTextDatum(MC_DATUM);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.drawString("PC Screen", SCREEN_WIDTH_PX / 2, SCREEN_HEIGHT_PX / 2 - 15);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
+  tft.drawString("Waiting for host...", SCREEN_WIDTH_PX / 2, SCREEN_HEIGHT_PX / 2 + 15);
+  resyncRequested = true;
+}
+
+void SecondScreenMenu()
+{
+  // 首次进入时创建队列
+  if (freeChunkQueue == NULL)
+  {
+    freeChunkQueue = xQueueCreate(SCREEN_RX_BUFFERS, sizeof(ScreenChunk *));
+    readyChunkQueue = xQueueCreate(SCREEN_RX_BUFFERS, sizeof(ScreenChunk *));
+  }
+  xQueueReset(freeChunkQueue);
+  xQueueReset(readyChunkQueue);
+  for (int i = 0; i < SCREEN_RX_BUFFERS; i++)
+  {
+    ScreenChunk *chunk = &screenChunks[i];
+    xQueueSend(freeChunkQueue, &chunk, 0);
+  }
+
+  bool savedSwap = tft.getSwapBytes();
+  tft.setSwapBytes(false);
+  drawWaitingHint();
+  bool showingHint = true;
+  unsigned long lastFrameTime = millis();
+  uint32_t frameBlitUs = 0;
+
+  PCLink_RegisterHandler(PC_LINK_TYPE_SCREEN, onScreenFrame);
+
+  while (1)
+  {
+    if (exitSubMenu || g_alarm_is_ringing || readButton())
+    {
+      exitSubMenu = false;
+      break;
+    }
+
+    ScreenChunk *chunk;
+    if (xQueueReceive(readyChunkQueue, &chunk, pdMS_TO_TICKS(10)) == pdTRUE)
+    {
+      uint32_t start = micros();
+      if (!blitChunk(chunk))
+      {
+        resyncRequested = true;
+      }
+      frameBlitUs += micros() - start;
+
+      uint16_t frameId = chunk->data[0] | (chunk->data[1] << 8);
+      uint8_t flags = chunk->data[2];
+      xQueueSend(freeChunkQueue, &chunk, 0); // 先归还缓冲区，让接收任务尽快继续
+
+      if (flags & SCREEN_FLAG_FRAME_END)
+      {
+        sendFrameAck(frameId, frameBlitUs);
+        frameBlitUs = 0;
+        lastFrameTime = millis();
+        showingHint = false;
+      }
+    }
+    else if (!showingHint && millis() - lastFrameTime > SCREEN_IDLE_TIMEOUT)
+    {
+      drawWaitingHint();
+      showingHint = true;
+    }
+  }
+
+  PCLink_RegisterHandler(PC_LINK_TYPE_SCREEN, NULL);
+  tft.setSwapBytes(savedSwap);
+}
@@ -0,0 +1,37 @@
+#ifndef SECOND_SCREEN_H
+#define SECOND_SCREEN_H
+
+#include <Arduino.h>
+
+// -----------------------------
+// 副屏协议 (PC_LINK_TYPE_SCREEN 帧的负载)
+// -----------------------------
+// 负载头: FRAME_ID_L | FRAME_ID_H | FLAGS | RESERVED
+// 之后是若干像素段，PC只发送与上一帧相比发生变化的段:
+//   SCREEN_OP_RAW : OP | Y | X | N | N个像素 (RGB565, 高字节在前，即屏幕线序)
+//   SCREEN_OP_FILL: OP | Y | X | N | 1个像素 (N个相同像素的游程)
+// 每个段头4字节、像素2字节，因此像素数据始终按2字节对齐。
+// 一帧画面可以拆成多个 PC_LINK 帧发送，最后一块带 SCREEN_FLAG_FRAME_END。
+#define SCREEN_WIDTH_PX       240
+#define SCREEN_HEIGHT_PX      240
+#define SCREEN_CHUNK_HEADER   4
+#define SCREEN_SPAN_HEADER    4
+
+#define SCREEN_OP_RAW         0x01
+#define SCREEN_OP_FILL        0x02
+
+#define SCREEN_FLAG_FRAME_END 0x01
+
+#define SCREEN_RX_BUFFERS     2    // 接收双缓冲
+#define SCREEN_IDLE_TIMEOUT   3000 // 超过该时间没有收到画面则显示等待提示(ms)
+
+/**
+ * @brief 副屏模式的入口函数。
+ * @details 进入后设备作为PC的第二块屏幕：PC端把渲染好的240x240画面做差分/游程压缩后
+ *          通过USB CDC发送，串口接收任务把数据块放入双缓冲，本函数取出后
+ *          直接把变化的像素段写入屏幕。每显示完一帧会向PC回送应答，用于流控和延迟统计。
+ *          按下按钮或收到退出请求时返回主菜单。
+ */
+void SecondScreenMenu();
+
+#endif // SECOND_SCREEN_H
@@ -0,0 +1,543 @@
+#include "Settings.h"
+#include <esp_partition.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+// 闪存布局 (每个扇区):
+//   扇区头 16 字节: magic | seq | eraseCount | crc(前12字节)
+//   批记录 (4字节对齐): len(2) | ~len(2) | crc(4) | 条目...
+//   条目: key(1) | version(1) | len(2) | 值[len]
+// 一次提交是一条批记录。先写条目再写记录头，记录头是提交点：
+// 掉电时记录头为空白或 CRC 不符，这条批记录连同扇区中其后的内容都被忽略。
+
+#define SECTOR_MAGIC        0x314A4357 // "WCJ1"
+#define SECTOR_HEADER_SIZE  16
+#define RECORD_HEADER_SIZE  8
+#define ENTRY_HEADER_SIZE   4
+#define MAX_SECTORS         16
+#define ERASED_WORD         0xFFFFFFFFu
+
+struct SectorHeader
+{
+  uint32_t magic;
+  uint32_t seq;
+  uint32_t eraseCount;
+  uint32_t crc;
+};
+
+struct RecordHeader
+{
+  uint16_t len;
+  uint16_t lenInv;
+  uint32_t crc;
+};
+
+struct EntryHeader
+{
+  uint8_t key;
+  uint8_t version;
+  uint16_t len;
+};
+
+/**
+ * @brief 一个键最新值在分区中的位置
+ */
+struct KeyIndex
+{
+  uint32_t addr;
+  uint16_t len;
+  uint8_t version;
+  bool valid;
+};
+
+/**
+ * @brief 扇区在内存中的状态
+ */
+struct SectorInfo
+{
+  uint32_t seq;
+  uint32_t eraseCount;
+  uint16_t used;   // 下一条记录的写入偏移，写满或封存时为扇区大小
+  bool erased;
+};
+
+// --- 全局变量 ---
+static const esp_partition_t *partition = NULL;
+static SemaphoreHandle_t settingsMutex = NULL;
+static TaskHandle_t settingsTaskHandle = NULL;
+static SectorInfo sectors[MAX_SECTORS];
+static uint16_t sectorCount = 0;
+static int16_t headSector = -1;
+static uint32_t nextSeq = 1;
+static KeyIndex keyIndex[SETTINGS_MAX_KEYS];
+static uint8_t stageBuf[SETTINGS_BATCH_MAX];
+static uint16_t stageLen = 0;
+static uint8_t ioBuf[SETTINGS_BATCH_MAX]; // 挂载扫描和整理搬移共用
+static SettingsStats stats;
+
+static uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc = 0xFFFFFFFFu)
+{
+  while (len--)
+  {
+    crc ^= *data++;
+    for (int k = 0; k < 8; k++)
+    {
+      crc = (crc & 1) ? 0xEDB88320u ^ (crc >> 1) : crc >> 1;
+    }
+  }
+  return crc;
+}
+
+static inline uint32_t align4(uint32_t n)
+{
+  return (n + 3) & ~3u;
+}
+
+static inline uint32_t sectorBase(int s)
+{
+  return (uint32_t)s * SETTINGS_SECTOR_SIZE;
+}
+
+static void lock()
+{
+  if (settingsMutex) xSemaphoreTakeRecursive(settingsMutex, portMAX_DELAY);
+}
+
+static void unlock()
+{
+  if (settingsMutex) xSemaphoreGiveRecursive(settingsMutex);
+}
+
+static bool flashWrite(uint32_t addr, const void *data, size_t len)
+{
+  stats.flashBytes += len;
+  return esp_partition_write(partition, addr, data, len) == ESP_OK;
+}
+
+static bool eraseSector(int s)
+{
+  stats.erases++;
+  sectors[s].eraseCount++;
+  sectors[s].erased = true;
+  sectors[s].used = SECTOR_HEADER_SIZE;
+  return esp_partition_erase_range(partition, sectorBase(s), SETTINGS_SECTOR_SIZE) == ESP_OK;
+}
+
+/**
+ * @brief [from, 扇区末尾) 是否全为空白 (0xFF)
+ */
+static bool isErasedFrom(int s, uint32_t from)
+{
+  for (uint32_t off = from; off < SETTINGS_SECTOR_SIZE; off += sizeof(ioBuf))
+  {
+    size_t n = SETTINGS_SECTOR_SIZE - off < sizeof(ioBuf) ? SETTINGS_SECTOR_SIZE - off : sizeof(ioBuf);
+    esp_partition_read(partition, sectorBase(s) + off, ioBuf, n);
+    for (size_t i = 0; i < n; i++)
+    {
+      if (ioBuf[i] != 0xFF) return false;
+    }
+  }
+  return true;
+}
+
+static uint16_t spareCount()
+{
+  uint16_t n = 0;
+  for (int s = 0; s < sectorCount; s++) n += sectors[s].erased;
+  return n;
+}
+
+/**
+ * @brief 把一条批记录中的条目登记到索引
+ * @param body 批记录的条目部分
+ * @param addr 条目部分在分区中的地址
+ */
+static void indexBatch(const uint8_t *body, uint16_t len, uint32_t addr)
+{
+  uint16_t off = 0;
+  while (off + ENTRY_HEADER_SIZE <= len)
+  {
+    EntryHeader e;
+    memcpy(&e, body + off, sizeof(e));
+    if (off + ENTRY_HEADER_SIZE + e.len > len) break;
+    if (e.key > 0 && e.key < SETTINGS_MAX_KEYS)
+    {
+      keyIndex[e.key] = {addr + off + ENTRY_HEADER_SIZE, e.len, e.version, true};
+    }
+    off += ENTRY_HEADER_SIZE + e.len;
+  }
+}
+
+/**
+ * @brief 扫描一个已用扇区的批记录，找到写入位置
+ * @details 遇到不完整的记录时封存扇区 (used 置为扇区大小)，之后的写入从下一个扇区开始，
+ *          不会写在残留的半条记录上。
+ */
+static void scanSector(int s)
+{
+  uint32_t off = SECTOR_HEADER_SIZE;
+  sectors[s].used = SETTINGS_SECTOR_SIZE;
+  while (off + RECORD_HEADER_SIZE <= SETTINGS_SECTOR_SIZE)
+  {
+    RecordHeader rec;
+    esp_partition_read(partition, sectorBase(s) + off, &rec, sizeof(rec));
+    if (rec.len == 0xFFFF && rec.lenInv == 0xFFFF && rec.crc == ERASED_WORD)
+    {
+      if (isErasedFrom(s, off)) sectors[s].used = off;
+      return;
+    }
+    if ((uint16_t)(rec.len ^ rec.lenInv) != 0xFFFF || rec.len > SETTINGS_BATCH_MAX ||
+        off + RECORD_HEADER_SIZE + rec.len > SETTINGS_SECTOR_SIZE)
+    {
+      return;
+    }
+    esp_partition_read(partition, sectorBase(s) + off + RECORD_HEADER_SIZE, ioBuf, rec.len);
+    if ((crc32(ioBuf, rec.len) ^ 0xFFFFFFFFu) != rec.crc)
+    {
+      return;
+    }
+    indexBatch(ioBuf, rec.len, sectorBase(s) + off + RECORD_HEADER_SIZE);
+    off += RECORD_HEADER_SIZE + align4(rec.len);
+  }
+}
+
+/**
+ * @brief 启用头扇区之后的下一个空白扇区
+ */
+static bool advanceHead()
+{
+  // 正常情况下空白扇区紧跟在头扇区之后，按环形顺序轮流使用各扇区
+  int next = -1;
+  for (int i = 1; i <= sectorCount && next < 0; i++)
+  {
+    int s = (headSector + i) % sectorCount;
+    if (sectors[s].erased) next = s;
+  }
+  if (next < 0)
+  {
+    Serial.println("[Settings] no spare sector");
+    return false;
+  }
+  SectorHeader h = {SECTOR_MAGIC, nextSeq++, sectors[next].eraseCount, 0};
+  h.crc = crc32((const uint8_t *)&h, 12) ^ 0xFFFFFFFFu;
+  if (!flashWrite(sectorBase(next), &h, sizeof(h)))
+  {
+    return false;
+  }
+  sectors[next].seq = h.seq;
+  sectors[next].erased = false;
+  sectors[next].used = SECTOR_HEADER_SIZE;
+  headSector = next;
+  return true;
+}
+
+/**
+ * @brief 在头扇区末尾追加一条批记录，放不下时先换到下一个扇区
+ */
+static bool appendBatch(const uint8_t *body, uint16_t len)
+{
+  uint32_t need = RECORD_HEADER_SIZE + align4(len);
+  if (headSector < 0 || sectors[headSector].used + need > SETTINGS_SECTOR_SIZE)
+  {
+    if (!advanceHead()) return false;
+  }
+  uint32_t addr = sectorBase(headSector) + sectors[headSector].used;
+  RecordHeader rec = {len, (uint16_t)~len, crc32(body, len) ^ 0xFFFFFFFFu};
+
+  // 写入失败时这个位置可能已有残留，封存扇区
+  sectors[headSector].used = SETTINGS_SECTOR_SIZE;
+  if (!flashWrite(addr + RECORD_HEADER_SIZE, body, len) || !flashWrite(addr, &rec, sizeof(rec)))
+  {
+    return false;
+  }
+  sectors[headSector].used = addr - sectorBase(headSector) + need;
+  indexBatch(body, len, addr + RECORD_HEADER_SIZE);
+  return true;
+}
+
+/**
+ * @brief 回收最旧的扇区：把其中仍是最新值的条目搬到头扇区，然后擦除
+ */
+static bool compactOldest()
+{
+  int oldest = -1;
+  for (int s = 0; s < sectorCount; s++)
+  {
+    if (!sectors[s].erased && s != headSector && (oldest < 0 || sectors[s].seq < sectors[oldest].seq))
+    {
+      oldest = s;
+    }
+  }
+  if (oldest < 0) return false;
+
+  uint32_t lo = sectorBase(oldest), hi = lo + SETTINGS_SECTOR_SIZE;
+  uint8_t *batch = stageBuf; // 整理在提交写完之后运行，借用提交缓冲区
+  uint16_t batchLen = 0;
+  for (int key = 1; key < SETTINGS_MAX_KEYS; key++)
+  {
+    const KeyIndex &k = keyIndex[key];
+    if (!k.valid || k.addr < lo || k.addr >= hi) continue;
+    if (batchLen + ENTRY_HEADER_SIZE + k.len > SETTINGS_BATCH_MAX)
+    {
+      if (!appendBatch(batch, batchLen)) return false;
+      batchLen = 0;
+    }
+    EntryHeader e = {(uint8_t)key, k.version, k.len};
+    memcpy(batch + batchLen, &e, sizeof(e));
+    esp_partition_read(partition, k.addr, batch + batchLen + ENTRY_HEADER_SIZE, k.len);
+    batchLen += ENTRY_HEADER_SIZE + k.len;
+  }
+  if (batchLen > 0 && !appendBatch(batch, batchLen))
+  {
+    return false;
+  }
+  stats.compactions++;
+  return eraseSector(oldest);
+}
+
+/**
+ * @brief 整理到空白扇区数回到 SETTINGS_SPARE_SECTORS
+ */
+static void compactAsNeeded()
+{
+  for (int i = 0; i < sectorCount && spareCount() < SETTINGS_SPARE_SECTORS; i++)
+  {
+    if (!compactOldest()) break;
+  }
+}
+
+/**
+ * @brief 后台整理任务：提交后空白扇区不足时被唤醒，整理在 UI 之外完成
+ */
+static void Settings_Task(void *pvParameters)
+{
+  for (;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    lock();
+    compactAsNeeded();
+    unlock();
+  }
+}
+
+void Settings_Init()
+{
+  if (partition != NULL)
+  {
+    return;
+  }
+  partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)SETTINGS_PARTITION_SUBTYPE, SETTINGS_PARTITION_LABEL);
+  if (partition == NULL)
+  {
+    Serial.println("[Settings] partition not found");
+    return;
+  }
+  sectorCount = partition->size / SETTINGS_SECTOR_SIZE;
+  if (sectorCount > MAX_SECTORS) sectorCount = MAX_SECTORS;
+  if (sectorCount < SETTINGS_SPARE_SECTORS + 1)
+  {
+    Serial.println("[Settings] partition too small");
+    partition = NULL;
+    return;
+  }
+
+  // 读扇区头，头部损坏或没有写完的扇区重新擦除
+  uint32_t maxErase = 0;
+  for (int s = 0; s < sectorCount; s++)
+  {
+    SectorHeader h;
+    esp_partition_read(partition, sectorBase(s), &h, sizeof(h));
+    sectors[s] = {0, 0, SECTOR_HEADER_SIZE, true};
+    if (h.magic == SECTOR_MAGIC && (crc32((const uint8_t *)&h, 12) ^ 0xFFFFFFFFu) == h.crc)
+    {
+      sectors[s] = {h.seq, h.eraseCount, SETTINGS_SECTOR_SIZE, false};
+      if (h.eraseCount > maxErase) maxErase = h.eraseCount;
+      if (h.seq >= nextSeq) nextSeq = h.seq + 1;
+    }
+    else if (!isErasedFrom(s, 0))
+    {
+      eraseSector(s);
+    }
+  }
+  for (int s = 0; s < sectorCount; s++)
+  {
+    if (sectors[s].erased && sectors[s].eraseCount == 0) sectors[s].eraseCount = maxErase;
+  }
+
+  // 按序号从旧到新扫描，后写的值覆盖先写的
+  uint32_t lastSeq = 0;
+  for (;;)
+  {
+    int s = -1;
+    for (int i = 0; i < sectorCount; i++)
+    {
+      if (!sectors[i].erased && sectors[i].seq > lastSeq && (s < 0 || sectors[i].seq < sectors[s].seq)) s = i;
+    }
+    if (s < 0) break;
+    scanSector(s);
+    lastSeq = sectors[s].seq;
+    headSector = s;
+  }
+  if (headSector < 0)
+  {
+    headSector = sectorCount - 1; // 空分区从扇区 0 开始
+    advanceHead();
+  }
+
+  compactAsNeeded(); // 上次掉电前没来得及整理时先补上，保证第一次提交有空白扇区可换
+  settingsMutex = xSemaphoreCreateRecursiveMutex();
+  xTaskCreate(Settings_Task, "Settings", 3072, NULL, 1, &settingsTaskHandle);
+  stats.flashBytes = 0;
+  stats.erases = 0;
+  stats.mounted = true;
+  Settings_Dump();
+}
+
+int Settings_Read(uint8_t key, void *buf, size_t size, uint8_t *version)
+{
+  if (partition == NULL || key == 0 || key >= SETTINGS_MAX_KEYS)
+  {
+    return -1;
+  }
+  lock();
+  KeyIndex k = keyIndex[key];
+  if (k.valid)
+  {
+    esp_partition_read(partition, k.addr, buf, size < k.len ? size : k.len);
+    if (version) *version = k.version;
+  }
+  unlock();
+  return k.valid ? k.len : -1;
+}
+
+void Settings_Begin()
+{
+  lock();
+  stageLen = 0;
+}
+
+/**
+ * @brief 已存值是否与 data 完全相同
+ */
+static bool sameAsStored(uint8_t key, uint8_t version, const void *data, size_t len)
+{
+  const KeyIndex &k = keyIndex[key];
+  if (!k.valid || k.version != version || k.len != len)
+  {
+    return false;
+  }
+  uint8_t chunk[64];
+  for (size_t off = 0; off < len; off += sizeof(chunk))
+  {
+    size_t n = len - off < sizeof(chunk) ? len - off : sizeof(chunk);
+    esp_partition_read(partition, k.addr + off, chunk, n);
+    if (memcmp(chunk, (const uint8_t *)data + off, n) != 0) return false;
+  }
+  return true;
+}
+
+bool Settings_Put(uint8_t key, uint8_t version, const void *data, size_t len)
+{
+  if (partition == NULL || key == 0 || key >= SETTINGS_MAX_KEYS)
+  {
+    return false;
+  }
+  if (sameAsStored(key, version, data, len))
+  {
+    stats.unchanged++;
+    return true;
+  }
+  if (stageLen + ENTRY_HEADER_SIZE + len > SETTINGS_BATCH_MAX)
+  {
+    Serial.printf("[Settings] key %u too large (%u bytes)\n", key, (unsigned)len);
+    return false;
+  }
+  EntryHeader e = {key, version, (uint16_t)len};
+  memcpy(stageBuf + stageLen, &e, sizeof(e));
+  memcpy(stageBuf + stageLen + ENTRY_HEADER_SIZE, data, len);
+  stageLen += ENTRY_HEADER_SIZE + len;
+  stats.payloadBytes += len;
+  return true;
+}
+
+bool Settings_Commit()
+{
+  bool ok = true;
+  if (stageLen > 0)
+  {
+    ok = appendBatch(stageBuf, stageLen);
+    stats.commits++;
+    stageLen = 0;
+    if (!ok) Serial.println("[Settings] commit failed");
+  }
+  if (spareCount() < SETTINGS_SPARE_SECTORS)
+  {
+    if (settingsTaskHandle) xTaskNotifyGive(settingsTaskHandle);
+    else compactAsNeeded();
+  }
+  unlock();
+  return ok;
+}
+
+void Settings_Abort()
+{
+  stageLen = 0;
+  unlock();
+}
+
+bool Settings_Write(uint8_t key, uint8_t version, const void *data, size_t len)
+{
+  Settings_Begin();
+  if (!Settings_Put(key, version, data, len))
+  {
+    Settings_Abort();
+    return false;
+  }
+  return Settings_Commit();
+}
+
+SettingsStats Settings_GetStats()
+{
+  lock();
+  SettingsStats s = stats;
+  s.sectors = sectorCount;
+  s.spareSectors = spareCount();
+  s.liveBytes = 0;
+  s.maxEraseCount = 0;
+  for (int key = 1; key < SETTINGS_MAX_KEYS; key++)
+  {
+    if (keyIndex[key].valid) s.liveBytes += keyIndex[key].len;
+  }
+  for (int i = 0; i < sectorCount; i++)
+  {
+    if (sectors[i].eraseCount > s.maxEraseCount) s.maxEraseCount = sectors[i].eraseCount;
+  }
+  unlock();
+  return s;
+}
+
+void Settings_Dump()
+{
+  SettingsStats s = Settings_GetStats();
+  if (!s.mounted)
+  {
+    Serial.println("[Settings] not mounted");
+    return;
+  }
+  float wa = s.payloadBytes ? (float)s.flashBytes / s.payloadBytes : 0.0f;
+  Serial.printf("[Settings] sectors %u spare %u live %uB | commits %lu unchanged %lu | payload %luB flash %luB wa %.2f | erases %lu compactions %lu maxErase %lu\n",
+                s.sectors, s.spareSectors, s.liveBytes, (unsigned long)s.commits, (unsigned long)s.unchanged,
+                (unsigned long)s.payloadBytes, (unsigned long)s.flashBytes, wa,
+                (unsigned long)s.erases, (unsigned long)s.compactions, (unsigned long)s.maxEraseCount);
+}
+
+bool Settings_HandleCommand(const char *line)
+{
+  if (strncmp(line, "settings", 8) != 0)
+  {
+    return false;
+  }
+  Settings_Dump();
+  return true;
+}
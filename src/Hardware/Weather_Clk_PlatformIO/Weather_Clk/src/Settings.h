@@ -0,0 +1,106 @@
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <Arduino.h>
+
+#define SETTINGS_PARTITION_LABEL   "settings" // partition.csv 中的设置分区
+#define SETTINGS_PARTITION_SUBTYPE 0x40       // 自定义数据分区子类型
+#define SETTINGS_SECTOR_SIZE       4096       // 闪存擦除单位
+#define SETTINGS_SPARE_SECTORS     2          // 后台整理保持的空白扇区数，整理时至少还有一个可写
+#define SETTINGS_BATCH_MAX         512        // 一次提交 (所有记录加起来) 的最大字节数
+#define SETTINGS_MAX_KEYS          16         // 键的取值范围 1 ~ SETTINGS_MAX_KEYS-1
+
+/**
+ * @brief 设置记录的键，每个键保存一个模块的完整设置。
+ * @details 键值只能追加，已发布的键不能改作他用，旧固件写入的记录仍按原来的含义读取。
+ */
+enum SettingsKey
+{
+    SETTINGS_KEY_ALARMS = 1, ///< 闹钟数组 (Alarm.cpp)。
+    SETTINGS_KEY_TARGET = 2, ///< 倒计时目标和进度条 (TargetSettings.cpp)。
+    SETTINGS_KEY_POWER = 3   ///< 空闲调暗和熄屏时间 (Power.cpp)。
+};
+
+/**
+ * @brief 设置存储的统计，用于评估写放大和擦除次数。
+ */
+struct SettingsStats
+{
+    uint32_t commits;       ///< 实际写入闪存的提交次数。
+    uint32_t unchanged;     ///< 内容与已存值相同而跳过的记录数。
+    uint32_t payloadBytes;  ///< 调用者要求保存的记录内容字节数 (不含跳过的)。
+    uint32_t flashBytes;    ///< 写入闪存的总字节数，含记录头、扇区头和整理时的搬移。
+    uint32_t erases;        ///< 扇区擦除次数。
+    uint32_t compactions;   ///< 整理 (回收最旧扇区) 次数。
+    uint32_t maxEraseCount; ///< 各扇区中最大的擦除计数。
+    uint16_t sectors;       ///< 分区的扇区数。
+    uint16_t spareSectors;  ///< 当前空白扇区数。
+    uint16_t liveBytes;     ///< 所有键的最新值占用的字节数。
+    bool mounted;           ///< 分区是否可用。
+};
+
+/**
+ * @brief 挂载设置分区并重建键索引，启动后台整理任务。
+ * @details 设置以追加方式写入日志：每次提交是一条带 CRC 的批记录，旧值不会被覆盖。
+ *          挂载时按扇区序号从旧到新扫描，每个键取最后一条完整记录的值；
+ *          写了一半的记录 (掉电) CRC 不符，连同扇区中其后的内容一起忽略。
+ *          没有设置分区时 (分区表未更新) 所有读取失败，写入被丢弃。
+ */
+void Settings_Init();
+
+/**
+ * @brief 读取一个键的最新值。
+ * @param key 设置键。
+ * @param buf 输出缓冲区。
+ * @param size 缓冲区大小，值比它长时只读取前 size 字节。
+ * @param version 输出记录的格式版本，可为NULL。调用者据此决定直接使用、迁移还是丢弃。
+ * @return 值的实际长度，键不存在时返回 -1。
+ */
+int Settings_Read(uint8_t key, void *buf, size_t size, uint8_t *version);
+
+/**
+ * @brief 开始一次提交，其后的 Settings_Put 在 Settings_Commit 时一起原子写入。
+ * @details 提交期间持有设置锁，其他任务的读写等待到提交结束。
+ */
+void Settings_Begin();
+
+/**
+ * @brief 把一条记录加入当前提交，内容与已存值相同时跳过。
+ * @param version 记录的格式版本，结构体布局改变时递增。
+ * @return 提交缓冲区放不下时返回 false。
+ */
+bool Settings_Put(uint8_t key, uint8_t version, const void *data, size_t len);
+
+/**
+ * @brief 把当前提交写入闪存：要么全部生效，要么 (掉电时) 全部不生效。
+ * @return 写入失败时返回 false，已存的旧值保持不变。
+ */
+bool Settings_Commit();
+
+/**
+ * @brief 放弃当前提交。
+ */
+void Settings_Abort();
+
+/**
+ * @brief 写入单个键，等同于 Begin + Put + Commit。
+ */
+bool Settings_Write(uint8_t key, uint8_t version, const void *data, size_t len);
+
+/**
+ * @brief 获取存储统计。
+ */
+SettingsStats Settings_GetStats();
+
+/**
+ * @brief 在串口输出存储统计和写放大 (闪存写入字节 / 记录内容字节)。
+ */
+void Settings_Dump();
+
+/**
+ * @brief 处理串口调试命令 "settings"。
+ * @return 是设置命令时返回 true。
+ */
+bool Settings_HandleCommand(const char *line);
+
+#endif // SETTINGS_H
@@ -5,6 +5,8 @@
 #include "Buzzer.h"
 #include "RotaryEncoder.h"
 #include "weather.h"
+#include "Display.h"
+#include "Screen.h"
 
 // --- 秒表状态的全局变量 ---
 static unsigned long stopwatch_start_time = 0;   // 秒表开始或恢复运行的时间戳
@@ -79,78 +81,95 @@ void displayStopwatchTime(unsigned long elapsed_millis) {
         menuSprite.drawString("READY", menuSprite.width() / 2, menuSprite.height() - 80);
     }
 
-    menuSprite.pushSprite(0, 0); // 将Sprite内容推送到屏幕
+    Display_Present(); // 将Sprite内容推送到屏幕
 }
 
 /**
- * @brief 秒表功能的主菜单函数
- * @details 管理秒表的启动、暂停、恢复和重置逻辑，并处理用户输入。
+ * @brief 当前应显示的秒表读数
  */
-void StopwatchMenu() {
-    // 进入菜单时重置所有状态
+static unsigned long stopwatchReading(unsigned long now) {
+    return stopwatch_running ? stopwatch_elapsed_time + (now - stopwatch_start_time) : stopwatch_elapsed_time;
+}
+
+// --- 页面状态 ---
+static unsigned long last_displayed_stopwatch_millis = 0; // 上一帧显示的读数
+static unsigned long last_realtime_clock_update = 0;      // 上次刷新顶部时钟的时刻
+
+/**
+ * @brief [页面] 进入时重置所有状态
+ */
+static void stopwatchEnter() {
     stopwatch_start_time = 0;
     stopwatch_elapsed_time = 0;
     stopwatch_running = false;
     stopwatch_pause_time = 0;
-    displayStopwatchTime(0); // 初始绘制界面
-    
-    static unsigned long last_displayed_stopwatch_millis = 0;
-    unsigned long last_realtime_clock_update = millis();
-
-    while (true) {
-        // 检查全局退出条件
-        if (exitSubMenu || g_alarm_is_ringing) {
-            exitSubMenu = false;
-            return;
-        }
+    last_displayed_stopwatch_millis = 0;
+    last_realtime_clock_update = millis();
+}
 
-        // 长按按钮重置并退出
-        if (readButtonLongPress()) {
-            tone(BUZZER_PIN, 1500, 100); // 退出提示音
-            // 重置所有状态
-            stopwatch_start_time = 0;
-            stopwatch_elapsed_time = 0;
+/**
+ * @brief [页面] 短按开始/暂停，长按重置并退出
+ * @return 百分之一秒变化或顶部时钟需要刷新时请求重绘
+ */
+static ScreenAction stopwatchUpdate(const ScreenInput &input) {
+    // 长按按钮重置并退出
+    if (input.longPress) {
+        Buzzer_Tone(1500, 100); // 退出提示音
+        return SCREEN_EXIT;
+    }
+
+    // 短按按钮用于开始/暂停
+    if (input.click) {
+        Buzzer_Tone(2000, 50); // 确认音
+        if (stopwatch_running) { // 如果正在运行 -> 暂停
+            // 累加本次运行的时间
+            stopwatch_elapsed_time += (input.nowMs - stopwatch_start_time);
             stopwatch_running = false;
-            menuSprite.setTextFont(1); menuSprite.setTextSize(1); // 恢复默认字体
-            return; // 退出函数，返回主菜单
+        } else { // 如果已暂停或停止 -> 开始/恢复
+            stopwatch_start_time = input.nowMs; // 记录新的开始时间
+            stopwatch_running = true;
         }
+        return SCREEN_REDRAW; // 状态文本改变
+    }
 
-        // 短按按钮用于开始/暂停
-        if (readButton()) {
-            tone(BUZZER_PIN, 2000, 50); // 确认音
-            if (stopwatch_running) { // 如果正在运行 -> 暂停
-                // 累加本次运行的时间
-                stopwatch_elapsed_time += (millis() - stopwatch_start_time);
-                stopwatch_running = false;
-            } else { // 如果已暂停或停止 -> 开始/恢复
-                stopwatch_start_time = millis(); // 记录新的开始时间
-                stopwatch_running = true;
-            }
-            // 状态改变后立即更新显示
-            unsigned long current_display_value = stopwatch_running ? 
-                (stopwatch_elapsed_time + (millis() - stopwatch_start_time)) : 
-                stopwatch_elapsed_time;
-            displayStopwatchTime(current_display_value);
-            last_displayed_stopwatch_millis = current_display_value;
-        }
+    // 如果百分之一秒发生变化，或者顶部的实时时钟需要更新，则重绘整个屏幕
+    unsigned long reading = stopwatchReading(input.nowMs);
+    if (reading / 10 != last_displayed_stopwatch_millis / 10) {
+        return SCREEN_REDRAW;
+    }
+    if (input.nowMs - last_realtime_clock_update >= 1000) {
+        last_realtime_clock_update = input.nowMs;
+        return SCREEN_REDRAW;
+    }
+    return SCREEN_IDLE;
+}
 
-        // --- 频繁更新显示 ---
-        unsigned long current_stopwatch_display_millis;
-        if (stopwatch_running) {
-            current_stopwatch_display_millis = stopwatch_elapsed_time + (millis() - stopwatch_start_time);
-        } else {
-            current_stopwatch_display_millis = stopwatch_elapsed_time;
-        }
-        
-        // 如果百分之一秒发生变化，或者顶部的实时时钟需要更新，则重绘整个屏幕
-        if (current_stopwatch_display_millis / 10 != last_displayed_stopwatch_millis / 10 || (millis() - last_realtime_clock_update) >= 1000) {
-            displayStopwatchTime(current_stopwatch_display_millis);
-            last_displayed_stopwatch_millis = current_stopwatch_display_millis;
-            if ((millis() - last_realtime_clock_update) >= 1000) {
-                last_realtime_clock_update = millis();
-            }
-        }
+/**
+ * @brief [页面] 绘制当前读数
+ */
+static void stopwatchRender() {
+    last_displayed_stopwatch_millis = stopwatchReading(millis());
+    displayStopwatchTime(last_displayed_stopwatch_millis);
+}
 
-        vTaskDelay(pdMS_TO_TICKS(10)); // 短暂延时，防止CPU空转
-    }
+/**
+ * @brief [页面] 退出时重置状态并恢复默认字体
+ */
+static void stopwatchExit(ScreenExitReason reason) {
+    stopwatch_start_time = 0;
+    stopwatch_elapsed_time = 0;
+    stopwatch_running = false;
+    menuSprite.setTextFont(1); menuSprite.setTextSize(1); // 恢复默认字体
+}
+
+// 每帧最多重绘一次，与渲染任务的最小推送间隔一致
+static const ScreenDef stopwatchScreen = {"stopwatch", DISPLAY_MIN_FRAME_MS, true, stopwatchEnter, stopwatchUpdate,
+                                          stopwatchRender, stopwatchExit};
+
+/**
+ * @brief 秒表功能的主菜单函数
+ * @details 管理秒表的启动、暂停、恢复和重置逻辑，由页面调度器驱动。
+ */
+void StopwatchMenu() {
+    Screen_Run(stopwatchScreen);
 }
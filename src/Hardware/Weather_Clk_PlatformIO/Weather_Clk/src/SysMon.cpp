@@ -0,0 +1,535 @@
+// 包含所有必需的头文件
+#include "SysMon.h"
+#include "Display.h"
+#include "Menu.h"
+#include "MQTT.h"
+#include "Alarm.h"
+#include "Power.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_task_wdt.h>
+#include <esp_system.h>
+#include <esp_partition.h>
+#include <esp_freertos_hooks.h>
+
+#define SCREEN_ROW_HEIGHT 10 // 诊断页面每行高度
+#define SCREEN_LIST_TOP   36 // 任务列表第一行的Y坐标
+#define SCREEN_ROWS       ((240 - SCREEN_LIST_TOP) / SCREEN_ROW_HEIGHT)
+
+static const char *const stateNames[] = {"run", "ready", "block", "susp", "del"};
+
+/**
+ * @brief 任务表中的一项，按任务名合并同名的多个实例
+ */
+struct TaskEntry
+{
+  SysMonTask info;
+  TaskHandle_t handle;  // 最近一次见到的实例
+  uint32_t lastRunTime; // 该实例上次采样时的累计运行时间
+  bool stackWarned;
+};
+
+/**
+ * @brief 一个登记了心跳的任务
+ */
+struct Watch
+{
+  TaskHandle_t handle;
+  uint32_t timeoutMs;
+  volatile uint32_t lastMs;
+  bool stalled;
+};
+
+// --- 全局变量 ---
+static TaskEntry tasks[SYSMON_MAX_TASKS];
+static int taskCount = 0;
+static Watch watches[SYSMON_MAX_WATCHES];
+static SysMonStats stats;
+static TaskStatus_t statusBuf[SYSMON_MAX_TASKS];
+static portMUX_TYPE monMux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t monTaskHandle = NULL;
+static uint32_t lastTotalRunTime = 0;
+static bool stallReported = false;
+
+#if !configGENERATE_RUN_TIME_STATS
+// --- 没有运行时间统计时，每个系统节拍记下正在运行的任务 ---
+static volatile TaskHandle_t tickHandles[SYSMON_MAX_TASKS];
+static volatile uint32_t tickCounts[SYSMON_MAX_TASKS];
+static volatile uint32_t tickTotal = 0;
+
+/**
+ * @brief [系统节拍钩子] 给当前任务计一个节拍，在中断中运行
+ */
+static void IRAM_ATTR cpuTickHook()
+{
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  tickTotal++;
+  for (int i = 0; i < SYSMON_MAX_TASKS; i++)
+  {
+    if (tickHandles[i] == self)
+    {
+      tickCounts[i]++;
+      return;
+    }
+    if (tickHandles[i] == NULL)
+    {
+      tickHandles[i] = self;
+      tickCounts[i] = 1;
+      return;
+    }
+  }
+}
+#endif
+
+/**
+ * @brief 按名字查找任务表，没有时新建一项
+ */
+static TaskEntry *findEntry(const char *name)
+{
+  for (int i = 0; i < taskCount; i++)
+  {
+    if (strncmp(tasks[i].info.name, name, sizeof(tasks[i].info.name)) == 0) return &tasks[i];
+  }
+  if (taskCount >= SYSMON_MAX_TASKS) return NULL;
+  TaskEntry *e = &tasks[taskCount++];
+  memset(e, 0, sizeof(*e));
+  strncpy(e->info.name, name, sizeof(e->info.name) - 1);
+  e->info.stackMin = UINT32_MAX;
+  return e;
+}
+
+/**
+ * @brief 读取一次所有任务的状态，更新栈余量和CPU占用
+ */
+static void sample()
+{
+#if configUSE_TRACE_FACILITY
+  uint32_t totalRunTime = 0;
+  int n = uxTaskGetSystemState(statusBuf, SYSMON_MAX_TASKS, &totalRunTime);
+#if configGENERATE_RUN_TIME_STATS
+  uint32_t totalDelta = totalRunTime - lastTotalRunTime;
+  lastTotalRunTime = totalRunTime;
+#else
+  // 取出并清零节拍计数
+  TaskHandle_t handles[SYSMON_MAX_TASKS];
+  uint32_t counts[SYSMON_MAX_TASKS];
+  portENTER_CRITICAL(&monMux);
+  for (int i = 0; i < SYSMON_MAX_TASKS; i++)
+  {
+    handles[i] = tickHandles[i];
+    counts[i] = tickCounts[i];
+    tickHandles[i] = NULL;
+    tickCounts[i] = 0;
+  }
+  uint32_t totalDelta = tickTotal;
+  tickTotal = 0;
+  portEXIT_CRITICAL(&monMux);
+#endif
+
+  uint32_t busyX10 = 0;
+  portENTER_CRITICAL(&monMux);
+  for (int i = 0; i < taskCount; i++) tasks[i].info.alive = false;
+  stats.tasks = n;
+  stats.stackMin = UINT32_MAX;
+  for (int s = 0; s < n; s++)
+  {
+    const TaskStatus_t &ts = statusBuf[s];
+    TaskEntry *e = findEntry(ts.pcTaskName);
+    if (!e) continue;
+    if (e->handle != ts.xHandle)
+    {
+      e->handle = ts.xHandle;
+      e->lastRunTime = 0;
+      e->info.instances++;
+    }
+
+#if configGENERATE_RUN_TIME_STATS
+    uint32_t delta = ts.ulRunTimeCounter - e->lastRunTime;
+    e->lastRunTime = ts.ulRunTimeCounter;
+#else
+    uint32_t delta = 0;
+    for (int i = 0; i < SYSMON_MAX_TASKS && handles[i]; i++)
+    {
+      if (handles[i] == ts.xHandle) delta = counts[i];
+    }
+#endif
+    e->info.cpuX10 = totalDelta ? (uint16_t)((uint64_t)delta * 1000 / totalDelta) : 0;
+    if (strncmp(ts.pcTaskName, "IDLE", 4) != 0) busyX10 += e->info.cpuX10;
+
+    e->info.alive = true;
+    e->info.priority = ts.uxCurrentPriority;
+    e->info.state = ts.eCurrentState;
+    e->info.stackFree = ts.usStackHighWaterMark; // ESP-IDF 中以字节为单位
+    if (e->info.stackFree < e->info.stackMin) e->info.stackMin = e->info.stackFree;
+    if (e->info.stackMin < stats.stackMin)
+    {
+      stats.stackMin = e->info.stackMin;
+      memcpy(stats.stackMinTask, e->info.name, sizeof(stats.stackMinTask));
+    }
+  }
+  stats.cpuX10 = busyX10 > 1000 ? 1000 : busyX10;
+  stats.samples++;
+  portEXIT_CRITICAL(&monMux);
+
+  // 串口输出放在临界区之外
+  for (int i = 0; i < taskCount; i++)
+  {
+    TaskEntry &e = tasks[i];
+    if (e.info.alive && !e.stackWarned && e.info.stackFree < SYSMON_STACK_WARN)
+    {
+      e.stackWarned = true;
+      Serial.printf("[SysMon] task %s stack low: %lu bytes free\n", e.info.name, (unsigned long)e.info.stackFree);
+    }
+  }
+#endif
+}
+
+/**
+ * @brief 检查登记了心跳的任务，返回心跳超时的任务数
+ * @details 已被删除的任务 (不在本次采样中) 的登记被清除。
+ */
+static uint8_t checkHeartbeats()
+{
+  uint32_t now = millis();
+  uint8_t stalled = 0;
+  for (int w = 0; w < SYSMON_MAX_WATCHES; w++)
+  {
+    Watch &watch = watches[w];
+    if (watch.handle == NULL) continue;
+
+    bool alive = false;
+    for (int i = 0; i < taskCount; i++)
+    {
+      if (tasks[i].handle == watch.handle && tasks[i].info.alive) alive = true;
+    }
+    if (!alive)
+    {
+      watch.handle = NULL;
+      continue;
+    }
+
+    uint32_t age = now - watch.lastMs;
+    bool late = watch.timeoutMs && age > watch.timeoutMs;
+    if (late && !watch.stalled)
+    {
+      Serial.printf("[SysMon] task %s missed its heartbeat for %lu ms (limit %lu ms)\n", pcTaskGetName(watch.handle),
+                    (unsigned long)age, (unsigned long)watch.timeoutMs);
+    }
+    watch.stalled = late;
+    if (late) stalled++;
+  }
+  return stalled;
+}
+
+/**
+ * @brief [FreeRTOS Task] 监控任务：采样、检查心跳、喂狗
+ */
+static void SysMon_Task(void *pvParameters)
+{
+  esp_task_wdt_add(NULL);
+  for (;;)
+  {
+    sample();
+    stats.stalled = checkHeartbeats();
+    if (stats.stalled == 0)
+    {
+      esp_task_wdt_reset();
+      stallReported = false;
+    }
+    else if (!stallReported)
+    {
+      // 不再喂狗，看门狗超时后 panic 并写入 coredump
+      stallReported = true;
+      Serial.printf("[SysMon] watchdog will fire in %d s\n", SYSMON_WDT_TIMEOUT_S);
+      SysMon_Dump();
+    }
+    vTaskDelay(pdMS_TO_TICKS(Power_IsIdle() ? SYSMON_IDLE_PERIOD_MS : SYSMON_PERIOD_MS));
+  }
+}
+
+/**
+ * @brief 查找 coredump 分区
+ */
+static const esp_partition_t *coreDumpPartition()
+{
+  return esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_COREDUMP, NULL);
+}
+
+/**
+ * @brief coredump 分区中转储的大小
+ * @details 转储以总长度开头，擦除后的分区读到 0xFFFFFFFF。
+ */
+static uint32_t coreDumpSize()
+{
+  const esp_partition_t *part = coreDumpPartition();
+  uint32_t len = 0xFFFFFFFF;
+  if (part == NULL || esp_partition_read(part, 0, &len, sizeof(len)) != ESP_OK) return 0;
+  return (len == 0xFFFFFFFF || len == 0 || len > part->size) ? 0 : len;
+}
+
+/**
+ * @brief 复位原因的显示名
+ */
+static const char *resetReasonName(esp_reset_reason_t reason)
+{
+  switch (reason)
+  {
+  case ESP_RST_POWERON: return "power-on";
+  case ESP_RST_SW: return "software";
+  case ESP_RST_PANIC: return "panic";
+  case ESP_RST_INT_WDT: return "interrupt watchdog";
+  case ESP_RST_TASK_WDT: return "task watchdog";
+  case ESP_RST_WDT: return "other watchdog";
+  case ESP_RST_DEEPSLEEP: return "deep sleep";
+  case ESP_RST_BROWNOUT: return "brownout";
+  default: return "other";
+  }
+}
+
+void SysMon_Init()
+{
+  esp_task_wdt_init(SYSMON_WDT_TIMEOUT_S, SYSMON_WDT_PANIC);
+#if !configGENERATE_RUN_TIME_STATS
+  esp_register_freertos_tick_hook(cpuTickHook);
+#endif
+  stats.runTimeStats = configGENERATE_RUN_TIME_STATS;
+  stats.coreDumpBytes = coreDumpSize();
+
+  Serial.printf("[SysMon] last reset: %s\n", resetReasonName(esp_reset_reason()));
+  if (stats.coreDumpBytes)
+  {
+    Serial.printf("[SysMon] core dump from a previous crash: %lu bytes, \"tasks coredump\" for details\n",
+                  (unsigned long)stats.coreDumpBytes);
+  }
+  xTaskCreate(SysMon_Task, "SysMon", 3072, NULL, SYSMON_TASK_PRIO, &monTaskHandle);
+}
+
+void SysMon_Watch(uint32_t timeoutMs)
+{
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  portENTER_CRITICAL(&monMux);
+  int slot = -1;
+  for (int i = 0; i < SYSMON_MAX_WATCHES; i++)
+  {
+    if (watches[i].handle == self) slot = i;
+    else if (slot < 0 && watches[i].handle == NULL) slot = i;
+  }
+  if (slot >= 0)
+  {
+    watches[slot].timeoutMs = timeoutMs;
+    watches[slot].lastMs = millis();
+    watches[slot].stalled = false;
+    watches[slot].handle = self;
+  }
+  portEXIT_CRITICAL(&monMux);
+}
+
+void SysMon_Heartbeat()
+{
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  for (int i = 0; i < SYSMON_MAX_WATCHES; i++)
+  {
+    if (watches[i].handle == self)
+    {
+      watches[i].lastMs = millis();
+      return;
+    }
+  }
+}
+
+int SysMon_GetTasks(SysMonTask *out, int max)
+{
+  uint32_t now = millis();
+  int n = 0;
+  portENTER_CRITICAL(&monMux);
+  for (int i = 0; i < taskCount && n < max; i++)
+  {
+    SysMonTask t = tasks[i].info;
+    t.watched = false;
+    for (int w = 0; w < SYSMON_MAX_WATCHES; w++)
+    {
+      if (watches[w].handle == NULL || watches[w].handle != tasks[i].handle || !t.alive) continue;
+      t.watched = true;
+      t.timeoutMs = watches[w].timeoutMs;
+      t.heartbeatAgeMs = now - watches[w].lastMs;
+      t.stalled = watches[w].stalled;
+    }
+    out[n++] = t;
+  }
+  portEXIT_CRITICAL(&monMux);
+
+  // 插入排序：存在的任务在前，按CPU占用从高到低
+  for (int i = 1; i < n; i++)
+  {
+    SysMonTask t = out[i];
+    int j = i - 1;
+    while (j >= 0 && (out[j].alive < t.alive || (out[j].alive == t.alive && out[j].cpuX10 < t.cpuX10)))
+    {
+      out[j + 1] = out[j];
+      j--;
+    }
+    out[j + 1] = t;
+  }
+  return n;
+}
+
+SysMonStats SysMon_GetStats()
+{
+  portENTER_CRITICAL(&monMux);
+  SysMonStats s = stats;
+  portEXIT_CRITICAL(&monMux);
+  return s;
+}
+
+int SysMon_FormatMqtt(char *buf, size_t size)
+{
+  SysMonStats s = SysMon_GetStats();
+  return snprintf(buf, size, "\"CPUUsage\":%u.%u,\"MinStack\":%lu,\"MinStackTask\":\"%s\",\"StalledTasks\":%u",
+                  s.cpuX10 / 10, s.cpuX10 % 10, (unsigned long)(s.stackMin == UINT32_MAX ? 0 : s.stackMin),
+                  s.stackMinTask, s.stalled);
+}
+
+void SysMon_Dump()
+{
+  static SysMonTask list[SYSMON_MAX_TASKS];
+  int n = SysMon_GetTasks(list, SYSMON_MAX_TASKS);
+  SysMonStats s = SysMon_GetStats();
+  Serial.printf("[SysMon] %u tasks, cpu %u.%u%% (%s), watchdog %d s%s\n", s.tasks, s.cpuX10 / 10, s.cpuX10 % 10,
+                s.runTimeStats ? "run-time stats" : "tick sampling", SYSMON_WDT_TIMEOUT_S,
+                SYSMON_WDT_PANIC ? " + core dump" : "");
+  Serial.println("[SysMon] task             prio state  cpu%  stack  min    inst  heartbeat");
+  for (int i = 0; i < n; i++)
+  {
+    const SysMonTask &t = list[i];
+    Serial.printf("[SysMon] %-16s %4u %-5s %3u.%u %6lu %6lu %4u  ", t.name, t.priority,
+                  t.alive ? stateNames[t.state < 5 ? t.state : 4] : "gone", t.cpuX10 / 10, t.cpuX10 % 10,
+                  (unsigned long)t.stackFree, (unsigned long)t.stackMin, t.instances);
+    if (!t.watched) Serial.println("-");
+    else if (t.timeoutMs == 0) Serial.printf("%lu ms ago\n", (unsigned long)t.heartbeatAgeMs);
+    else
+    {
+      Serial.printf("%lu/%lu ms%s\n", (unsigned long)t.heartbeatAgeMs, (unsigned long)t.timeoutMs,
+                    t.stalled ? " STALLED" : "");
+    }
+  }
+}
+
+bool SysMon_HandleCommand(const char *line)
+{
+  if (strncmp(line, "tasks", 5) != 0)
+  {
+    return false;
+  }
+  const char *arg = line + 5;
+  while (*arg == ' ') arg++;
+
+  if (strncmp(arg, "coredump", 8) == 0)
+  {
+    const esp_partition_t *part = coreDumpPartition();
+    if (part == NULL)
+    {
+      Serial.println("[SysMon] no coredump partition");
+    }
+    else if (strstr(arg, "erase"))
+    {
+      esp_err_t err = esp_partition_erase_range(part, 0, part->size);
+      stats.coreDumpBytes = err == ESP_OK ? 0 : coreDumpSize();
+      Serial.printf("[SysMon] core dump erase: %s\n", esp_err_to_name(err));
+    }
+    else
+    {
+      stats.coreDumpBytes = coreDumpSize();
+      Serial.printf("[SysMon] coredump partition at 0x%lx, %lu bytes; dump: %lu bytes\n", (unsigned long)part->address,
+                    (unsigned long)part->size, (unsigned long)stats.coreDumpBytes);
+      if (stats.coreDumpBytes)
+      {
+        Serial.printf("[SysMon] read with: esptool.py read_flash 0x%lx 0x%lx core.bin; espcoredump.py info_corefile -c core.bin -t raw firmware.elf\n",
+                      (unsigned long)part->address, (unsigned long)part->size);
+      }
+    }
+  }
+  else
+  {
+    SysMon_Dump();
+  }
+  return true;
+}
+
+/**
+ * @brief 绘制诊断页面
+ * @param first 列表中第一行显示的任务序号
+ */
+static void drawMonitor(const SysMonTask *list, int n, int first)
+{
+  SysMonStats s = SysMon_GetStats();
+  char line[48];
+
+  menuSprite.fillSprite(TFT_BLACK);
+  menuSprite.setTextFont(1);
+  menuSprite.setTextSize(1);
+  menuSprite.setTextDatum(TL_DATUM);
+
+  menuSprite.setTextColor(TFT_GREEN, TFT_BLACK);
+  snprintf(line, sizeof(line), "SYSTEM  cpu %u.%u%%  tasks %u", s.cpuX10 / 10, s.cpuX10 % 10, s.tasks);
+  menuSprite.drawString(line, 4, 4);
+  menuSprite.setTextColor(s.stalled ? TFT_RED : TFT_DARKGREY, TFT_BLACK);
+  snprintf(line, sizeof(line), "wdt %ds %s  dump %s", SYSMON_WDT_TIMEOUT_S, s.stalled ? "STALL" : "ok",
+           s.coreDumpBytes ? "yes" : "no");
+  menuSprite.drawString(line, 4, 14);
+  menuSprite.setTextColor(TFT_CYAN, TFT_BLACK);
+  menuSprite.drawString("task          cpu%  stack   hb", 4, 25);
+
+  for (int row = 0; row < SCREEN_ROWS && first + row < n; row++)
+  {
+    const SysMonTask &t = list[first + row];
+    char hb[8] = "-";
+    if (t.watched) snprintf(hb, sizeof(hb), "%lus", (unsigned long)(t.heartbeatAgeMs / 1000));
+    snprintf(line, sizeof(line), "%-13.13s %3u.%u %6lu %4s", t.name, t.cpuX10 / 10, t.cpuX10 % 10,
+             (unsigned long)(t.alive ? t.stackFree : t.stackMin), hb);
+
+    uint16_t color = TFT_WHITE;
+    if (!t.alive) color = TFT_DARKGREY;
+    else if (t.stalled || t.stackMin < SYSMON_STACK_WARN) color = TFT_RED;
+    menuSprite.setTextColor(color, TFT_BLACK);
+    menuSprite.drawString(line, 4, SCREEN_LIST_TOP + row * SCREEN_ROW_HEIGHT);
+  }
+  Display_Present();
+}
+
+void SystemMonitorMenu()
+{
+  static SysMonTask list[SYSMON_MAX_TASKS];
+  int first = 0;
+  uint32_t lastDraw = 0;
+  bool dirty = true;
+
+  while (true)
+  {
+    if (exitSubMenu || g_alarm_is_ringing)
+    {
+      exitSubMenu = false;
+      return;
+    }
+    if (readButton())
+    {
+      return;
+    }
+    int delta = readEncoder();
+    if (delta != 0)
+    {
+      first += delta;
+      dirty = true;
+    }
+
+    if (dirty || millis() - lastDraw >= SYSMON_PERIOD_MS)
+    {
+      int n = SysMon_GetTasks(list, SYSMON_MAX_TASKS);
+      int maxFirst = n > SCREEN_ROWS ? n - SCREEN_ROWS : 0;
+      first = constrain(first, 0, maxFirst);
+      drawMonitor(list, n, first);
+      lastDraw = millis();
+      dirty = false;
+    }
+    vTaskDelay(pdMS_TO_TICKS(15));
+  }
+}
@@ -0,0 +1,106 @@
+#ifndef SYSMON_H
+#define SYSMON_H
+
+#include <Arduino.h>
+
+#define SYSMON_MAX_TASKS      32    // 记录的任务名数，反复创建的同名任务共用一条
+#define SYSMON_MAX_WATCHES    8     // 登记心跳的任务数
+#define SYSMON_TASK_PRIO      6     // 高于所有应用任务，某个任务空转时监控仍能运行
+#define SYSMON_PERIOD_MS      1000  // 采样周期
+#define SYSMON_IDLE_PERIOD_MS 5000  // 调暗和熄屏时的采样周期，须小于看门狗超时
+#define SYSMON_STACK_WARN     256   // 栈余量 (字节) 低于此值时在串口告警一次，诊断页面标红
+#define SYSMON_WDT_TIMEOUT_S  15    // 任务看门狗超时：监控任务只在所有心跳正常时喂狗
+#define SYSMON_WDT_PANIC      1     // 看门狗超时时 panic，所有任务的栈写入 coredump 分区后重启
+
+/**
+ * @brief 一个任务 (按任务名) 的监控数据。
+ */
+struct SysMonTask
+{
+    char name[16];           ///< 任务名。
+    uint8_t priority;        ///< 当前优先级。
+    uint8_t state;           ///< eTaskState：0 运行、1 就绪、2 阻塞、3 挂起、4 已删除。
+    bool alive;              ///< 最近一次采样时是否存在。
+    uint16_t instances;      ///< 开机以来见过的实例数，反复创建的任务大于1。
+    uint16_t cpuX10;         ///< 上一个采样周期的CPU占用 (‰)。
+    uint32_t stackFree;      ///< 当前实例的栈历史最小余量 (字节)。
+    uint32_t stackMin;       ///< 所有实例中最小的栈余量 (字节)。
+    bool watched;            ///< 是否登记了心跳。
+    uint32_t timeoutMs;      ///< 心跳超时，0 表示只记录不检查。
+    uint32_t heartbeatAgeMs; ///< 距上次心跳的时间。
+    bool stalled;            ///< 心跳已超时。
+};
+
+/**
+ * @brief 监控汇总。
+ */
+struct SysMonStats
+{
+    uint16_t tasks;          ///< 当前存在的任务数。
+    uint16_t cpuX10;         ///< 上一个采样周期除空闲任务外的CPU占用 (‰)。
+    uint32_t samples;        ///< 采样次数。
+    uint32_t stackMin;       ///< 所有任务中最小的栈余量。
+    char stackMinTask[16];   ///< 栈余量最小的任务。
+    uint8_t stalled;         ///< 心跳超时的任务数，大于0时看门狗将在超时后触发。
+    bool runTimeStats;       ///< CPU占用来自 FreeRTOS 运行时间统计 (否则来自系统节拍采样)。
+    uint32_t coreDumpBytes;  ///< coredump 分区中上次崩溃的转储大小，0 表示没有。
+};
+
+/**
+ * @brief 启动监控任务并配置任务看门狗。
+ * @details 监控任务订阅任务看门狗，每个采样周期检查一次登记了心跳的任务，全部正常时才喂狗。
+ *          某个任务卡住时看门狗超时 panic，coredump 分区记下所有任务的栈，重启后可用 espcoredump.py 分析。
+ *          启动时报告上次复位原因和 coredump 分区中是否有转储。
+ */
+void SysMon_Init();
+
+/**
+ * @brief 登记当前任务的心跳，任务循环中调用 SysMon_Heartbeat。
+ * @param timeoutMs 心跳超时，0 表示只在诊断页面显示心跳间隔，不触发看门狗。
+ * @details 只适合有固定周期的循环：无限期阻塞等待的任务不应设置超时。
+ *          任务被删除后登记自动失效。
+ */
+void SysMon_Watch(uint32_t timeoutMs);
+
+/**
+ * @brief 当前任务报告自己仍在正常循环。没有登记的任务调用时不起作用。
+ */
+void SysMon_Heartbeat();
+
+/**
+ * @brief 获取各任务的监控数据，按CPU占用从高到低排序。
+ * @return 写入 out 的任务数。
+ */
+int SysMon_GetTasks(SysMonTask *out, int max);
+
+/**
+ * @brief 获取监控汇总。
+ */
+SysMonStats SysMon_GetStats();
+
+/**
+ * @brief 生成MQTT上报的属性片段 (不含外层花括号)，如 "CPUUsage":12.5,"MinStack":480,...
+ * @return 写入的字符数。
+ */
+int SysMon_FormatMqtt(char *buf, size_t size);
+
+/**
+ * @brief 在串口输出所有任务的优先级、状态、CPU占用、栈余量和心跳。
+ */
+void SysMon_Dump();
+
+/**
+ * @brief 处理串口命令 "tasks"。
+ * @details tasks                  输出任务表
+ *          tasks coredump         显示 coredump 分区中的转储
+ *          tasks coredump erase   擦除转储
+ * @return 是监控命令时返回 true。
+ */
+bool SysMon_HandleCommand(const char *line);
+
+/**
+ * @brief 诊断页面：任务表，旋转编码器滚动，单击退出。
+ */
+void SystemMonitorMenu();
+
+#endif // SYSMON_H
@@ -1,5 +1,6 @@
 #include <Arduino.h>
 #include <EEPROM.h>
+#include "Settings.h"
 #include <TFT_eSPI.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
@@ -16,11 +17,19 @@
 #include "DS18B20.h"
 #include "System.h"
 #include "ADC.h"
-#include "img.h"
 #include <OneWire.h>
 #include <DallasTemperature.h>
 #include "TargetSettings.h"
 #include "MQTT.h"
+#include "FontCache.h"
+#include "DigitAtlas.h"
+#include "Display.h"
+#include "HwScroll.h"
+#include "Memory.h"
+#include "Power.h"
+#include "Boot.h"
+#include "SysMon.h"
+#include "Worker.h"
 
 #define EEPROM_SIZE 256
 #define SCREEN_WIDTH 240
@@ -29,15 +38,15 @@
 // --- 外部变量声明 ---
 extern DallasTemperature sensors;
 extern OneWire oneWire;
-extern Adafruit_NeoPixel strip;
 
 // --- 全局对象实例化 ---
 TFT_eSPI tft = TFT_eSPI();
 TFT_eSprite menuSprite = TFT_eSprite(&tft); // 用于双缓冲的主Sprite
 
 // --- 日志系统变量 ---
-int tft_log_y = 40; // 日志在屏幕上开始的Y坐标
+int tft_log_y = LOG_TOP; // 日志在屏幕上开始的Y坐标
 int current_log_lines = 0; // 当前已显示的日志行数
+static bool logScrolling = false; // 日志区是否由面板硬件滚动
 
 /**
  * @brief 设置所有NeoPixel LED的颜色
@@ -47,11 +56,7 @@ int current_log_lines = 0; // 当前已显示的日志行数
  */
 void setLEDColor(uint8_t r, uint8_t g, uint8_t b)
 {
-    for (int i = 0; i < NUM_LEDS; i++)
-    {
-        strip.setPixelColor(i, strip.Color(r, g, b));
-    }
-    strip.show();
+    LedEngine_Solid(r, g, b);
 }
 
 /**
@@ -86,44 +91,6 @@ void typeWriterCommand(const char *text, int x, int y, uint32_t color = TFT_WHIT
     typeWriterEffect(text, x + 12, y, color, delayMs, true);
 }
 
-/**
- * @brief 在日志区域显示系统硬件信息
- */
-void displaySystemInfoTypewriter()
-{
-    // 芯片信息
-#ifdef CONFIG_IDF_TARGET_ESP32C3
-    tftLogInfo("Chip: ESP32-C3");
-#else
-    tftLogInfo("Chip: Unknown ESP");
-#endif
-
-    // 核心数
-    char coresInfo[20];
-    sprintf(coresInfo, "Cores: %d", 1);
-    tftLogInfo(coresInfo);
-
-    // CPU频率
-    char cpuInfo[25];
-    sprintf(cpuInfo, "CPU: %dMHz", ESP.getCpuFreqMHz());
-    tftLogInfo(cpuInfo);
-
-    // 闪存大小
-    char flashInfo[35];
-    sprintf(flashInfo, "Flash: %dMB", ESP.getFlashChipSize() / (1024 * 1024));
-    tftLogInfo(flashInfo);
-
-    // 可用堆内存
-    char heapInfo[30];
-    sprintf(heapInfo, "Heap: %d bytes", ESP.getFreeHeap());
-    tftLogInfo(heapInfo);
-
-    // SDK版本
-    char sdkInfo[25];
-    sprintf(sdkInfo, "SDK: %s", ESP.getSdkVersion());
-    tftLogInfo(sdkInfo);
-}
-
 /**
  * @brief 显示存储在EEPROM中的用户设置
  */
@@ -182,118 +149,263 @@ void displayEepromInfo()
     }
 }
 
+// 启动阶段序号，与 bootStages 中的顺序一致
+enum BootStageId
+{
+    STAGE_SETTINGS,
+    STAGE_DISPLAY,
+    STAGE_UI,
+    STAGE_BUZZER,
+    STAGE_LED,
+    STAGE_ENCODER,
+    STAGE_TARGET,
+    STAGE_ALARM,
+    STAGE_SENSOR,
+    STAGE_ADC,
+    STAGE_SERIAL,
+    STAGE_CREDS,
+    STAGE_WIFI,
+    STAGE_NTP,
+    STAGE_WEATHER,
+    STAGE_MQTT,
+    STAGE_SYSMON,
+    STAGE_COUNT
+};
+
+// 主菜单需要的阶段，全部完成后即进入菜单，其余阶段 (传感器、网络) 在后台继续
+#define BOOT_MENU_STAGES (BOOT_BIT(STAGE_SETTINGS) | BOOT_BIT(STAGE_DISPLAY) | BOOT_BIT(STAGE_UI) |   \
+                          BOOT_BIT(STAGE_BUZZER) | BOOT_BIT(STAGE_LED) | BOOT_BIT(STAGE_ENCODER) |    \
+                          BOOT_BIT(STAGE_TARGET) | BOOT_BIT(STAGE_CREDS))
+
+#define BOOT_WIFI_TIMEOUT_MS 20000 // 与原来 10 次 x 2 秒的连接等待相同
+#define BOOT_NTP_TIMEOUT_MS  15000
+#define BOOT_MQTT_TIMEOUT_MS 15000
+#define BOOT_PROGRESS_TOP    32    // 启动画面第一行阶段的Y坐标
+#define BOOT_PROGRESS_MS     100   // 启动画面刷新执行中阶段耗时的间隔
+
+static bool stageSettings()
+{
+    EEPROM.begin(EEPROM_SIZE); // 只用于导入旧版固件保存的设置
+    Settings_Init(); // 没有设置分区时各模块使用默认值，不影响后续阶段
+    return true;
+}
+
+static bool stageDisplay()
+{
+    tft.init();
+    tft.setRotation(1);
+    tft.fillScreen(TFT_BLACK);
+    Display_Init(); // 启动负责推送画面的渲染任务
+    return true;
+}
+
+static bool stageUi()
+{
+    menuSprite.createSprite(240, 240); // 创建与屏幕同样大小的Sprite
+    bool fontOk = FontCache_Init(); // 中文字体常驻加载一次，建立字形索引
+#if FONT_CACHE_BENCHMARK
+    FontCache_Benchmark(menuSprite);
+#endif
+    DigitAtlas_Init(); // 预先生成表盘时钟数字的图集
+    return menuSprite.created() && fontOk;
+}
+
+static bool stageBuzzer()
+{
+    Buzzer_Init();
+    Buzzer_Play(numSongs - 1, PLAY_ONCE, VOICE_NOTIFY); // "Windows XP"
+    return true;
+}
+
+static bool stageLed()
+{
+    LedEngine_Init(); // LED引擎独占灯带，需在任何灯效调用之前启动
+    return true;
+}
+
+static bool stageEncoder()
+{
+    initRotaryEncoder();
+    return true;
+}
+
+static bool stageTarget()
+{
+    TargetSettings_Init();
+    return true;
+}
+
+static bool stageAlarm()
+{
+    Alarm_Init(); // 须在校时之前注册校时回调，否则调度任务按未校准的时间睡眠
+    xTaskCreate(TimeUpdate_Task, "Time Update Task", 2048, NULL, 5, NULL);
+    return true;
+}
+
+static bool stageSensor()
+{
+    DS18B20_Init();
+    createDS18B20Task(); // 创建后台温度读取任务
+    return sensors.getDeviceCount() > 0;
+}
+
+static bool stageAdc()
+{
+    setupADC();
+    Serial.printf("[Boot] ADC raw %d\n", adc1_get_raw(ADC1_CHANNEL_2));
+    startADC(); // 启动ADC后台读取任务
+    return true;
+}
+
+static bool stageSerial()
+{
+    startPerformanceMonitoring(); // 启动性能数据和串口命令后台接收任务
+    return true;
+}
+
+static bool stageCreds()
+{
+    return hasSavedWiFi(); // 没有保存的网络时由 bootSystem 在前台打开配置门户
+}
+
+static bool stageWifi()
+{
+    return connectSavedWiFi(BOOT_WIFI_TIMEOUT_MS);
+}
+
+static bool stageNtp()
+{
+    return syncTimeInBackground(BOOT_NTP_TIMEOUT_MS);
+}
+
+static bool stageWeather()
+{
+    return fetchWeatherInBackground();
+}
+
+static bool stageMqtt()
+{
+    setupMQTT(); // MQTT任务自己等待WiFi并重连，这里只记录首次连上所用的时间
+    uint32_t start = millis();
+    while (!isMQTTConnected() && millis() - start < BOOT_MQTT_TIMEOUT_MS)
+    {
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+    return isMQTTConnected();
+}
+
+static bool stageSysMon()
+{
+    SysMon_Init(); // 各阶段启动的后台任务在首次心跳时登记，不依赖其他阶段
+    return true;
+}
+
+static const BootStageDef bootStages[STAGE_COUNT] = {
+    {"settings", stageSettings, 0, 4096},
+    {"display", stageDisplay, 0, 3072},
+    {"ui", stageUi, BOOT_BIT(STAGE_DISPLAY), 4096},
+    {"buzzer", stageBuzzer, 0, 2048},
+    {"led", stageLed, 0, 2048},
+    {"encoder", stageEncoder, 0, 2048},
+    {"target", stageTarget, BOOT_BIT(STAGE_SETTINGS), 3072},
+    {"alarm", stageAlarm, BOOT_BIT(STAGE_SETTINGS) | BOOT_BIT(STAGE_BUZZER), 3072},
+    {"sensor", stageSensor, 0, 2048},
+    {"adc", stageAdc, 0, 2048},
+    {"serial", stageSerial, 0, 2048},
+    {"creds", stageCreds, 0, 3072},
+    {"wifi", stageWifi, BOOT_BIT(STAGE_CREDS), 4096},
+    {"ntp", stageNtp, BOOT_BIT(STAGE_WIFI) | BOOT_BIT(STAGE_ALARM), 3072},
+    {"weather", stageWeather, BOOT_BIT(STAGE_WIFI), 6144},
+    {"mqtt", stageMqtt, 0, 2048},
+    {"sysmon", stageSysMon, 0, 3072},
+};
+
 /**
- * @brief 执行硬件自检并显示结果
+ * @brief 画出启动阶段列表中的一行：阶段名、状态和耗时
  */
-void hardwareTest()
+static void drawBootStage(int i)
 {
-    // 蜂鸣器测试
-    tftLogInfo("Testing Buzzer...");
-    tone(BUZZER_PIN, 1500, 200);
-    delay(300);
-    tftLogSuccess("Buzzer: OK");
-
-    // DS18B20温度传感器测试
-    tftLogInfo("Testing DS18B20...");
-    sensors.begin();
-    if (sensors.getDeviceCount() == 0)
+    static const uint16_t statusColors[] = {TFT_DARKGREY, TFT_YELLOW, TFT_GREEN, TFT_RED, TFT_DARKGREY};
+    BootStageInfo info = Boot_GetStage(i);
+    char line[40];
+    if (info.status == BOOT_PENDING)
     {
-        tftLogError("No DS18B20 sensors detected");
+        snprintf(line, sizeof(line), "%-8s %-7s %7s", bootStages[i].name, Boot_StatusName(info.status), "");
     }
     else
     {
-        tftLogSuccess("DS18B20: OK");
+        snprintf(line, sizeof(line), "%-8s %-7s %5lums", bootStages[i].name, Boot_StatusName(info.status),
+                 (unsigned long)info.durationMs);
     }
-
-    // LED灯带测试
-    tftLogInfo("Testing LEDs...");
-    setLEDColor(255, 0, 0); delay(200);
-    setLEDColor(0, 255, 0); delay(200);
-    setLEDColor(0, 0, 255); delay(200);
-    setLEDColor(0, 0, 0);
-    tftLogSuccess("LEDs: OK");
-
-    // ADC测试
-    tftLogInfo("Testing ADC...");
-    char adcStr[25];
-    sprintf(adcStr, "ADC: %lu OK", (unsigned long) adc1_get_raw(ADC1_CHANNEL_2));
-    tftLogSuccess(adcStr);
+    tft.setTextColor(statusColors[info.status], TFT_BLACK);
+    tft.drawString(line, LOG_MARGIN, BOOT_PROGRESS_TOP + i * LOG_LINE_HEIGHT);
 }
 
 /**
- * @brief 播放开机动画和显示启动信息
+ * @brief 显示启动进度，直到主菜单需要的阶段全部完成
+ * @details 屏幕在 display 阶段完成后才能使用；之后每个阶段完成时、以及每 BOOT_PROGRESS_MS 刷新一次。
+ *          已经有结果的行不再重画。
  */
-void bootAnimation()
+static void showBootProgress()
 {
-    // 播放开机音乐
-    static int boot_song_index = numSongs - 1; // "Windows XP"
-    xTaskCreatePinnedToCore(Buzzer_PlayMusic_Task, "BootSound", 8192, &boot_song_index, 1, NULL, 0);
-
-    // 播放GIF动画
-    const uint16_t *boot_gif[] = { huaji_0,huaji_1,huaji_2,huaji_3,huaji_4,huaji_5,huaji_6,huaji_7,huaji_8,huaji_9,huaji_10,huaji_11,huaji_12,huaji_13,huaji_14,huaji_15 };
-    for (int k = 0; k < 3; k++)
-    { // 播放3遍
-        for (int i = 0; i < 16; i++)
+    uint32_t drawnFinal = 0; // 已画出最终结果的阶段
+    bool headerDrawn = false;
+    while (true)
+    {
+        uint32_t done = Boot_Wait(BOOT_MENU_STAGES | BOOT_BIT(STAGE_DISPLAY), BOOT_PROGRESS_MS);
+        if (done & BOOT_BIT(STAGE_DISPLAY))
         {
-            menuSprite.fillScreen(TFT_WHITE);
-            menuSprite.pushImage(46, 45, 150, 148, boot_gif[i]);
-            menuSprite.pushSprite(0, 0);
-            delay(50);
+            Display_Lock();
+            tft.setTextFont(1);
+            tft.setTextSize(1);
+            tft.setTextDatum(TL_DATUM);
+            if (!headerDrawn)
+            {
+                tft.setTextColor(TFT_GREEN, TFT_BLACK);
+                tft.drawString("SYSTEM BOOT SEQUENCE", 20, 5);
+                tft.drawFastHLine(0, 25, SCREEN_WIDTH, TFT_DARKGREEN);
+                headerDrawn = true;
+            }
+            for (int i = 0; i < STAGE_COUNT; i++)
+            {
+                if (drawnFinal & BOOT_BIT(i)) continue;
+                drawBootStage(i);
+                if (done & BOOT_BIT(i)) drawnFinal |= BOOT_BIT(i);
+            }
+            Display_Unlock();
+        }
+        if ((done & BOOT_MENU_STAGES) == BOOT_MENU_STAGES)
+        {
+            return;
         }
     }
-
-    tft.fillScreen(TFT_BLACK);
-    typeWriterEffect("SYSTEM BOOT SEQUENCE", 20, 5, TFT_GREEN, 50);
-    tft.drawFastHLine(0, 25, SCREEN_WIDTH, TFT_DARKGREEN);
-
-    displaySystemInfoTypewriter(); // 显示系统信息
-    delay(1000);
-    hardwareTest(); // 执行硬件测试
-    delay(1000);
-
-    // 完成提示
-    tft.fillScreen(TFT_BLACK);
-    tft.setTextDatum(MC_DATUM);
-    tft.setTextColor(TFT_GREEN);
-    tft.drawString("All systems operational", 120, 80);
-    tft.drawString("Start Connecting to WiFi...", 120, 160);
-    delay(1500);
 }
 
 /**
  * @brief 系统总初始化函数
- * @details 在 `setup()` 中被调用，负责所有硬件和软件模块的初始化。
+ * @details 在 `setup()` 中被调用。各模块的初始化按依赖关系分成若干阶段并行执行 (见 bootStages)，
+ *          主菜单需要的本地硬件就绪后立即进入菜单，WiFi、校时、天气和MQTT在后台继续完成。
+ *          串口命令 "boot" 输出各阶段的耗时。
  */
 void bootSystem()
 {
     Serial.begin(115200);
-    EEPROM.begin(EEPROM_SIZE);
+    Arena_Init(); // 界面内存池归 setup()/loop() 所在的任务使用
+    Worker_Init(); // 常驻的绘制和音频工作任务，各阶段和页面只向它们提交作业
 
-    // 初始化硬件
-    Buzzer_Init();
-    initRotaryEncoder();
-    DS18B20_Init();
-    createDS18B20Task(); // 创建后台温度读取任务
-    tft.init();
-    tft.setRotation(1);
-    tft.fillScreen(TFT_BLACK);
-    menuSprite.createSprite(240, 240); // 创建与屏幕同样大小的Sprite
-    TargetSettings_Init();
-    setupADC();
-    startADC(); // 启动ADC后台读取任务
-    startPerformanceMonitoring(); // 启动性能数据后台接收任务
-
-    // 开机动画和自检
-    bootAnimation();
+    Boot_Run(bootStages, STAGE_COUNT);
+    showBootProgress();
 
-    Alarm_Init(); // 初始化闹钟模块
-    connectWiFi_with_Manager(); // 连接WiFi
-    syncTime();
-    xTaskCreate(TimeUpdate_Task, "Time Update Task", 2048, NULL, 5, NULL);
-    setupMQTT(); // 设置MQTT
-    connectMQTT(); // 连接MQTT
+    if (Boot_GetStage(STAGE_CREDS).status != BOOT_OK)
+    {
+        connectWiFi_with_Manager(); // 没有保存的网络，打开配置门户，保存后重启
+    }
 
+    Display_Lock();
     tft.fillScreen(TFT_BLACK);
+    Display_Unlock();
+    Power_Init(); // 启动完成后才开始计算空闲时间
+    Boot_MarkReady();
     showMenuConfig(); // 显示主菜单
 }
 
@@ -304,8 +416,14 @@ void bootSystem()
  */
 void tftClearLog()
 {
+    if (logScrolling)
+    {
+        HwScroll_End();
+        logScrolling = false;
+    }
     tft.fillScreen(TFT_BLACK);
-    tft_log_y = 40;
+    Display_Invalidate();
+    tft_log_y = LOG_TOP;
     current_log_lines = 0;
 }
 
@@ -316,19 +434,33 @@ void tftClearLog()
  */
 void tftLog(String text, uint16_t color)
 {
+    Display_Lock(); // 网络、MQTT等后台任务也会输出日志
     tft.setTextFont(1);
     tft.setTextSize(1);
-    // 如果日志满了，则等待1秒后清屏
+    // 如果日志满了，面板支持纵向滚动时 (竖屏安装) 整体上移一行，否则等待1秒后清屏
     if (current_log_lines >= LOG_MAX_LINES)
     {
-        delay(1000);
-        tftClearLog();
+        logScrolling = (logScrolling && HwScroll_IsActive()) ||
+                       HwScroll_Begin(HW_SCROLL_AXIS_Y, LOG_TOP, LOG_MAX_LINES * LOG_LINE_HEIGHT);
+        if (logScrolling)
+        {
+            HwScroll_Scroll(LOG_LINE_HEIGHT);
+            tft_log_y -= LOG_LINE_HEIGHT;
+            current_log_lines--;
+        }
+        else
+        {
+            delay(1000);
+            tftClearLog();
+        }
     }
-    tft.fillRect(LOG_MARGIN, tft_log_y, tft.width() - LOG_MARGIN * 2, LOG_LINE_HEIGHT, TFT_BLACK);
+    int y = HwScroll_Map(tft_log_y); // 滚动后新的一行写在滚动区回绕后的位置
+    tft.fillRect(LOG_MARGIN, y, tft.width() - LOG_MARGIN * 2, LOG_LINE_HEIGHT, TFT_BLACK);
     String fullText = "> " + text;
-    typeWriterEffect(fullText.c_str(), LOG_MARGIN, tft_log_y, color, 8, true);
+    typeWriterEffect(fullText.c_str(), LOG_MARGIN, y, color, 8, true);
     tft_log_y += LOG_LINE_HEIGHT;
     current_log_lines++;
+    Display_Unlock();
 }
 
 // --- 不同日志级别的便捷函数 ---
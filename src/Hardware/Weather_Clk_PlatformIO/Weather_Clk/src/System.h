@@ -4,6 +4,7 @@
 
 extern int tft_log_y;
 extern int current_log_lines;
+const int LOG_TOP = 40; // 日志区域顶部的Y坐标
 const int LOG_MARGIN = 5;
 const int LOG_LINE_HEIGHT = 12;
 const int LOG_MAX_LINES = 15;
@@ -13,7 +14,8 @@ const int LOG_MAX_LINES = 15;
  * @brief 系统启动函数。
  * @details 这是系统的总入口点，负责所有硬件和软件模块的初始化，
  *          包括串口、EEPROM、蜂鸣器、编码器、传感器、TFT屏幕、ADC、WiFi、MQTT等。
- *          它还会执行一个开机动画，并同步网络时间，最后显示主菜单。
+ *          各模块按依赖关系并行初始化，屏幕上显示每个阶段的进度；本地硬件就绪后即显示主菜单，
+ *          联网、校时、天气和MQTT在后台完成。
  */
 void bootSystem();
 
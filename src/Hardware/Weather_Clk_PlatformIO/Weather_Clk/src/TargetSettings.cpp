@@ -4,6 +4,9 @@
 #include "weather.h" 
 #include "Menu.h"    
 #include <EEPROM.h>
+#include "Display.h"
+#include "Settings.h"
+#include "Screen.h"
 
 #define TARGET_HIGHLIGHT_COLOR      TFT_YELLOW
 #define TARGET_SAVE_COLOR           TFT_GREEN
@@ -21,6 +24,9 @@ static bool data_loaded = false;
 
 enum class EditMode { YEAR, MONTH, DAY, HOUR, MINUTE, SECOND, SAVE, CANCEL };
 
+#define TARGET_SCHEMA_VERSION 1 // 设置存储中 TargetRecord 的格式版本，布局改变时递增
+
+// 旧版固件保存在EEPROM中的格式 (仅用于导入)
 struct TargetData
 {
     uint8_t magic_key;
@@ -28,6 +34,13 @@ struct TargetData
     ProgressBarInfo progressBar;
 };
 
+// 设置存储中的格式
+struct TargetRecord
+{
+    time_t countdownTarget;
+    ProgressBarInfo progressBar;
+};
+
 const char *predefined_titles[] = {
     "1st semester",
     "winter holiday",
@@ -199,8 +212,17 @@ void drawTargetElements(TFT_eSprite *sprite)
 
 static void loadData()
 {
+    TargetRecord record;
+    uint8_t version = 0;
+    if (Settings_Read(SETTINGS_KEY_TARGET, &record, sizeof(record), &version) == sizeof(record) && version == TARGET_SCHEMA_VERSION)
+    {
+        countdownTarget = record.countdownTarget;
+        progressBar = record.progressBar;
+        return;
+    }
+
     TargetData data;
-    EEPROM.get(EEPROM_TARGET_START_ADDR, data);
+    EEPROM.get(EEPROM_TARGET_START_ADDR, data); // 导入旧版EEPROM中的设置
 
     if (data.magic_key == EEPROM_TARGET_MAGIC_KEY)
     {
@@ -216,170 +238,222 @@ static void loadData()
         progressBar.endTime = countdownTarget + (30 * 24 * 3600);
         strncpy(progressBar.title, predefined_titles[0], sizeof(progressBar.title) - 1);
         progressBar.title[sizeof(progressBar.title) - 1] = '\0';
-        saveData();
     }
+    saveData();
 }
 
 static void saveData()
 {
-    TargetData data = { EEPROM_TARGET_MAGIC_KEY, countdownTarget, progressBar };
-    EEPROM.put(EEPROM_TARGET_START_ADDR, data);
-    EEPROM.commit();
+    TargetRecord record;
+    memset(&record, 0, sizeof(record)); // 填充字节也参与比较，未改动时不会重复写入
+    record.countdownTarget = countdownTarget;
+    record.progressBar = progressBar;
+    Settings_Write(SETTINGS_KEY_TARGET, TARGET_SCHEMA_VERSION, &record, sizeof(record));
 }
 
 
-void TargetSettings_Menu()
-{
-    const char *mainMenuItems[] = { "Set Countdown", "Set Progress Start", "Set Progress End", "Set Progress Title", "Back" };
-    int numItems = sizeof(mainMenuItems) / sizeof(mainMenuItems[0]);
-    int selectedIndex = 0;
+// --- 主菜单页面 ---
+static const char *const mainMenuItems[] = { "Set Countdown", "Set Progress Start", "Set Progress End", "Set Progress Title", "Back" };
+static const int numMainMenuItems = sizeof(mainMenuItems) / sizeof(mainMenuItems[0]);
+static int mainSelectedIndex = 0;
 
-    while (true)
+static void drawItemList(const char *const *items, int numItems, int selectedIndex, int y0)
+{
+    for (int i = 0; i < numItems; i++)
     {
-        menuSprite.fillScreen(TFT_BLACK);
-        menuSprite.setTextDatum(MC_DATUM);
-        menuSprite.setTextFont(1);
-        menuSprite.setTextSize(2);
-        for (int i = 0; i < numItems; i++)
-        {
-            menuSprite.setTextColor(i == selectedIndex ? TARGET_HIGHLIGHT_COLOR : TARGET_TEXT_COLOR, TFT_BLACK);
-            menuSprite.drawString(mainMenuItems[i], 120, 60 + i * 30);
-        }
-        menuSprite.pushSprite(0, 0);
+        menuSprite.setTextColor(i == selectedIndex ? TARGET_HIGHLIGHT_COLOR : TARGET_TEXT_COLOR, TFT_BLACK);
+        menuSprite.drawString(items[i], 120, y0 + i * 30);
+    }
+}
 
-        if (readButtonLongPress()) { tone(BUZZER_PIN, 1500, 100); return; }
+static void mainMenuEnter()
+{
+    mainSelectedIndex = 0;
+}
 
-        int encoder_value = readEncoder();
-        if (encoder_value != 0)
-        {
-            selectedIndex = (selectedIndex + encoder_value + numItems) % numItems;
-            tone(BUZZER_PIN, 1000, 20);
-        }
+static ScreenAction mainMenuUpdate(const ScreenInput &input)
+{
+    if (input.longPress) { Buzzer_Tone(1500, 100); return SCREEN_EXIT; }
+
+    if (input.encoder != 0)
+    {
+        mainSelectedIndex = (mainSelectedIndex + input.encoder + numMainMenuItems) % numMainMenuItems;
+        Buzzer_Tone(1000, 20);
+        return SCREEN_REDRAW;
+    }
 
-        if (readButton())
+    if (input.click)
+    {
+        Buzzer_Tone(2000, 50);
+        bool success = false;
+        switch (mainSelectedIndex)
         {
-            tone(BUZZER_PIN, 2000, 50);
-            bool success = false;
-            switch (selectedIndex)
-            {
-            case 0: success = editDateTime(countdownTarget, "Set Countdown Target"); break;
-            case 1: success = editDateTime(progressBar.startTime, "Set Progress Start"); break;
-            case 2: success = editDateTime(progressBar.endTime, "Set Progress End"); break;
-            case 3: selectTitleMenu(); success = true; break;
-            case 4: return;
-            }
-            if (success) { saveData(); }
+        case 0: success = editDateTime(countdownTarget, "Set Countdown Target"); break;
+        case 1: success = editDateTime(progressBar.startTime, "Set Progress Start"); break;
+        case 2: success = editDateTime(progressBar.endTime, "Set Progress End"); break;
+        case 3: selectTitleMenu(); break; // 选中即已保存
+        case 4: return SCREEN_EXIT;
         }
-        vTaskDelay(pdMS_TO_TICKS(10));
+        if (success) { saveData(); }
     }
+    return SCREEN_IDLE;
 }
 
-static void selectTitleMenu()
+static void mainMenuRender()
 {
-    int selectedIndex = 0;
+    menuSprite.fillScreen(TFT_BLACK);
+    menuSprite.setTextDatum(MC_DATUM);
+    menuSprite.setTextFont(1);
+    menuSprite.setTextSize(2);
+    drawItemList(mainMenuItems, numMainMenuItems, mainSelectedIndex, 60);
+    Display_Present();
+}
+
+static const ScreenDef mainMenuScreen = {"target", DISPLAY_MIN_FRAME_MS, true, mainMenuEnter, mainMenuUpdate,
+                                         mainMenuRender, NULL};
+
+void TargetSettings_Menu()
+{
+    Screen_Run(mainMenuScreen);
+}
+
+// --- 标题选择页面 ---
+static int titleSelectedIndex = 0;
+
+static void titleMenuEnter()
+{
+    titleSelectedIndex = 0;
     for (int i = 0; i < num_predefined_titles; ++i)
     {
-        if (strcmp(progressBar.title, predefined_titles[i]) == 0) { selectedIndex = i; break; }
+        if (strcmp(progressBar.title, predefined_titles[i]) == 0) { titleSelectedIndex = i; break; }
     }
+}
 
-    while (true)
+static ScreenAction titleMenuUpdate(const ScreenInput &input)
+{
+    if (input.longPress) { Buzzer_Tone(1500, 100); return SCREEN_EXIT; }
+
+    if (input.encoder != 0)
     {
-        menuSprite.fillScreen(TFT_BLACK);
-        menuSprite.setTextDatum(MC_DATUM);
-        menuSprite.setTextFont(1);
-        menuSprite.setTextSize(2);
-        menuSprite.setTextColor(TARGET_TEXT_COLOR);
-        menuSprite.drawString("Select Title", 120, 30);
-        for (int i = 0; i < num_predefined_titles; i++)
-        {
-            menuSprite.setTextColor(i == selectedIndex ? TARGET_HIGHLIGHT_COLOR : TARGET_TEXT_COLOR, TFT_BLACK);
-            menuSprite.drawString(predefined_titles[i], 120, 80 + i * 30);
-        }
-        menuSprite.pushSprite(0, 0);
+        titleSelectedIndex = (titleSelectedIndex + input.encoder + num_predefined_titles) % num_predefined_titles;
+        Buzzer_Tone(1000, 20);
+        return SCREEN_REDRAW;
+    }
 
-        if (readButtonLongPress()) { tone(BUZZER_PIN, 1500, 100); return; }
+    if (input.click)
+    {
+        Buzzer_Tone(2000, 50);
+        strncpy(progressBar.title, predefined_titles[titleSelectedIndex], sizeof(progressBar.title) - 1);
+        progressBar.title[sizeof(progressBar.title) - 1] = '\0';
+        saveData();
+        return SCREEN_EXIT;
+    }
+    return SCREEN_IDLE;
+}
 
-        int encoder_value = readEncoder();
-        if (encoder_value != 0)
-        {
-            selectedIndex = (selectedIndex + encoder_value + num_predefined_titles) % num_predefined_titles;
-            tone(BUZZER_PIN, 1000, 20);
-        }
+static void titleMenuRender()
+{
+    menuSprite.fillScreen(TFT_BLACK);
+    menuSprite.setTextDatum(MC_DATUM);
+    menuSprite.setTextFont(1);
+    menuSprite.setTextSize(2);
+    menuSprite.setTextColor(TARGET_TEXT_COLOR);
+    menuSprite.drawString("Select Title", 120, 30);
+    drawItemList(predefined_titles, num_predefined_titles, titleSelectedIndex, 80);
+    Display_Present();
+}
 
-        if (readButton())
-        {
-            tone(BUZZER_PIN, 2000, 50);
-            strncpy(progressBar.title, predefined_titles[selectedIndex], sizeof(progressBar.title) - 1);
-            progressBar.title[sizeof(progressBar.title) - 1] = '\0';
-            saveData();
-            return;
-        }
-        vTaskDelay(pdMS_TO_TICKS(10));
-    }
+static const ScreenDef titleMenuScreen = {"target_title", DISPLAY_MIN_FRAME_MS, true, titleMenuEnter, titleMenuUpdate,
+                                          titleMenuRender, NULL};
+
+static void selectTitleMenu()
+{
+    Screen_Run(titleMenuScreen);
 }
 
-static bool editDateTime(time_t &timeToEdit, const char *menuTitle)
+// --- 日期时间编辑页面 ---
+static time_t *editTarget = NULL;     // 正在编辑的时间
+static const char *editTitle = "";
+static struct tm editTm;
+static EditMode editMode = EditMode::YEAR;
+static bool editSaved = false;
+
+static void editEnter()
 {
-    struct tm temp_tm;
-    localtime_r(&timeToEdit, &temp_tm);
+    localtime_r(editTarget, &editTm);
+    editMode = EditMode::YEAR;
+    editSaved = false;
+}
 
-    EditMode mode = EditMode::YEAR;
+static ScreenAction editUpdate(const ScreenInput &input)
+{
+    if (input.longPress) { Buzzer_Tone(1500, 100); return SCREEN_EXIT; }
 
-    while (true)
+    int encoder_value = input.encoder;
+    if (encoder_value != 0)
     {
-        drawEditScreen(temp_tm, mode, menuTitle);
+        Buzzer_Tone(1000, 20);
 
-        if (readButtonLongPress()) { tone(BUZZER_PIN, 1500, 100); return false; }
-
-        int encoder_value = readEncoder();
-        if (encoder_value != 0)
+        switch (editMode)
         {
-            tone(BUZZER_PIN, 1000, 20);
-            int original_day = temp_tm.tm_mday;
+        case EditMode::YEAR:   editTm.tm_year += encoder_value; if (editTm.tm_year < 124) editTm.tm_year = 124; break;
+        case EditMode::MONTH:  editTm.tm_mon += encoder_value; break;
+        case EditMode::DAY:    editTm.tm_mday += encoder_value; break;
+        case EditMode::HOUR:   editTm.tm_hour = (editTm.tm_hour + encoder_value + 24) % 24; break;
+        case EditMode::MINUTE: editTm.tm_min = (editTm.tm_min + encoder_value + 60) % 60; break;
+        case EditMode::SECOND: editTm.tm_sec = (editTm.tm_sec + encoder_value + 60) % 60; break;
+        case EditMode::SAVE:   editMode = EditMode::CANCEL; break;
+        case EditMode::CANCEL: editMode = EditMode::SAVE; break;
+        }
 
-            switch (mode)
+        if (editMode <= EditMode::DAY)
+        {
+            if (editMode == EditMode::DAY)
             {
-            case EditMode::YEAR:   temp_tm.tm_year += encoder_value; if (temp_tm.tm_year < 124) temp_tm.tm_year = 124; break;
-            case EditMode::MONTH:  temp_tm.tm_mon += encoder_value; break;
-            case EditMode::DAY:    temp_tm.tm_mday += encoder_value; break;
-            case EditMode::HOUR:   temp_tm.tm_hour = (temp_tm.tm_hour + encoder_value + 24) % 24; break;
-            case EditMode::MINUTE: temp_tm.tm_min = (temp_tm.tm_min + encoder_value + 60) % 60; break;
-            case EditMode::SECOND: temp_tm.tm_sec = (temp_tm.tm_sec + encoder_value + 60) % 60; break;
-            case EditMode::SAVE:   mode = EditMode::CANCEL; break;
-            case EditMode::CANCEL: mode = EditMode::SAVE; break;
+                time_t temp_time = mktime(&editTm);
+                localtime_r(&temp_time, &editTm);
             }
-
-            if (mode <= EditMode::DAY)
+            else
             {
-                if (mode == EditMode::DAY && encoder_value != 0)
-                {
-                    time_t temp_time = mktime(&temp_tm);
-                    localtime_r(&temp_time, &temp_tm);
-                }
-                else
-                {
-                    mktime(&temp_tm);
-                }
+                mktime(&editTm);
             }
         }
+        return SCREEN_REDRAW;
+    }
 
-        if (readButton())
+    if (input.click)
+    {
+        Buzzer_Tone(2000, 50);
+        if (editMode == EditMode::SAVE)
         {
-            tone(BUZZER_PIN, 2000, 50);
-            if (mode == EditMode::SAVE)
-            {
-                timeToEdit = mktime(&temp_tm);
-                return true;
-            }
-            else if (mode == EditMode::CANCEL)
-            {
-                return false;
-            }
-            mode = static_cast<EditMode>(static_cast<int>(mode) + 1);
-            if (mode > EditMode::CANCEL) mode = EditMode::YEAR;
+            *editTarget = mktime(&editTm);
+            editSaved = true;
+            return SCREEN_EXIT;
+        }
+        else if (editMode == EditMode::CANCEL)
+        {
+            return SCREEN_EXIT;
         }
-        vTaskDelay(pdMS_TO_TICKS(5));
+        editMode = static_cast<EditMode>(static_cast<int>(editMode) + 1);
+        if (editMode > EditMode::CANCEL) editMode = EditMode::YEAR;
+        return SCREEN_REDRAW;
     }
+    return SCREEN_IDLE;
+}
+
+static void editRender()
+{
+    drawEditScreen(editTm, editMode, editTitle);
+}
+
+static const ScreenDef editScreen = {"target_edit", DISPLAY_MIN_FRAME_MS, true, editEnter, editUpdate, editRender, NULL};
+
+static bool editDateTime(time_t &timeToEdit, const char *menuTitle)
+{
+    editTarget = &timeToEdit;
+    editTitle = menuTitle;
+    Screen_Run(editScreen);
+    return editSaved;
 }
 
 static void drawEditScreen(const tm &time, EditMode mode, const char *menuTitle)
@@ -416,5 +490,5 @@ static void drawEditScreen(const tm &time, EditMode mode, const char *menuTitle)
     menuSprite.drawString("CANCEL", 163, 215);
     if (mode == EditMode::CANCEL) menuSprite.fillRoundRect(125, 200, 75, 30, 5, TARGET_CANCEL_COLOR);
 
-    menuSprite.pushSprite(0, 0);
+    Display_Present();
 }
\ No newline at end of file
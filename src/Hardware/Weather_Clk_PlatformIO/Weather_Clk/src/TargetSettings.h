@@ -4,7 +4,7 @@
 #include <time.h>
 #include <TFT_eSPI.h>
 
-// EEPROM start address for this module's data.
+// Legacy EEPROM location, only read once to import settings saved by older firmware.
 // Alarm data is at address 0 and takes about 51 bytes. We'll start at 100 for safety.
 #define EEPROM_TARGET_START_ADDR 100
 #define EEPROM_TARGET_MAGIC_KEY 0xDA // Different magic key to avoid conflicts
@@ -20,15 +20,15 @@ struct ProgressBarInfo {
 
 /**
  * @brief 初始化目标设置模块。
- * @details 此函数从EEPROM加载倒计时和进度条的设置。如果EEPROM中没有有效数据
- *          （通过一个“魔术数字”校验），它会加载一组默认值并保存。
+ * @details 此函数从设置存储加载倒计时和进度条的设置。设置存储中没有记录时导入旧版
+ *          EEPROM中的数据（通过一个“魔术数字”校验），都没有则加载一组默认值并保存。
  */
 void TargetSettings_Init();
 
 /**
  * @brief 显示并处理目标设置菜单。
  * @details 提供一个多级菜单，允许用户分别设置倒计时的目标日期时间、
- *          进度条的开始/结束日期以及进度条的标题。所有更改都会被保存到EEPROM。
+ *          进度条的开始/结束日期以及进度条的标题。所有更改都会被保存到设置存储。
  */
 void TargetSettings_Menu();
 
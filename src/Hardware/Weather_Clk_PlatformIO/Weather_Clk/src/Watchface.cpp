@@ -3,7 +3,6 @@
 #include <cmath>           // C++数学库，用于sin, cos等函数
 #include "Buzzer.h"        // 蜂鸣器相关功能
 #include "Alarm.h"         // 闹钟相关功能
-#include <vector>          // C++标准库，用于动态数组
 #include "Watchface.h"     // 本文件的头文件
 #include "MQTT.h"          // MQTT通信功能
 #include "RotaryEncoder.h" // 旋转编码器输入处理
@@ -12,6 +11,10 @@
 #include <time.h>          // C标准时间库，用于tm结构体
 #include "DS18B20.h"       // DS18B20温度传感器
 #include "TargetSettings.h"// 目标设置菜单
+#include "SandSim.h"       // 沙盒表盘的沙粒模拟
+#include "DigitAtlas.h"    // 时钟数字图集
+#include "Display.h"       // 屏幕渲染任务
+#include "Profiler.h"      // 帧耗时统计
 
 // --- 宏定义 ---
 #define MENU_FONT 1 // 菜单使用的默认字体
@@ -125,7 +128,7 @@ static void displayWatchfaceList(int selectedIndex, int displayOffset)
         menuSprite.setTextColor(itemIndex == selectedIndex ? TFT_YELLOW : TFT_WHITE, TFT_BLACK);
         menuSprite.drawString(watchfaceItems[itemIndex].name, tft.width() / 2, 60 + i * 30);
     }
-    menuSprite.pushSprite(0, 0); // 将缓冲区内容推送到屏幕
+    Display_Present(); // 将缓冲区内容推送到屏幕
 }
 
 /**
@@ -155,7 +158,7 @@ void WatchfaceMenu()
         // 长按退出菜单
         if (readButtonLongPress())
         {
-            tone(BUZZER_PIN, 1500, 100);
+            Buzzer_Tone(1500, 100);
             return;
         }
 
@@ -176,7 +179,7 @@ void WatchfaceMenu()
                 displayOffset = selectedIndex - VISIBLE_WATCHFACES + 1;
             }
             displayWatchfaceList(selectedIndex, displayOffset); // 重绘列表
-            tone(BUZZER_PIN, 1000, 50); // 播放提示音
+            Buzzer_Tone(1000, 50); // 播放提示音
         }
 
         // 读取按钮点击
@@ -192,7 +195,7 @@ void WatchfaceMenu()
         if (singleClick && (millis() - lastClickTime > 300))
         {
             singleClick = false;
-            tone(BUZZER_PIN, 2000, 50);
+            Buzzer_Tone(2000, 50);
             watchfaceItems[selectedIndex].show(); // 调用选中的表盘函数
             displayWatchfaceList(selectedIndex, displayOffset); // 从表盘返回后，重绘菜单
         }
@@ -270,8 +273,16 @@ void draw_char(int16_t x, int16_t y, char c, uint16_t color, uint16_t bg, uint8_
 // 整点报时逻辑
 // =================================================================================================
 static int g_lastChimeSecond = -1; // 记录上一次报时的秒数，防止重复触发
-static TaskHandle_t g_hourlyMusicTaskHandle = NULL; // 整点音乐播放任务的句柄
-static int g_hourlySongIndex = 0; // 要播放的整点音乐索引
+static uint32_t g_hourlyPlayback = 0; // 整点音乐在音频工作任务中的播放编号
+
+/**
+ * @brief 停止整点报时音乐，已被其他音乐替换或已播完时不起作用
+ */
+static void stopHourlyChime()
+{
+    Buzzer_Stop(g_hourlyPlayback);
+    g_hourlyPlayback = 0;
+}
 
 /**
  * @brief 处理整点报时和倒计时逻辑
@@ -295,29 +306,14 @@ static void handleHourlyChime()
 
     getLocalTime(&timeinfo); // 获取当前时间
 
-    // 检查音乐任务是否已自行结束
-    if (g_hourlyMusicTaskHandle != NULL && eTaskGetState(g_hourlyMusicTaskHandle) == eDeleted)
-    {
-        g_hourlyMusicTaskHandle = NULL;
-    }
-
     // 如果当前处于“等待播放音乐”状态
     if (waitingForMusic)
     {
         // 在整点长音后等待3秒
         if (millis() - lastBeepTime >= 3000)
         {
-            // 如果已有音乐在播放，先停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-            }
-
-            // 根据当前小时数选择一首歌进行播放
-            g_hourlySongIndex = timeinfo.tm_hour % numSongs;
-            stopBuzzerTask = false; // 重置停止标志
-            // 创建一个新的后台任务来播放音乐
-            xTaskCreatePinnedToCore(Buzzer_PlayMusic_Task, "Buzzer_Music_Task", 8192, &g_hourlySongIndex, 1, &g_hourlyMusicTaskHandle, 0);
+            // 根据当前小时数选择一首歌，在提示声部播放一遍，正在播放的音乐暂停在当前音符，报时结束后继续
+            g_hourlyPlayback = Buzzer_Play(timeinfo.tm_hour % numSongs, PLAY_ONCE, VOICE_NOTIFY);
 
             waitingForMusic = false; // 重置状态
         }
@@ -331,14 +327,14 @@ static void handleHourlyChime()
         if (g_lastChimeSecond != timeinfo.tm_sec) // 每秒只响一次
         {
             int freq = 1000;
-            tone(BUZZER_PIN, freq, 100);
+            Buzzer_Tone(freq, 100, VOICE_NOTIFY);
             g_lastChimeSecond = timeinfo.tm_sec;
         }
     }
     // 在整点0分0秒时，触发长音并进入等待播放音乐的状态
     else if (timeinfo.tm_min == 0 && timeinfo.tm_sec == 0)
     {
-        tone(BUZZER_PIN, 3000, 1000); // 播放一声长音
+        Buzzer_Tone(3000, 1000, VOICE_NOTIFY); // 播放一声长音
         waitingForMusic = true;      // 设置等待标志
         lastBeepTime = millis();     // 记录当前时间
         g_lastChimeSecond = timeinfo.tm_sec;
@@ -392,7 +388,8 @@ static void drawCommonElements()
     menuSprite.setTextDatum(TR_DATUM); // 设置文本对齐方式为右上角
     menuSprite.setTextSize(2);
     menuSprite.setTextColor(WEATHER_DATA_COLOR, TFT_BLACK);
-    String weatherStr = String(temperature) + " " + String(humidity);
+    char weatherStr[24]; // 每帧都会绘制，用栈上的缓冲区而不是 String
+    snprintf(weatherStr, sizeof(weatherStr), "%s %s", temperature, humidity);
     menuSprite.drawString(weatherStr, tft.width() - 15, 5);
 
     // --- 左上角：天气数据上报时间 ---
@@ -446,7 +443,8 @@ static void drawCommonElements()
     menuSprite.setTextFont(1);
     menuSprite.setTextSize(1);
     float temp = getDS18B20Temp();
-    String tempStr = "DS18B20: " + String(temp, 1) + " C";
+    char tempStr[24];
+    snprintf(tempStr, sizeof(tempStr), "DS18B20: %.1f C", temp);
     menuSprite.setTextColor(DS18B20_TEMP_COLOR, TFT_BLACK);
     menuSprite.drawString(tempStr, 120, tft.height() - 35);
 
@@ -547,11 +545,12 @@ static void ChargeWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin(); // 从这里开始计算本帧的模拟、绘制和推送耗时
         getLocalTime(&timeinfo); // 获取当前本地时间
         menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
         drawAdvancedCommonElements();     // 绘制高级通用UI元素（天气、日期、DS18B20温度、WiFi状态等）
@@ -562,7 +561,7 @@ static void ChargeWatchface()
         sprintf(timeStr, "%02d:%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
         menuSprite.setTextSize(5);         // 设置时间字体大小
         menuSprite.setTextColor(TIME_MAIN_COLOR, TFT_BLACK); // 设置时间颜色
-        menuSprite.drawString(timeStr, tft.width() / 2, 115); // 在屏幕中央绘制时间
+        DigitAtlas_DrawString(menuSprite, timeStr, tft.width() / 2, 115); // 在屏幕中央绘制时间
 
         // 绘制电池轮廓
         menuSprite.drawXBitmap(xoff, yoff, battery_outline, 70, 40, TFT_WHITE, TFT_BLACK);
@@ -585,7 +584,8 @@ static void ChargeWatchface()
 
         anim_frame = (anim_frame + 1) % 30; // 更新动画帧，循环播放水波动画
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(50);
         vTaskDelay(pdMS_TO_TICKS(50)); // 短暂延时，控制动画速度和CPU占用
     }
 }
@@ -632,14 +632,7 @@ static void Cube3DWatchface()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle); // 删除音乐任务
-                g_hourlyMusicTaskHandle = NULL;       // 重置任务句柄
-                noTone(BUZZER_PIN);                   // 停止蜂鸣器发声
-                stopBuzzerTask = true;                // 设置停止蜂鸣器任务标志
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -656,28 +649,23 @@ static void Cube3DWatchface()
             rotInc += encoderChange; // 增加或减少旋转速度
             if (rotInc > 10) rotInc = 10; // 限制最大速度
             if (rotInc < 1) rotInc = 1;   // 限制最小速度
-            tone(BUZZER_PIN, 1000, 50);   // 播放按键音
+            Buzzer_Tone(1000, 50);   // 播放按键音
         }
 
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
 
+        uint32_t simStart = Profiler_Now(); // 顶点旋转和投影计入模拟耗时
         // 复制初始顶点数据到可变数组
         memcpy(cube_vertices, cube_vertices_start, sizeof(cube_vertices_start));
 
@@ -731,6 +719,7 @@ static void Cube3DWatchface()
             vertex[0] = x; // 更新顶点X坐标
             vertex[1] = y; // 更新顶点Y坐标
         }
+        Profiler_Add(PROF_STAGE_SIM, Profiler_Now() - simStart);
 
         // 绘制立方体的所有边
         for (int i = 0; i < 12; ++i)
@@ -749,9 +738,10 @@ static void Cube3DWatchface()
         menuSprite.setTextDatum(TC_DATUM); // 设置文本对齐方式为顶部居中
         menuSprite.setTextSize(4);         // 设置字体大小
         menuSprite.setTextColor(TIME_MAIN_COLOR, TFT_BLACK); // 设置时间颜色
-        menuSprite.drawString(timeStr, tft.width() / 2, 15); // 在屏幕顶部居中绘制时间
+        DigitAtlas_DrawString(menuSprite, timeStr, tft.width() / 2, 15); // 在屏幕顶部居中绘制时间
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(20);
         vTaskDelay(pdMS_TO_TICKS(20)); // 短暂延时，控制动画速度和CPU占用
     }
 }
@@ -871,14 +861,7 @@ static void GalaxyWatchface()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -891,19 +874,13 @@ static void GalaxyWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
 
@@ -918,9 +895,10 @@ static void GalaxyWatchface()
         menuSprite.setTextDatum(TC_DATUM); // 设置文本对齐方式为顶部居中
         menuSprite.setTextSize(4);         // 设置字体大小
         menuSprite.setTextColor(TIME_MAIN_COLOR, TFT_BLACK); // 设置时间颜色
-        menuSprite.drawString(timeStr, tft.width() / 2, 15); // 在屏幕顶部居中绘制时间
+        DigitAtlas_DrawString(menuSprite, timeStr, tft.width() / 2, 15); // 在屏幕顶部居中绘制时间
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(20);
         vTaskDelay(pdMS_TO_TICKS(20)); // 短暂延时，控制动画速度和CPU占用
     }
 }
@@ -938,14 +916,7 @@ static void SimClockWatchface()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -958,19 +929,13 @@ static void SimClockWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
 
@@ -1006,7 +971,7 @@ static void SimClockWatchface()
             // 计算数字绘制位置
             int numX = centerX + (int) ((radius - 12) * cos(angle));
             int numY = centerY + (int) ((radius - 12) * sin(angle));
-            menuSprite.drawString(String(i), numX, numY); // 绘制小时数字
+            DigitAtlas_DrawString(menuSprite, String(i).c_str(), numX, numY); // 绘制小时数字
         }
 
         // 绘制中心圆点
@@ -1030,7 +995,8 @@ static void SimClockWatchface()
         int secY = centerY + (int) (0.9 * radius * sin(secAngle * M_PI / 180.0)); // 计算秒针Y端点
         menuSprite.drawLine(centerX, centerY, secX, secY, TFT_BLUE); // 绘制秒针
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(50);
         vTaskDelay(pdMS_TO_TICKS(50)); // 短暂延时，确保秒针平滑更新
     }
 }
@@ -1047,14 +1013,7 @@ static void PlaceholderWatchface()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -1066,19 +1025,13 @@ static void PlaceholderWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
         drawAdvancedCommonElements();     // 绘制高级通用UI元素（天气、日期、DS18B20温度、WiFi状态等）
@@ -1088,7 +1041,8 @@ static void PlaceholderWatchface()
         menuSprite.setTextSize(2);         // 设置字体大小
         menuSprite.drawString("Placeholder", tft.width() / 2, tft.height() / 2 + 20); // 绘制占位符文本
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(100);
         vTaskDelay(pdMS_TO_TICKS(100)); // 短暂延时
     }
 }
@@ -1123,7 +1077,7 @@ static void drawTickerNum(TickerData *data)
     // 如果数字没有在移动，或者动画刚开始（y_pos为0），则直接绘制当前数字
     if (!data->moving || y_pos == 0)
     {
-        menuSprite.drawString(current_char, x, y);
+        DigitAtlas_DrawString(menuSprite, current_char, x, y);
         return;
     }
 
@@ -1131,15 +1085,11 @@ static void drawTickerNum(TickerData *data)
     int16_t reveal_height = y_pos;
     if (reveal_height > h) reveal_height = h; // 限制最大显示高度为数字高度
 
-    // 设置视口，只显示当前数字的底部一部分
-    menuSprite.setViewport(x, y + h - reveal_height, w, reveal_height);
-    menuSprite.drawString(current_char, 0, -(h - reveal_height)); // 绘制当前数字，向上偏移以显示底部
-    menuSprite.resetViewport(); // 重置视口
+    // 只显示当前数字的底部一部分
+    DigitAtlas_DrawCharClipped(menuSprite, current_char[0], x, y, x, y + h - reveal_height, w, reveal_height);
 
-    // 设置视口，只显示上一个数字的顶部一部分
-    menuSprite.setViewport(x, y, w, h - reveal_height);
-    menuSprite.drawString(prev_char, 0, 0); // 绘制上一个数字
-    menuSprite.resetViewport(); // 重置视口
+    // 只显示上一个数字的顶部一部分
+    DigitAtlas_DrawCharClipped(menuSprite, prev_char[0], x, y, x, y, w, h - reveal_height);
 
     // 绘制扫描线
     menuSprite.drawFastHLine(x, y + h - reveal_height, w, TFT_WHITE);
@@ -1164,19 +1114,19 @@ static void drawVectorScrollTickerNum(TickerData *data)
     // 如果数字没有在移动，或者动画刚开始/结束，则直接绘制当前数字
     if (!data->moving || y_pos == 0 || y_pos > h + TICKER_GAP)
     {
-        menuSprite.drawString(current_char, x, y);
+        DigitAtlas_DrawString(menuSprite, current_char, x, y);
         return;
     }
 
     // 绘制从底部向上滚入的新数字
     // 它从 y + h + TICKER_GAP 位置开始，移动到 y 位置
     int16_t new_y = y + h + TICKER_GAP - y_pos;
-    menuSprite.drawString(current_char, x, new_y);
+    DigitAtlas_DrawString(menuSprite, current_char, x, new_y);
 
     // 绘制向上滚出屏幕的旧数字
     // 它从 y 位置开始，移动到 y - (h + TICKER_GAP) 位置
     int16_t old_y = y - y_pos;
-    menuSprite.drawString(prev_char, x, old_y);
+    DigitAtlas_DrawString(menuSprite, prev_char, x, old_y);
 }
 
 /**
@@ -1221,14 +1171,7 @@ static void VectorScrollWatchface()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -1240,19 +1183,13 @@ static void VectorScrollWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         g_watchface_timeDate.time.hour = timeinfo.tm_hour;
         g_watchface_timeDate.time.mins = timeinfo.tm_min;
@@ -1303,7 +1240,7 @@ static void VectorScrollWatchface()
         {
             menuSprite.setTextSize(4); // 冒号字体大小
             menuSprite.setTextColor(TIME_MAIN_COLOR, TFT_BLACK); // 冒号颜色
-            menuSprite.drawString(":", start_x + num_w * 2 + 10, y_main + 5); // 绘制冒号
+            DigitAtlas_DrawString(menuSprite, ":", start_x + num_w * 2 + 10, y_main + 5); // 绘制冒号
         }
 
         // 绘制0.1秒数字
@@ -1313,9 +1250,10 @@ static void VectorScrollWatchface()
         menuSprite.setTextDatum(TL_DATUM); // 左上角对齐
         int x_pos = tickers[5].x + tickers[5].w; // 0.1秒数字的X位置
         int y_pos = tickers[5].y + tickers[5].h - 8; // 0.1秒数字的Y位置
-        menuSprite.drawString(String(tenth), x_pos, y_pos); // 绘制0.1秒数字
+        DigitAtlas_DrawString(menuSprite, String(tenth).c_str(), x_pos, y_pos); // 绘制0.1秒数字
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(20);
         vTaskDelay(pdMS_TO_TICKS(20)); // 短暂延时，控制动画速度和CPU占用
     }
 }
@@ -1362,14 +1300,7 @@ static void VectorScanWatchface()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -1381,19 +1312,13 @@ static void VectorScanWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         g_watchface_timeDate.time.hour = timeinfo.tm_hour;
         g_watchface_timeDate.time.mins = timeinfo.tm_min;
@@ -1431,7 +1356,7 @@ static void VectorScanWatchface()
         {
             menuSprite.setTextSize(4); // 冒号字体大小
             menuSprite.setTextColor(TFT_WHITE, TFT_BLACK); // 冒号颜色
-            menuSprite.drawString(":", start_x + num_w * 2 + 10, y_main + 5); // 绘制冒号
+            DigitAtlas_DrawString(menuSprite, ":", start_x + num_w * 2 + 10, y_main + 5); // 绘制冒号
         }
 
         // 绘制0.1秒数字
@@ -1441,9 +1366,10 @@ static void VectorScanWatchface()
         menuSprite.setTextDatum(TL_DATUM); // 左上角对齐
         int x_pos = tickers[5].x + tickers[5].w; // 0.1秒数字的X位置
         int y_pos = tickers[5].y + tickers[5].h - 8; // 0.1秒数字的Y位置
-        menuSprite.drawString(String(tenth), x_pos, y_pos); // 绘制0.1秒数字
+        DigitAtlas_DrawString(menuSprite, String(tenth).c_str(), x_pos, y_pos); // 绘制0.1秒数字
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(20);
         vTaskDelay(pdMS_TO_TICKS(20)); // 短暂延时，控制动画速度和CPU占用
     }
 }
@@ -1460,14 +1386,7 @@ static void SimpleClockWatchface()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -1480,19 +1399,13 @@ static void SimpleClockWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
         drawAdvancedCommonElements();     // 绘制高级通用UI元素
@@ -1509,14 +1422,15 @@ static void SimpleClockWatchface()
         int timeHeight = menuSprite.fontHeight();     // 获取字体高度
         int timeX = tft.width() / 2;                  // 时间X坐标（居中）
         int timeY = (tft.height() - timeHeight) / 2 + 10; // 时间Y坐标（居中偏下）
-        menuSprite.drawString(timeStr, timeX, timeY); // 绘制时间字符串
+        DigitAtlas_DrawString(menuSprite, timeStr, timeX, timeY); // 绘制时间字符串
 
         // 绘制十分之一秒数字
         int tenth = (millis() % 1000) / 100; // 获取十分之一秒
         menuSprite.setTextSize(1);         // 设置字体大小
-        menuSprite.drawString(String(tenth), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
+        DigitAtlas_DrawString(menuSprite, String(tenth).c_str(), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(100);
         vTaskDelay(pdMS_TO_TICKS(100)); // 短暂延时
     }
 }
@@ -1548,14 +1462,7 @@ static void shared_rain_logic(uint16_t color)
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -1567,19 +1474,13 @@ static void shared_rain_logic(uint16_t color)
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
 
@@ -1609,14 +1510,15 @@ static void shared_rain_logic(uint16_t color)
         int timeHeight = menuSprite.fontHeight();     // 获取字体高度
         int timeX = tft.width() / 2;                  // 时间X坐标（居中）
         int timeY = (tft.height() - timeHeight) / 2 + 10; // 时间Y坐标（居中偏下）
-        menuSprite.drawString(timeStr, timeX, timeY); // 绘制时间字符串
+        DigitAtlas_DrawString(menuSprite, timeStr, timeX, timeY); // 绘制时间字符串
 
         // 绘制十分之一秒数字
         int tenth = (millis() % 1000) / 100; // 获取十分之一秒
         menuSprite.setTextSize(1);         // 设置字体大小
-        menuSprite.drawString(String(tenth), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
+        DigitAtlas_DrawString(menuSprite, String(tenth).c_str(), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(20);
         vTaskDelay(pdMS_TO_TICKS(20)); // 短暂延时，控制动画速度和CPU占用
     }
 }
@@ -1631,7 +1533,8 @@ static void CodeRainWatchface() { shared_rain_logic(TFT_CYAN); }
 
 // --- Snow ---
 #define SNOW_PARTICLES 100 // 雪花粒子数量
-std::vector<std::pair<int, int>> snow_particles(SNOW_PARTICLES); // 存储雪花粒子坐标的向量
+struct SnowFlake { int16_t x, y; };
+static SnowFlake snow_particles[SNOW_PARTICLES]; // 固定容量的雪花粒子坐标，不占用堆
 
 /**
  * @brief 雪花表盘：模拟雪花飘落的效果，并显示当前时间。
@@ -1640,21 +1543,14 @@ static void SnowWatchface()
 {
     util_randomSeed(millis()); // 使用当前时间作为随机数种子
     // 初始化所有雪花粒子的随机位置
-    for (auto &p : snow_particles) { p.first = util_random_range(0, tft.width()); p.second = util_random_range(0, tft.height()); }
+    for (auto &p : snow_particles) { p.x = util_random_range(0, tft.width()); p.y = util_random_range(0, tft.height()); }
     while (1)
     {
         // 检查退出子菜单标志，如果为真则退出当前表盘
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -1666,28 +1562,22 @@ static void SnowWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
 
         // 更新并绘制雪花粒子
         for (auto &p : snow_particles)
         {
-            p.second += 1; // 雪花向下移动
-            if (p.second > tft.height()) { p.second = 0; p.first = util_random_range(0, tft.width()); } // 如果超出屏幕底部，重置到顶部随机位置
-            menuSprite.drawPixel(p.first, p.second, TFT_WHITE); // 绘制雪花
+            p.y += 1; // 雪花向下移动
+            if (p.y > tft.height()) { p.y = 0; p.x = util_random_range(0, tft.width()); } // 如果超出屏幕底部，重置到顶部随机位置
+            menuSprite.drawPixel(p.x, p.y, TFT_WHITE); // 绘制雪花
         }
 
         drawAdvancedCommonElements(); // 绘制高级通用UI元素
@@ -1704,14 +1594,15 @@ static void SnowWatchface()
         int timeHeight = menuSprite.fontHeight();     // 获取字体高度
         int timeX = tft.width() / 2;                  // 时间X坐标（居中）
         int timeY = (tft.height() - timeHeight) / 2 + 10; // 时间Y坐标（居中偏下）
-        menuSprite.drawString(timeStr, timeX, timeY); // 绘制时间字符串
+        DigitAtlas_DrawString(menuSprite, timeStr, timeX, timeY); // 绘制时间字符串
 
         // 绘制十分之一秒数字
         int tenth = (millis() % 1000) / 100; // 获取十分之一秒
         menuSprite.setTextSize(1);         // 设置字体大小
-        menuSprite.drawString(String(tenth), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
+        DigitAtlas_DrawString(menuSprite, String(tenth).c_str(), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(30);
         vTaskDelay(pdMS_TO_TICKS(30)); // 短暂延时，控制动画速度和CPU占用
     }
 }
@@ -1729,14 +1620,7 @@ static void WavesWatchface()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -1748,19 +1632,13 @@ static void WavesWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
 
@@ -1790,14 +1668,15 @@ static void WavesWatchface()
         int timeHeight = menuSprite.fontHeight();     // 获取字体高度
         int timeX = tft.width() / 2;                  // 时间X坐标（居中）
         int timeY = (tft.height() - timeHeight) / 2 + 10; // 时间Y坐标（居中偏下）
-        menuSprite.drawString(timeStr, timeX, timeY); // 绘制时间字符串
+        DigitAtlas_DrawString(menuSprite, timeStr, timeX, timeY); // 绘制时间字符串
 
         // 绘制十分之一秒数字
         int tenth = (millis() % 1000) / 100; // 获取十分之一秒
         menuSprite.setTextSize(1);         // 设置字体大小
-        menuSprite.drawString(String(tenth), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
+        DigitAtlas_DrawString(menuSprite, String(tenth).c_str(), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(20);
         vTaskDelay(pdMS_TO_TICKS(20)); // 短暂延时，控制动画速度和CPU占用
     }
 }
@@ -1815,14 +1694,7 @@ static void NenoWatchface()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -1834,19 +1706,13 @@ static void NenoWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
 
@@ -1873,14 +1739,15 @@ static void NenoWatchface()
         int timeHeight = menuSprite.fontHeight();     // 获取字体高度
         int timeX = tft.width() / 2;                  // 时间X坐标（居中）
         int timeY = (tft.height() - timeHeight) / 2 + 10; // 时间Y坐标（居中偏下）
-        menuSprite.drawString(timeStr, timeX, timeY); // 绘制时间字符串
+        DigitAtlas_DrawString(menuSprite, timeStr, timeX, timeY); // 绘制时间字符串
 
         // 绘制十分之一秒数字
         int tenth = (millis() % 1000) / 100; // 获取十分之一秒
         menuSprite.setTextSize(1);         // 设置字体大小
-        menuSprite.drawString(String(tenth), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
+        DigitAtlas_DrawString(menuSprite, String(tenth).c_str(), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(20);
         vTaskDelay(pdMS_TO_TICKS(20)); // 短暂延时，控制动画速度和CPU占用
     }
 }
@@ -1891,7 +1758,7 @@ static void NenoWatchface()
  * @brief 定义弹跳球的数据结构
  */
 struct Ball { float x, y, vx, vy; uint16_t color; };
-std::vector<Ball> balls(BALL_COUNT); // 存储所有弹跳球的向量
+static Ball balls[BALL_COUNT]; // 固定容量的弹跳球数组
 
 /**
  * @brief 弹跳球表盘：显示多个在屏幕上弹跳的彩色球，并显示当前时间。
@@ -1912,14 +1779,7 @@ static void BallsWatchface()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -1931,30 +1791,31 @@ static void BallsWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
 
-        // 更新并绘制所有弹跳球
+        // 更新所有弹跳球
+        {
+            PROF_SCOPE(PROF_STAGE_SIM);
+            for (auto &b : balls)
+            {
+                b.x += b.vx; b.y += b.vy; // 更新球的位置
+                // 碰撞检测和反弹
+                if (b.x < 5 || b.x > tft.width() - 5) b.vx *= -1;
+                if (b.y < 5 || b.y > tft.height() - 5) b.vy *= -1;
+            }
+        }
+        // 绘制所有弹跳球
         for (auto &b : balls)
         {
-            b.x += b.vx; b.y += b.vy; // 更新球的位置
-            // 碰撞检测和反弹
-            if (b.x < 5 || b.x > tft.width() - 5) b.vx *= -1;
-            if (b.y < 5 || b.y > tft.height() - 5) b.vy *= -1;
-            menuSprite.fillCircle(b.x, b.y, 5, b.color); // 绘制球
+            menuSprite.fillCircle(b.x, b.y, 5, b.color);
         }
 
         drawAdvancedCommonElements(); // 绘制高级通用UI元素
@@ -1971,42 +1832,37 @@ static void BallsWatchface()
         int timeHeight = menuSprite.fontHeight();     // 获取字体高度
         int timeX = tft.width() / 2;                  // 时间X坐标（居中）
         int timeY = (tft.height() - timeHeight) / 2 + 10; // 时间Y坐标（居中偏下）
-        menuSprite.drawString(timeStr, timeX, timeY); // 绘制时间字符串
+        DigitAtlas_DrawString(menuSprite, timeStr, timeX, timeY); // 绘制时间字符串
 
         // 绘制十分之一秒数字
         int tenth = (millis() % 1000) / 100; // 获取十分之一秒
         menuSprite.setTextSize(1);         // 设置字体大小
-        menuSprite.drawString(String(tenth), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
+        DigitAtlas_DrawString(menuSprite, String(tenth).c_str(), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(20);
         vTaskDelay(pdMS_TO_TICKS(20)); // 短暂延时，控制动画速度和CPU占用
     }
 }
 
 // --- Sand Box ---
-#define SAND_WIDTH 120  // 沙盒模拟区域的宽度
-#define SAND_HEIGHT 120 // 沙盒模拟区域的高度
-byte sand_grid[SAND_WIDTH][SAND_HEIGHT] = { 0 }; // 沙盒网格，0表示空，1表示沙粒
+#define SAND_SPAWN_CHANCE 80 // 每帧在顶部生成一颗沙粒的概率(%)，1像素沙粒的面积是原来的1/4，生成得更快
 
 /**
  * @brief 沙盒表盘：模拟沙粒下落堆积的效果，并显示当前时间。
+ * @details 沙粒模拟由 SandSim 完成：按位存储的240x240网格，只计算仍在运动的行，
+ *          只重绘内容发生变化的行。每秒整屏重绘一次，清除宽度变化的文字留下的残影。
  */
 static void SandBoxWatchface()
 {
+    int lastSecond = -1; // 上一次整屏重绘时的秒数，-1表示刚进入表盘
     while (1)
     {
         // 检查退出子菜单标志，如果为真则退出当前表盘
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -2018,47 +1874,31 @@ static void SandBoxWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
 
-        // 随机在顶部生成新的沙粒
-        if (util_random(100) < 20) sand_grid[util_random(SAND_WIDTH)][0] = 1;
-        menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
-
-        // 模拟沙粒下落逻辑
-        for (int y = SAND_HEIGHT - 2; y >= 0; y--) // 从倒数第二行开始向上遍历
         {
-            for (int x = 0; x < SAND_WIDTH; x++) // 遍历每一列
+            PROF_SCOPE(PROF_STAGE_SIM);
+            // 随机在顶部生成新的沙粒，沙堆堆到顶部时清空重新开始
+            if (util_random(100) < SAND_SPAWN_CHANCE && !SandSim_Spawn(util_random(SAND_COLS)))
             {
-                if (sand_grid[x][y] == 1) // 如果当前位置有沙粒
-                {
-                    if (sand_grid[x][y + 1] == 0) { sand_grid[x][y] = 0; sand_grid[x][y + 1] = 1; } // 如果正下方为空，则沙粒下落
-                    else if (x > 0 && sand_grid[x - 1][y + 1] == 0) { sand_grid[x][y] = 0; sand_grid[x - 1][y + 1] = 1; } // 如果左下方为空，则沙粒向左下落
-                    else if (x < SAND_WIDTH - 1 && sand_grid[x + 1][y + 1] == 0) { sand_grid[x][y] = 0; sand_grid[x + 1][y + 1] = 1; } // 如果右下方为空，则沙粒向右下落
-                }
-            }
-        }
-        // 绘制沙粒
-        for (int y = 0; y < SAND_HEIGHT; y++)
-        {
-            for (int x = 0; x < SAND_WIDTH; x++)
-            {
-                if (sand_grid[x][y] == 1) menuSprite.drawPixel(x * 2, y * 2, TFT_YELLOW); // 将沙粒绘制为黄色像素
+                SandSim_Init();
             }
+
+            SandSim_Step(); // 模拟沙粒下落，已静止的行不参与计算
         }
 
+        // 绘制沙粒：进入表盘时和每秒整屏重绘一次，其余帧只重绘变化的行
+        bool fullRedraw = (timeinfo.tm_sec != lastSecond);
+        lastSecond = timeinfo.tm_sec;
+        SandSim_Render(&menuSprite, TFT_YELLOW, TFT_BLACK, fullRedraw);
+
         drawAdvancedCommonElements(); // 绘制高级通用UI元素
 
         menuSprite.setTextFont(1);         // 设置字体
@@ -2073,14 +1913,15 @@ static void SandBoxWatchface()
         int timeHeight = menuSprite.fontHeight();     // 获取字体高度
         int timeX = tft.width() / 2;                  // 时间X坐标（居中）
         int timeY = (tft.height() - timeHeight) / 2 + 10; // 时间Y坐标（居中偏下）
-        menuSprite.drawString(timeStr, timeX, timeY); // 绘制时间字符串
+        DigitAtlas_DrawString(menuSprite, timeStr, timeX, timeY); // 绘制时间字符串
 
         // 绘制十分之一秒数字
         int tenth = (millis() % 1000) / 100; // 获取十分之一秒
         menuSprite.setTextSize(1);         // 设置字体大小
-        menuSprite.drawString(String(tenth), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
+        DigitAtlas_DrawString(menuSprite, String(tenth).c_str(), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(10);
         vTaskDelay(pdMS_TO_TICKS(10)); // 短暂延时，控制动画速度和CPU占用
     }
 }
@@ -2102,14 +1943,7 @@ static void ProgressBarWatchface()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -2121,19 +1955,13 @@ static void ProgressBarWatchface()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         menuSprite.fillSprite(TFT_BLACK); // 清空屏幕缓冲区，填充黑色背景
         drawCommonElements();             // 绘制通用UI元素
@@ -2150,12 +1978,12 @@ static void ProgressBarWatchface()
         int timeWidth = menuSprite.textWidth(timeStr); // 获取时间字符串的宽度
         int timeX = tft.width() / 2;                  // 时间X坐标（居中）
         int timeY = 125;                              // 时间Y坐标
-        menuSprite.drawString(timeStr, timeX, timeY); // 绘制时间字符串
+        DigitAtlas_DrawString(menuSprite, timeStr, timeX, timeY); // 绘制时间字符串
 
         // 绘制十分之一秒数字
         int tenth = (millis() % 1000) / 100; // 获取十分之一秒
         menuSprite.setTextSize(1);         // 设置字体大小
-        menuSprite.drawString(String(tenth), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
+        DigitAtlas_DrawString(menuSprite, String(tenth).c_str(), timeX + timeWidth / 2 + 10, timeY + 10); // 绘制十分之一秒数字
 
         // --- 进度条 ---
         menuSprite.setTextDatum(TL_DATUM); // 设置文本对齐方式为左上角
@@ -2188,7 +2016,8 @@ static void ProgressBarWatchface()
         sprintf(buf, "Min: %.0f%%", minute_progress * 100); // 格式化百分比文本
         menuSprite.drawString(buf, PB_PERCENTAGE_TEXT_X, bar_y_start + bar_y_spacing * 2); // 绘制百分比文本
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(100);
         vTaskDelay(pdMS_TO_TICKS(100)); // 短暂延时
     }
 }
@@ -2225,14 +2054,7 @@ static void VectorScrollWatchface_SEG()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -2244,19 +2066,13 @@ static void VectorScrollWatchface_SEG()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         g_watchface_timeDate.time.hour = timeinfo.tm_hour;
         g_watchface_timeDate.time.mins = timeinfo.tm_min;
@@ -2345,8 +2161,8 @@ static void VectorScrollWatchface_SEG()
             menuSprite.setTextFont(COLON_FONT); // 冒号字体
             menuSprite.setTextSize(COLON_SIZE); // 冒号字体大小
             menuSprite.setTextColor(TIME_MAIN_COLOR, TFT_BLACK); // 冒号颜色
-            menuSprite.drawString(":", colon1_x, colon_y); // 绘制第一个冒号
-            menuSprite.drawString(":", colon2_x, colon_y); // 绘制第二个冒号
+            DigitAtlas_DrawString(menuSprite, ":", colon1_x, colon_y); // 绘制第一个冒号
+            DigitAtlas_DrawString(menuSprite, ":", colon2_x, colon_y); // 绘制第二个冒号
         }
 
         // 绘制0.1秒数字
@@ -2357,9 +2173,10 @@ static void VectorScrollWatchface_SEG()
         menuSprite.setTextDatum(TL_DATUM); // 左上角对齐
         int x_pos = tickers[5].x + tickers[5].w; // 0.1秒数字的X位置
         int y_pos = tickers[5].y + tickers[5].h - 8; // 0.1秒数字的Y位置
-        menuSprite.drawString(String(tenth), x_pos, y_pos); // 绘制0.1秒数字
+        DigitAtlas_DrawString(menuSprite, String(tenth).c_str(), x_pos, y_pos); // 绘制0.1秒数字
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(20);
         vTaskDelay(pdMS_TO_TICKS(20)); // 短暂延时，控制动画速度和CPU占用
     }
 }
@@ -2381,14 +2198,7 @@ static void VectorScanWatchface_SEG()
         if (exitSubMenu)
         {
             exitSubMenu = false; // 重置标志
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
             return; // 退出表盘函数
         }
         // 如果闹钟正在响铃，则退出表盘，让闹钟优先处理
@@ -2400,19 +2210,13 @@ static void VectorScanWatchface_SEG()
         // 检测按钮点击，如果点击则退出当前表盘
         if (readButton())
         {
-            // 如果有整点报时音乐正在播放，则停止它
-            if (g_hourlyMusicTaskHandle != NULL)
-            {
-                vTaskDelete(g_hourlyMusicTaskHandle);
-                g_hourlyMusicTaskHandle = NULL;
-                noTone(BUZZER_PIN);
-                stopBuzzerTask = true;
-            }
-            tone(BUZZER_PIN, 1500, 50); // 播放按键音
+            stopHourlyChime(); // 如果有整点报时音乐正在播放，则停止它
+            Buzzer_Tone(1500, 50); // 播放按键音
             menuSprite.setTextFont(MENU_FONT); // 恢复菜单字体设置
             return; // 退出表盘函数
         }
 
+        Profiler_FrameBegin();
         getLocalTime(&timeinfo); // 获取当前本地时间
         g_watchface_timeDate.time.hour = timeinfo.tm_hour;
         g_watchface_timeDate.time.mins = timeinfo.tm_min;
@@ -2491,8 +2295,8 @@ static void VectorScanWatchface_SEG()
             menuSprite.setTextFont(COLON_FONT); // 冒号字体
             menuSprite.setTextSize(COLON_SIZE); // 冒号字体大小
             menuSprite.setTextColor(TIME_MAIN_COLOR, TFT_BLACK); // 冒号颜色
-            menuSprite.drawString(":", colon1_x, colon_y); // 绘制第一个冒号
-            menuSprite.drawString(":", colon2_x, colon_y); // 绘制第二个冒号
+            DigitAtlas_DrawString(menuSprite, ":", colon1_x, colon_y); // 绘制第一个冒号
+            DigitAtlas_DrawString(menuSprite, ":", colon2_x, colon_y); // 绘制第二个冒号
         }
 
         // 绘制0.1秒数字
@@ -2503,9 +2307,10 @@ static void VectorScanWatchface_SEG()
         menuSprite.setTextDatum(TL_DATUM); // 左上角对齐
         int x_pos = tickers[5].x + tickers[5].w; // 0.1秒数字的X位置
         int y_pos = tickers[5].y + tickers[5].h - 8; // 0.1秒数字的Y位置
-        menuSprite.drawString(String(tenth), x_pos, y_pos); // 绘制0.1秒数字
+        DigitAtlas_DrawString(menuSprite, String(tenth).c_str(), x_pos, y_pos); // 绘制0.1秒数字
 
-        menuSprite.pushSprite(0, 0); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Display_Present(); // 将屏幕缓冲区内容推送到TFT屏幕显示
+        Profiler_FrameEnd(20);
         vTaskDelay(pdMS_TO_TICKS(20)); // 短暂延时，控制动画速度和CPU占用
     }
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "Menu.h" 
 #include "System.h" 
 #include "weather.h" 
+#include "Display.h"
 
 WebServer server(80);
 DNSServer dnsServer;
@@ -91,7 +92,7 @@ void handleSave()
     menuSprite.setTextDatum(MC_DATUM);
     menuSprite.drawString("Credentials Saved!", 120, 80);
     menuSprite.drawString("Rebooting...", 120, 120);
-    menuSprite.pushSprite(0, 0);
+    Display_Present();
 
     server.send(200, "text/plain", "Credentials saved. The device will now reboot and try to connect.");
     delay(2000);
@@ -104,6 +105,54 @@ void handleNotFound()
 }
 
 
+/**
+ * @brief 从 Preferences 读取保存的凭据
+ */
+static void loadSavedWiFi(String &ssid, String &pass)
+{
+    preferences.begin("wifi-creds", true);
+    ssid = preferences.getString("ssid", "");
+    pass = preferences.getString("password", "");
+    preferences.end();
+}
+
+/**
+ * @brief 以站点模式开始连接 (不等待结果)
+ */
+static void beginSavedWiFi(const String &ssid, const String &pass)
+{
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(true);
+    WiFi.persistent(true);
+    WiFi.setSleep(false);
+    WiFi.setTxPower(WIFI_POWER_19_5dBm);
+    WiFi.begin(ssid.c_str(), pass.c_str());
+}
+
+bool hasSavedWiFi()
+{
+    String ssid, pass;
+    loadSavedWiFi(ssid, pass);
+    return ssid.length() > 0;
+}
+
+bool connectSavedWiFi(uint32_t timeoutMs)
+{
+    if (WiFi.status() == WL_CONNECTED)
+    {
+        return true;
+    }
+    String ssid, pass;
+    loadSavedWiFi(ssid, pass);
+    if (ssid.length() == 0)
+    {
+        return false;
+    }
+    beginSavedWiFi(ssid, pass);
+    Serial.println("Connecting to saved network: " + ssid);
+    return WiFi.waitForConnectResult(timeoutMs) == WL_CONNECTED;
+}
+
 bool connectWiFi_with_Manager()
 {
     if (WiFi.status() == WL_CONNECTED)
@@ -115,10 +164,8 @@ bool connectWiFi_with_Manager()
     tft.fillScreen(TFT_BLACK);
     tftClearLog();
 
-    preferences.begin("wifi-creds", true);
-    String saved_ssid = preferences.getString("ssid", "");
-    String saved_pass = preferences.getString("password", "");
-    preferences.end();
+    String saved_ssid, saved_pass;
+    loadSavedWiFi(saved_ssid, saved_pass);
 
     if (saved_ssid.length() > 0)
     {
@@ -126,13 +173,7 @@ bool connectWiFi_with_Manager()
         tftLog(saved_ssid.c_str(), TFT_CYAN);
         tftLog("Connecting...", TFT_WHITE);
 
-        WiFi.mode(WIFI_STA);
-        WiFi.setAutoReconnect(true);
-        WiFi.persistent(true);
-        WiFi.setSleep(false);
-        WiFi.setTxPower(WIFI_POWER_19_5dBm);
-
-        WiFi.begin(saved_ssid.c_str(), saved_pass.c_str());
+        beginSavedWiFi(saved_ssid, saved_pass);
         tftLog("WiFi.begin() called", TFT_YELLOW);
         int attempts = 0;
         while (WiFi.status() != WL_CONNECTED && attempts < 10)
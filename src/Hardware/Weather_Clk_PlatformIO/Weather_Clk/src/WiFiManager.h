@@ -1,6 +1,8 @@
 #ifndef WIFIMANAGER_H
 #define WIFIMANAGER_H
 
+#include <Arduino.h>
+
 /**
  * @brief 尝试使用保存的凭据连接WiFi，如果失败则启动配置门户。
  * @details 此函数首先会尝试使用存储在Preferences（EEPROM）中的SSID和密码进行连接。
@@ -12,4 +14,17 @@
  */
 bool connectWiFi_with_Manager();
 
+/**
+ * @brief 是否保存过WiFi凭据。
+ * @details 没有保存时只能通过 connectWiFi_with_Manager 的配置门户联网。
+ */
+bool hasSavedWiFi();
+
+/**
+ * @brief 使用保存的凭据连接WiFi，不访问屏幕，可在后台任务中调用。
+ * @param timeoutMs 等待连接的最长时间。
+ * @return 在超时前连接成功返回 `true`。失败后自动重连仍然开启，稍后可能自行连上。
+ */
+bool connectSavedWiFi(uint32_t timeoutMs);
+
 #endif // WIFIMANAGER_H
@@ -0,0 +1,229 @@
+// 包含所有必需的头文件
+#include "Worker.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+
+/**
+ * @brief 发给工作任务的命令
+ */
+enum WorkerCmdType
+{
+  WORKER_CMD_START,
+  WORKER_CMD_STOP,
+  WORKER_CMD_PAUSE,
+  WORKER_CMD_RESUME,
+  WORKER_CMD_WAKE
+};
+
+struct WorkerCmd
+{
+  WorkerCmdType type;
+  const WorkerJob *job;
+  int arg;
+  uint32_t seq; // 停止命令的序号，完成时写入 Worker::stopDone
+};
+
+/**
+ * @brief 工作任务的创建参数
+ */
+struct WorkerDef
+{
+  const char *name;
+  uint32_t stack;
+  UBaseType_t priority;
+};
+
+// 栈大小按原来各个临时任务中最大的一个取，可用串口命令 "tasks" 查看实际余量
+static const WorkerDef workerDefs[WORKER_COUNT] = {
+  {"Render", 4096, 1},
+  {"Audio", 3072, 2},
+};
+
+struct Worker
+{
+  TaskHandle_t task;
+  QueueHandle_t queue;
+  SemaphoreHandle_t stopped;   // 每处理完一条停止命令给出一次
+  SemaphoreHandle_t stopLock;  // 同一时间只有一个调用者等待 stopped
+  uint32_t stopSeq;            // 最近发出的停止命令序号，在 stopLock 内递增
+  volatile uint32_t stopDone;  // 最近处理完的停止命令序号
+  const WorkerJob *volatile job;
+  bool paused;
+  bool idle;                   // step 返回了 WORKER_IDLE，等下一条命令
+};
+
+// --- 全局变量 ---
+static Worker workers[WORKER_COUNT];
+
+/**
+ * @brief 结束当前作业，调用它的 stop
+ */
+static void endJob(Worker &w)
+{
+  const WorkerJob *job = w.job;
+  w.job = NULL;
+  w.paused = false;
+  if (job != NULL && job->stop != NULL)
+  {
+    job->stop();
+  }
+}
+
+/**
+ * @brief [FreeRTOS Task] 工作任务：在命令队列上等到下一步的时刻，期间到达的命令立即处理
+ * @param pvParameters 工作任务序号
+ */
+static void Worker_Task(void *pvParameters)
+{
+  Worker &w = workers[(int)(intptr_t)pvParameters];
+  TickType_t due = 0; // 下一步的时刻
+
+  for (;;)
+  {
+    TickType_t wait = portMAX_DELAY;
+    if (w.job != NULL && !w.paused && !w.idle)
+    {
+      TickType_t now = xTaskGetTickCount();
+      wait = (int32_t)(due - now) > 0 ? due - now : 0;
+    }
+
+    WorkerCmd cmd;
+    if (xQueueReceive(w.queue, &cmd, wait) == pdTRUE)
+    {
+      w.idle = false; // 任何命令都让空闲的作业重新执行一步
+      switch (cmd.type)
+      {
+      case WORKER_CMD_START:
+        endJob(w);
+        w.job = cmd.job;
+        if (cmd.job->start != NULL)
+        {
+          cmd.job->start(cmd.arg);
+        }
+        due = xTaskGetTickCount();
+        break;
+      case WORKER_CMD_STOP:
+        endJob(w);
+        w.stopDone = cmd.seq;
+        xSemaphoreGive(w.stopped);
+        break;
+      case WORKER_CMD_PAUSE:
+      case WORKER_CMD_RESUME:
+      {
+        bool paused = cmd.type == WORKER_CMD_PAUSE;
+        if (w.job != NULL && w.paused != paused)
+        {
+          w.paused = paused;
+          if (w.job->pause != NULL)
+          {
+            w.job->pause(paused);
+          }
+          due = xTaskGetTickCount();
+        }
+        break;
+      }
+      case WORKER_CMD_WAKE:
+        due = xTaskGetTickCount();
+        break;
+      }
+      continue;
+    }
+
+    uint32_t ms = w.job->step();
+    if (ms == WORKER_DONE)
+    {
+      endJob(w);
+      continue;
+    }
+    if (ms == WORKER_IDLE)
+    {
+      w.idle = true;
+      continue;
+    }
+    // 按截止时间排下一步，每一步的执行时间不会累积成节奏漂移；落后时不补跑
+    TickType_t now = xTaskGetTickCount();
+    due += pdMS_TO_TICKS(ms);
+    if ((int32_t)(due - now) < 0)
+    {
+      due = now;
+    }
+  }
+}
+
+void Worker_Init()
+{
+  for (int i = 0; i < WORKER_COUNT; i++)
+  {
+    Worker &w = workers[i];
+    w.queue = xQueueCreate(WORKER_QUEUE_LEN, sizeof(WorkerCmd));
+    w.stopped = xSemaphoreCreateCounting(WORKER_QUEUE_LEN, 0);
+    w.stopLock = xSemaphoreCreateMutex();
+    w.stopSeq = 0;
+    w.stopDone = 0;
+    w.job = NULL;
+    w.paused = false;
+    w.idle = false;
+    xTaskCreate(Worker_Task, workerDefs[i].name, workerDefs[i].stack, (void *)(intptr_t)i, workerDefs[i].priority, &w.task);
+  }
+}
+
+void Worker_Start(WorkerId id, const WorkerJob *job, int arg)
+{
+  WorkerCmd cmd = {WORKER_CMD_START, job, arg};
+  xQueueSend(workers[id].queue, &cmd, portMAX_DELAY);
+}
+
+void Worker_Stop(WorkerId id)
+{
+  Worker &w = workers[id];
+  if (xTaskGetCurrentTaskHandle() == w.task)
+  {
+    endJob(w); // 作业自己的回调中停止
+    return;
+  }
+  xSemaphoreTake(w.stopLock, portMAX_DELAY);
+  // 即使已经空闲也发送命令，排在它之前的开始命令随之作废
+  WorkerCmd cmd = {WORKER_CMD_STOP, NULL, 0, ++w.stopSeq};
+  xQueueSend(w.queue, &cmd, portMAX_DELAY);
+  // 之前超时的停止命令完成时也会给出信号，按序号丢弃，直到本条命令处理完
+  TickType_t start = xTaskGetTickCount();
+  TickType_t timeout = pdMS_TO_TICKS(WORKER_STOP_TIMEOUT_MS);
+  bool done = false;
+  for (;;)
+  {
+    TickType_t elapsed = xTaskGetTickCount() - start;
+    if (elapsed >= timeout || xSemaphoreTake(w.stopped, timeout - elapsed) != pdTRUE)
+    {
+      break;
+    }
+    if (w.stopDone == cmd.seq)
+    {
+      done = true;
+      break;
+    }
+  }
+  xSemaphoreGive(w.stopLock);
+  if (!done)
+  {
+    Serial.printf("[Worker] %s: stop timed out\n", workerDefs[id].name);
+  }
+}
+
+void Worker_Pause(WorkerId id, bool paused)
+{
+  WorkerCmd cmd = {paused ? WORKER_CMD_PAUSE : WORKER_CMD_RESUME, NULL, 0};
+  xQueueSend(workers[id].queue, &cmd, portMAX_DELAY);
+}
+
+void Worker_Wake(WorkerId id)
+{
+  WorkerCmd cmd = {WORKER_CMD_WAKE, NULL, 0};
+  xQueueSend(workers[id].queue, &cmd, 0);
+}
+
+const WorkerJob *Worker_Current(WorkerId id)
+{
+  return workers[id].job;
+}
@@ -0,0 +1,70 @@
+#ifndef WORKER_H
+#define WORKER_H
+
+#include <Arduino.h>
+
+#define WORKER_QUEUE_LEN       4          // 每个工作任务的命令队列深度
+#define WORKER_STOP_TIMEOUT_MS 1000       // Worker_Stop 等待当前一步执行完的最长时间
+#define WORKER_DONE            UINT32_MAX // step 返回此值表示作业已结束
+#define WORKER_IDLE            (UINT32_MAX - 1) // step 返回此值表示作业暂时无事可做，等到下一条命令再调用 step
+
+/**
+ * @brief 常驻的工作任务，开机时创建一次，之后只切换作业。
+ */
+enum WorkerId
+{
+    WORKER_RENDER, ///< 后台绘制页面：温度曲线、ADC仪表、动画、性能监控，优先级与界面任务相同。
+    WORKER_AUDIO,  ///< 播放乐曲，优先级高于界面任务，音符准时发声。
+    WORKER_COUNT
+};
+
+/**
+ * @brief 一个作业：原来的“每次进入页面创建一个任务”改写成的分步回调。
+ * @details 所有回调都在工作任务中执行。作业的状态放在各模块的静态变量中，
+ *          step 返回距下一步的毫秒数，期间工作任务阻塞在命令队列上，停止命令立即生效。
+ */
+struct WorkerJob
+{
+    const char *name;            ///< 作业名，用于日志。
+    void (*start)(int arg);      ///< 作业开始时调用一次，arg 为 Worker_Start 的参数。可为 NULL。
+    uint32_t (*step)();          ///< 执行一步，返回距下一步的毫秒数，WORKER_DONE 表示作业结束。
+    void (*pause)(bool paused);  ///< 暂停或继续时调用，如关闭正在发声的音符。可为 NULL。
+    void (*stop)();              ///< 作业结束或被停止时调用，释放作业占用的资源。可为 NULL。
+};
+
+/**
+ * @brief 创建所有工作任务和命令队列，开机时调用一次。
+ */
+void Worker_Init();
+
+/**
+ * @brief 让工作任务开始执行作业，不等待。
+ * @details 工作任务正在执行其他作业时，先调用旧作业的 stop，再开始新作业。
+ */
+void Worker_Start(WorkerId id, const WorkerJob *job, int arg);
+
+/**
+ * @brief 停止工作任务当前的作业，等到作业的 stop 执行完才返回。
+ * @details 工作任务在两步之间阻塞于命令队列，通常立即返回，不再需要设置标志后轮询等待任务自行删除。
+ *          多个任务同时调用时依次等待，每个调用者只在自己的停止命令处理完后返回。
+ */
+void Worker_Stop(WorkerId id);
+
+/**
+ * @brief 暂停或继续当前作业，暂停期间不调用 step。
+ */
+void Worker_Pause(WorkerId id, bool paused);
+
+/**
+ * @brief 让当前作业立即执行一步，不等待。
+ * @details 用于有自己命令队列的作业：先把命令放进作业的队列，再唤醒工作任务。
+ *          工作任务的命令队列已满时直接返回，排在前面的命令同样会让作业执行一步。
+ */
+void Worker_Wake(WorkerId id);
+
+/**
+ * @brief 工作任务正在执行的作业 (包括暂停中的)，空闲时返回 NULL。
+ */
+const WorkerJob *Worker_Current(WorkerId id);
+
+#endif // WORKER_H
@@ -0,0 +1,211 @@
+"""
+font_12 子集化工具
+
+从完整的VLW字体中只保留固件真正会用到的字形:
+    1. 源代码字符串字面量中出现的所有字符 (自动扫描 src 目录)
+    2. 可配置的动态字符集，用于显示网络API返回的文本 (默认: source，即保留源字体的全部字形)
+输出的VLW数组按码点升序排列，并额外生成码点表和位图偏移表 (都在Flash中)，
+固件 FontCache 直接在Flash上二分查找，不需要在RAM中建立索引。
+
+仓库中的 font_12 只有按 字.txt 生成的约1700个常用字，本身就是给网络文本准备的字符集，
+所以默认不删字，只排序并生成查找表 (Flash 增加约10KB 的表，换来RAM中不再需要索引)。
+只有换用更大的源字体时，用 --dynamic 指定较小的字符集才会真正减小体积。
+
+源字体可以是 TFT_eSPI Create_font 生成的 .vlw 文件，也可以是已有的 font_12.h 数组。
+不在子集中的字符在固件中会显示为方框。
+
+用法:
+    python subset_font.py --font ../font_12.h --out ../font_12.h
+    python subset_font.py --font ../font_12.h --dynamic source.txt --out ../font_12.h
+    python subset_font.py --font big_font.vlw --dynamic ascii --dynamic 字.txt --out ../font_12.h
+"""
+import argparse
+import fnmatch
+import glob
+import math
+import os
+import re
+import struct
+import sys
+
+VLW_HEADER_BYTES = 24
+VLW_METRICS_BYTES = 28
+
+# 扫描字面量时跳过的文件 (字体、图片、乐谱等数据头文件)
+DEFAULT_EXCLUDE = ['font_*.h', 'img.h']
+
+
+def load_vlw(path):
+    """读取 .vlw 文件或包含VLW数组的 .h 文件，返回字节串"""
+    if path.endswith('.h'):
+        with open(path, 'r', encoding='utf-8') as f:
+            text = f.read()
+        start = text.index('{')
+        end = text.index('}', start)
+        return bytes(int(h, 16) for h in re.findall(r'0x([0-9A-Fa-f]{2})', text[start:end]))
+    with open(path, 'rb') as f:
+        return f.read()
+
+
+def parse_vlw(data):
+    """解析VLW: 返回 (文件头, 字形列表, 尾部)，字形为 (码点, 度量28字节, 位图)"""
+    count = struct.unpack('>I', data[:4])[0]
+    offset = VLW_HEADER_BYTES + count * VLW_METRICS_BYTES
+    glyphs = []
+    for i in range(count):
+        pos = VLW_HEADER_BYTES + i * VLW_METRICS_BYTES
+        metrics = data[pos:pos + VLW_METRICS_BYTES]
+        code, height, width = struct.unpack('>III', metrics[:12])
+        size = width * height
+        glyphs.append((code, metrics, data[offset:offset + size]))
+        offset += size
+    return data[:VLW_HEADER_BYTES], glyphs, data[offset:]
+
+
+def source_codepoints(src_dir, exclude):
+    """收集源代码字符串字面量中出现的字符 (注释中的字符不算)"""
+    files = []
+    for pattern in ('*.cpp', '*.h', '*.ino'):
+        files += glob.glob(os.path.join(src_dir, pattern))
+    codes = set()
+    for path in sorted(files):
+        name = os.path.basename(path)
+        if any(fnmatch.fnmatch(name, pat) for pat in exclude):
+            continue
+        with open(path, 'r', encoding='utf-8', errors='ignore') as f:
+            text = f.read()
+        text = re.sub(r'//[^\n]*', '', text)
+        text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+        for m in re.finditer(r'"((?:[^"\\\n]|\\.)*)"', text):
+            codes.update(ord(ch) for ch in m.group(1) if ord(ch) >= 0x20)
+    return codes
+
+
+def gb2312_level1():
+    """GB2312一级汉字 (3755个，0xB0A1-0xD7F9)"""
+    codes = set()
+    for hi in range(0xB0, 0xD8):
+        for lo in range(0xA1, 0xFF):
+            try:
+                codes.add(ord(bytes([hi, lo]).decode('gb2312')))
+            except UnicodeDecodeError:
+                pass
+    return codes
+
+
+def dynamic_codepoints(specs, font_codes):
+    """解析 --dynamic 参数: 预定义字符集名称或文本文件路径 (文件中的所有字符，或 0x7684,0x4e00 形式的码点列表)"""
+    named = {
+        'source': lambda: set(font_codes),
+        'ascii': lambda: set(range(0x20, 0x7F)),
+        'cjk-punct': lambda: set(range(0x3000, 0x3040)) | set(range(0xFF00, 0xFF66)),
+        'gb2312-1': gb2312_level1,
+    }
+    codes = set()
+    for spec in specs:
+        if spec in named:
+            codes |= named[spec]()
+        elif os.path.exists(spec):
+            with open(spec, 'r', encoding='utf-8') as f:
+                text = f.read()
+            hex_codes = re.findall(r'0x([0-9A-Fa-f]{4,5})', text)
+            if hex_codes:
+                codes.update(int(h, 16) for h in hex_codes)
+            else:
+                codes.update(ord(ch) for ch in text if ord(ch) >= 0x20)
+        else:
+            sys.exit(f"未知的字符集: {spec}")
+    return codes
+
+
+def build_vlw(header, glyphs, trailer):
+    """按给定顺序重新组装VLW，返回 (VLW字节, 每个字形的位图偏移)"""
+    out = bytearray(struct.pack('>I', len(glyphs)) + header[4:])
+    for _, metrics, _ in glyphs:
+        out += metrics
+    offsets = []
+    for _, _, bitmap in glyphs:
+        offsets.append(len(out))
+        out += bitmap
+    out += trailer
+    return bytes(out), offsets
+
+
+def format_array(ctype, name, values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(', '.join(fmt.format(v) for v in values[i:i + per_line]) + ',')
+    return f"const {ctype} {name}[] PROGMEM = {{\n" + '\n'.join(lines) + "\n};\n"
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description='按实际用到的字符生成 font_12 子集')
+    parser.add_argument('--font', default=os.path.join(here, '..', 'font_12.h'), help='源字体 (.vlw 或 .h)')
+    parser.add_argument('--src', default=os.path.join(here, '..'), help='扫描字符串字面量的源代码目录')
+    parser.add_argument('--dynamic', action='append',
+                        help='动态字符集: source (源字体全部字形) / ascii / cjk-punct / gb2312-1 / 文本文件，可重复 (默认 source)')
+    parser.add_argument('--exclude', action='append', default=list(DEFAULT_EXCLUDE), help='扫描时跳过的文件名模式')
+    parser.add_argument('--name', default='font_12', help='生成的数组名')
+    parser.add_argument('--out', default=os.path.join(here, '..', 'font_12.h'), help='输出头文件')
+    args = parser.parse_args()
+
+    dynamic_specs = args.dynamic or ['source']
+    source_data = load_vlw(args.font)
+    header, glyphs, trailer = parse_vlw(source_data)
+
+    literal = source_codepoints(args.src, args.exclude)
+    dynamic = dynamic_codepoints(dynamic_specs, (g[0] for g in glyphs))
+    wanted = literal | dynamic
+
+    # 重复的码点只保留第一个，与 TFT_eSPI 线性查找的结果一致
+    by_code = {}
+    for glyph in glyphs:
+        by_code.setdefault(glyph[0], glyph)
+    kept = [by_code[c] for c in sorted(by_code) if c in wanted or c == 0x20]
+    dropped = len(glyphs) - len(kept)
+
+    vlw, offsets = build_vlw(header, kept, trailer)
+    codes = [g[0] for g in kept]
+    if max(codes, default=0) > 0xFFFF:
+        sys.exit("码点超出BMP，固件只支持16位码点")
+
+    # 字面量中的ASCII大多用内置字体绘制，单独统计，只把缺少的非ASCII字符逐个列出
+    missing_literal = sorted(c for c in literal if c not in by_code and c >= 0x80)
+    missing_ascii = sorted(c for c in (literal | dynamic) if c not in by_code and 0x20 < c < 0x80)
+    missing_dynamic = sorted(c for c in dynamic - literal if c not in by_code and c >= 0x80)
+
+    flash_before = len(source_data)
+    flash_after = len(vlw) + 2 * len(codes) + 4 * len(offsets)
+    probes = math.ceil(math.log2(len(codes) + 1)) if codes else 0
+    report = [
+        f"源字体: {len(glyphs)} 个字形, {flash_before} 字节",
+        f"子集:   {len(kept)} 个字形 (删除 {dropped} 个), {flash_after} 字节 "
+        f"(VLW {len(vlw)} + 码点表 {2 * len(codes)} + 偏移表 {4 * len(offsets)})",
+        f"查找:   二分查找最多 {probes} 次比较 (原线性查找平均 {len(glyphs) // 2} 次，最多 {len(glyphs)} 次)",
+        f"字符集: 字面量 {len(literal)} 个字符 + 动态 {' + '.join(dynamic_specs)} ({len(dynamic)} 个字符)",
+        f"缺字:   字面量 {len(missing_literal)} 个, ASCII {len(missing_ascii)} 个, "
+        f"动态字符集 {len(missing_dynamic)} 个 (将显示为方框)",
+    ]
+    if missing_literal:
+        report.append("源代码中用到但源字体没有的字符: " + ''.join(chr(c) for c in missing_literal))
+    for line in report:
+        print(line)
+
+    with open(args.out, 'w', encoding='utf-8') as f:
+        f.write("// 由 create_font/subset_font.py 生成，请勿手动修改\n")
+        for line in report:
+            f.write("// " + line + "\n")
+        f.write("#include <pgmspace.h>\n\n")
+        f.write(f"#define {args.name.upper()}_SORTED 1 // 字形按码点升序排列，可二分查找\n")
+        f.write(f"#define {args.name.upper()}_GLYPHS {len(codes)}\n\n")
+        f.write(format_array('uint8_t', args.name, vlw, 16, '0x{:02X}'))
+        f.write("\n// 每个字形的码点 (升序)\n")
+        f.write(format_array('uint16_t', args.name + '_codepoints', codes, 12, '0x{:04X}'))
+        f.write("\n// 每个字形的位图在VLW数组中的偏移\n")
+        f.write(format_array('uint32_t', args.name + '_bitmaps', offsets, 8, '0x{:06X}'))
+    print(f"已生成 {args.out}")
+
+
+if __name__ == "__main__":
+    main()
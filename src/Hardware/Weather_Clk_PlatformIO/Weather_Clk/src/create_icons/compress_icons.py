@@ -0,0 +1,214 @@
+"""
+菜单图标压缩工具
+
+把 img.h 中 200x200 的 RGB565 原始图标数组 (或PNG图片) 转换为 MenuIcon 压缩格式，生成 menu_icons.h。
+每一行独立编码，行首是该行的字节数 (16位小端)，行内操作码:
+    0x00~0x7F  重复上一个像素 (n+1) 次 (每行开始时“上一个像素”为0)
+    0x80~0xEF  调色板中的第 (n-0x80) 个颜色，1个像素 (调色板为该图标出现最多的112种颜色)
+    0xF0~0xFF  后面跟 (n-0xF0+1) 个16位原始像素 (小端)
+像素值与 img.h 中完全相同 (不做字节交换)，固件 MenuIcon_Draw 的结果与 pushImage 逐像素一致。
+生成后会在本机解码一遍校验。
+
+用法:
+    python compress_icons.py --img ../img.h --out ../menu_icons.h
+    python compress_icons.py --img ../img.h --png Clock=clock.png --out ../menu_icons.h
+"""
+import argparse
+import collections
+import os
+import re
+import sys
+
+OP_RUN = 0x00
+OP_INDEX = 0x80
+OP_LITERAL = 0xF0
+RUN_MAX = OP_INDEX - OP_RUN
+PALETTE_MAX = OP_LITERAL - OP_INDEX
+LITERAL_MAX = 0x100 - OP_LITERAL
+
+
+def load_img_h(path):
+    """读取 img.h 中所有 uint16_t 数组，返回 {名称: [像素]}"""
+    with open(path, 'r', encoding='utf-8', errors='ignore') as f:
+        text = f.read()
+    arrays = {}
+    pattern = r'const\s+(?:uint16_t|unsigned\s+short)\s+(\w+)\s*\[[^\]]*\]\s*(?:PROGMEM\s*)?=\s*\{(.*?)\}'
+    for m in re.finditer(pattern, text, flags=re.S):
+        arrays[m.group(1)] = [int(v, 0) for v in re.findall(r'0[xX][0-9A-Fa-f]+|\d+', m.group(2))]
+    return arrays
+
+
+def load_png(path, size, swap):
+    """读取PNG并转换为RGB565 (需要Pillow)，swap 为 True 时与 img.h 一样按字节交换后存放"""
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("读取PNG需要安装 Pillow: pip install pillow")
+    img = Image.open(path).convert('RGB').resize(size)
+    pixels = []
+    for r, g, b in img.getdata():
+        v = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+        pixels.append(((v >> 8) | (v << 8)) & 0xFFFF if swap else v)
+    return pixels
+
+
+def menu_icon_names(menu_cpp):
+    """从 Menu.cpp 的 menuItems 中找出用到的图标 (形如 &Weather_icon)"""
+    with open(menu_cpp, 'r', encoding='utf-8') as f:
+        text = f.read()
+    text = re.sub(r'//[^\n]*', '', text)
+    names = []
+    for m in re.finditer(r'\{\s*"[^"]*"\s*,\s*&(\w+)_icon\s*,', text):
+        if m.group(1) not in names:
+            names.append(m.group(1))
+    return names
+
+
+def build_palette(pixels, width):
+    """按“需要单独编码的次数”(即不能被重复操作覆盖的像素) 统计颜色，取最多的作为调色板"""
+    counts = collections.Counter()
+    for y in range(0, len(pixels), width):
+        prev = 0
+        for v in pixels[y:y + width]:
+            if v != prev:
+                counts[v] += 1
+            prev = v
+    return [c for c, _ in counts.most_common(PALETTE_MAX)]
+
+
+def encode_row(row, index):
+    out = bytearray()
+    prev = 0
+    i = 0
+    while i < len(row):
+        v = row[i]
+        if v == prev:
+            n = 1
+            while i + n < len(row) and row[i + n] == prev and n < RUN_MAX:
+                n += 1
+            out.append(OP_RUN + n - 1)
+            i += n
+        elif v in index:
+            out.append(OP_INDEX + index[v])
+            prev = v
+            i += 1
+        else:
+            # 收集连续的、不在调色板中且不与前一个相同的像素
+            block = [v]
+            while (i + len(block) < len(row) and len(block) < LITERAL_MAX
+                   and row[i + len(block)] not in index and row[i + len(block)] != block[-1]):
+                block.append(row[i + len(block)])
+            out.append(OP_LITERAL + len(block) - 1)
+            for p in block:
+                out += bytes((p & 0xFF, p >> 8))
+            prev = block[-1]
+            i += len(block)
+    if len(out) > 0xFFFF:
+        sys.exit("单行压缩数据超过65535字节")
+    return bytes((len(out) & 0xFF, len(out) >> 8)) + out
+
+
+def encode_icon(pixels, width, height):
+    palette = build_palette(pixels, width)
+    index = {c: i for i, c in enumerate(palette)}
+    data = bytearray()
+    for y in range(height):
+        data += encode_row(pixels[y * width:(y + 1) * width], index)
+    return palette, bytes(data)
+
+
+def decode_icon(palette, data, width, height):
+    """与固件 MenuIcon_Draw 相同的解码过程，用于校验"""
+    pixels = []
+    pos = 0
+    for _ in range(height):
+        length = data[pos] | (data[pos + 1] << 8)
+        pos += 2
+        end = pos + length
+        prev = 0
+        row = []
+        while pos < end:
+            op = data[pos]
+            pos += 1
+            if op < OP_INDEX:
+                row += [prev] * (op - OP_RUN + 1)
+            elif op < OP_LITERAL:
+                prev = palette[op - OP_INDEX]
+                row.append(prev)
+            else:
+                for _ in range(op - OP_LITERAL + 1):
+                    prev = data[pos] | (data[pos + 1] << 8)
+                    pos += 2
+                    row.append(prev)
+        if len(row) != width:
+            raise ValueError("行宽度不一致")
+        pixels += row
+    return pixels
+
+
+def format_array(ctype, name, values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(', '.join(fmt.format(v) for v in values[i:i + per_line]) + ',')
+    return f"const {ctype} {name}[] PROGMEM = {{\n" + '\n'.join(lines) + "\n};\n"
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description='把菜单图标压缩为 MenuIcon 格式')
+    parser.add_argument('--img', default=os.path.join(here, '..', 'img.h'), help='包含原始RGB565数组的头文件')
+    parser.add_argument('--menu', default=os.path.join(here, '..', 'Menu.cpp'), help='从 menuItems 中查找用到的图标')
+    parser.add_argument('--names', nargs='*', help='要转换的数组名 (默认: Menu.cpp 中用到的全部图标)')
+    parser.add_argument('--png', action='append', default=[], help='名称=图片.png，用PNG代替 img.h 中的数组')
+    parser.add_argument('--no-swap', action='store_true', help='PNG像素不做字节交换 (img.h 使用普通字节序时)')
+    parser.add_argument('--size', default='200x200', help='图标尺寸，宽x高')
+    parser.add_argument('--out', default=os.path.join(here, '..', 'menu_icons.h'), help='输出头文件')
+    args = parser.parse_args()
+
+    width, height = (int(v) for v in args.size.lower().split('x'))
+    names = args.names or menu_icon_names(args.menu)
+    arrays = load_img_h(args.img) if os.path.exists(args.img) else {}
+    for spec in args.png:
+        name, path = spec.split('=', 1)
+        arrays[name] = load_png(path, (width, height), not args.no_swap)
+        if name not in names:
+            names.append(name)
+
+    blocks = []
+    report = []
+    raw_total = packed_total = 0
+    for name in names:
+        if name not in arrays:
+            sys.exit(f"找不到图标数组: {name}")
+        pixels = arrays[name]
+        if len(pixels) != width * height:
+            sys.exit(f"{name}: 像素数 {len(pixels)} 与尺寸 {width}x{height} 不符")
+        palette, data = encode_icon(pixels, width, height)
+        if decode_icon(palette, data, width, height) != pixels:
+            sys.exit(f"{name}: 解码校验失败")
+
+        raw = len(pixels) * 2
+        packed = len(data) + 2 * len(palette)
+        raw_total += raw
+        packed_total += packed
+        report.append(f"{name}: {raw} -> {packed} 字节 ({100.0 * packed / raw:.1f}%), 调色板 {len(palette)} 色")
+        blocks.append(format_array('uint16_t', f"{name}_icon_palette", palette, 12, '0x{:04X}'))
+        blocks.append(format_array('uint8_t', f"{name}_icon_data", data, 16, '0x{:02X}'))
+        blocks.append(f"const MenuIcon {name}_icon = {{{width}, {height}, {name}_icon_palette, {name}_icon_data}};\n")
+
+    report.append(f"合计: {len(names)} 个图标, {raw_total} -> {packed_total} 字节")
+    for line in report:
+        print(line)
+
+    with open(args.out, 'w', encoding='utf-8') as f:
+        f.write("// 由 create_icons/compress_icons.py 生成，请勿手动修改\n")
+        for line in report:
+            f.write("// " + line + "\n")
+        f.write("#ifndef MENU_ICONS_H\n#define MENU_ICONS_H\n\n#include \"MenuIcon.h\"\n\n")
+        f.write('\n'.join(blocks))
+        f.write("\n#endif // MENU_ICONS_H\n")
+    print(f"已生成 {args.out}")
+
+
+if __name__ == "__main__":
+    main()
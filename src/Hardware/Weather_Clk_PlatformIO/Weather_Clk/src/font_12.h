@@ -1,5 +1,15 @@
+// 由 create_font/subset_font.py 生成，请勿手动修改
+// 源字体: 1700 个字形, 418691 字节
+// 子集:   1700 个字形 (删除 0 个), 428891 字节 (VLW 418691 + 码点表 3400 + 偏移表 6800)
+// 查找:   二分查找最多 11 次比较 (原线性查找平均 850 次，最多 1700 次)
+// 字符集: 字面量 235 个字符 + 动态 source (1700 个字符)
+// 缺字:   字面量 2 个, ASCII 72 个, 动态字符集 0 个 (将显示为方框)
+// 源代码中用到但源字体没有的字符: 描颜
 #include <pgmspace.h>
 
+#define FONT_12_SORTED 1 // 字形按码点升序排列，可二分查找
+#define FONT_12_GLYPHS 1700
+
 const uint8_t font_12[] PROGMEM = {
 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x05,
@@ -26169,5 +26179,368 @@ const uint8_t font_12[] PROGMEM = {
 0xC2, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x95, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x0F, 0xE9, 0x92, 0x89, 0xE9, 0x92, 0x89, 0xE8, 0xBF, 0x9B, 0xE6, 0xAD, 0xA5, 0xE4, 0xBD, 0x93,
 0x00, 0x10, 0x44, 0x69, 0x6E, 0x67, 0x54, 0x61, 0x6C, 0x6B, 0x2D, 0x4A, 0x69, 0x6E, 0x42, 0x75,
-0x54, 0x69, 0x01, 
+0x54, 0x69, 0x01,
+};
+
+// 每个字形的码点 (升序)
+const uint16_t font_12_codepoints[] PROGMEM = {
+0x002C, 0x002E, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039,
+0x003A, 0x003B, 0x003F, 0x005B, 0x005D, 0x3002, 0x300A, 0x300B, 0x4E00, 0x4E01, 0x4E03, 0x4E07,
+0x4E09, 0x4E0A, 0x4E0B, 0x4E0D, 0x4E0E, 0x4E13, 0x4E14, 0x4E16, 0x4E1A, 0x4E1C, 0x4E1D, 0x4E24,
+0x4E25, 0x4E2A, 0x4E2D, 0x4E30, 0x4E34, 0x4E39, 0x4E3A, 0x4E3B, 0x4E3D, 0x4E3E, 0x4E43, 0x4E45,
+0x4E48, 0x4E49, 0x4E4B, 0x4E4C, 0x4E4E, 0x4E4F, 0x4E50, 0x4E54, 0x4E58, 0x4E5D, 0x4E5F, 0x4E60,
+0x4E61, 0x4E66, 0x4E70, 0x4E71, 0x4E86, 0x4E88, 0x4E89, 0x4E8B, 0x4E8C, 0x4E8E, 0x4E8F, 0x4E91,
+0x4E92, 0x4E94, 0x4E95, 0x4E9A, 0x4E9B, 0x4EA1, 0x4EA4, 0x4EA6, 0x4EA7, 0x4EA9, 0x4EAB, 0x4EAC,
+0x4EAE, 0x4EB2, 0x4EBA, 0x4EBF, 0x4EC0, 0x4EC1, 0x4EC5, 0x4ECA, 0x4ECB, 0x4ECD, 0x4ECE, 0x4ED3,
+0x4ED6, 0x4ED8, 0x4EE3, 0x4EE4, 0x4EE5, 0x4EEA, 0x4EEC, 0x4EF2, 0x4EF6, 0x4EF7, 0x4EFB, 0x4EFD,
+0x4EFF, 0x4F01, 0x4F0A, 0x4F0D, 0x4F10, 0x4F11, 0x4F17, 0x4F18, 0x4F19, 0x4F1A, 0x4F1F, 0x4F20,
+0x4F24, 0x4F26, 0x4F2A, 0x4F2F, 0x4F30, 0x4F34, 0x4F38, 0x4F3C, 0x4F46, 0x4F4D, 0x4F4E, 0x4F4F,
+0x4F53, 0x4F55, 0x4F59, 0x4F5B, 0x4F5C, 0x4F60, 0x4F69, 0x4F73, 0x4F7F, 0x4F8B, 0x4F9B, 0x4F9D,
+0x4FA7, 0x4FA8, 0x4FB5, 0x4FBF, 0x4FC3, 0x4FC4, 0x4FCA, 0x4FD7, 0x4FDD, 0x4FE1, 0x4FEE, 0x4FF1,
+0x500D, 0x5012, 0x5019, 0x501F, 0x5021, 0x503A, 0x503C, 0x503E, 0x5047, 0x504F, 0x505A, 0x505C,
+0x5065, 0x5077, 0x507F, 0x50A8, 0x50CF, 0x513F, 0x5141, 0x5143, 0x5145, 0x5148, 0x5149, 0x514B,
+0x514D, 0x5151, 0x515A, 0x5165, 0x5168, 0x516B, 0x516C, 0x516D, 0x5170, 0x5171, 0x5173, 0x5174,
+0x5175, 0x5176, 0x5177, 0x5178, 0x517B, 0x517C, 0x5185, 0x518C, 0x518D, 0x5192, 0x5199, 0x519B,
+0x519C, 0x51A0, 0x51AC, 0x51B0, 0x51B2, 0x51B3, 0x51B5, 0x51B6, 0x51B7, 0x51C0, 0x51C6, 0x51CC,
+0x51CF, 0x51DD, 0x51E0, 0x51E1, 0x51E4, 0x51ED, 0x51FA, 0x51FB, 0x5200, 0x5206, 0x5207, 0x520A,
+0x5211, 0x5212, 0x5217, 0x5218, 0x5219, 0x521A, 0x521B, 0x521D, 0x5224, 0x5229, 0x522B, 0x5230,
+0x5236, 0x5237, 0x5238, 0x523A, 0x523B, 0x5242, 0x524D, 0x5267, 0x5269, 0x526F, 0x5272, 0x529B,
+0x529E, 0x529F, 0x52A0, 0x52A1, 0x52A3, 0x52A8, 0x52A9, 0x52AA, 0x52B1, 0x52B2, 0x52B3, 0x52BF,
+0x52C3, 0x52C7, 0x52D2, 0x52D8, 0x52E4, 0x5305, 0x5316, 0x5317, 0x533A, 0x533B, 0x5341, 0x5343,
+0x5347, 0x5348, 0x534A, 0x534E, 0x534F, 0x5355, 0x5356, 0x5357, 0x535A, 0x5360, 0x5361, 0x5362,
+0x536B, 0x5370, 0x5371, 0x5373, 0x5374, 0x5377, 0x5382, 0x5385, 0x5386, 0x538B, 0x539A, 0x539F,
+0x53A6, 0x53BB, 0x53BF, 0x53C2, 0x53C8, 0x53CA, 0x53CB, 0x53CC, 0x53CD, 0x53D1, 0x53D6, 0x53D7,
+0x53D8, 0x53E3, 0x53E4, 0x53E5, 0x53E6, 0x53EA, 0x53EB, 0x53EC, 0x53EF, 0x53F0, 0x53F2, 0x53F3,
+0x53F6, 0x53F7, 0x53F8, 0x5401, 0x5403, 0x5404, 0x5408, 0x5409, 0x540C, 0x540D, 0x540E, 0x5411,
+0x5417, 0x541B, 0x5426, 0x5427, 0x5428, 0x542B, 0x542C, 0x542F, 0x5434, 0x5438, 0x5448, 0x544A,
+0x5458, 0x5462, 0x5468, 0x5473, 0x547C, 0x547D, 0x548C, 0x54A8, 0x54C1, 0x54C8, 0x54CD, 0x54E5,
+0x54EA, 0x54F2, 0x5510, 0x552E, 0x552F, 0x5531, 0x5546, 0x554A, 0x5584, 0x559C, 0x559D, 0x5609,
+0x5668, 0x56DB, 0x56DE, 0x56E0, 0x56E2, 0x56ED, 0x56F0, 0x56F4, 0x56FA, 0x56FD, 0x56FE, 0x5706,
+0x5708, 0x571F, 0x5723, 0x5728, 0x5730, 0x5733, 0x573A, 0x5740, 0x5747, 0x574F, 0x5750, 0x5757,
+0x575A, 0x575B, 0x5761, 0x5766, 0x578B, 0x57C3, 0x57CE, 0x57DF, 0x57F9, 0x57FA, 0x5802, 0x5851,
+0x5854, 0x585E, 0x586B, 0x5883, 0x5899, 0x589E, 0x58A8, 0x58C1, 0x58EB, 0x58EE, 0x58F0, 0x5904,
+0x5907, 0x590D, 0x590F, 0x5916, 0x591A, 0x591C, 0x591F, 0x5927, 0x5929, 0x592A, 0x592B, 0x592E,
+0x5931, 0x5934, 0x593A, 0x5947, 0x5949, 0x594B, 0x594F, 0x5954, 0x5956, 0x5957, 0x5965, 0x5973,
+0x5976, 0x5979, 0x597D, 0x5982, 0x5987, 0x5988, 0x59BB, 0x59CB, 0x59D0, 0x59D1, 0x59D3, 0x59D4,
+0x59DC, 0x5A01, 0x5A18, 0x5A31, 0x5A5A, 0x5A92, 0x5B50, 0x5B54, 0x5B57, 0x5B58, 0x5B59, 0x5B5F,
+0x5B63, 0x5B66, 0x5B69, 0x5B81, 0x5B83, 0x5B85, 0x5B87, 0x5B88, 0x5B89, 0x5B8B, 0x5B8C, 0x5B8F,
+0x5B97, 0x5B98, 0x5B9A, 0x5B9C, 0x5B9D, 0x5B9E, 0x5BA1, 0x5BA2, 0x5BA3, 0x5BA4, 0x5BAA, 0x5BAB,
+0x5BB3, 0x5BB6, 0x5BB9, 0x5BBD, 0x5BBE, 0x5BBF, 0x5BC4, 0x5BC6, 0x5BCC, 0x5BD2, 0x5BDF, 0x5BE8,
+0x5BF9, 0x5BFB, 0x5BFC, 0x5BFF, 0x5C01, 0x5C04, 0x5C06, 0x5C0A, 0x5C0F, 0x5C11, 0x5C14, 0x5C1A,
+0x5C1D, 0x5C24, 0x5C31, 0x5C3C, 0x5C3D, 0x5C40, 0x5C42, 0x5C45, 0x5C4A, 0x5C4B, 0x5C55, 0x5C5E,
+0x5C65, 0x5C71, 0x5C81, 0x5C97, 0x5C9B, 0x5CA9, 0x5CAD, 0x5CB8, 0x5CE1, 0x5CF0, 0x5D07, 0x5DDD,
+0x5DDE, 0x5DE5, 0x5DE6, 0x5DE7, 0x5DE8, 0x5DE9, 0x5DEE, 0x5DF1, 0x5DF2, 0x5DF4, 0x5E01, 0x5E02,
+0x5E03, 0x5E08, 0x5E0C, 0x5E10, 0x5E1D, 0x5E26, 0x5E2D, 0x5E2E, 0x5E38, 0x5E45, 0x5E55, 0x5E72,
+0x5E73, 0x5E74, 0x5E76, 0x5E78, 0x5E7C, 0x5E7F, 0x5E84, 0x5E86, 0x5E8A, 0x5E8F, 0x5E93, 0x5E94,
+0x5E95, 0x5E97, 0x5E9C, 0x5E9F, 0x5EA6, 0x5EA7, 0x5EAD, 0x5EB7, 0x5EC9, 0x5EF6, 0x5EFA, 0x5F00,
+0x5F02, 0x5F03, 0x5F04, 0x5F0F, 0x5F15, 0x5F1F, 0x5F20, 0x5F31, 0x5F39, 0x5F3A, 0x5F52, 0x5F53,
+0x5F55, 0x5F62, 0x5F69, 0x5F6D, 0x5F70, 0x5F71, 0x5F79, 0x5F7B, 0x5F80, 0x5F81, 0x5F84, 0x5F85,
+0x5F88, 0x5F8B, 0x5F90, 0x5F92, 0x5F97, 0x5FAA, 0x5FAE, 0x5FB7, 0x5FBD, 0x5FC3, 0x5FC5, 0x5FC6,
+0x5FD7, 0x5FD8, 0x5FD9, 0x5FE0, 0x5FE7, 0x5FEB, 0x5FF5, 0x5FFD, 0x6000, 0x6001, 0x600E, 0x6015,
+0x601D, 0x6025, 0x6027, 0x602A, 0x603B, 0x6050, 0x6062, 0x6069, 0x606F, 0x6070, 0x6076, 0x6089,
+0x60A3, 0x60A8, 0x60C5, 0x60CA, 0x60DC, 0x60E0, 0x60EF, 0x60F3, 0x6108, 0x610F, 0x611F, 0x613F,
+0x6162, 0x6167, 0x6170, 0x61C2, 0x620F, 0x6210, 0x6211, 0x6216, 0x6218, 0x622A, 0x6234, 0x6237,
+0x623F, 0x6240, 0x624B, 0x624D, 0x624E, 0x6253, 0x6258, 0x6263, 0x6267, 0x6269, 0x626B, 0x626C,
+0x626D, 0x6270, 0x6276, 0x6279, 0x627E, 0x627F, 0x6280, 0x628A, 0x6293, 0x6295, 0x6297, 0x6298,
+0x62A2, 0x62A4, 0x62A5, 0x62B1, 0x62B5, 0x62BC, 0x62BD, 0x62C5, 0x62C6, 0x62C9, 0x62CD, 0x62D2,
+0x62D3, 0x62D4, 0x62D6, 0x62DB, 0x62DC, 0x62DF, 0x62E5, 0x62E8, 0x62E9, 0x62EC, 0x62FF, 0x6301,
+0x6302, 0x6307, 0x6309, 0x6311, 0x6316, 0x6324, 0x6325, 0x632F, 0x6350, 0x6355, 0x635F, 0x6362,
+0x636E, 0x6377, 0x6388, 0x6389, 0x638C, 0x6392, 0x63A2, 0x63A5, 0x63A7, 0x63A8, 0x63AA, 0x63D0,
+0x63E1, 0x63ED, 0x63F4, 0x640F, 0x641E, 0x642C, 0x6444, 0x6446, 0x6447, 0x644A, 0x6458, 0x6469,
+0x6478, 0x64A4, 0x64AD, 0x64CD, 0x652F, 0x6536, 0x6539, 0x653B, 0x653E, 0x653F, 0x6545, 0x6548,
+0x654C, 0x654F, 0x6551, 0x6559, 0x6562, 0x6563, 0x6566, 0x656C, 0x6570, 0x6574, 0x6587, 0x6597,
+0x6599, 0x65A4, 0x65AD, 0x65AF, 0x65B0, 0x65B9, 0x65BD, 0x65C1, 0x65C5, 0x65CB, 0x65CF, 0x65D7,
+0x65E0, 0x65E2, 0x65E5, 0x65E6, 0x65E7, 0x65E8, 0x65E9, 0x65EC, 0x65F1, 0x65F6, 0x65FA, 0x6606,
+0x660C, 0x660E, 0x6613, 0x661F, 0x6620, 0x6625, 0x6628, 0x662F, 0x663E, 0x664B, 0x6653, 0x665A,
+0x6668, 0x666E, 0x666F, 0x667A, 0x6682, 0x6696, 0x66B4, 0x66F2, 0x66F4, 0x66F9, 0x66FC, 0x66FE,
+0x66FF, 0x6700, 0x6708, 0x6709, 0x670B, 0x670D, 0x6717, 0x671B, 0x671D, 0x671F, 0x6728, 0x672A,
+0x672B, 0x672C, 0x672F, 0x6731, 0x6734, 0x673A, 0x6740, 0x6742, 0x6743, 0x674E, 0x6750, 0x6751,
+0x675C, 0x675F, 0x6761, 0x6765, 0x6768, 0x676D, 0x676F, 0x6770, 0x677E, 0x677F, 0x6781, 0x6784,
+0x6790, 0x6797, 0x679A, 0x679C, 0x67AA, 0x67B6, 0x67D0, 0x67D3, 0x67DC, 0x67E5, 0x67EC, 0x67F1,
+0x67F3, 0x67F4, 0x6807, 0x680F, 0x6811, 0x6821, 0x6837, 0x6838, 0x6839, 0x683C, 0x6842, 0x6848,
+0x6851, 0x6863, 0x6865, 0x6881, 0x6885, 0x68A6, 0x68B0, 0x68C0, 0x68C9, 0x68CB, 0x68EE, 0x690D,
+0x695A, 0x697C, 0x6982, 0x6A21, 0x6A2A, 0x6B20, 0x6B21, 0x6B22, 0x6B23, 0x6B27, 0x6B32, 0x6B3E,
+0x6B4C, 0x6B62, 0x6B63, 0x6B64, 0x6B65, 0x6B66, 0x6B7B, 0x6B8A, 0x6B8B, 0x6B96, 0x6BB5, 0x6BC1,
+0x6BC5, 0x6BCD, 0x6BCF, 0x6BD2, 0x6BD4, 0x6BD5, 0x6BDB, 0x6BEB, 0x6C0F, 0x6C11, 0x6C14, 0x6C34,
+0x6C38, 0x6C42, 0x6C47, 0x6C49, 0x6C57, 0x6C5F, 0x6C60, 0x6C61, 0x6C7D, 0x6C88, 0x6C89, 0x6C99,
+0x6C9F, 0x6CA1, 0x6CB3, 0x6CB9, 0x6CBB, 0x6CBF, 0x6CC9, 0x6CD5, 0x6CDB, 0x6CE2, 0x6CE5, 0x6CE8,
+0x6CEA, 0x6CF0, 0x6CF3, 0x6CFD, 0x6D01, 0x6D0B, 0x6D17, 0x6D1B, 0x6D1E, 0x6D25, 0x6D2A, 0x6D32,
+0x6D3B, 0x6D3E, 0x6D41, 0x6D4B, 0x6D4E, 0x6D53, 0x6D59, 0x6D66, 0x6D69, 0x6D6A, 0x6D6E, 0x6D77,
+0x6D88, 0x6D89, 0x6D8C, 0x6D9B, 0x6DA6, 0x6DA8, 0x6DB2, 0x6DE1, 0x6DEE, 0x6DF1, 0x6DF7, 0x6DFB,
+0x6E05, 0x6E10, 0x6E14, 0x6E20, 0x6E21, 0x6E29, 0x6E2F, 0x6E38, 0x6E56, 0x6E7E, 0x6E90, 0x6EAA,
+0x6ECB, 0x6ED1, 0x6EDA, 0x6EDE, 0x6EE1, 0x6EE8, 0x6EE9, 0x6F14, 0x6F20, 0x6F2B, 0x6F5C, 0x6F6E,
+0x6FB3, 0x6FC0, 0x704C, 0x706B, 0x706D, 0x706F, 0x7075, 0x707E, 0x7089, 0x708E, 0x70AD, 0x70AE,
+0x70B8, 0x70B9, 0x70BC, 0x70C8, 0x70DF, 0x70E7, 0x70ED, 0x7126, 0x7136, 0x714C, 0x7164, 0x7167,
+0x719F, 0x71C3, 0x71D5, 0x7206, 0x7231, 0x7236, 0x7247, 0x7248, 0x724C, 0x7259, 0x725B, 0x7267,
+0x7269, 0x7275, 0x7279, 0x72AF, 0x72B6, 0x72EC, 0x731B, 0x732A, 0x732E, 0x7387, 0x7389, 0x738B,
+0x73A9, 0x73AF, 0x73B0, 0x73BB, 0x73CD, 0x73E0, 0x73ED, 0x7403, 0x7406, 0x741B, 0x745E, 0x7483,
+0x74DC, 0x74E6, 0x74F6, 0x7518, 0x751A, 0x751F, 0x7528, 0x7530, 0x7531, 0x7532, 0x7533, 0x7535,
+0x7537, 0x753B, 0x7545, 0x754C, 0x7559, 0x755C, 0x7565, 0x756A, 0x7586, 0x7591, 0x7597, 0x75AB,
+0x75BE, 0x75C5, 0x75C7, 0x75DB, 0x767B, 0x767D, 0x767E, 0x7684, 0x7687, 0x76AE, 0x76C8, 0x76CA,
+0x76D0, 0x76D1, 0x76D6, 0x76D7, 0x76D8, 0x76DB, 0x76DF, 0x76EE, 0x76F2, 0x76F4, 0x76F8, 0x76FE,
+0x7701, 0x770B, 0x771F, 0x773C, 0x7740, 0x7763, 0x77DB, 0x77E5, 0x77ED, 0x77F3, 0x77FF, 0x7801,
+0x7814, 0x7834, 0x7840, 0x786C, 0x786E, 0x788D, 0x78E8, 0x793A, 0x793C, 0x793E, 0x7956, 0x795D,
+0x795E, 0x7965, 0x7968, 0x7981, 0x798F, 0x79BB, 0x79C0, 0x79C1, 0x79CB, 0x79CD, 0x79D1, 0x79D2,
+0x79D8, 0x79DF, 0x79E6, 0x79E9, 0x79EF, 0x79F0, 0x79FB, 0x7A0B, 0x7A0E, 0x7A33, 0x7A3B, 0x7A3F,
+0x7A46, 0x7A76, 0x7A77, 0x7A7A, 0x7A7F, 0x7A81, 0x7A97, 0x7ACB, 0x7AD9, 0x7ADE, 0x7ADF, 0x7AE0,
+0x7AE5, 0x7AEF, 0x7AF9, 0x7B11, 0x7B14, 0x7B26, 0x7B2C, 0x7B49, 0x7B51, 0x7B54, 0x7B56, 0x7B79,
+0x7B7E, 0x7B80, 0x7B97, 0x7BA1, 0x7BB1, 0x7BC7, 0x7BEE, 0x7C4D, 0x7C73, 0x7C7B, 0x7C89, 0x7CAE,
+0x7CBE, 0x7CD6, 0x7CFB, 0x7D20, 0x7D22, 0x7D27, 0x7D2F, 0x7E41, 0x7EA0, 0x7EA2, 0x7EA4, 0x7EA6,
+0x7EA7, 0x7EAA, 0x7EAF, 0x7EB2, 0x7EB3, 0x7EB5, 0x7EB7, 0x7EB8, 0x7EBA, 0x7EBD, 0x7EBF, 0x7EC3,
+0x7EC4, 0x7EC6, 0x7EC7, 0x7EC8, 0x7ECD, 0x7ECF, 0x7ED3, 0x7ED5, 0x7ED8, 0x7ED9, 0x7EDC, 0x7EDD,
+0x7EDF, 0x7EE7, 0x7EE9, 0x7EED, 0x7EF4, 0x7EFC, 0x7EFF, 0x7F13, 0x7F16, 0x7F18, 0x7F29, 0x7F34,
+0x7F3A, 0x7F51, 0x7F57, 0x7F5A, 0x7F6A, 0x7F6E, 0x7F72, 0x7F8A, 0x7F8E, 0x7FA4, 0x7FFB, 0x8000,
+0x8001, 0x8003, 0x8005, 0x800C, 0x8010, 0x8015, 0x8017, 0x8033, 0x804C, 0x8054, 0x8058, 0x805A,
+0x8083, 0x8089, 0x8096, 0x80A1, 0x80A5, 0x80AF, 0x80B2, 0x80C0, 0x80C6, 0x80CC, 0x80DC, 0x80DE,
+0x80E1, 0x80F6, 0x80FD, 0x8111, 0x811A, 0x8131, 0x8138, 0x8150, 0x817E, 0x81A8, 0x81EA, 0x81F3,
+0x81F4, 0x8206, 0x820D, 0x8212, 0x821E, 0x822A, 0x822C, 0x8239, 0x826F, 0x8270, 0x8272, 0x827A,
+0x827E, 0x8282, 0x82B1, 0x82B3, 0x82CF, 0x82D7, 0x82E5, 0x82E6, 0x82F1, 0x8303, 0x8336, 0x8349,
+0x8352, 0x8361, 0x8363, 0x836F, 0x8377, 0x83AB, 0x83B1, 0x83B7, 0x83DC, 0x8425, 0x8428, 0x843D,
+0x8457, 0x8463, 0x848B, 0x8499, 0x84C4, 0x84DD, 0x852C, 0x8584, 0x85CF, 0x864E, 0x8651, 0x865A,
+0x866B, 0x867D, 0x86CB, 0x878D, 0x8840, 0x884C, 0x8857, 0x8861, 0x8863, 0x8865, 0x8868, 0x888B,
+0x88AB, 0x88C1, 0x88C5, 0x88D5, 0x897F, 0x8981, 0x8986, 0x89C1, 0x89C2, 0x89C4, 0x89C6, 0x89C8,
+0x89C9, 0x89D2, 0x89E3, 0x89E6, 0x8A00, 0x8A89, 0x8B66, 0x8BA1, 0x8BA2, 0x8BA4, 0x8BA8, 0x8BA9,
+0x8BAD, 0x8BAE, 0x8BAF, 0x8BB0, 0x8BB2, 0x8BB8, 0x8BBA, 0x8BBE, 0x8BBF, 0x8BC1, 0x8BC4, 0x8BC6,
+0x8BC9, 0x8BCA, 0x8BCD, 0x8BD5, 0x8BD7, 0x8BDA, 0x8BDD, 0x8BDE, 0x8BE2, 0x8BE5, 0x8BED, 0x8BEF,
+0x8BF4, 0x8BF7, 0x8BF8, 0x8BFA, 0x8BFB, 0x8BFE, 0x8C01, 0x8C03, 0x8C08, 0x8C0A, 0x8C0B, 0x8C13,
+0x8C22, 0x8C37, 0x8C46, 0x8C61, 0x8C6A, 0x8C8C, 0x8D1D, 0x8D1F, 0x8D21, 0x8D22, 0x8D23, 0x8D25,
+0x8D27, 0x8D28, 0x8D29, 0x8D2B, 0x8D2D, 0x8D2F, 0x8D34, 0x8D35, 0x8D37, 0x8D38, 0x8D39, 0x8D3A,
+0x8D3E, 0x8D44, 0x8D4F, 0x8D54, 0x8D56, 0x8D5A, 0x8D5B, 0x8D5E, 0x8D60, 0x8D62, 0x8D6B, 0x8D70,
+0x8D74, 0x8D75, 0x8D76, 0x8D77, 0x8D85, 0x8D8A, 0x8D8B, 0x8DA3, 0x8DB3, 0x8DC3, 0x8DD1, 0x8DDD,
+0x8DDF, 0x8DE8, 0x8DEF, 0x8DF3, 0x8DF5, 0x8E0F, 0x8EAB, 0x8F66, 0x8F68, 0x8F6C, 0x8F6E, 0x8F6F,
+0x8F7B, 0x8F7D, 0x8F7F, 0x8F83, 0x8F85, 0x8F86, 0x8F88, 0x8F89, 0x8F91, 0x8F93, 0x8F96, 0x8F9B,
+0x8F9E, 0x8F9F, 0x8FB9, 0x8FBD, 0x8FBE, 0x8FC1, 0x8FC5, 0x8FC7, 0x8FC8, 0x8FCE, 0x8FD0, 0x8FD1,
+0x8FD4, 0x8FD8, 0x8FD9, 0x8FDB, 0x8FDC, 0x8FDD, 0x8FDE, 0x8FDF, 0x8FEA, 0x8FEB, 0x8FF0, 0x8FF7,
+0x8FF9, 0x8FFD, 0x9000, 0x9001, 0x9002, 0x9003, 0x9009, 0x900F, 0x9010, 0x9012, 0x9014, 0x901A,
+0x901F, 0x9020, 0x9047, 0x904D, 0x9053, 0x9057, 0x906D, 0x9075, 0x907F, 0x9080, 0x9093, 0x90A3,
+0x90A6, 0x90AE, 0x90B9, 0x90BB, 0x90CA, 0x90D1, 0x90E8, 0x90ED, 0x90FD, 0x914D, 0x9152, 0x9178,
+0x9192, 0x91C7, 0x91CA, 0x91CC, 0x91CD, 0x91CE, 0x91CF, 0x91D1, 0x9274, 0x9488, 0x949F, 0x94A2,
+0x94A6, 0x94B1, 0x94BB, 0x94C1, 0x94DC, 0x94F6, 0x94FA, 0x9500, 0x9501, 0x9505, 0x950B, 0x9519,
+0x9521, 0x9526, 0x952E, 0x9547, 0x955C, 0x957F, 0x95E8, 0x95ED, 0x95EE, 0x95EF, 0x95F2, 0x95F4,
+0x95F9, 0x95FB, 0x9614, 0x961F, 0x9632, 0x9633, 0x9634, 0x9635, 0x9636, 0x963B, 0x963F, 0x9644,
+0x9645, 0x9646, 0x9648, 0x964D, 0x9650, 0x9655, 0x9662, 0x9664, 0x9669, 0x966A, 0x9675, 0x9676,
+0x9677, 0x9686, 0x968F, 0x9690, 0x9694, 0x969C, 0x96BE, 0x96C4, 0x96C5, 0x96C6, 0x96E8, 0x96EA,
+0x96F6, 0x96F7, 0x9700, 0x9707, 0x9732, 0x9752, 0x9759, 0x975E, 0x9760, 0x9762, 0x9769, 0x978B,
+0x97E9, 0x97F3, 0x9876, 0x9879, 0x987A, 0x987B, 0x987E, 0x987F, 0x9881, 0x9884, 0x9886, 0x9887,
+0x9891, 0x9897, 0x9898, 0x989D, 0x98CE, 0x98DE, 0x98DF, 0x9910, 0x996D, 0x996E, 0x9970, 0x9971,
+0x9972, 0x9986, 0x9996, 0x9999, 0x9A6C, 0x9A76, 0x9A7B, 0x9A8C, 0x9A97, 0x9AA8, 0x9AD8, 0x9C7C,
+0x9C81, 0x9C9C, 0x9E21, 0x9E23, 0x9E4F, 0x9EA6, 0x9EBB, 0x9EC4, 0x9ECE, 0x9ED1, 0x9ED8, 0x9F13,
+0x9F50, 0x9F84, 0x9F99, 0xFF01, 0xFF0C, 0xFF1A, 0xFF1B, 0xFF1F,
+};
+
+// 每个字形的位图在VLW数组中的偏移
+const uint32_t font_12_bitmaps[] PROGMEM = {
+0x00BA08, 0x00BA1C, 0x00BA25, 0x00BAB4, 0x00BB02, 0x00BB77, 0x00BBEC, 0x00BC6E,
+0x00BCE3, 0x00BD58, 0x00BDCD, 0x00BE4F, 0x00BEC4, 0x00BEEC, 0x00BF28, 0x00BF90,
+0x00C000, 0x00C070, 0x00C08E, 0x00C13E, 0x00C1EE, 0x00C218, 0x00C2C1, 0x00C385,
+0x00C449, 0x00C4FF, 0x00C5C3, 0x00C687, 0x00C759, 0x00C82B, 0x00C8FD, 0x00C9CF,
+0x00CAA1, 0x00CB65, 0x00CC37, 0x00CCFB, 0x00CDBF, 0x00CEA0, 0x00CF81, 0x00D053,
+0x00D125, 0x00D1F7, 0x00D2C9, 0x00D39B, 0x00D45F, 0x00D522, 0x00D612, 0x00D6C8,
+0x00D7A9, 0x00D87B, 0x00D95C, 0x00DA2E, 0x00DAF1, 0x00DBC3, 0x00DCA4, 0x00DD76,
+0x00DE57, 0x00DF38, 0x00E00A, 0x00E0CE, 0x00E192, 0x00E264, 0x00E336, 0x00E408,
+0x00E4CC, 0x00E582, 0x00E646, 0x00E718, 0x00E7EA, 0x00E8A0, 0x00E956, 0x00EA1A,
+0x00EAD0, 0x00EB86, 0x00EC3C, 0x00ED0E, 0x00EDC4, 0x00EE88, 0x00EF4C, 0x00F02D,
+0x00F0FF, 0x00F1E0, 0x00F2A4, 0x00F376, 0x00F448, 0x00F51A, 0x00F5EC, 0x00F6CD,
+0x00F7AE, 0x00F89E, 0x00F97F, 0x00FA60, 0x00FB41, 0x00FC22, 0x00FD03, 0x00FDE4,
+0x00FEB6, 0x00FF97, 0x010087, 0x010168, 0x010249, 0x01031B, 0x0103FC, 0x0104DD,
+0x0105BE, 0x0106AE, 0x01079E, 0x01087F, 0x01096F, 0x010A5F, 0x010B31, 0x010C21,
+0x010D11, 0x010DF2, 0x010ED3, 0x010FB4, 0x011095, 0x011185, 0x011266, 0x011347,
+0x011428, 0x011518, 0x011608, 0x0116E9, 0x0117CA, 0x0118BA, 0x01199B, 0x011A7C,
+0x011B5D, 0x011C3E, 0x011D1F, 0x011E00, 0x011EE1, 0x011FD1, 0x0120C1, 0x0121A2,
+0x012283, 0x012373, 0x012463, 0x012544, 0x012625, 0x012715, 0x012805, 0x0128E6,
+0x0129C7, 0x012AB7, 0x012BA7, 0x012C88, 0x012D78, 0x012E59, 0x012F3A, 0x01301B,
+0x01310B, 0x0131EC, 0x0132DC, 0x0133CC, 0x0134AD, 0x01359D, 0x01368D, 0x01377D,
+0x01386D, 0x01394E, 0x013A2F, 0x013B10, 0x013C00, 0x013CE1, 0x013DC2, 0x013EB2,
+0x013FA2, 0x014092, 0x014182, 0x014272, 0x014362, 0x014443, 0x014524, 0x0145F6,
+0x0146C8, 0x01479A, 0x01486C, 0x01493E, 0x014A10, 0x014AF1, 0x014BC3, 0x014C95,
+0x014D85, 0x014E57, 0x014F29, 0x015019, 0x0150EB, 0x0151AF, 0x015273, 0x015354,
+0x015418, 0x0154DC, 0x0155A0, 0x015672, 0x015744, 0x015825, 0x015906, 0x0159D8,
+0x015AC8, 0x015B9A, 0x015C50, 0x015D14, 0x015DE6, 0x015EB8, 0x015F99, 0x01607A,
+0x01615B, 0x01623C, 0x01631D, 0x0163EF, 0x0164C1, 0x0165B1, 0x0166A1, 0x016773,
+0x016854, 0x016944, 0x016A34, 0x016B06, 0x016BE7, 0x016CC8, 0x016D9A, 0x016E5E,
+0x016F22, 0x016FE6, 0x0170C7, 0x017199, 0x01726B, 0x01734C, 0x01742D, 0x01750E,
+0x0175EF, 0x0176D0, 0x0177C0, 0x017892, 0x017973, 0x017A54, 0x017B35, 0x017C16,
+0x017CF7, 0x017DC9, 0x017EAA, 0x017F9A, 0x01808A, 0x01816B, 0x01825B, 0x01833C,
+0x01842C, 0x01851C, 0x01860C, 0x0186ED, 0x0187BF, 0x018891, 0x018972, 0x018A53,
+0x018B43, 0x018C15, 0x018CE7, 0x018DC8, 0x018EB8, 0x018FA8, 0x01907A, 0x01914C,
+0x01922D, 0x0192FF, 0x0193D1, 0x0194B2, 0x019584, 0x019665, 0x019729, 0x01980A,
+0x0198DC, 0x019992, 0x019A56, 0x019B28, 0x019BFA, 0x019CCC, 0x019D9E, 0x019E70,
+0x019F42, 0x01A023, 0x01A0F5, 0x01A1C7, 0x01A2A8, 0x01A389, 0x01A44D, 0x01A51F,
+0x01A600, 0x01A6B6, 0x01A788, 0x01A869, 0x01A93B, 0x01AA0D, 0x01AAFD, 0x01ABCF,
+0x01ACAF, 0x01AD8F, 0x01AE70, 0x01AF60, 0x01B050, 0x01B140, 0x01B212, 0x01B2E4,
+0x01B3D4, 0x01B4A6, 0x01B578, 0x01B668, 0x01B748, 0x01B829, 0x01B90A, 0x01B9DC,
+0x01BAAE, 0x01BB8F, 0x01BC38, 0x01BCFC, 0x01BDCE, 0x01BE91, 0x01BF47, 0x01C019,
+0x01C0DD, 0x01C193, 0x01C249, 0x01C32A, 0x01C3FC, 0x01C4DD, 0x01C5AF, 0x01C673,
+0x01C745, 0x01C809, 0x01C8DB, 0x01C9AD, 0x01CA7F, 0x01CB51, 0x01CC15, 0x01CCF6,
+0x01CDC8, 0x01CE9A, 0x01CF6C, 0x01D022, 0x01D0D8, 0x01D1B9, 0x01D28B, 0x01D35D,
+0x01D43E, 0x01D51F, 0x01D600, 0x01D6C4, 0x01D788, 0x01D85A, 0x01D92C, 0x01DA0D,
+0x01DADF, 0x01DBB1, 0x01DC92, 0x01DD73, 0x01DE37, 0x01DEFB, 0x01DFCD, 0x01E09F,
+0x01E171, 0x01E261, 0x01E333, 0x01E414, 0x01E4D8, 0x01E59C, 0x01E660, 0x01E732,
+0x01E804, 0x01E8D6, 0x01E99A, 0x01EA6C, 0x01EB4D, 0x01EC1F, 0x01ECD5, 0x01ED8B,
+0x01EE4F, 0x01EF13, 0x01EFD7, 0x01F09B, 0x01F15F, 0x01F223, 0x01F2E7, 0x01F3B9,
+0x01F48B, 0x01F55D, 0x01F621, 0x01F6E5, 0x01F7D5, 0x01F8A7, 0x01F988, 0x01FA69,
+0x01FB3B, 0x01FC1C, 0x01FD0C, 0x01FDD0, 0x01FEC0, 0x01FF84, 0x020056, 0x020137,
+0x020209, 0x0202CD, 0x0203AE, 0x02049E, 0x02058E, 0x02066E, 0x020740, 0x020804,
+0x0208E5, 0x0209C5, 0x020A97, 0x020B69, 0x020C59, 0x020D49, 0x020E29, 0x020EED,
+0x020FBF, 0x021083, 0x021155, 0x021245, 0x021317, 0x0213F8, 0x0214CA, 0x0215AB,
+0x02167D, 0x02175E, 0x02183F, 0x021920, 0x021A01, 0x021AD3, 0x021BB4, 0x021C95,
+0x021D76, 0x021E57, 0x021F29, 0x02200A, 0x0220DC, 0x0221CC, 0x02229E, 0x02238E,
+0x02246F, 0x022550, 0x022631, 0x022703, 0x0227D5, 0x0228B6, 0x022997, 0x022A87,
+0x022B68, 0x022C49, 0x022D2A, 0x022E0B, 0x022EEC, 0x022FBE, 0x0230AE, 0x02318F,
+0x023270, 0x023342, 0x023423, 0x023504, 0x0235E5, 0x0236D5, 0x0237C5, 0x023889,
+0x02395B, 0x023A2D, 0x023B0E, 0x023BE0, 0x023CB2, 0x023D93, 0x023E65, 0x023F46,
+0x024018, 0x0240DC, 0x0241A0, 0x024272, 0x024344, 0x024416, 0x0244F7, 0x0245C9,
+0x0246AA, 0x02477C, 0x02484E, 0x02492F, 0x0249F3, 0x024AB7, 0x024B89, 0x024C4C,
+0x024D2C, 0x024DF0, 0x024EB4, 0x024F95, 0x025059, 0x02511D, 0x0251EF, 0x0252D0,
+0x0253A2, 0x025483, 0x025564, 0x025636, 0x0256FA, 0x0257CC, 0x0258AD, 0x02598E,
+0x025A6F, 0x025B5F, 0x025C31, 0x025D03, 0x025DE4, 0x025ED4, 0x025FC4, 0x0260A5,
+0x026177, 0x026249, 0x02631B, 0x0263ED, 0x0264BF, 0x026591, 0x026663, 0x026744,
+0x026825, 0x026906, 0x0269E7, 0x026AC8, 0x026BA9, 0x026C8A, 0x026D6B, 0x026E4C,
+0x026F2D, 0x02700E, 0x0270D2, 0x0271B3, 0x027285, 0x027357, 0x027429, 0x027519,
+0x0275FA, 0x0276DB, 0x0277CB, 0x02789D, 0x02797E, 0x027A50, 0x027B06, 0x027BD8,
+0x027CB8, 0x027D6E, 0x027E4F, 0x027F21, 0x027FC9, 0x028072, 0x028128, 0x0281FA,
+0x0282CC, 0x0283AD, 0x02848E, 0x02856F, 0x028641, 0x028713, 0x0287F4, 0x0288D5,
+0x0289B6, 0x028A79, 0x028B69, 0x028C4A, 0x028D0E, 0x028DD2, 0x028EA4, 0x028F76,
+0x029048, 0x02911A, 0x02920A, 0x0292EB, 0x0293DB, 0x0294BC, 0x0295AC, 0x02969C,
+0x02978C, 0x02987C, 0x02996C, 0x029A5C, 0x029B4C, 0x029C3C, 0x029D1D, 0x029DFE,
+0x029EDF, 0x029FC0, 0x02A0A1, 0x02A191, 0x02A255, 0x02A327, 0x02A3F9, 0x02A4CB,
+0x02A59D, 0x02A660, 0x02A741, 0x02A813, 0x02A8E5, 0x02A9B7, 0x02AA89, 0x02AB5B,
+0x02AC11, 0x02AD01, 0x02ADF1, 0x02AED2, 0x02AFC2, 0x02B094, 0x02B175, 0x02B265,
+0x02B346, 0x02B427, 0x02B508, 0x02B5F8, 0x02B6E8, 0x02B7C9, 0x02B8B9, 0x02B9A9,
+0x02BA99, 0x02BB7A, 0x02BC6A, 0x02BD5A, 0x02BE4A, 0x02BF3A, 0x02BFFE, 0x02C0D0,
+0x02C1A2, 0x02C266, 0x02C32A, 0x02C40B, 0x02C4CF, 0x02C5A1, 0x02C682, 0x02C772,
+0x02C836, 0x02C926, 0x02C9EA, 0x02CABC, 0x02CB8E, 0x02CC52, 0x02CD33, 0x02CE05,
+0x02CEE6, 0x02CFB8, 0x02D08A, 0x02D17A, 0x02D25B, 0x02D33C, 0x02D41D, 0x02D4D3,
+0x02D5A5, 0x02D686, 0x02D74A, 0x02D82B, 0x02D90C, 0x02D9FC, 0x02DACE, 0x02DBAF,
+0x02DC81, 0x02DD62, 0x02DE43, 0x02DF15, 0x02E005, 0x02E0D7, 0x02E1A9, 0x02E28A,
+0x02E37A, 0x02E45B, 0x02E53C, 0x02E60E, 0x02E6EF, 0x02E7D0, 0x02E8B1, 0x02E992,
+0x02EA73, 0x02EB54, 0x02EC44, 0x02ED08, 0x02EDDA, 0x02EEAC, 0x02EF8D, 0x02F05F,
+0x02F131, 0x02F203, 0x02F2E4, 0x02F3B6, 0x02F47A, 0x02F55B, 0x02F62D, 0x02F70E,
+0x02F7E0, 0x02F8B2, 0x02F984, 0x02FA56, 0x02FB37, 0x02FC18, 0x02FD08, 0x02FDE9,
+0x02FEBB, 0x02FFAB, 0x03008C, 0x03016D, 0x03024E, 0x03032F, 0x030410, 0x0304F1,
+0x0305D2, 0x0306C2, 0x0307A3, 0x030875, 0x030956, 0x030A37, 0x030B27, 0x030C17,
+0x030CF8, 0x030DD9, 0x030EBA, 0x030FAA, 0x03108B, 0x03117B, 0x03125C, 0x03133D,
+0x03142D, 0x03150E, 0x0315E0, 0x0316C1, 0x0317A2, 0x031883, 0x031973, 0x031A63,
+0x031B53, 0x031C25, 0x031D15, 0x031DF6, 0x031EE6, 0x031FC7, 0x0320A8, 0x032189,
+0x032279, 0x03234B, 0x03243B, 0x03252B, 0x03261B, 0x03270B, 0x0327EC, 0x0328DC,
+0x0329AE, 0x032A8F, 0x032B70, 0x032C51, 0x032D41, 0x032E31, 0x032F21, 0x033011,
+0x0330E3, 0x0331C4, 0x0332A4, 0x033394, 0x033484, 0x033574, 0x033664, 0x033754,
+0x033844, 0x033925, 0x033A06, 0x033AE7, 0x033BD7, 0x033CC7, 0x033DB7, 0x033E98,
+0x033F88, 0x034069, 0x034159, 0x034249, 0x034339, 0x034429, 0x03450A, 0x0345EB,
+0x0346DB, 0x0347CB, 0x03488F, 0x034970, 0x034A42, 0x034B23, 0x034C04, 0x034CE5,
+0x034DD5, 0x034EC5, 0x034FA6, 0x035096, 0x035168, 0x035258, 0x035348, 0x035429,
+0x035519, 0x0355EB, 0x0356BD, 0x035765, 0x035829, 0x0358FB, 0x0359BE, 0x035A90,
+0x035B62, 0x035C34, 0x035D15, 0x035DCB, 0x035E9D, 0x035F53, 0x036025, 0x0360F7,
+0x0361BB, 0x03628D, 0x03637D, 0x03645E, 0x03653F, 0x036611, 0x0366C7, 0x036799,
+0x03686B, 0x03694C, 0x036A10, 0x036AE2, 0x036BB4, 0x036C86, 0x036D58, 0x036E39,
+0x036EFD, 0x036FDE, 0x0370A2, 0x037174, 0x03722A, 0x0372EE, 0x0373CF, 0x037492,
+0x037573, 0x037654, 0x037735, 0x037807, 0x0378CB, 0x0379AC, 0x037A8D, 0x037B6E,
+0x037C4F, 0x037D30, 0x037E11, 0x037EF2, 0x037FD3, 0x0380C3, 0x0381A4, 0x038285,
+0x038357, 0x038438, 0x038519, 0x038609, 0x0386F9, 0x0387DA, 0x0388BB, 0x03898D,
+0x038A6E, 0x038B4F, 0x038C30, 0x038D20, 0x038E00, 0x038EF0, 0x038FD1, 0x0390C1,
+0x0391A2, 0x039292, 0x039382, 0x039472, 0x039553, 0x039643, 0x039724, 0x039805,
+0x0398E6, 0x0399D6, 0x039AA8, 0x039B89, 0x039C6A, 0x039D5A, 0x039E3B, 0x039F1C,
+0x039FFD, 0x03A0ED, 0x03A1DD, 0x03A2BE, 0x03A3AE, 0x03A48F, 0x03A57F, 0x03A660,
+0x03A741, 0x03A822, 0x03A903, 0x03A9F3, 0x03AAD4, 0x03ABC4, 0x03ACA5, 0x03AD95,
+0x03AE85, 0x03AF66, 0x03B056, 0x03B146, 0x03B236, 0x03B308, 0x03B3F8, 0x03B4E8,
+0x03B5D8, 0x03B6B9, 0x03B79A, 0x03B87B, 0x03B95C, 0x03BA4C, 0x03BB3C, 0x03BC1D,
+0x03BD0D, 0x03BDEE, 0x03BEB2, 0x03BF75, 0x03C047, 0x03C119, 0x03C1DD, 0x03C2A1,
+0x03C391, 0x03C472, 0x03C562, 0x03C652, 0x03C742, 0x03C832, 0x03C904, 0x03C9D6,
+0x03CAA8, 0x03CB6C, 0x03CC3E, 0x03CD02, 0x03CDD4, 0x03CE97, 0x03CF69, 0x03D03B,
+0x03D11C, 0x03D1FD, 0x03D2DE, 0x03D3B0, 0x03D482, 0x03D554, 0x03D618, 0x03D6F9,
+0x03D7CB, 0x03D89D, 0x03D96F, 0x03DA50, 0x03DB22, 0x03DC03, 0x03DCE4, 0x03DDD4,
+0x03DEB5, 0x03DFA5, 0x03E085, 0x03E166, 0x03E247, 0x03E328, 0x03E409, 0x03E4EA,
+0x03E5BC, 0x03E680, 0x03E770, 0x03E851, 0x03E941, 0x03EA13, 0x03EAF4, 0x03EBD5,
+0x03ECB5, 0x03ED96, 0x03EE86, 0x03EF58, 0x03F048, 0x03F129, 0x03F20A, 0x03F2EB,
+0x03F3DB, 0x03F4CB, 0x03F5AC, 0x03F69C, 0x03F78C, 0x03F85E, 0x03F93F, 0x03FA11,
+0x03FAF2, 0x03FBC4, 0x03FCB4, 0x03FD95, 0x03FE85, 0x03FF75, 0x040065, 0x040155,
+0x040236, 0x040317, 0x0403F8, 0x0404D9, 0x0405BA, 0x04069B, 0x04078B, 0x04085D,
+0x04093E, 0x040A2E, 0x040B00, 0x040BF0, 0x040CE0, 0x040DC1, 0x040EB1, 0x040FA1,
+0x041082, 0x041172, 0x041262, 0x041343, 0x041433, 0x041514, 0x0415F5, 0x0416D5,
+0x0417B6, 0x0418A6, 0x041987, 0x041A77, 0x041B58, 0x041C39, 0x041D29, 0x041E19,
+0x041EEB, 0x041FBD, 0x0420AD, 0x04218E, 0x042260, 0x042341, 0x042413, 0x0424F4,
+0x0425D5, 0x0426C5, 0x042797, 0x042887, 0x042959, 0x042A49, 0x042B2A, 0x042BFC,
+0x042CCE, 0x042DA0, 0x042E81, 0x042F71, 0x043043, 0x043115, 0x0431F6, 0x0432C8,
+0x0433B8, 0x043499, 0x04357A, 0x04364C, 0x04372D, 0x04380E, 0x0438E0, 0x0439B2,
+0x043A93, 0x043B65, 0x043C37, 0x043D18, 0x043DF9, 0x043ECB, 0x043FAC, 0x04409C,
+0x04418C, 0x04426D, 0x04433F, 0x0443F5, 0x0444AB, 0x04457D, 0x04465D, 0x04473E,
+0x04482E, 0x04491E, 0x044A0E, 0x044AFE, 0x044BDF, 0x044CB1, 0x044DA1, 0x044E82,
+0x044F72, 0x045053, 0x045117, 0x045207, 0x0452CB, 0x04538F, 0x045453, 0x045534,
+0x0455EA, 0x0456AE, 0x045764, 0x045827, 0x0458EA, 0x0459AD, 0x045A7F, 0x045B51,
+0x045C41, 0x045CF7, 0x045DBB, 0x045E9B, 0x045F6D, 0x04605D, 0x04613E, 0x04621F,
+0x046300, 0x0463E1, 0x0464D1, 0x0465C1, 0x0466A2, 0x046774, 0x04682A, 0x0468D3,
+0x0469A5, 0x046A69, 0x046B4A, 0x046C1C, 0x046CEE, 0x046DC0, 0x046EA0, 0x046F72,
+0x047053, 0x047125, 0x0471F7, 0x0472C9, 0x047371, 0x047443, 0x047515, 0x0475F6,
+0x0476D7, 0x0477A9, 0x04787B, 0x04794D, 0x047A1F, 0x047B00, 0x047BE1, 0x047CC2,
+0x047DA3, 0x047E93, 0x047F63, 0x048053, 0x048134, 0x048206, 0x0482F6, 0x0483D6,
+0x0484B6, 0x048597, 0x048678, 0x048768, 0x04882C, 0x04890D, 0x0489EE, 0x048ACF,
+0x048BB0, 0x048C91, 0x048D72, 0x048E62, 0x048F43, 0x049033, 0x049105, 0x0491F5,
+0x0492D6, 0x0493B7, 0x049498, 0x049579, 0x049669, 0x04974A, 0x04982B, 0x04990C,
+0x0499ED, 0x049ACE, 0x049BBE, 0x049C9F, 0x049D80, 0x049E61, 0x049F42, 0x04A023,
+0x04A113, 0x04A1F4, 0x04A2C6, 0x04A398, 0x04A45C, 0x04A53D, 0x04A61E, 0x04A6F0,
+0x04A7B4, 0x04A894, 0x04A975, 0x04AA56, 0x04AB28, 0x04ABFA, 0x04ACDB, 0x04ADCB,
+0x04AEAC, 0x04AF8D, 0x04B07D, 0x04B16D, 0x04B24E, 0x04B32F, 0x04B410, 0x04B500,
+0x04B5F0, 0x04B6D1, 0x04B7B2, 0x04B893, 0x04B974, 0x04BA64, 0x04BB54, 0x04BC34,
+0x04BD24, 0x04BE05, 0x04BEE6, 0x04BFD6, 0x04C0B7, 0x04C1A7, 0x04C297, 0x04C369,
+0x04C43B, 0x04C51C, 0x04C60C, 0x04C6DE, 0x04C7BF, 0x04C891, 0x04C955, 0x04CA27,
+0x04CAF9, 0x04CBDA, 0x04CC9E, 0x04CD70, 0x04CE60, 0x04CF32, 0x04D004, 0x04D0E5,
+0x04D1B7, 0x04D298, 0x04D35C, 0x04D42E, 0x04D50F, 0x04D5E1, 0x04D6B3, 0x04D785,
+0x04D875, 0x04D956, 0x04DA1A, 0x04DAEC, 0x04DBCD, 0x04DCBD, 0x04DD8F, 0x04DE61,
+0x04DF33, 0x04E014, 0x04E0F4, 0x04E1C6, 0x04E2B6, 0x04E388, 0x04E478, 0x04E54A,
+0x04E61C, 0x04E6EE, 0x04E7CF, 0x04E8BF, 0x04E9AF, 0x04EA81, 0x04EB53, 0x04EC25,
+0x04ECF7, 0x04EDC9, 0x04EEAA, 0x04EF8B, 0x04F05D, 0x04F13E, 0x04F21F, 0x04F30F,
+0x04F3F0, 0x04F4D1, 0x04F5B2, 0x04F693, 0x04F765, 0x04F855, 0x04F945, 0x04FA26,
+0x04FAEA, 0x04FBBC, 0x04FC8E, 0x04FD6F, 0x04FE50, 0x04FF40, 0x050012, 0x0500C6,
+0x0501B6, 0x050297, 0x050369, 0x05042C, 0x05050D, 0x0505EE, 0x0506C0, 0x0507A1,
+0x050882, 0x050954, 0x050A44, 0x050B16, 0x050C06, 0x050CF6, 0x050DD7, 0x050EC7,
+0x050FB7, 0x0510A7, 0x051197, 0x05123F, 0x0512F5, 0x0513E5, 0x0514C6, 0x051598,
+0x051679, 0x05174B, 0x05182C, 0x05191C, 0x051A0C, 0x051ACF, 0x051BB0, 0x051C74,
+0x051D46, 0x051E36, 0x051F08, 0x051FDA, 0x0520BB, 0x05219C, 0x05227D, 0x05235D,
+0x05242F, 0x05251F, 0x052600, 0x0526D2, 0x0527B3, 0x052885, 0x052966, 0x052A56,
+0x052B37, 0x052C27, 0x052D08, 0x052DE9, 0x052ED9, 0x052FBA, 0x05308C, 0x05316D,
+0x05324E, 0x053320, 0x0533E4, 0x0534D4, 0x0535A6, 0x053678, 0x053758, 0x053848,
+0x053929, 0x053A19, 0x053AFA, 0x053BDB, 0x053CBC, 0x053D80, 0x053E52, 0x053F24,
+0x054005, 0x0540D7, 0x0541B8, 0x0542A8, 0x054398, 0x054488, 0x054569, 0x05464A,
+0x05472B, 0x05481B, 0x0548FC, 0x0549DD, 0x054ACD, 0x054B90, 0x054C62, 0x054D43,
+0x054E24, 0x054F05, 0x054FE6, 0x0550C7, 0x0551B7, 0x055289, 0x05535B, 0x05543C,
+0x05551D, 0x0555E1, 0x0556D1, 0x0557B2, 0x055893, 0x055974, 0x055A46, 0x055B18,
+0x055BDC, 0x055CBD, 0x055D8F, 0x055E61, 0x055F25, 0x055FF7, 0x0560C9, 0x05619B,
+0x05627C, 0x05635D, 0x056421, 0x0564F3, 0x0565C5, 0x056697, 0x056778, 0x05684A,
+0x05692B, 0x0569FD, 0x056ADE, 0x056BA2, 0x056C83, 0x056D55, 0x056E36, 0x056F08,
+0x056FDA, 0x0570AC, 0x05718D, 0x05726E, 0x057340, 0x057412, 0x0574E4, 0x0575A8,
+0x05767A, 0x05774C, 0x05781E, 0x0578FF, 0x0579E0, 0x057AC1, 0x057B85, 0x057C48,
+0x057D29, 0x057E19, 0x057EFA, 0x057FBE, 0x058090, 0x058171, 0x058261, 0x058342,
+0x058432, 0x058513, 0x0585F4, 0x0586D5, 0x0587C5, 0x0588A6, 0x058978, 0x058A68,
+0x058B3A, 0x058C0C, 0x058CED, 0x058DBF, 0x058E91, 0x058F81, 0x059053, 0x059134,
+0x059224, 0x059305, 0x0593F5, 0x0594D6, 0x0595A8, 0x059698, 0x059779, 0x059869,
+0x05993B, 0x059A1C, 0x059AFD, 0x059BDE, 0x059CBF, 0x059DA0, 0x059E90, 0x059F71,
+0x05A061, 0x05A142, 0x05A223, 0x05A2F5, 0x05A3C7, 0x05A4A8, 0x05A598, 0x05A678,
+0x05A768, 0x05A849, 0x05A939, 0x05AA29, 0x05AAFB, 0x05ABCD, 0x05ACAE, 0x05AD9E,
+0x05AE7F, 0x05AF60, 0x05B032, 0x05B113, 0x05B203, 0x05B2E4, 0x05B3D4, 0x05B4A6,
+0x05B596, 0x05B677, 0x05B767, 0x05B857, 0x05B929, 0x05BA19, 0x05BB09, 0x05BBEA,
+0x05BCBC, 0x05BD8E, 0x05BE60, 0x05BF41, 0x05C031, 0x05C121, 0x05C202, 0x05C2E3,
+0x05C3C4, 0x05C4B4, 0x05C595, 0x05C667, 0x05C748, 0x05C829, 0x05C90A, 0x05C9EB,
+0x05CACC, 0x05CB9E, 0x05CC7F, 0x05CD60, 0x05CE41, 0x05CF22, 0x05CFF4, 0x05D0D5,
+0x05D1B6, 0x05D297, 0x05D378, 0x05D459, 0x05D549, 0x05D62A, 0x05D70B, 0x05D7FB,
+0x05D8DC, 0x05D9CC, 0x05DAAD, 0x05DB8E, 0x05DC6F, 0x05DD50, 0x05DE40, 0x05DF30,
+0x05E011, 0x05E101, 0x05E1F1, 0x05E2D1, 0x05E3B2, 0x05E493, 0x05E565, 0x05E646,
+0x05E718, 0x05E7F9, 0x05E8E9, 0x05E9CA, 0x05EAAB, 0x05EB9B, 0x05EC6D, 0x05ED4E,
+0x05EE3E, 0x05EF10, 0x05EFF1, 0x05F0E1, 0x05F1A5, 0x05F269, 0x05F34A, 0x05F41C,
+0x05F4EE, 0x05F5C0, 0x05F692, 0x05F764, 0x05F845, 0x05F926, 0x05F9EA, 0x05FABC,
+0x05FB8E, 0x05FC6F, 0x05FD50, 0x05FE31, 0x05FF03, 0x05FFD5, 0x0600A7, 0x060188,
+0x06024C, 0x06031E, 0x0603F0, 0x0604D1, 0x060595, 0x060676, 0x060748, 0x06081A,
+0x0608EC, 0x0609BE, 0x060A90, 0x060B71, 0x060C43, 0x060D15, 0x060DE7, 0x060EB9,
+0x060F8B, 0x06106C, 0x06113E, 0x061210, 0x0612E2, 0x0613D2, 0x0614A4, 0x061585,
+0x061675, 0x061747, 0x061819, 0x061909, 0x0619F9, 0x061ACB, 0x061B9D, 0x061C8D,
+0x061D6E, 0x061E5E, 0x061F4E, 0x06203E, 0x06211F, 0x062200, 0x0622F0, 0x0623E0,
+0x0624B2, 0x0625A2, 0x062683, 0x062755, 0x062835, 0x062925, 0x062A06, 0x062AE7,
+0x062BAB, 0x062C9B, 0x062D5F, 0x062E31, 0x062F12, 0x062FF3, 0x0630C5, 0x0631A6,
+0x063278, 0x063359, 0x06341C, 0x0634EE, 0x0635CF, 0x0636BF, 0x0637A0, 0x063872,
+0x063962, 0x063A52, 0x063B42, 0x063C22, 0x063D03, 0x063DF3, 0x063ED4, 0x063FB5,
+0x0640A5, 0x064195, 0x064285, 0x064375, 0x064465, 0x064546, 0x06460A, 0x0646EB,
+0x0647DB, 0x0648BC, 0x0649AC, 0x064A9C, 0x064B6E, 0x064C4F, 0x064D2F, 0x064DE5,
+0x064EB7, 0x064F7A, 0x06505B, 0x06513C, 0x06522C, 0x0652FE, 0x0653D0, 0x0654B1,
+0x065575, 0x065639, 0x06571A, 0x0657FB, 0x0658CD, 0x0659AE, 0x065A80, 0x065B61,
+0x065C33, 0x065D14, 0x065DE6, 0x065EC7, 0x065FA8, 0x06607A, 0x06616A, 0x06624B,
+0x06627F, 0x066293, 0x0662BB, 0x0662F7,
 };
@@ -5,10 +5,15 @@
 #include "Menu.h"
 #include "System.h"
 #include "MQTT.h" 
+#include "Power.h"
+#include "SysMon.h"
+#include "EventBus.h"
+#include "Buzzer.h"
+#include "MusicMenuLite.h"
 
-volatile void (*requestedSongAction)(int) = NULL;
-volatile int requestedSongIndex = -1;
-volatile bool g_force_exit_ui = false; // 强制UI退出的全局标志
+#define UI_EVENT_QUEUE_LEN 8 // 界面循环的事件队列深度
+
+static QueueHandle_t uiEvents = NULL; // 界面循环订阅的事件：远程点歌、闹钟响铃、唤醒
 
 /**
  * @brief 程序入口点和初始化函数
@@ -19,6 +24,32 @@ volatile bool g_force_exit_ui = false; // 强制UI退出的全局标志
 void setup()
 {
     bootSystem(); // 调用系统启动函数
+    uiEvents = xQueueCreate(UI_EVENT_QUEUE_LEN, sizeof(AppEvent));
+    EventBus_SubscribeQueue(uiEvents, EVENT_MASK(EVENT_PLAY_SONG) | EVENT_MASK(EVENT_ALARM_RING) | EVENT_MASK(EVENT_WAKE));
+    SysMon_Watch(0); // 界面循环会被模态页面长时间阻塞，只在诊断页面显示心跳间隔
+}
+
+/**
+ * @brief 处理界面循环收到的事件
+ * @details 远程点歌在这里打开阻塞的播放界面；其余事件只用来唤醒界面循环，
+ *          showMenu() 随即按最新状态 (响铃标志、屏幕状态) 重绘。
+ */
+static void handleUiEvent(const AppEvent &event)
+{
+    if (event.type != EVENT_PLAY_SONG)
+    {
+        return;
+    }
+    if (event.b == SONG_UI_LITE)
+    {
+        play_song_lite_ui(event.a);
+    }
+    else
+    {
+        play_song_full_ui(event.a);
+    }
+    // 当阻塞的UI函数返回后，重新绘制主菜单以确保UI状态一致
+    showMenuConfig();
 }
 
 /**
@@ -26,26 +57,20 @@ void setup()
  * @details setup() 函数执行完毕后，此函数会反复执行。
  *          它构成了程序的主事件循环。
  *          - showMenu(): 处理和显示主菜单界面及各个子菜单的逻辑。
- *          - vTaskDelay(): FreeRTOS的延时函数，让出CPU给其他任务，避免空转。
+ *          - EventBus_Receive(): 阻塞在事件队列上代替固定延时，让出CPU；
+ *            熄屏时最长阻塞 POWER_SLEEP_POLL_MS，唤醒、点歌和闹钟事件到达时立即返回。
  */
 void loop()
 {
-    // 检查是否有从后台任务（如MQTT）发起的UI操作请求
-    if (requestedSongAction != NULL)
-    {
-        void (*action)(int) = (void (*)(int))requestedSongAction; // 复制函数指针
-        int songIndex = requestedSongIndex; // 复制歌曲索引
-
-        // 清除请求标志
-        requestedSongAction = NULL;
-        requestedSongIndex = -1;
-
-        action(songIndex); // 执行请求的函数 (例如 play_song_full_ui)
+    SysMon_Heartbeat();
+    showMenu(); // 显示和处理菜单逻辑
 
-        // 当阻塞的UI函数返回后，重新绘制主菜单以确保UI状态一致
-        showMenuConfig();
+    AppEvent event;
+    if (EventBus_Receive(uiEvents, &event, Power_IdleWaitMs(15)))
+    {
+        do
+        {
+            handleUiEvent(event);
+        } while (EventBus_Receive(uiEvents, &event, 0));
     }
-
-    showMenu(); // 显示和处理菜单逻辑
-    vTaskDelay(pdMS_TO_TICKS(15)); // 短暂延时，让出CPU
 }
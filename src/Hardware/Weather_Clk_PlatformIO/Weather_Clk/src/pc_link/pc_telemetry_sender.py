@@ -0,0 +1,135 @@
+"""
+PC性能数据发送端 (二进制帧协议参考实现)
+
+帧格式 (与固件 PCLink.h 保持一致):
+    | 0xA5 | 0x5A | VER | TYPE | LEN_L | LEN_H | PAYLOAD[LEN] | CRC_L | CRC_H |
+CRC16-CCITT (多项式0x1021, 初值0xFFFF) 覆盖 VER 到 PAYLOAD 末尾。
+遥测负载由 TLV 字段组成: ID[1] | LEN[1] | VALUE[LEN]，多字节数值为小端。
+
+依赖: pip install pyserial psutil
+用法: python pc_telemetry_sender.py COM5 --rate 20
+"""
+import argparse
+import platform
+import struct
+import time
+
+import psutil
+import serial
+
+SYNC = b'\xA5\x5A'
+VERSION = 1
+TYPE_TELEMETRY = 0x01
+
+FIELD_CPU_LOAD = 0x01
+FIELD_CPU_TEMP = 0x02
+FIELD_GPU_LOAD = 0x03
+FIELD_GPU_TEMP = 0x04
+FIELD_RAM_LOAD = 0x05
+FIELD_CORE_LOADS = 0x06
+FIELD_CPU_CLOCK = 0x07
+FIELD_GPU_CLOCK = 0x08
+FIELD_FAN_RPM = 0x09
+FIELD_NET_RX = 0x0A
+FIELD_NET_TX = 0x0B
+FIELD_DISK_READ = 0x0C
+FIELD_DISK_WRITE = 0x0D
+FIELD_CPU_NAME = 0x0E
+FIELD_GPU_NAME = 0x0F
+
+
+def crc16_ccitt(data, crc=0xFFFF):
+    """与固件 PCLink_CRC16 相同的算法"""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def tlv(field_id, value):
+    """打包一个 TLV 字段"""
+    return struct.pack('<BB', field_id, len(value)) + value
+
+
+def build_frame(frame_type, payload):
+    """打包完整的一帧"""
+    body = struct.pack('<BBH', VERSION, frame_type, len(payload)) + payload
+    return SYNC + body + struct.pack('<H', crc16_ccitt(body))
+
+
+class Sampler:
+    """采集本机性能数据，网络/磁盘为两次采样之间的速率"""
+
+    def __init__(self):
+        self.last_time = time.monotonic()
+        self.last_net = psutil.net_io_counters()
+        self.last_disk = psutil.disk_io_counters()
+        psutil.cpu_percent(percpu=True)  # 第一次调用只建立基准
+
+    def sample(self):
+        now = time.monotonic()
+        dt = max(now - self.last_time, 1e-3)
+        net = psutil.net_io_counters()
+        disk = psutil.disk_io_counters()
+
+        cores = psutil.cpu_percent(percpu=True)
+        fields = [
+            tlv(FIELD_CPU_LOAD, struct.pack('<B', int(sum(cores) / len(cores)))),
+            tlv(FIELD_RAM_LOAD, struct.pack('<H', int(psutil.virtual_memory().percent * 10))),
+            tlv(FIELD_CORE_LOADS, bytes(min(int(c), 100) for c in cores[:32])),
+            tlv(FIELD_NET_RX, struct.pack('<I', int((net.bytes_recv - self.last_net.bytes_recv) / dt / 1024))),
+            tlv(FIELD_NET_TX, struct.pack('<I', int((net.bytes_sent - self.last_net.bytes_sent) / dt / 1024))),
+        ]
+        if disk is not None and self.last_disk is not None:
+            fields.append(tlv(FIELD_DISK_READ, struct.pack('<I', int((disk.read_bytes - self.last_disk.read_bytes) / dt / 1024))))
+            fields.append(tlv(FIELD_DISK_WRITE, struct.pack('<I', int((disk.write_bytes - self.last_disk.write_bytes) / dt / 1024))))
+
+        freq = psutil.cpu_freq()
+        if freq:
+            fields.append(tlv(FIELD_CPU_CLOCK, struct.pack('<H', int(freq.current))))
+
+        # 温度和风扇只有部分平台(Linux)提供
+        temps = getattr(psutil, 'sensors_temperatures', lambda: {})()
+        for name in ('coretemp', 'k10temp', 'cpu_thermal'):
+            if temps.get(name):
+                fields.append(tlv(FIELD_CPU_TEMP, struct.pack('<h', int(temps[name][0].current))))
+                break
+        fans = getattr(psutil, 'sensors_fans', lambda: {})()
+        rpms = [f.current for entries in fans.values() for f in entries][:4]
+        if rpms:
+            fields.append(tlv(FIELD_FAN_RPM, b''.join(struct.pack('<H', int(r)) for r in rpms)))
+
+        self.last_time, self.last_net, self.last_disk = now, net, disk
+        return b''.join(fields)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='向 Weather_Clk 发送PC性能数据')
+    parser.add_argument('port', help='串口号，例如 COM5 或 /dev/ttyACM0')
+    parser.add_argument('--rate', type=float, default=10.0, help='发送频率 Hz (默认10)')
+    args = parser.parse_args()
+
+    sampler = Sampler()
+    period = 1.0 / args.rate
+    with serial.Serial(args.port, 115200, timeout=0) as port:
+        # 名称只需在开始时发送一次，固件会保留上一次的值
+        cpu_name = (platform.processor() or platform.machine()).encode()[:63]
+        port.write(build_frame(TYPE_TELEMETRY, tlv(FIELD_CPU_NAME, cpu_name)))
+
+        sent = 0
+        start = time.monotonic()
+        next_time = start
+        while True:
+            frame = build_frame(TYPE_TELEMETRY, sampler.sample())
+            port.write(frame)
+            sent += 1
+            if sent % int(max(args.rate, 1) * 5) == 0:
+                print(f"已发送 {sent} 帧, {sent / (time.monotonic() - start):.1f} 帧/秒, 帧长 {len(frame)} 字节")
+            next_time += period
+            time.sleep(max(0.0, next_time - time.monotonic()))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,234 @@
+"""
+副屏模式发送端与吞吐量测试 (与固件 SecondScreen.h 保持一致)
+
+PC端渲染240x240画面，与上一帧做差分，只把变化的像素段发送给设备:
+    SCREEN_OP_RAW : OP | Y | X | N | N个RGB565像素 (高字节在前)
+    SCREEN_OP_FILL: OP | Y | X | N | 1个RGB565像素 (游程)
+一帧可拆成多个 PC_LINK_TYPE_SCREEN 帧，最后一块置 FRAME_END 标志。
+设备每显示完一帧回送 PC_LINK_TYPE_SCREEN_ACK，用于流控和端到端延迟统计。
+
+依赖: pip install pyserial numpy pillow
+用法:
+    python second_screen_sender.py COM5                 # 演示仪表盘
+    python second_screen_sender.py COM5 --grab 0,0      # 镜像桌面左上角240x240区域
+    python second_screen_sender.py COM5 --frames 300    # 发送300帧后输出测试结果
+"""
+import argparse
+import struct
+import threading
+import time
+
+import numpy as np
+import serial
+from PIL import Image, ImageDraw
+
+from pc_telemetry_sender import SYNC, crc16_ccitt, build_frame
+
+WIDTH = 240
+HEIGHT = 240
+MAX_PAYLOAD = 4096            # PC_LINK_MAX_PAYLOAD
+CHUNK_HEADER = 4
+TYPE_SCREEN = 0x02
+TYPE_SCREEN_ACK = 0x82
+OP_RAW = 0x01
+OP_FILL = 0x02
+FLAG_FRAME_END = 0x01
+ACK_RESYNC = 0x01
+
+GAP_MERGE = 2                 # 两个变化段之间相同像素不超过该值时合并发送(段头占2个像素的开销)
+MIN_FILL = 4                  # 相同像素达到该长度才用游程编码
+WINDOW = 2                    # 未应答帧的最大数量，与设备的双缓冲对应
+
+
+def to_rgb565(image):
+    """PIL图像 -> (H, W) uint16 RGB565 数组"""
+    rgb = np.asarray(image.convert('RGB'), dtype=np.uint16)
+    return ((rgb[:, :, 0] >> 3) << 11) | ((rgb[:, :, 1] >> 2) << 5) | (rgb[:, :, 2] >> 3)
+
+
+def encode_row(y, row, x0, x1, out):
+    """把一行中 [x0, x1) 的像素编码为 RAW/FILL 段"""
+    x = x0
+    raw_start = x0
+    while x < x1:
+        run_end = x + 1
+        while run_end < x1 and row[run_end] == row[x]:
+            run_end += 1
+        if run_end - x >= MIN_FILL:
+            if raw_start < x:
+                out.append(struct.pack('BBBB', OP_RAW, y, raw_start, x - raw_start) + row[raw_start:x].astype('>u2').tobytes())
+            out.append(struct.pack('>BBBBH', OP_FILL, y, x, run_end - x, int(row[x])))
+            raw_start = run_end
+        x = run_end
+    if raw_start < x1:
+        out.append(struct.pack('BBBB', OP_RAW, y, raw_start, x1 - raw_start) + row[raw_start:x1].astype('>u2').tobytes())
+
+
+def encode_frame(prev, cur):
+    """与上一帧比较，返回变化像素段列表; prev为None时发送完整画面"""
+    spans = []
+    changed = np.ones(cur.shape, dtype=bool) if prev is None else (cur != prev)
+    for y in np.flatnonzero(changed.any(axis=1)):
+        xs = np.flatnonzero(changed[y])
+        # 把相邻的变化像素合并成段
+        breaks = np.flatnonzero(np.diff(xs) > GAP_MERGE + 1)
+        starts = np.concatenate(([xs[0]], xs[breaks + 1]))
+        ends = np.concatenate((xs[breaks], [xs[-1]])) + 1
+        for x0, x1 in zip(starts, ends):
+            encode_row(int(y), cur[y], int(x0), int(x1), spans)
+    return spans
+
+
+def pack_chunks(frame_id, spans):
+    """把像素段装入不超过 MAX_PAYLOAD 的数据块，最后一块置 FRAME_END"""
+    chunks = []
+    body = b''
+    for span in spans:
+        if CHUNK_HEADER + len(body) + len(span) > MAX_PAYLOAD:
+            chunks.append(struct.pack('<HBB', frame_id, 0, 0) + body)
+            body = b''
+        body += span
+    chunks.append(struct.pack('<HBB', frame_id, FLAG_FRAME_END, 0) + body)
+    return [build_frame(TYPE_SCREEN, c) for c in chunks]
+
+
+class AckReader(threading.Thread):
+    """后台解析设备回送的应答帧"""
+
+    def __init__(self, port):
+        super().__init__(daemon=True)
+        self.port = port
+        self.cond = threading.Condition()
+        self.acks = {}           # frame_id -> (接收时间, 标志, 设备写屏耗时us)
+
+    def run(self):
+        buf = b''
+        while True:
+            buf += self.port.read(self.port.in_waiting or 1)
+            while True:
+                start = buf.find(SYNC)
+                if start < 0:
+                    buf = buf[-1:]
+                    break
+                buf = buf[start:]
+                if len(buf) < 6:
+                    break
+                length = struct.unpack_from('<H', buf, 4)[0]
+                if len(buf) < 8 + length:
+                    break
+                body, crc = buf[2:6 + length], struct.unpack_from('<H', buf, 6 + length)[0]
+                buf = buf[8 + length:]
+                if crc16_ccitt(body) != crc or body[1] != TYPE_SCREEN_ACK:
+                    continue
+                frame_id, flags, _, blit_us = struct.unpack_from('<HBBI', body, 4)
+                with self.cond:
+                    self.acks[frame_id] = (time.perf_counter(), flags, blit_us)
+                    self.cond.notify_all()
+
+    def wait(self, frame_id, timeout):
+        """等待指定帧的应答，超时返回None"""
+        with self.cond:
+            self.cond.wait_for(lambda: frame_id in self.acks, timeout)
+            return self.acks.pop(frame_id, None)
+
+
+class DemoSource:
+    """演示画面: 时钟、滚动曲线和一个移动色块"""
+
+    def __init__(self):
+        self.t0 = time.perf_counter()
+        self.history = [120] * WIDTH
+
+    def next(self):
+        t = time.perf_counter() - self.t0
+        img = Image.new('RGB', (WIDTH, HEIGHT), (8, 8, 16))
+        draw = ImageDraw.Draw(img)
+        draw.text((10, 10), time.strftime('%H:%M:%S'), fill=(255, 255, 255))
+        draw.text((10, 24), f't = {t:6.2f}s', fill=(0, 200, 255))
+        self.history = self.history[1:] + [int(150 + 50 * np.sin(t * 3) + 10 * np.sin(t * 17))]
+        draw.line(list(enumerate(self.history)), fill=(0, 255, 0))
+        x = int((np.sin(t) + 1) * 100)
+        draw.rectangle((x, 60, x + 40, 100), fill=(255, 120, 0))
+        return img
+
+
+class GrabSource:
+    """镜像桌面上的一块240x240区域"""
+
+    def __init__(self, x, y):
+        from PIL import ImageGrab
+        self.grab = ImageGrab.grab
+        self.box = (x, y, x + WIDTH, y + HEIGHT)
+
+    def next(self):
+        return self.grab(bbox=self.box)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Weather_Clk 副屏发送端')
+    parser.add_argument('port', help='串口号，例如 COM5 或 /dev/ttyACM0')
+    parser.add_argument('--fps', type=float, default=30.0, help='目标帧率 (默认30)')
+    parser.add_argument('--grab', help='镜像桌面区域左上角坐标，例如 100,200')
+    parser.add_argument('--frames', type=int, default=0, help='发送指定帧数后输出测试结果并退出')
+    args = parser.parse_args()
+
+    source = GrabSource(*map(int, args.grab.split(','))) if args.grab else DemoSource()
+    port = serial.Serial(args.port, 115200, timeout=0.1)
+    reader = AckReader(port)
+    reader.start()
+
+    prev = None
+    frame_id = 0
+    in_flight = []               # [(frame_id, 发送时间, 字节数)]
+    latencies, blit_times, sizes = [], [], []
+    start = time.perf_counter()
+    next_time = start
+    period = 1.0 / args.fps
+
+    try:
+        while not args.frames or frame_id < args.frames:
+            cur = to_rgb565(source.next())
+            frames = pack_chunks(frame_id & 0xFFFF, encode_frame(prev, cur))
+            sent_at = time.perf_counter()
+            for f in frames:
+                port.write(f)
+            in_flight.append((frame_id & 0xFFFF, sent_at, sum(len(f) for f in frames)))
+            prev = cur
+            frame_id += 1
+
+            # 流控: 最多 WINDOW 帧未应答
+            while len(in_flight) >= WINDOW or (args.frames and frame_id >= args.frames and in_flight):
+                fid, t_sent, size = in_flight.pop(0)
+                ack = reader.wait(fid, 1.0)
+                if ack is None:
+                    prev = None  # 丢失应答，下一帧发送完整画面
+                    continue
+                t_ack, flags, blit_us = ack
+                latencies.append((t_ack - t_sent) * 1000)
+                blit_times.append(blit_us / 1000)
+                sizes.append(size)
+                if flags & ACK_RESYNC:
+                    prev = None
+
+            if frame_id % max(int(args.fps) * 2, 1) == 0 and latencies:
+                elapsed = time.perf_counter() - start
+                print(f"{frame_id / elapsed:5.1f} fps | {np.mean(sizes[-60:]):7.0f} B/帧 | "
+                      f"延迟 {np.mean(latencies[-60:]):5.1f} ms | 写屏 {np.mean(blit_times[-60:]):5.1f} ms")
+
+            next_time += period
+            time.sleep(max(0.0, next_time - time.perf_counter()))
+    except KeyboardInterrupt:
+        pass
+
+    if latencies:
+        elapsed = time.perf_counter() - start
+        print('--- 测试结果 ---')
+        print(f"帧数      : {frame_id} ({frame_id / elapsed:.1f} fps)")
+        print(f"每帧字节  : 平均 {np.mean(sizes):.0f}, 最大 {np.max(sizes)} (未压缩 {WIDTH * HEIGHT * 2})")
+        print(f"吞吐量    : {np.sum(sizes) / elapsed / 1024:.1f} KB/s")
+        print(f"端到端延迟: 平均 {np.mean(latencies):.1f} ms, P95 {np.percentile(latencies, 95):.1f} ms")
+        print(f"设备写屏  : 平均 {np.mean(blit_times):.1f} ms")
+
+
+if __name__ == '__main__':
+    main()
@@ -5,7 +5,17 @@
 #include "MQTT.h"
 #include "RotaryEncoder.h"
 #include "Buzzer.h"
+#include "PCLink.h"
 #include "freertos/semphr.h"
+#include "Display.h"
+#include "Profiler.h"
+#include "Power.h"
+#include "Boot.h"
+#include "SysMon.h"
+#include "EventBus.h"
+#include "Screen.h"
+#include "Worker.h"
+#include "Settings.h"
 
 // --- 全局变量 ---
 
@@ -17,6 +27,7 @@ SemaphoreHandle_t pcDataMutex; // 用于保护pcData的互斥锁
 char inputBuffer[BUFFER_SIZE];
 uint16_t bufferIndex = 0;
 bool stringComplete = false; // 串口数据接收完成标志
+static TaskHandle_t serialTaskHandle = NULL; // 串口接收任务句柄，供CDC接收事件唤醒
 
 extern TFT_eSPI tft; // 声明在其他文件中定义的外部TFT对象
 
@@ -107,6 +118,84 @@ void drawPerformanceStaticElements()
   tft.endWrite();
 }
 
+/**
+ * @brief 信息行的页面
+ */
+enum InfoPage
+{
+  INFO_PAGE_IO,    // 网络/磁盘吞吐
+  INFO_PAGE_CLOCK, // CPU/GPU频率和风扇转速
+  INFO_PAGE_CORES, // 每个核心的负载
+  INFO_PAGE_COUNT
+};
+
+/**
+ * @brief 绘制图例下方的信息行
+ * @details 一行放不下所有扩展数据，每 INFO_PAGE_UPDATES 次更新轮换一页：网络/磁盘吞吐、频率和风扇、
+ *          每个核心的负载条。发送端没有提供的页面跳过。
+ * @param data 本次更新的数据副本
+ */
+static void drawInfoLine(const PCData &data)
+{
+  static uint8_t page = INFO_PAGE_IO;
+  static uint8_t updates = 0;
+  if (++updates >= INFO_PAGE_UPDATES)
+  {
+    updates = 0;
+    page = (page + 1) % INFO_PAGE_COUNT;
+  }
+  if (page == INFO_PAGE_CLOCK && data.cpuClock == 0 && data.gpuClock == 0 && data.fanCount == 0)
+  {
+    page = INFO_PAGE_CORES;
+  }
+  if (page == INFO_PAGE_CORES && data.coreCount == 0)
+  {
+    page = INFO_PAGE_IO;
+  }
+
+  tft.fillRect(0, IO_LINE_Y, tft.width(), INFO_LINE_HEIGHT, BG_COLOR);
+  tft.setTextSize(1);
+  tft.setTextColor(TITLE_COLOR, BG_COLOR);
+
+  char line[48];
+  switch (page)
+  {
+  case INFO_PAGE_IO:
+    snprintf(line, sizeof(line), "NET %luK/%luK  DISK %luK/%luK",
+             (unsigned long) data.netRx, (unsigned long) data.netTx,
+             (unsigned long) data.diskRead, (unsigned long) data.diskWrite);
+    tft.drawString(line, COMBINED_CHART_X, IO_LINE_Y);
+    break;
+  case INFO_PAGE_CLOCK:
+  {
+    int n = snprintf(line, sizeof(line), "CPU %uMHz GPU %uMHz", data.cpuClock, data.gpuClock);
+    for (uint8_t i = 0; i < data.fanCount && n < (int) sizeof(line); i++)
+    {
+      n += snprintf(line + n, sizeof(line) - n, i == 0 ? " FAN %u" : "/%u", data.fanRpm[i]);
+    }
+    tft.drawString(line, COMBINED_CHART_X, IO_LINE_Y);
+    break;
+  }
+  case INFO_PAGE_CORES:
+  {
+    // 每个核心一根竖条，高度按负载缩放，与图表左右对齐
+    int slot = COMBINED_CHART_WIDTH / data.coreCount;
+    int barWidth = slot > 1 ? slot - 1 : 1;
+    for (uint8_t i = 0; i < data.coreCount; i++)
+    {
+      int h = min((int) data.coreLoad[i], 100) * INFO_LINE_HEIGHT / 100;
+      int x = COMBINED_CHART_X + i * slot;
+      tft.drawFastHLine(x, IO_LINE_Y + INFO_LINE_HEIGHT - 1, barWidth, TFT_DARKGREY);
+      if (h > 0)
+      {
+        tft.fillRect(x, IO_LINE_Y + INFO_LINE_HEIGHT - h, barWidth, h, TFT_GREEN);
+      }
+    }
+    break;
+  }
+  }
+}
+
 /**
  * @brief 更新性能监控界面的动态数据
  * @details 包括CPU/GPU/RAM的负载和温度，以及ESP32自身的温度。同时更新图表曲线。
@@ -126,6 +215,7 @@ void updatePerformanceData()
     return;
   }
 
+  Display_Lock(); // 本函数在后台任务中直接绘制屏幕
   tft.startWrite();
   tft.setTextColor(VALUE_COLOR, BG_COLOR);
   tft.setTextFont(1);
@@ -152,6 +242,12 @@ void updatePerformanceData()
   tft.setTextColor(TFT_ORANGE, BG_COLOR);
   tft.drawString(String(esp32c3_temp, 1) + " C", DATA_X + VALUE_OFFSET_X, DATA_Y + 3 * LINE_HEIGHT);
 
+  // 扩展数据 (仅二进制协议提供)
+  if (localPcData.protocolVersion > 0)
+  {
+    drawInfoLine(localPcData);
+  }
+
   // 更新图表
   static float gx = 0.0; // 图表X轴当前位置
   cpuLoadTrace.addPoint(gx, localPcData.cpuLoad);
@@ -170,6 +266,7 @@ void updatePerformanceData()
     gpuTempTrace.startTrace(TFT_ORANGE);
   }
   tft.endWrite();
+  Display_Unlock();
 }
 
 /**
@@ -187,6 +284,14 @@ void resetBuffer()
  */
 void parsePCData()
 {
+  // 调试命令与性能数据共用串口文本通道
+  if (Profiler_HandleCommand(inputBuffer) || Settings_HandleCommand(inputBuffer) || Power_HandleCommand(inputBuffer) ||
+      Boot_HandleCommand(inputBuffer) || SysMon_HandleCommand(inputBuffer) || EventBus_HandleCommand(inputBuffer) ||
+      Screen_HandleCommand(inputBuffer) || Buzzer_HandleCommand(inputBuffer))
+  {
+    return;
+  }
+
   struct PCData parsedValues;
   memset(&parsedValues, 0, sizeof(parsedValues));
   parsedValues.valid = false;
@@ -228,24 +333,153 @@ void parsePCData()
     pcData.gpuTemp = parsedValues.gpuTemp;
     pcData.ramLoad = parsedValues.ramLoad;
     pcData.valid = parsedValues.valid;
+    pcData.protocolVersion = 0;
     xSemaphoreGive(pcDataMutex);
   }
 }
 
+// 小端读取辅助函数
+static inline uint16_t readU16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static inline uint32_t readU32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24); }
 
 /**
- * @brief [FreeRTOS Task] 性能监控显示任务
- * @details 循环读取ESP32自身温度，并调用updatePerformanceData()函数更新屏幕上的动态数据。
+ * @brief 解析二进制遥测帧
+ * @details 负载由 TLV 字段组成；长度不符或不认识的字段直接跳过。
  */
-void Performance_Task(void *pvParameters)
+void parsePCTelemetryFrame(uint8_t version, const uint8_t *payload, uint16_t length)
 {
-  for (;;)
+  if (pcDataMutex == NULL || xSemaphoreTake(pcDataMutex, (TickType_t) 10) != pdTRUE)
+  {
+    return;
+  }
+
+  uint16_t pos = 0;
+  while (pos + 2 <= length)
+  {
+    uint8_t id = payload[pos];
+    uint8_t len = payload[pos + 1];
+    const uint8_t *v = payload + pos + 2;
+    pos += 2 + len;
+    if (pos > length)
+    {
+      break; // 字段被截断，丢弃剩余部分
+    }
+
+    switch (id)
+    {
+    case PC_FIELD_CPU_LOAD:
+      if (len >= 1) pcData.cpuLoad = v[0];
+      break;
+    case PC_FIELD_CPU_TEMP:
+      if (len >= 2) pcData.cpuTemp = (int16_t) readU16(v);
+      break;
+    case PC_FIELD_GPU_LOAD:
+      if (len >= 1) pcData.gpuLoad = v[0];
+      break;
+    case PC_FIELD_GPU_TEMP:
+      if (len >= 2) pcData.gpuTemp = (int16_t) readU16(v);
+      break;
+    case PC_FIELD_RAM_LOAD:
+      if (len >= 2) pcData.ramLoad = readU16(v) / 10.0f;
+      break;
+    case PC_FIELD_CORE_LOADS:
+      pcData.coreCount = min((int) len, PC_MAX_CORES);
+      memcpy(pcData.coreLoad, v, pcData.coreCount);
+      break;
+    case PC_FIELD_CPU_CLOCK:
+      if (len >= 2) pcData.cpuClock = readU16(v);
+      break;
+    case PC_FIELD_GPU_CLOCK:
+      if (len >= 2) pcData.gpuClock = readU16(v);
+      break;
+    case PC_FIELD_FAN_RPM:
+      pcData.fanCount = min(len / 2, PC_MAX_FANS);
+      for (uint8_t i = 0; i < pcData.fanCount; i++)
+      {
+        pcData.fanRpm[i] = readU16(v + i * 2);
+      }
+      break;
+    case PC_FIELD_NET_RX:
+      if (len >= 4) pcData.netRx = readU32(v);
+      break;
+    case PC_FIELD_NET_TX:
+      if (len >= 4) pcData.netTx = readU32(v);
+      break;
+    case PC_FIELD_DISK_READ:
+      if (len >= 4) pcData.diskRead = readU32(v);
+      break;
+    case PC_FIELD_DISK_WRITE:
+      if (len >= 4) pcData.diskWrite = readU32(v);
+      break;
+    case PC_FIELD_CPU_NAME:
+    {
+      uint8_t n = min((int) len, (int) sizeof(pcData.cpuName) - 1);
+      memcpy(pcData.cpuName, v, n);
+      pcData.cpuName[n] = '\0';
+      break;
+    }
+    case PC_FIELD_GPU_NAME:
+    {
+      uint8_t n = min((int) len, (int) sizeof(pcData.gpuName) - 1);
+      memcpy(pcData.gpuName, v, n);
+      pcData.gpuName[n] = '\0';
+      break;
+    }
+    default:
+      break; // 新版本追加的字段，忽略
+    }
+  }
+
+  pcData.protocolVersion = version;
+  pcData.valid = true;
+  xSemaphoreGive(pcDataMutex);
+}
+
+/**
+ * @brief 将一个字节追加到文本协议的行缓冲区
+ * @return 收到行结束符时返回true
+ */
+static bool appendTextByte(char inChar)
+{
+  if (inChar == '\n' || inChar == '\r')
+  {
+    return bufferIndex > 0; // 忽略\r\n中的第二个结束符产生的空行
+  }
+  if (bufferIndex < BUFFER_SIZE - 1)
+  {
+    inputBuffer[bufferIndex++] = inChar;
+    inputBuffer[bufferIndex] = '\0';
+  }
+  return false;
+}
+
+#if ARDUINO_USB_MODE && ARDUINO_USB_CDC_ON_BOOT
+/**
+ * @brief USB CDC接收事件回调，在事件循环任务中运行，仅负责唤醒串口接收任务
+ */
+static void onSerialRxEvent(void *arg, esp_event_base_t base, int32_t id, void *data)
+{
+  if (serialTaskHandle != NULL)
   {
-    // esp32c3_temp = temperatureRead();
-    updatePerformanceData();
-    vTaskDelay(pdMS_TO_TICKS(500)); // 每500ms更新一次
+    xTaskNotifyGive(serialTaskHandle);
   }
 }
+#endif
+
+
+/**
+ * @brief [绘制作业] 性能监控显示
+ * @details 调用updatePerformanceData()函数更新屏幕上的动态数据。
+ * @return 每500ms更新一次
+ */
+static uint32_t performanceStep()
+{
+  // esp32c3_temp = temperatureRead();
+  updatePerformanceData();
+  return 500;
+}
+
+static const WorkerJob performanceJob = {"performance", NULL, performanceStep, NULL, NULL};
 
 /**
  * @brief [FreeRTOS Task] 串口接收任务
@@ -256,58 +490,75 @@ void SERIAL_Task(void *pvParameters)
 {
   esp32c3_temp = temperatureRead();
   PCData_Init(&pcData);
-  unsigned long lastCharTime = 0;
+  uint8_t rxChunk[SERIAL_RX_CHUNK];
+  unsigned long lastByteTime = 0;
   for (;;)
   {
-    if (Serial.available())
-    {
-      char inChar = (char) Serial.read();
-      if (bufferIndex < BUFFER_SIZE - 1)
-      {
-        inputBuffer[bufferIndex++] = inChar;
-        inputBuffer[bufferIndex] = '\0';
-      }
-      lastCharTime = millis();
+    // 等待接收事件；超时用于处理文本协议的行超时和半帧复位
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SERIAL_LINE_TIMEOUT));
 
-      if (inChar == '\n' || inChar == '\r')
+    int available;
+    while ((available = Serial.available()) > 0)
+    {
+      size_t count = Serial.readBytes(rxChunk, min(available, SERIAL_RX_CHUNK));
+      for (size_t i = 0; i < count; i++)
       {
-        stringComplete = true;
+        if (!PCLink_Feed(rxChunk[i]) && appendTextByte((char) rxChunk[i]))
+        {
+          stringComplete = true;
+        }
+        if (stringComplete)
+        {
+          parsePCData();
+          stringComplete = false;
+          resetBuffer();
+        }
       }
+      lastByteTime = millis();
     }
 
-    // 50ms超时判断
-    if (!stringComplete && bufferIndex > 0 && (millis() - lastCharTime > 50))
-    {
-      stringComplete = true;
-    }
-
-    if (stringComplete)
+    // 超时判断：不带换行符的旧发送端，以及中途断开的二进制帧
+    if (millis() - lastByteTime > SERIAL_LINE_TIMEOUT)
     {
-      parsePCData();
-      stringComplete = false;
-      resetBuffer();
+      if (bufferIndex > 0)
+      {
+        parsePCData();
+        resetBuffer();
+      }
+      if (PCLink_InFrame())
+      {
+        PCLink_Reset();
+      }
     }
-    vTaskDelay(pdMS_TO_TICKS(10));
   }
 }
 
+/**
+ * @brief 启动PC性能数据接收
+ * @details 创建数据互斥锁，注册二进制遥测帧处理函数，并启动串口接收任务。
+ *          在原生USB CDC上，接收任务由CDC接收事件唤醒，而不是固定周期轮询。
+ */
 void startPerformanceMonitoring()
 {
   pcDataMutex = xSemaphoreCreateMutex();
-  xTaskCreatePinnedToCore(SERIAL_Task, "Serial_Rx", 2048, NULL, 3, NULL, 0);
+  PCLink_RegisterHandler(PC_LINK_TYPE_TELEMETRY, parsePCTelemetryFrame);
+  Serial.setRxBufferSize(SERIAL_RX_BUFFER);
+  xTaskCreatePinnedToCore(SERIAL_Task, "Serial_Rx", 3072, NULL, 3, &serialTaskHandle, 0);
+#if ARDUINO_USB_MODE && ARDUINO_USB_CDC_ON_BOOT
+  Serial.onEvent(ARDUINO_HW_CDC_RX_EVENT, onSerialRxEvent);
+#endif
 }
 
 /**
  * @brief 性能监控菜单的入口函数
- * @details 创建并管理性能显示任务和串口接收任务。处理退出逻辑。
+ * @details 在绘制工作任务上启动性能显示作业，处理退出逻辑。
  */
 void performanceMenu()
 {
   tft.fillScreen(TFT_BLACK);
   drawPerformanceStaticElements(); // 绘制静态背景
 
-  // 创建显示任务
-  xTaskCreatePinnedToCore(Performance_Task, "Perf_Show", 8192, NULL, 1, NULL, 0);
+  Worker_Start(WORKER_RENDER, &performanceJob, 0);
 
   while (1)
   {
@@ -315,8 +566,7 @@ void performanceMenu()
     if (exitSubMenu || g_alarm_is_ringing || readButton())
     {
       exitSubMenu = false;
-      // 删除创建的任务以释放资源
-      vTaskDelete(xTaskGetHandle("Perf_Show"));
+      Worker_Stop(WORKER_RENDER); // 作业只在两次更新之间停止，不会停在绘制途中
       break; // 退出循环，返回主菜单
     }
     vTaskDelay(pdMS_TO_TICKS(10));
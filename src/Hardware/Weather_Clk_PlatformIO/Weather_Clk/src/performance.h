@@ -19,11 +19,20 @@
 #define LOGO_Y_TOP     5
 #define LOGO_Y_BOTTOM  75
 #define BUFFER_SIZE    512
+#define SERIAL_RX_CHUNK      256  // 每次批量读取的最大字节数
+#define SERIAL_RX_BUFFER     4096 // USB CDC接收队列大小，容纳一整块副屏像素数据
+#define SERIAL_LINE_TIMEOUT  50   // 文本协议的行超时(ms)
+
+#define PC_MAX_CORES   32
+#define PC_MAX_FANS    4
 
 #define COMBINED_CHART_WIDTH    200
 #define COMBINED_CHART_HEIGHT   80
 #define COMBINED_CHART_X        20
 #define COMBINED_CHART_Y        155
+#define IO_LINE_Y               138
+#define INFO_LINE_HEIGHT        10
+#define INFO_PAGE_UPDATES       6  // 信息行每页停留的更新次数 (每次500ms)
 
 #define VALUE_OFFSET_X 40
 #define VALUE_WIDTH    100
@@ -56,16 +65,34 @@ struct PCData
     int gpuLoad;
     float ramLoad;
     bool valid; // 数据是否有效
+
+    // 以下字段仅由二进制协议提供，旧的文本协议不会更新它们
+    uint8_t protocolVersion;          // 最近一帧的协议版本，0表示来自文本协议
+    uint8_t coreCount;                // coreLoad中有效的核心数
+    uint8_t coreLoad[PC_MAX_CORES];   // 每个逻辑核心的负载 %
+    uint16_t cpuClock;                // CPU频率 MHz
+    uint16_t gpuClock;                // GPU频率 MHz
+    uint8_t fanCount;                 // fanRpm中有效的风扇数
+    uint16_t fanRpm[PC_MAX_FANS];     // 风扇转速 RPM
+    uint32_t netRx;                   // 网络下行 KB/s
+    uint32_t netTx;                   // 网络上行 KB/s
+    uint32_t diskRead;                // 磁盘读 KB/s
+    uint32_t diskWrite;               // 磁盘写 KB/s
 };
 // -----------------------------
 // 函数声明
 // -----------------------------
+/**
+ * @brief 启动PC性能数据的后台接收。
+ * @details 在系统启动时调用一次：创建互斥锁、注册二进制遥测帧处理函数，
+ *          并创建由USB CDC接收事件驱动的串口接收任务。
+ */
 void startPerformanceMonitoring();
 
 /**
  * @brief 性能监控菜单的入口函数。
  * @details 此函数作为性能监控功能的主入口，负责清空屏幕、
- *          创建并启动用于界面初始化、数据更新和串口通信的FreeRTOS任务。
+ *          绘制静态背景，并在绘制工作任务上启动数据更新作业。
  *          它会持续运行，直到用户通过按钮操作或特定标志位退出子菜单。
  */
 void performanceMenu();
@@ -106,6 +133,17 @@ void resetBuffer();
  */
 void parsePCData();
 
+/**
+ * @brief 解析一帧二进制遥测数据。
+ * @param version 帧头中的协议版本号。
+ * @param payload 帧负载，由若干 TLV 字段组成。
+ * @param length 负载长度。
+ * @details 作为 PC_LINK_TYPE_TELEMETRY 帧的处理函数注册到 PCLink。
+ *          不认识的字段ID会被跳过，因此新版本的上位机可以追加字段而不影响旧固件。
+ *          帧中未出现的字段保持上一次的值。
+ */
+void parsePCTelemetryFrame(uint8_t version, const uint8_t *payload, uint16_t length);
+
 /**
  * @brief [FreeRTOS Task] 性能监控界面的初始化任务。
  * @param pvParameters 任务创建时传入的参数（未使用）。
@@ -114,20 +152,13 @@ void parsePCData();
  */
 void Performance_Init_Task(void *pvParameters);
 
-/**
- * @brief [FreeRTOS Task] 性能数据显示更新任务。
- * @param pvParameters 任务创建时传入的参数（未使用）。
- * @details 这是一个周期性执行的FreeRTOS任务，它定时读取ESP32的内部温度，
- *          然后调用 `updatePerformanceData()` 函数刷新屏幕上的所有动态性能数据。
- */
-void Performance_Task(void *pvParameters);
-
 /**
  * @brief [FreeRTOS Task] 串口数据接收任务。
  * @param pvParameters 任务创建时传入的参数（未使用）。
- * @details 这是一个持续运行的FreeRTOS任务，负责监听并从串口读取数据。
- *          当接收到完整的一行数据（以换行符结尾）时，它会调用 `parsePCData()`
- *          函数进行数据解析，然后重置缓冲区。
+ * @details 这是一个持续运行的FreeRTOS任务，平时阻塞在任务通知上，
+ *          由USB CDC的接收事件唤醒后用 `Serial.readBytes()` 批量读取数据。
+ *          以同步字节开头的数据交给 PCLink 解析二进制帧；
+ *          其余字节按旧的文本协议积累成行，收到换行符或超时后调用 `parsePCData()`。
  */
 void SERIAL_Task(void *pvParameters);
 
@@ -2,6 +2,7 @@
 #include "System.h"
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
+#include "Memory.h"
 
 // --- 内部变量 ---
 static SpaceData g_space_data; // 用于存储从API获取的所有空间相关数据的全局结构体
@@ -84,7 +85,8 @@ static void fetchAstronauts() {
 
     if (httpCode == HTTP_CODE_OK) {
         String payload = http.getString();
-        DynamicJsonDocument doc(1024);
+        ArenaScope scope; // 解析用的临时内存在离开作用域时一次回收
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
 
         if (error) {
@@ -121,7 +123,8 @@ static void fetchISSPosition() {
 
     if (httpCode == HTTP_CODE_OK) {
         String payload = http.getString();
-        DynamicJsonDocument doc(256);
+        ArenaScope scope;
+        JsonDocument doc(ArenaJsonAllocator::instance());
         DeserializationError error = deserializeJson(doc, payload);
 
         if (error) {
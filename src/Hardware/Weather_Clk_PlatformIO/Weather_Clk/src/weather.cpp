@@ -712,6 +712,23 @@ bool fetchWeather()
     return success;
 }
 
+bool syncTimeInBackground(uint32_t timeoutMs)
+{
+    strcpy(lastSyncTimeStr, "Syncing Time...");
+
+    configTime(GMT_OFFSET_SEC, DAYLIGHT_OFFSET, ntpServer);
+    if (getLocalTime(&timeinfo, timeoutMs))
+    {
+        strftime(lastSyncTimeStr, sizeof(lastSyncTimeStr), "Time Success at %H:%M:%S", &timeinfo);
+        synced = true;
+        Serial.printf("Silent time sync performed successfully.");
+        return true;
+    }
+    sprintf(lastSyncTimeStr, "Time FAILED at %02d:%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec); // Fixed format string
+    Serial.printf("Silent time sync FAILED.");
+    return false;
+}
+
 void silentSyncTime()
 {
     if (!ensureWiFiConnected())
@@ -723,19 +740,7 @@ void silentSyncTime()
     tft.setTextColor(TFT_YELLOW, TFT_BLACK);
     tft.setTextDatum(TR_DATUM);
 
-    strcpy(lastSyncTimeStr, "Syncing Time...");
-
-    configTime(GMT_OFFSET_SEC, DAYLIGHT_OFFSET, ntpServer);
-    if (getLocalTime(&timeinfo, 10000))
-    {
-        strftime(lastSyncTimeStr, sizeof(lastSyncTimeStr), "Time Success at %H:%M:%S", &timeinfo);
-        Serial.printf("Silent time sync performed successfully.");
-    }
-    else
-    {
-        sprintf(lastSyncTimeStr, "Time FAILED at %02d:%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec); // Fixed format string
-        Serial.printf("Silent time sync FAILED.");
-    }
+    syncTimeInBackground(10000);
     Serial.println("WiFi disconnected after silent time sync.");
 }
 
@@ -750,6 +755,13 @@ void silentFetchWeather()
     tft.setTextColor(TFT_YELLOW, TFT_BLACK);
     tft.setTextDatum(TR_DATUM);
 
+    fetchWeatherInBackground();
+    Serial.println("WiFi disconnected after silent weather fetch.");
+}
+
+bool fetchWeatherInBackground()
+{
+    bool success = false;
     strcpy(lastWeatherSyncStr, "Syncing...");
 
     WiFiClient client;
@@ -775,6 +787,7 @@ void silentFetchWeather()
                 report_str.toCharArray(reporttime, sizeof(reporttime));
                 sprintf(lastWeatherSyncStr, "Weather Success at %02d:%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
                 Serial.printf("Silent weather fetch performed successfully.");
+                success = true;
             }
             else
             {
@@ -794,7 +807,7 @@ void silentFetchWeather()
         sprintf(lastWeatherSyncStr, "Weather FAILED (Connection) at %02d:%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
         Serial.printf("Silent weather fetch FAILED (connection).");
     }
-    Serial.println("WiFi disconnected after silent weather fetch.");
+    return success;
 }
 
 void TimeUpdate_Task(void *pvParameters)
@@ -70,6 +70,21 @@ void silentSyncTime();
  */
 void silentFetchWeather();
 
+/**
+ * @brief 同步NTP时间，不访问屏幕，可在后台任务中调用。
+ * @details 需要WiFi已连接。成功后置位 `synced`，时间更新任务开始刷新 `timeinfo`。
+ * @param timeoutMs 等待NTP响应的最长时间。
+ * @return 同步成功返回 `true`。
+ */
+bool syncTimeInBackground(uint32_t timeoutMs);
+
+/**
+ * @brief 获取天气数据，不访问屏幕，可在后台任务中调用。
+ * @details 需要WiFi已连接。更新全局的天气数据和天气同步状态字符串。
+ * @return 获取并解析成功返回 `true`。
+ */
+bool fetchWeatherInBackground();
+
 /**
  * @brief 确保WiFi处于连接状态。
  * @details 这是一个非阻塞函数，用于检查和管理WiFi连接。如果未连接，